@@ -1,4 +1,5 @@
 using System.CommandLine;
+using System.CommandLine.Invocation;
 using System.Diagnostics;
 using CIL2CPP.Core;
 using CIL2CPP.Core.IL;
@@ -41,6 +42,23 @@ class Program
             name: "--rd-xml",
             getDefaultValue: () => null,
             description: "Path to rd.xml runtime directives file (D.2: NuGet package type preservation)");
+        var compileNoCacheOption = new Option<bool>(
+            name: "--no-cache",
+            description: "Ignore the incremental compilation cache and rebuild IR + C++ from scratch");
+        var compilePartitionOption = new Option<string>(
+            name: "--partition",
+            getDefaultValue: () => "size",
+            description: "Method partitioning: size (bin-pack types) or callgraph (hot/cold clusters + link order)");
+        var compileProfileOption = new Option<FileInfo?>(
+            name: "--profile",
+            getDefaultValue: () => null,
+            description: "Collapsed-stack CPU profile driving callgraph partitioning (implies --partition callgraph)");
+        var compileTimingsOption = new Option<bool>(
+            name: "--timings",
+            description: "Print a per-phase time and memory report (also written to .cil2cpp/timings.json)");
+        var compileKeepMetadataOption = new Option<bool>(
+            name: "--keep-reflection-metadata",
+            description: "Keep reflection metadata for every user type instead of only reflected-on ones");
 
         var compileCommand = new Command("compile", "Compile C# project to native executable")
         {
@@ -48,13 +66,24 @@ class Program
             outputOption,
             configOption,
             runtimePrefixOption,
-            compileRdXmlOption
+            compileRdXmlOption,
+            compileNoCacheOption,
+            compilePartitionOption,
+            compileProfileOption,
+            compileTimingsOption,
+            compileKeepMetadataOption
         };
 
-        compileCommand.SetHandler((input, output, config, runtimePrefix, rdXml) =>
+        // More options than the typed SetHandler overloads take — bind from the parse result
+        compileCommand.SetHandler((InvocationContext context) =>
         {
-            Compile(input, output, config, runtimePrefix, rdXml?.FullName);
-        }, inputOption, outputOption, configOption, runtimePrefixOption, compileRdXmlOption);
+            var r = context.ParseResult;
+            Compile(r.GetValueForOption(inputOption)!, r.GetValueForOption(outputOption)!,
+                r.GetValueForOption(configOption)!, r.GetValueForOption(runtimePrefixOption),
+                r.GetValueForOption(compileRdXmlOption)?.FullName, r.GetValueForOption(compileNoCacheOption),
+                r.GetValueForOption(compilePartitionOption)!, r.GetValueForOption(compileProfileOption),
+                r.GetValueForOption(compileTimingsOption), r.GetValueForOption(compileKeepMetadataOption));
+        });
 
         rootCommand.AddCommand(compileCommand);
 
@@ -72,16 +101,39 @@ class Program
             name: "--rd-xml",
             getDefaultValue: () => null,
             description: "Path to rd.xml runtime directives file (D.2: NuGet package type preservation)");
+        var codegenNoCacheOption = new Option<bool>(
+            name: "--no-cache",
+            description: "Ignore the incremental compilation cache and rebuild IR + C++ from scratch");
+        var codegenPartitionOption = new Option<string>(
+            name: "--partition",
+            getDefaultValue: () => "size",
+            description: "Method partitioning: size (bin-pack types) or callgraph (hot/cold clusters + link order)");
+        var codegenProfileOption = new Option<FileInfo?>(
+            name: "--profile",
+            getDefaultValue: () => null,
+            description: "Collapsed-stack CPU profile driving callgraph partitioning (implies --partition callgraph)");
+        var codegenTimingsOption = new Option<bool>(
+            name: "--timings",
+            description: "Print a per-phase time and memory report (also written to .cil2cpp/timings.json)");
+        var codegenKeepMetadataOption = new Option<bool>(
+            name: "--keep-reflection-metadata",
+            description: "Keep reflection metadata for every user type instead of only reflected-on ones");
 
         var codegenCommand = new Command("codegen", "Generate C++ code from C# project (without compiling)")
         {
-            codegenInputOption, codegenOutputOption, codegenConfigOption, codegenRdXmlOption
+            codegenInputOption, codegenOutputOption, codegenConfigOption, codegenRdXmlOption, codegenNoCacheOption,
+            codegenPartitionOption, codegenProfileOption, codegenTimingsOption, codegenKeepMetadataOption
         };
 
-        codegenCommand.SetHandler((input, output, config, rdXml) =>
+        codegenCommand.SetHandler((InvocationContext context) =>
         {
-            GenerateCpp(input, output, config, rdXml?.FullName);
-        }, codegenInputOption, codegenOutputOption, codegenConfigOption, codegenRdXmlOption);
+            var r = context.ParseResult;
+            GenerateCpp(r.GetValueForOption(codegenInputOption)!, r.GetValueForOption(codegenOutputOption)!,
+                r.GetValueForOption(codegenConfigOption)!, r.GetValueForOption(codegenRdXmlOption)?.FullName,
+                r.GetValueForOption(codegenNoCacheOption), r.GetValueForOption(codegenPartitionOption)!,
+                r.GetValueForOption(codegenProfileOption), r.GetValueForOption(codegenTimingsOption),
+                r.GetValueForOption(codegenKeepMetadataOption));
+        });
 
         rootCommand.AddCommand(codegenCommand);
 
@@ -176,7 +228,8 @@ class Program
     /// Returns null if setup fails (error already printed).
     /// </summary>
     static (FileInfo AssemblyFile, BuildConfiguration Config)? PrepareBuild(
-        FileInfo input, DirectoryInfo output, string configName)
+        FileInfo input, DirectoryInfo output, string configName,
+        string partition = "size", FileInfo? profile = null, bool keepReflectionMetadata = false)
     {
         FileInfo assemblyFile;
         try
@@ -200,6 +253,30 @@ class Program
             return null;
         }
 
+        // Method layout: a profile always implies the call-graph layout
+        MethodLayout layout;
+        switch (partition.ToLowerInvariant())
+        {
+            case "size": layout = MethodLayout.Size; break;
+            case "callgraph": layout = MethodLayout.CallGraph; break;
+            default:
+                Console.Error.WriteLine($"Error: Unknown partition mode: {partition}. Use 'size' or 'callgraph'.");
+                return null;
+        }
+        if (profile != null)
+        {
+            if (!profile.Exists)
+            {
+                Console.Error.WriteLine($"Error: Profile not found: {profile.FullName}");
+                return null;
+            }
+            layout = MethodLayout.CallGraph;
+        }
+        if (layout != MethodLayout.Size)
+            config = config with { MethodLayout = layout, LayoutProfilePath = profile?.FullName };
+        if (keepReflectionMetadata)
+            config = config with { TrimReflectionMetadata = false };
+
         output.Create();
         return (assemblyFile, config);
     }
@@ -222,30 +299,105 @@ class Program
         Console.WriteLine($"Input:  {assemblyFile.FullName}");
         Console.WriteLine($"Output: {output.FullName}");
         Console.WriteLine($"Config: {config.ConfigurationName}");
+        if (config.MethodLayout != MethodLayout.Size)
+            Console.WriteLine($"Layout: {config.MethodLayout}" +
+                (config.LayoutProfilePath != null ? $" (profile: {config.LayoutProfilePath})" : ""));
         Console.WriteLine();
     }
 
+    /// <summary>
+    /// Check the incremental compilation cache. Returns true if the generated C++ in the
+    /// output directory is up to date and IR + codegen can be skipped.
+    /// </summary>
+    static bool TryReuseCache(CompilationCache cache, FileInfo assemblyFile, bool noCache)
+    {
+        if (noCache)
+        {
+            cache.Invalidate();
+            Console.WriteLine("[cache] Disabled (--no-cache)");
+            return false;
+        }
+
+        var hit = cache.TryHit(assemblyFile.FullName, out var reason);
+        Console.WriteLine(hit
+            ? $"[cache] Hit: generated C++ {reason}, skipping IR + codegen"
+            : $"[cache] Miss: {reason}");
+        return hit;
+    }
+
+    /// <summary>
+    /// Record the fingerprint of this run (root assembly first, then every loaded dependency).
+    /// </summary>
+    static void SaveCache(CompilationCache cache, IRModule module, AssemblySet assemblySet,
+        GeneratedOutput generatedOutput)
+    {
+        var assemblyPaths = new List<string> { assemblySet.RootAssembly.MainModule.FileName };
+        assemblyPaths.AddRange(assemblySet.LoadedAssemblies.Values.Select(a => a.MainModule.FileName));
+        cache.Save(module.Name, assemblyPaths, generatedOutput);
+    }
+
+    /// <summary>
+    /// Print how many types keep member metadata, and why all user types do when they do.
+    /// </summary>
+    static void ReportReflectionVisibility(ReachabilityResult reachability)
+    {
+        Console.WriteLine($"      {reachability.ReflectionTargetTypes.Count} reflection-visible types");
+        if (reachability.UntrackedReflectionSite != null)
+            Console.WriteLine($"      Note: untracked reflection in {reachability.UntrackedReflectionSite} " +
+                "keeps metadata for all user types (use typeof(T) or rd.xml to narrow)");
+    }
+
+    /// <summary>
+    /// Print the --timings report and save it as JSON next to the cache manifest.
+    /// </summary>
+    static void ReportTimings(CompilationTimings timings, DirectoryInfo output)
+    {
+        Console.WriteLine();
+        Console.Write(timings.FormatReport());
+        var jsonPath = Path.Combine(output.FullName, CompilationCache.CacheDirName, "timings.json");
+        Directory.CreateDirectory(Path.GetDirectoryName(jsonPath)!);
+        File.WriteAllText(jsonPath, timings.ToJson());
+        Console.WriteLine($"  Report: {jsonPath}");
+    }
+
     static void GenerateCpp(FileInfo input, DirectoryInfo output, string configName = "Release",
-        string? rdXmlPath = null)
+        string? rdXmlPath = null, bool noCache = false, string partition = "size", FileInfo? profile = null,
+        bool showTimings = false, bool keepReflectionMetadata = false)
     {
-        var prepared = PrepareBuild(input, output, configName);
+        var prepared = PrepareBuild(input, output, configName, partition, profile, keepReflectionMetadata);
         if (prepared is not var (assemblyFile, config)) return;
 
+        var timings = new CompilationTimings();
         try
         {
             PrintBanner(assemblyFile, output, config);
 
+            // F.3: Skip IR + codegen entirely when no input assembly, option or compiler changed
+            var cache = new CompilationCache(output.FullName, config, rdXmlPath);
+            if (TryReuseCache(cache, assemblyFile, noCache))
+            {
+                Console.WriteLine();
+                Console.WriteLine($"Code generation completed! ({config.ConfigurationName}, cached)");
+                return;
+            }
+
             var sw = Stopwatch.StartNew();
 
             Console.WriteLine("[1/4] Loading assembly set...");
+            var loadPhase = timings.Begin("Load assembly set");
             using var assemblySet = new AssemblySet(assemblyFile.FullName, config);
+            loadPhase.Stop();
             Console.WriteLine($"      Root assembly: {assemblySet.RootAssemblyName}");
             Console.WriteLine($"      ({sw.Elapsed.TotalSeconds:F1}s)");
             sw.Restart();
 
             Console.WriteLine("[2/4] Analyzing reachability...");
+            var reachabilityPhase = timings.Begin("Reachability");
             var featureSwitchResolver = new FeatureSwitchResolver();
-            var analyzer = new ReachabilityAnalyzer(assemblySet, featureSwitchResolver);
+            var analyzer = new ReachabilityAnalyzer(assemblySet, featureSwitchResolver)
+            {
+                TrimReflectionMetadata = config.TrimReflectionMetadata
+            };
             // D.2: Apply rd.xml preservation rules before tree-shaking
             if (!string.IsNullOrEmpty(rdXmlPath))
             {
@@ -254,16 +406,20 @@ class Program
                 Console.WriteLine($"      rd.xml: {rules.Count} preservation rules from {rdXmlPath}");
             }
             var reachability = analyzer.Analyze();
+            reachabilityPhase.Stop($"types={reachability.ReachableTypes.Count}, methods={reachability.ReachableMethods.Count}");
             Console.WriteLine($"      {reachability.ReachableTypes.Count} reachable types ({reachability.ConstructedTypes.Count} constructed)");
+            ReportReflectionVisibility(reachability);
             Console.WriteLine($"      {reachability.ReachableMethods.Count} reachable methods");
             Console.WriteLine($"      {assemblySet.LoadedAssemblies.Count} assemblies loaded");
             Console.WriteLine($"      ({sw.Elapsed.TotalSeconds:F1}s)");
             sw.Restart();
 
             Console.WriteLine("[3/4] Building IR...");
+            var irPhase = timings.Begin("Build IR");
             using var reader = new AssemblyReader(assemblyFile.FullName, config);
-            var builder = new IRBuilder(reader, config);
+            var builder = new IRBuilder(reader, config) { Timings = timings };
             var module = builder.Build(assemblySet, reachability);
+            irPhase.Stop();
             Console.WriteLine($"      {module.Types.Count} types, {module.GetAllMethods().Count()} methods");
             if (module.EntryPoint != null)
                 Console.WriteLine($"      Entry point: {module.EntryPoint.DeclaringType?.ILFullName}.{module.EntryPoint.Name}");
@@ -273,14 +429,14 @@ class Program
             sw.Restart();
 
             Console.WriteLine("[4/4] Generating C++ code...");
-            var generator = new CppCodeGenerator(module, config);
-            var generatedOutput = generator.Generate();
-            generatedOutput.WriteToDirectory(output.FullName);
-            PrintGeneratedFiles(generatedOutput);
+            var generatedOutput = GenerateAndWrite(module, config, output, timings);
+            SaveCache(cache, module, assemblySet, generatedOutput);
 
             Console.WriteLine();
             var outputType = module.EntryPoint != null ? "executable" : "static library";
             Console.WriteLine($"Code generation completed! ({config.ConfigurationName}, {outputType})");
+            if (showTimings)
+                ReportTimings(timings, output);
         }
         catch (Exception ex)
         {
@@ -290,96 +446,152 @@ class Program
     }
 
     static void Compile(FileInfo input, DirectoryInfo output, string configName = "Release",
-        string? runtimePrefix = null, string? rdXmlPath = null)
+        string? runtimePrefix = null, string? rdXmlPath = null, bool noCache = false,
+        string partition = "size", FileInfo? profile = null, bool showTimings = false,
+        bool keepReflectionMetadata = false)
     {
-        var prepared = PrepareBuild(input, output, configName);
+        var prepared = PrepareBuild(input, output, configName, partition, profile, keepReflectionMetadata);
         if (prepared is not var (assemblyFile, config)) return;
 
+        var timings = new CompilationTimings();
         try
         {
             PrintBanner(assemblyFile, output, config, "compile");
 
-            Console.WriteLine("[1/6] Loading assembly set...");
-            using var assemblySet = new AssemblySet(assemblyFile.FullName, config);
-            Console.WriteLine($"      Root assembly: {assemblySet.RootAssemblyName}");
-
-            Console.WriteLine("[2/6] Analyzing reachability...");
-            var featureSwitchResolver = new FeatureSwitchResolver();
-            var analyzer = new ReachabilityAnalyzer(assemblySet, featureSwitchResolver);
-            // D.2: Apply rd.xml preservation rules before tree-shaking
-            if (!string.IsNullOrEmpty(rdXmlPath))
-            {
-                var rules = RdXmlParser.Parse(rdXmlPath);
-                analyzer.SetPreservationRules(rules);
-                Console.WriteLine($"      rd.xml: {rules.Count} preservation rules from {rdXmlPath}");
-            }
-            var reachability = analyzer.Analyze();
-            Console.WriteLine($"      {reachability.ReachableTypes.Count} reachable types, {reachability.ReachableMethods.Count} reachable methods");
+            // F.3: On a cache hit the generated C++ is already up to date — go straight to CMake
+            var cache = new CompilationCache(output.FullName, config, rdXmlPath);
+            var projectName = TryReuseCache(cache, assemblyFile, noCache)
+                ? cache.CachedModuleName!
+                : GenerateForCompile(assemblyFile, output, config, rdXmlPath, cache, timings);
+
+            var nativePhase = timings.Begin("Native build (CMake)");
+            BuildNative(output, config, runtimePrefix, projectName);
+            nativePhase.Stop();
+            if (showTimings)
+                ReportTimings(timings, output);
+        }
+        catch (Exception ex)
+        {
+            Console.Error.WriteLine($"Error: {ex.Message}");
+            Console.Error.WriteLine(ex.StackTrace);
+        }
+    }
 
-            Console.WriteLine("[3/6] Building IR...");
-            using var reader = new AssemblyReader(assemblyFile.FullName, config);
-            var builder = new IRBuilder(reader, config);
-            var module = builder.Build(assemblySet, reachability);
-            Console.WriteLine($"      {module.Types.Count} types, {module.GetAllMethods().Count()} methods");
+    /// <summary>
+    /// Steps 1-4 of <c>compile</c>: assembly set → reachability → IR → C++.
+    /// Returns the module name (used to locate the output executable).
+    /// </summary>
+    static string GenerateForCompile(FileInfo assemblyFile, DirectoryInfo output,
+        BuildConfiguration config, string? rdXmlPath, CompilationCache cache, CompilationTimings timings)
+    {
+        Console.WriteLine("[1/6] Loading assembly set...");
+        var loadPhase = timings.Begin("Load assembly set");
+        using var assemblySet = new AssemblySet(assemblyFile.FullName, config);
+        loadPhase.Stop();
+        Console.WriteLine($"      Root assembly: {assemblySet.RootAssemblyName}");
+
+        Console.WriteLine("[2/6] Analyzing reachability...");
+        var reachabilityPhase = timings.Begin("Reachability");
+        var featureSwitchResolver = new FeatureSwitchResolver();
+        var analyzer = new ReachabilityAnalyzer(assemblySet, featureSwitchResolver)
+        {
+            TrimReflectionMetadata = config.TrimReflectionMetadata
+        };
+        // D.2: Apply rd.xml preservation rules before tree-shaking
+        if (!string.IsNullOrEmpty(rdXmlPath))
+        {
+            var rules = RdXmlParser.Parse(rdXmlPath);
+            analyzer.SetPreservationRules(rules);
+            Console.WriteLine($"      rd.xml: {rules.Count} preservation rules from {rdXmlPath}");
+        }
+        var reachability = analyzer.Analyze();
+        reachabilityPhase.Stop($"types={reachability.ReachableTypes.Count}, methods={reachability.ReachableMethods.Count}");
+        Console.WriteLine($"      {reachability.ReachableTypes.Count} reachable types, {reachability.ReachableMethods.Count} reachable methods");
+        ReportReflectionVisibility(reachability);
+
+        Console.WriteLine("[3/6] Building IR...");
+        var irPhase = timings.Begin("Build IR");
+        using var reader = new AssemblyReader(assemblyFile.FullName, config);
+        var builder = new IRBuilder(reader, config) { Timings = timings };
+        var module = builder.Build(assemblySet, reachability);
+        irPhase.Stop();
+        Console.WriteLine($"      {module.Types.Count} types, {module.GetAllMethods().Count()} methods");
+
+        Console.WriteLine("[4/6] Generating C++ code...");
+        var generatedOutput = GenerateAndWrite(module, config, output, timings);
+        SaveCache(cache, module, assemblySet, generatedOutput);
+        return module.Name;
+    }
 
-            Console.WriteLine("[4/6] Generating C++ code...");
-            var generator = new CppCodeGenerator(module, config);
-            var generatedOutput = generator.Generate();
-            generatedOutput.WriteToDirectory(output.FullName);
-            PrintGeneratedFiles(generatedOutput);
+    /// <summary>
+    /// Render C++ and write it out. Method partitions stream straight into the output
+    /// directory while rendering; the remaining files are written afterwards. Both paths
+    /// leave files with unchanged content untouched.
+    /// </summary>
+    static GeneratedOutput GenerateAndWrite(IRModule module, BuildConfiguration config,
+        DirectoryInfo output, CompilationTimings timings)
+    {
+        var generator = new CppCodeGenerator(module, config) { Timings = timings };
+        var generatedOutput = generator.Generate(output.FullName);
+        var writePhase = timings.Begin("Write files");
+        var written = generatedOutput.WriteToDirectory(output.FullName);
+        writePhase.Stop($"{written} of {generatedOutput.AllFiles.Count()} changed");
+        PrintGeneratedFiles(generatedOutput);
+        Console.WriteLine($"      {written} of {generatedOutput.AllFiles.Count()} files changed");
+        return generatedOutput;
+    }
 
-            // Resolve runtime prefix
-            var prefix = ResolveRuntimePrefix(runtimePrefix);
-            if (prefix == null)
-            {
-                Console.Error.WriteLine("Error: Cannot find cil2cpp runtime installation.");
-                Console.Error.WriteLine("       Use --runtime-prefix to specify the install path,");
-                Console.Error.WriteLine("       or set the CIL2CPP_PREFIX environment variable.");
-                return;
-            }
-            Console.WriteLine($"      Runtime prefix: {prefix}");
-
-            Console.WriteLine("[5/6] Configuring CMake...");
-            var buildDir = Path.Combine(output.FullName, "build");
-            if (!RunProcess("cmake",
-                    $"-B \"{buildDir}\" -S \"{output.FullName}\" " +
-                    $"-DCMAKE_PREFIX_PATH=\"{prefix}\"",
-                    output.FullName))
-            {
-                Console.Error.WriteLine("Error: CMake configuration failed.");
-                return;
-            }
+    /// <summary>
+    /// Steps 5-6 of <c>compile</c>: CMake configure + native build.
+    /// </summary>
+    static void BuildNative(DirectoryInfo output, BuildConfiguration config, string? runtimePrefix,
+        string projectName)
+    {
+        // Resolve runtime prefix
+        var prefix = ResolveRuntimePrefix(runtimePrefix);
+        if (prefix == null)
+        {
+            Console.Error.WriteLine("Error: Cannot find cil2cpp runtime installation.");
+            Console.Error.WriteLine("       Use --runtime-prefix to specify the install path,");
+            Console.Error.WriteLine("       or set the CIL2CPP_PREFIX environment variable.");
+            return;
+        }
+        Console.WriteLine($"      Runtime prefix: {prefix}");
+
+        Console.WriteLine("[5/6] Configuring CMake...");
+        var buildDir = Path.Combine(output.FullName, "build");
+        if (!RunProcess("cmake",
+                $"-B \"{buildDir}\" -S \"{output.FullName}\" " +
+                $"-DCMAKE_PREFIX_PATH=\"{prefix}\"",
+                output.FullName))
+        {
+            Console.Error.WriteLine("Error: CMake configuration failed.");
+            return;
+        }
 
-            Console.WriteLine($"[6/6] Building native ({config.ConfigurationName})...");
-            if (!RunProcess("cmake",
-                    $"--build \"{buildDir}\" --config {config.ConfigurationName}",
-                    output.FullName))
-            {
-                Console.Error.WriteLine("Error: Native build failed.");
-                return;
-            }
+        Console.WriteLine($"[6/6] Building native ({config.ConfigurationName})...");
+        if (!RunProcess("cmake",
+                $"--build \"{buildDir}\" --config {config.ConfigurationName}",
+                output.FullName))
+        {
+            Console.Error.WriteLine("Error: Native build failed.");
+            return;
+        }
 
-            // Find the output executable
-            var projectName = module.Name;
-            var exeName = OperatingSystem.IsWindows() ? $"{projectName}.exe" : projectName;
-            var exePath = FindOutputExecutable(buildDir, exeName, config.ConfigurationName);
+        // Find the output executable
+        var exeName = OperatingSystem.IsWindows() ? $"{projectName}.exe" : projectName;
+        var exePath = FindOutputExecutable(buildDir, exeName, config.ConfigurationName);
 
-            Console.WriteLine();
-            if (exePath != null)
-            {
-                Console.WriteLine($"Compilation succeeded! ({config.ConfigurationName})");
-                Console.WriteLine($"Output: {exePath}");
-            }
-            else
-            {
-                Console.WriteLine($"Build completed but could not locate output executable.");
-                Console.WriteLine($"Check: {buildDir}");
-            }
+        Console.WriteLine();
+        if (exePath != null)
+        {
+            Console.WriteLine($"Compilation succeeded! ({config.ConfigurationName})");
+            Console.WriteLine($"Output: {exePath}");
         }
-        catch (Exception ex)
+        else
         {
-            Console.Error.WriteLine($"Error: {ex.Message}");
-            Console.Error.WriteLine(ex.StackTrace);
+            Console.WriteLine($"Build completed but could not locate output executable.");
+            Console.WriteLine($"Check: {buildDir}");
         }
     }
 
@@ -28,6 +28,25 @@ public record BuildConfiguration
     public Dictionary<string, bool> FeatureSwitches { get; init; } = _emptyFeatureSwitches;
     private static readonly Dictionary<string, bool> _emptyFeatureSwitches = new();
 
+    /// <summary>
+    /// How method bodies are distributed across the generated *_methods_N.cpp files.
+    /// See <see cref="MethodLayout"/>.
+    /// </summary>
+    public MethodLayout MethodLayout { get; init; } = MethodLayout.Size;
+
+    /// <summary>
+    /// Optional CPU profile (collapsed stacks: "caller;callee;leaf count" per line, frames are
+    /// C++ function names) that drives <see cref="MethodLayout.CallGraph"/> instead of static
+    /// call-site counts. Implies CallGraph layout.
+    /// </summary>
+    public string? LayoutProfilePath { get; init; }
+
+    /// <summary>
+    /// Strip member metadata from types that are never reflected on (executables only).
+    /// Off keeps metadata for every user type — used to measure what trimming saves.
+    /// </summary>
+    public bool TrimReflectionMetadata { get; init; } = true;
+
     /// <summary>Configuration name for CMake (Debug or Release).</summary>
     public string ConfigurationName => IsDebug ? "Debug" : "Release";
 
@@ -71,3 +90,18 @@ public record BuildConfiguration
         _ => throw new ArgumentException($"Unknown configuration: {name}. Use 'Debug' or 'Release'.")
     };
 }
+
+/// <summary>
+/// Method-to-translation-unit layout strategy.
+/// </summary>
+public enum MethodLayout
+{
+    /// <summary>Greedy bin-packing of whole types by instruction count (default).</summary>
+    Size,
+
+    /// <summary>
+    /// Cluster methods that call each other into the same partition (hot code first), move
+    /// cctors and throw helpers into cold partitions, and emit a linker symbol-ordering file.
+    /// </summary>
+    CallGraph,
+}
@@ -0,0 +1,280 @@
+using CIL2CPP.Core.IR;
+
+namespace CIL2CPP.Core.CodeGen;
+
+/// <summary>
+/// Call-graph driven method layout (<see cref="MethodLayout.CallGraph"/>).
+///
+/// Size-based partitioning bin-packs whole types, so a hot call chain ends up spread across
+/// many object files and cold code (cctors, throw helpers) sits between hot functions.
+/// This layout instead:
+///   1. Splits methods into hot and cold. Cold = static constructors, throw helpers
+///      (methods that never return normally), and — with a profile — methods with no samples.
+///   2. Clusters hot methods along the heaviest call edges (Pettis-Hansen / C3 style greedy
+///      merge: callee cluster appended after caller cluster), capped at one partition's size.
+///      Edge weights come from the profile when given, otherwise from static call-site counts.
+///   3. Packs clusters into partitions in order (entry point / densest cluster first), then
+///      packs cold methods into trailing cold partitions.
+/// The resulting hot order is also the link order written to the symbol-ordering file.
+/// Fully deterministic: ties break on the original method order.
+/// </summary>
+public static class CallGraphLayout
+{
+    public sealed class Result
+    {
+        /// <summary>Method partitions: hot partitions first, then cold partitions.</summary>
+        public List<List<IRMethod>> Partitions { get; } = new();
+
+        /// <summary>Number of leading hot partitions in <see cref="Partitions"/>.</summary>
+        public int HotPartitionCount { get; set; }
+
+        /// <summary>Methods placed in cold partitions (reference equality).</summary>
+        public HashSet<IRMethod> ColdMethods { get; } = new(ReferenceEqualityComparer.Instance);
+
+        /// <summary>Hot methods in layout order — the desired link order.</summary>
+        public List<IRMethod> HotOrder { get; } = new();
+
+        /// <summary>Number of methods that matched a profile entry (0 without a profile).</summary>
+        public int ProfileMatches { get; set; }
+    }
+
+    public static Result Build(IReadOnlyList<IRMethod> methods, int partitionSize,
+        CallProfile? profile = null, IRMethod? entryPoint = null)
+    {
+        var result = new Result();
+        int n = methods.Count;
+        if (n == 0)
+        {
+            result.Partitions.Add(new List<IRMethod>());
+            result.HotPartitionCount = 1;
+            return result;
+        }
+
+        var indexByName = new Dictionary<string, int>(StringComparer.Ordinal);
+        var sizes = new int[n];
+        for (int i = 0; i < n; i++)
+        {
+            indexByName.TryAdd(methods[i].CppName, i);
+            sizes[i] = Math.Max(1, EstimateSize(methods[i]));
+        }
+
+        // A profile that matches nothing (stale build, wrong binary) must not turn everything cold.
+        if (profile != null)
+        {
+            result.ProfileMatches = methods.Count(m => profile.SelfWeight(m.CppName) > 0
+                || profile.TotalWeight(m.CppName) > 0);
+            if (result.ProfileMatches == 0) profile = null;
+        }
+
+        var cold = new bool[n];
+        for (int i = 0; i < n; i++)
+        {
+            cold[i] = IsColdMethod(methods[i])
+                || (profile != null && profile.TotalWeight(methods[i].CppName) == 0
+                    && methods[i] != entryPoint);
+        }
+
+        // ── Edge weights (caller → callee), hot endpoints only ──
+        var edges = new Dictionary<(int From, int To), long>();
+        for (int i = 0; i < n; i++)
+        {
+            if (cold[i]) continue;
+            foreach (var callee in EnumerateCallees(methods[i]))
+            {
+                if (!indexByName.TryGetValue(callee, out var j) || j == i || cold[j]) continue;
+                edges[(i, j)] = edges.GetValueOrDefault((i, j)) + 1;
+            }
+        }
+        if (profile != null)
+        {
+            // Sampled edges dominate; static call sites only break ties between them.
+            const long ProfileScale = 1L << 20;
+            foreach (var ((caller, callee), weight) in profile.Edges)
+            {
+                if (!indexByName.TryGetValue(caller, out var i) || !indexByName.TryGetValue(callee, out var j)) continue;
+                if (i == j || cold[i] || cold[j]) continue;
+                edges[(i, j)] = edges.GetValueOrDefault((i, j)) + weight * ProfileScale;
+            }
+        }
+
+        // ── Greedy cluster merge along heaviest edges ──
+        var clusterOf = new int[n];
+        var clusters = new List<int>?[n];
+        var clusterSize = new int[n];
+        for (int i = 0; i < n; i++)
+        {
+            clusterOf[i] = i;
+            clusters[i] = new List<int> { i };
+            clusterSize[i] = sizes[i];
+        }
+
+        foreach (var ((from, to), _) in edges
+            .OrderByDescending(e => e.Value)
+            .ThenBy(e => e.Key.From)
+            .ThenBy(e => e.Key.To))
+        {
+            int a = clusterOf[from], b = clusterOf[to];
+            if (a == b || clusterSize[a] + clusterSize[b] > partitionSize) continue;
+            // Callee cluster follows caller cluster
+            foreach (var m in clusters[b]!)
+                clusterOf[m] = a;
+            clusters[a]!.AddRange(clusters[b]!);
+            clusterSize[a] += clusterSize[b];
+            clusters[b] = null;
+        }
+
+        // ── Order hot clusters ──
+        int entryIndex = entryPoint != null ? IndexOf(methods, entryPoint) : -1;
+        var hotClusters = Enumerable.Range(0, n)
+            .Where(c => clusters[c] != null && !cold[clusters[c]![0]])
+            .Select(c => (Id: c, Members: clusters[c]!, First: clusters[c]!.Min(),
+                Density: profile == null ? 0.0
+                    : clusters[c]!.Sum(m => (double)profile.SelfWeight(methods[m].CppName)) / clusterSize[c]))
+            .OrderByDescending(c => entryIndex >= 0 && clusterOf[entryIndex] == c.Id)
+            .ThenByDescending(c => c.Density)
+            .ThenBy(c => c.First)
+            .ToList();
+
+        // ── Pack into partitions ──
+        var current = new List<IRMethod>();
+        int currentSize = 0;
+        foreach (var cluster in hotClusters)
+        {
+            foreach (var m in cluster.Members)
+            {
+                current.Add(methods[m]);
+                result.HotOrder.Add(methods[m]);
+            }
+            currentSize += clusterSize[cluster.Id];
+            if (currentSize >= partitionSize)
+            {
+                result.Partitions.Add(current);
+                current = new List<IRMethod>();
+                currentSize = 0;
+            }
+        }
+        if (current.Count > 0 || result.Partitions.Count == 0)
+            result.Partitions.Add(current);
+        result.HotPartitionCount = result.Partitions.Count;
+
+        current = new List<IRMethod>();
+        currentSize = 0;
+        for (int i = 0; i < n; i++)
+        {
+            if (!cold[i]) continue;
+            current.Add(methods[i]);
+            result.ColdMethods.Add(methods[i]);
+            currentSize += sizes[i];
+            if (currentSize >= partitionSize)
+            {
+                result.Partitions.Add(current);
+                current = new List<IRMethod>();
+                currentSize = 0;
+            }
+        }
+        if (current.Count > 0)
+            result.Partitions.Add(current);
+
+        return result;
+    }
+
+    /// <summary>
+    /// Cold by construction: static constructors run once, and throw helpers
+    /// (bodies that throw but never return) only run on the failure path.
+    /// </summary>
+    internal static bool IsColdMethod(IRMethod method)
+    {
+        if (method.IsStaticConstructor) return true;
+        if (method.BasicBlocks.Count == 0) return false;
+
+        bool throws = false;
+        foreach (var block in method.BasicBlocks)
+        foreach (var instr in block.Instructions)
+        {
+            if (instr is IRReturn) return false;
+            if (instr is IRThrow or IRRethrow) throws = true;
+        }
+        return throws;
+    }
+
+    /// <summary>Direct (non-virtual) callees of a method, by C++ function name.</summary>
+    internal static IEnumerable<string> EnumerateCallees(IRMethod method)
+    {
+        var body = method.BasicBlocks.Count > 0 ? method : method.CanonicalMethod;
+        if (body == null) yield break;
+        if (body != method)
+        {
+            // Canonical wrapper: a single forwarding call
+            yield return body.CppName;
+            yield break;
+        }
+        foreach (var block in body.BasicBlocks)
+        foreach (var instr in block.Instructions)
+        {
+            if (instr is IRCall call && !call.IsVirtual && !string.IsNullOrEmpty(call.FunctionName))
+                yield return call.FunctionName;
+            else if (instr is IRNewObj newObj && !string.IsNullOrEmpty(newObj.CtorName))
+                yield return newObj.CtorName;
+        }
+    }
+
+    private static int EstimateSize(IRMethod method)
+    {
+        if (method.BasicBlocks.Count > 0)
+            return method.BasicBlocks.Sum(b => b.Instructions.Count);
+        // Canonical wrapper: thin inline function (~3 instructions worth)
+        return 3;
+    }
+
+    private static int IndexOf(IReadOnlyList<IRMethod> methods, IRMethod target)
+    {
+        for (int i = 0; i < methods.Count; i++)
+            if (ReferenceEquals(methods[i], target)) return i;
+        return -1;
+    }
+}
+
+/// <summary>
+/// Sampled call profile in collapsed-stack format (one stack per line, root first,
+/// frames separated by ';', trailing sample count): "main;Foo_Run;Foo_Step 42".
+/// Frames are C++ function names as emitted by the code generator.
+/// </summary>
+public sealed class CallProfile
+{
+    private readonly Dictionary<string, long> _self = new(StringComparer.Ordinal);
+    private readonly Dictionary<string, long> _total = new(StringComparer.Ordinal);
+
+    /// <summary>Caller → callee sample counts from adjacent stack frames.</summary>
+    public Dictionary<(string Caller, string Callee), long> Edges { get; } = new();
+
+    public long SelfWeight(string function) => _self.GetValueOrDefault(function);
+
+    /// <summary>Samples in which the function appears anywhere on the stack.</summary>
+    public long TotalWeight(string function) => _total.GetValueOrDefault(function);
+
+    public static CallProfile Load(string path) => Parse(File.ReadLines(path));
+
+    public static CallProfile Parse(IEnumerable<string> lines)
+    {
+        var profile = new CallProfile();
+        foreach (var raw in lines)
+        {
+            var line = raw.Trim();
+            if (line.Length == 0 || line[0] == '#') continue;
+            int space = line.LastIndexOf(' ');
+            if (space <= 0 || !long.TryParse(line.AsSpan(space + 1), out var count) || count <= 0) continue;
+
+            var frames = line[..space].Split(';', StringSplitOptions.RemoveEmptyEntries);
+            if (frames.Length == 0) continue;
+            profile._self[frames[^1]] = profile._self.GetValueOrDefault(frames[^1]) + count;
+            foreach (var frame in frames.Distinct(StringComparer.Ordinal))
+                profile._total[frame] = profile._total.GetValueOrDefault(frame) + count;
+            for (int i = 0; i + 1 < frames.Length; i++)
+            {
+                var key = (frames[i], frames[i + 1]);
+                profile.Edges[key] = profile.Edges.GetValueOrDefault(key) + count;
+            }
+        }
+        return profile;
+    }
+}
@@ -0,0 +1,252 @@
+using System.Reflection.Metadata;
+using System.Reflection.PortableExecutable;
+using System.Security.Cryptography;
+using System.Text;
+using System.Text.Json;
+using CIL2CPP.Core.IL;
+
+namespace CIL2CPP.Core.CodeGen;
+
+/// <summary>
+/// Whole-program output cache for incremental compilation (Phase F.3).
+///
+/// The cache key is a SHA-256 over the compiler identity (version + Core assembly MVID),
+/// the build options (configuration, feature switches, method layout + profile, rd.xml
+/// contents), the resolved .NET runtime directory (its name is the shared framework version)
+/// and the name + MVID of every assembly that the previous run loaded (root + NuGet + BCL).
+/// MVIDs change whenever an assembly's IL changes, so reading them from PE metadata is enough
+/// to decide whether IR + codegen would produce the same output — no Cecil load, no
+/// reachability analysis. Each recorded name is resolved again through the current search
+/// paths (<see cref="AssemblySet.DiscoverSearchPaths"/>): a newly installed runtime, or a
+/// same-named assembly that now shadows the recorded one, is a miss even though every
+/// recorded file is still in place.
+///
+/// Scope: the IR is whole-program (generic monomorphization and tree-shaking cross assembly
+/// boundaries), so a hit reuses the complete IR + codegen result. Per-assembly IR reuse
+/// (rebuilding only the user assembly on top of cached BCL IR) is follow-up F.3b in
+/// docs/roadmap.md; until then any changed input means a full IR build, after which only
+/// changed files are rewritten.
+/// On a miss, <see cref="GeneratedOutput.WriteToDirectory"/> only rewrites files whose
+/// content changed, so CMake/ninja rebuild only the affected partitions.
+///
+/// Layout: &lt;output&gt;/.cil2cpp/cache.json (manifest: key, assemblies, per-file hashes).
+/// </summary>
+public class CompilationCache
+{
+    public const string CacheDirName = ".cil2cpp";
+    public const string ManifestFileName = "cache.json";
+
+    /// <summary>Bump when the manifest layout changes.</summary>
+    private const int FormatVersion = 2;
+
+    private readonly string _outputDir;
+    private readonly string _optionsHash;
+
+    public record AssemblyEntry(string Name, string Path, string Mvid);
+
+    public record Manifest(
+        int Format,
+        string Key,
+        string Compiler,
+        string Options,
+        string ModuleName,
+        string Runtime,
+        List<AssemblyEntry> Assemblies,
+        Dictionary<string, string> Files);
+
+    public CompilationCache(string outputDir, BuildConfiguration config, string? rdXmlPath = null)
+    {
+        _outputDir = outputDir;
+        _optionsHash = ComputeOptionsHash(config, rdXmlPath);
+    }
+
+    /// <summary>Path of the manifest file inside the output directory.</summary>
+    public string ManifestPath => Path.Combine(_outputDir, CacheDirName, ManifestFileName);
+
+    /// <summary>
+    /// Compiler identity: assembly version + MVID of CIL2CPP.Core.
+    /// The MVID changes on every compiler rebuild, so a locally modified compiler
+    /// never reuses output produced by a different build of itself.
+    /// </summary>
+    public static string CompilerIdentity { get; } = ComputeCompilerIdentity();
+
+    /// <summary>Module name recorded by the last successful run (set by <see cref="TryHit"/>).</summary>
+    public string? CachedModuleName { get; private set; }
+
+    /// <summary>
+    /// Check whether the generated output in the output directory is up to date for
+    /// the given root assembly. Returns false with a human-readable reason on a miss.
+    /// </summary>
+    public bool TryHit(string rootAssemblyPath, out string reason)
+    {
+        CachedModuleName = null;
+        var manifest = LoadManifest();
+        if (manifest == null) { reason = "no cache manifest"; return false; }
+        if (manifest.Format != FormatVersion) { reason = "cache format changed"; return false; }
+        if (manifest.Compiler != CompilerIdentity) { reason = "compiler changed"; return false; }
+        if (manifest.Options != _optionsHash) { reason = "options changed"; return false; }
+
+        var root = Path.GetFullPath(rootAssemblyPath);
+        if (manifest.Assemblies.Count == 0
+            || !string.Equals(manifest.Assemblies[0].Path, root, StringComparison.OrdinalIgnoreCase))
+        {
+            reason = "root assembly changed";
+            return false;
+        }
+
+        var searchPaths = AssemblySet.DiscoverSearchPaths(root);
+        var runtime = searchPaths.RuntimeDirectory ?? "";
+        if (!string.Equals(manifest.Runtime, runtime, StringComparison.OrdinalIgnoreCase))
+        {
+            reason = $"runtime changed: {RuntimeVersion(manifest.Runtime)} -> {RuntimeVersion(runtime)}";
+            return false;
+        }
+
+        var current = new List<AssemblyEntry>(manifest.Assemblies.Count);
+        foreach (var asm in manifest.Assemblies)
+        {
+            var resolved = searchPaths.Locate(asm.Name);
+            if (resolved == null) { reason = $"assembly missing: {asm.Name}"; return false; }
+            if (!string.Equals(resolved, asm.Path, StringComparison.OrdinalIgnoreCase))
+            {
+                reason = $"assembly resolves elsewhere: {asm.Name} ({resolved})";
+                return false;
+            }
+            var mvid = TryReadMvid(resolved);
+            if (mvid == null) { reason = $"assembly missing: {asm.Name}"; return false; }
+            if (mvid != asm.Mvid) { reason = $"assembly changed: {asm.Name}"; return false; }
+            current.Add(asm with { Mvid = mvid });
+        }
+
+        if (ComputeKey(_optionsHash, runtime, current) != manifest.Key) { reason = "key mismatch"; return false; }
+
+        foreach (var (fileName, hash) in manifest.Files)
+        {
+            var path = Path.Combine(_outputDir, fileName);
+            if (!File.Exists(path)) { reason = $"generated file missing: {fileName}"; return false; }
+            if (HashBytes(File.ReadAllBytes(path)) != hash) { reason = $"generated file modified: {fileName}"; return false; }
+        }
+
+        CachedModuleName = manifest.ModuleName;
+        reason = $"up to date (key {manifest.Key[..12]})";
+        return true;
+    }
+
+    /// <summary>
+    /// Record a successful compilation. <paramref name="assemblyPaths"/> must list the root
+    /// assembly first, followed by every other assembly loaded during the run.
+    /// </summary>
+    public void Save(string moduleName, IEnumerable<string> assemblyPaths, GeneratedOutput output)
+    {
+        var assemblies = new List<AssemblyEntry>();
+        string? runtime = null;
+        var seen = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+        foreach (var p in assemblyPaths)
+        {
+            if (string.IsNullOrEmpty(p)) continue;
+            var full = Path.GetFullPath(p);
+            if (!seen.Add(full)) continue;
+            runtime ??= AssemblySet.DiscoverSearchPaths(full).RuntimeDirectory ?? "";
+            var mvid = TryReadMvid(full);
+            // An assembly we can't fingerprint can't be validated next time — don't cache.
+            if (mvid == null) { Invalidate(); return; }
+            assemblies.Add(new AssemblyEntry(Path.GetFileNameWithoutExtension(full), full, mvid));
+        }
+
+        var files = new Dictionary<string, string>(StringComparer.OrdinalIgnoreCase);
+        foreach (var file in output.AllFiles)
+            files[file.FileName] = file.StreamedHash ?? HashString(file.Content);
+
+        runtime ??= "";
+        var manifest = new Manifest(FormatVersion, ComputeKey(_optionsHash, runtime, assemblies),
+            CompilerIdentity, _optionsHash, moduleName, runtime, assemblies, files);
+
+        Directory.CreateDirectory(Path.GetDirectoryName(ManifestPath)!);
+        File.WriteAllText(ManifestPath, JsonSerializer.Serialize(manifest,
+            new JsonSerializerOptions { WriteIndented = true }));
+    }
+
+    /// <summary>Delete the manifest so the next run performs a full compilation.</summary>
+    public void Invalidate()
+    {
+        if (File.Exists(ManifestPath))
+            File.Delete(ManifestPath);
+    }
+
+    private Manifest? LoadManifest()
+    {
+        if (!File.Exists(ManifestPath)) return null;
+        try
+        {
+            return JsonSerializer.Deserialize<Manifest>(File.ReadAllText(ManifestPath));
+        }
+        catch (JsonException)
+        {
+            return null;
+        }
+    }
+
+    /// <summary>
+    /// Read the module MVID straight from PE metadata (no Cecil load).
+    /// Returns null if the file is missing or not a managed assembly.
+    /// </summary>
+    internal static string? TryReadMvid(string path)
+    {
+        if (!File.Exists(path)) return null;
+        try
+        {
+            using var stream = File.OpenRead(path);
+            using var pe = new PEReader(stream);
+            if (!pe.HasMetadata) return null;
+            var md = pe.GetMetadataReader();
+            return md.GetGuid(md.GetModuleDefinition().Mvid).ToString("N");
+        }
+        catch (BadImageFormatException)
+        {
+            return null;
+        }
+    }
+
+    internal static string ComputeKey(string optionsHash, string runtime, IEnumerable<AssemblyEntry> assemblies)
+    {
+        var sb = new StringBuilder();
+        sb.Append(CompilerIdentity).Append('\n').Append(optionsHash).Append('\n');
+        sb.Append("runtime=").Append(runtime).Append('\n');
+        // Order-independent: the set of loaded assemblies, not the order they were resolved in
+        foreach (var asm in assemblies.OrderBy(a => a.Name, StringComparer.Ordinal))
+            sb.Append(asm.Name).Append('=').Append(asm.Mvid).Append('\n');
+        return HashString(sb.ToString());
+    }
+
+    /// <summary>Shared framework version for messages: the runtime directory's name.</summary>
+    private static string RuntimeVersion(string runtimeDir) =>
+        string.IsNullOrEmpty(runtimeDir) ? "none" : Path.GetFileName(runtimeDir.TrimEnd('/', '\\'));
+
+    internal static string ComputeOptionsHash(BuildConfiguration config, string? rdXmlPath)
+    {
+        var sb = new StringBuilder();
+        sb.Append($"config={config.ConfigurationName};");
+        sb.Append($"line={config.EmitLineDirectives};il={config.EmitILOffsetComments};");
+        sb.Append($"st={config.EnableStackTraces};pdb={config.ReadDebugSymbols};");
+        foreach (var (key, value) in config.FeatureSwitches.OrderBy(kv => kv.Key, StringComparer.Ordinal))
+            sb.Append($"fs:{key}={value};");
+        sb.Append($"layout={config.MethodLayout};reflmeta={config.TrimReflectionMetadata};");
+        if (config.LayoutProfilePath != null)
+            sb.Append("profile=").Append(File.Exists(config.LayoutProfilePath)
+                ? HashBytes(File.ReadAllBytes(config.LayoutProfilePath)) : "missing").Append(';');
+        if (!string.IsNullOrEmpty(rdXmlPath))
+            sb.Append("rdxml=").Append(File.Exists(rdXmlPath) ? HashBytes(File.ReadAllBytes(rdXmlPath)) : "missing");
+        return HashString(sb.ToString());
+    }
+
+    private static string ComputeCompilerIdentity()
+    {
+        var asm = typeof(CompilationCache).Assembly;
+        var version = asm.GetName().Version?.ToString() ?? "0.0.0.0";
+        return $"{version}+{asm.ManifestModule.ModuleVersionId:N}";
+    }
+
+    internal static string HashString(string content) => HashBytes(Encoding.UTF8.GetBytes(content));
+
+    internal static string HashBytes(byte[] bytes) => Convert.ToHexString(SHA256.HashData(bytes)).ToLowerInvariant();
+}
@@ -567,6 +567,8 @@ public partial class CppCodeGenerator
         sb.AppendLine("void __init_resource_strings();");
         // Delegate trampoline registration (compiler-generated for CreateObjectArrayDelegate)
         sb.AppendLine("void __init_delegate_trampolines();");
+        // Sampling profiler method table (empty unless built with CIL2CPP_PROFILER)
+        sb.AppendLine("void __init_method_symbols();");
         sb.AppendLine();
 
         // Extern declarations for array initializer data (defined in data file)
@@ -604,6 +606,20 @@ public partial class CppCodeGenerator
             sb.AppendLine();
         }
 
+        // Compile-time validation: SemaphoreSlim/ManualResetEventSlim ICalls access fields by layout
+        foreach (var (ilName, layout) in SyncSlimLayouts)
+        {
+            var slimType = userTypes.FirstOrDefault(t => t.ILFullName == ilName);
+            if (slimType == null) continue;
+            sb.AppendLine($"// Safety: {ilName} fields must match {layout}");
+            foreach (var field in slimType.Fields)
+            {
+                sb.AppendLine($"static_assert(offsetof({slimType.CppName}, {field.CppName}) == offsetof({layout}, {field.CppName}),");
+                sb.AppendLine($"    \"{ilName}.{field.Name} offset mismatch between runtime and codegen\");");
+            }
+            sb.AppendLine();
+        }
+
         // Compile-time validation: opaque Span/ReadOnlySpan stubs match expected layout
         foreach (var spanStub in opaqueSpanStubs)
         {
@@ -625,7 +641,7 @@ public partial class CppCodeGenerator
         if (opaqueSafeHandleMarshallerStubs.Count > 0) sb.AppendLine();
 
         var stubsMs = headerSw.ElapsedMilliseconds - fwdDeclMs - typeInfoDeclMs - typeDefMs - methodDeclMs;
-        Console.Error.WriteLine($"[perf] Header sections: fwdDecl={fwdDeclMs}ms typeInfoDecl={typeInfoDeclMs}ms " +
+        Timings.Note("Header sections", $"fwdDecl={fwdDeclMs}ms typeInfoDecl={typeInfoDeclMs}ms " +
             $"typeDef={typeDefMs}ms methodDecl={methodDeclMs}ms stubs={stubsMs}ms total={headerSw.ElapsedMilliseconds}ms");
 
         return new GeneratedFile
@@ -1055,6 +1071,16 @@ public partial class CppCodeGenerator
         },
     };
 
+    /// <summary>
+    /// BCL types whose generated structs the runtime reads through a layout struct
+    /// (runtime/include/cil2cpp/sync_slim.h). Key: IL full name; value: C++ layout type.
+    /// </summary>
+    private static readonly (string ILFullName, string Layout)[] SyncSlimLayouts =
+    {
+        ("System.Threading.SemaphoreSlim", "cil2cpp::SemaphoreSlimLayout"),
+        ("System.Threading.ManualResetEventSlim", "cil2cpp::ManualResetEventSlimLayout"),
+    };
+
     /// <summary>
 
     // REMOVED: HasUnknownParameterTypes, HasUnknownBodyReferences,
@@ -402,8 +402,11 @@ public partial class CppCodeGenerator
         // Each Func<>/Action<> delegate type gets a trampoline registered at init time.
         EmitObjectArrayDelegateTrampolines(sb);
 
+        // Address → method table for the runtime's sampling profiler (CIL2CPP_PROFILE).
+        EmitMethodSymbolTable(sb);
+
         var restMs = dataSw.ElapsedMilliseconds - sectionMs - typeInfoMs;
-        Console.Error.WriteLine($"[perf] DataFile sections: unbox={unboxMs}ms vtable={vtableMs}ms iface={ifaceMs}ms " +
+        Timings.Note("DataFile sections", $"unbox={unboxMs}ms vtable={vtableMs}ms iface={ifaceMs}ms " +
             $"finalizer={finalizerMs}ms reflection={reflectionMs}ms variance={varianceMs}ms " +
             $"typeinfo={typeInfoMs}ms rest={restMs}ms total={dataSw.ElapsedMilliseconds}ms");
 
@@ -414,53 +417,106 @@ public partial class CppCodeGenerator
         };
     }
 
+    /// <summary>
+    /// Rendered method text is flushed to the partition's file writer whenever the buffer
+    /// exceeds this many chars (streaming mode only), bounding memory per worker.
+    /// </summary>
+    private const int StreamFlushChars = 256 * 1024;
+
     /// <summary>
     /// Generate method implementation files, partitioned for parallel compilation.
     /// Two-phase approach:
     ///   Phase 1 (sequential): Filter methods per partition — handles signature dedup,
     ///           undeclared-call checks, and diagnostic counters (shared mutable state).
+    ///           With <see cref="MethodLayout.CallGraph"/>, methods are then regrouped by
+    ///           <see cref="CallGraphLayout"/> (hot clusters first, cold partitions last).
     ///   Phase 2 (parallel): Generate C++ code per partition — pure string construction,
     ///           no shared mutable state (deadCodeReplacements collected per-partition and merged).
+    ///           When streaming (<see cref="_streamDirectory"/>), each worker also writes its
+    ///           partition to disk as it renders, skipping files whose content hash is unchanged.
     /// </summary>
     private List<GeneratedFile> GenerateMethodFiles()
     {
-        var methodsSw = System.Diagnostics.Stopwatch.StartNew();
-        var partitions = PartitionTypes(_userTypes);
-
         // Phase 1: Sequential filtering — collect methods to emit per partition.
-        var partitionMethods = new List<IRMethod>[partitions.Count];
-        for (int i = 0; i < partitions.Count; i++)
+        var phase1Sw = Timings.Begin("MethodFiles filter");
+        List<IRMethod>[] partitionMethods;
+        CallGraphLayout.Result? layout = null;
+        if (_config.MethodLayout == MethodLayout.CallGraph)
         {
-            partitionMethods[i] = new List<IRMethod>();
-            foreach (var type in partitions[i])
-                FilterMethodsForType(type, partitionMethods[i]);
+            var allMethods = new List<IRMethod>();
+            foreach (var type in _userTypes)
+                FilterMethodsForType(type, allMethods);
+            var profile = _config.LayoutProfilePath != null ? CallProfile.Load(_config.LayoutProfilePath) : null;
+            layout = CallGraphLayout.Build(allMethods, MinInstructionsPerPartition, profile, _module.EntryPoint);
+            partitionMethods = layout.Partitions.ToArray();
+            _hotMethodOrder = layout.HotOrder;
+            if (profile != null && layout.ProfileMatches == 0)
+                Console.Error.WriteLine($"[CIL2CPP] Warning: profile {_config.LayoutProfilePath} matched no methods — using static call graph");
+        }
+        else
+        {
+            var partitions = PartitionTypes(_userTypes);
+            partitionMethods = new List<IRMethod>[partitions.Count];
+            for (int i = 0; i < partitions.Count; i++)
+            {
+                partitionMethods[i] = new List<IRMethod>();
+                foreach (var type in partitions[i])
+                    FilterMethodsForType(type, partitionMethods[i]);
+            }
         }
-        var phase1Ms = methodsSw.ElapsedMilliseconds;
+        phase1Sw.Stop(layout != null
+            ? $"layout=callgraph hot={layout.HotPartitionCount} cold_methods={layout.ColdMethods.Count}"
+            : "layout=size");
 
         // Phase 2: Parallel code generation — each partition builds its own StringBuilder.
-        var results = new (string FileName, string Content, List<(string, string, string)> DeadCode)[partitions.Count];
-        Parallel.For(0, partitions.Count, i =>
+        var phase2Sw = Timings.Begin("MethodFiles render");
+        int partitionCount = partitionMethods.Length;
+        var results = new (GeneratedFile File, List<(string, string, string)> DeadCode)[partitionCount];
+        Parallel.For(0, partitionCount, i =>
         {
             var localDeadCode = new List<(string Category, string FunctionName, string InMethod)>();
+            var file = new GeneratedFile { FileName = $"{_module.Name}_methods_{i}.cpp" };
+            using var writer = _streamDirectory != null
+                ? new GeneratedFileWriter(Path.Combine(_streamDirectory, file.FileName))
+                : null;
+
             var sb = new StringBuilder();
-            EmitSourceFileHeader(sb, $"Methods (part {i + 1} of {partitions.Count})");
+            bool coldPartition = layout != null && i >= layout.HotPartitionCount;
+            EmitSourceFileHeader(sb, coldPartition
+                ? $"Methods (part {i + 1} of {partitionCount}, cold: cctors + throw helpers)"
+                : $"Methods (part {i + 1} of {partitionCount})");
 
             sb.AppendLine("// ===== Method Implementations =====");
             foreach (var method in partitionMethods[i])
-                GenerateMethodImpl(sb, method, localDeadCode);
+            {
+                GenerateMethodImpl(sb, method, localDeadCode, isCold: coldPartition);
+                if (writer != null && sb.Length >= StreamFlushChars)
+                {
+                    writer.Write(sb);
+                    sb.Clear();
+                }
+            }
 
-            results[i] = ($"{_module.Name}_methods_{i}.cpp", sb.ToString(), localDeadCode);
+            if (writer != null)
+            {
+                writer.Write(sb);
+                file.StreamedChanged = writer.Commit();
+                file.StreamedHash = writer.Hash;
+            }
+            else
+            {
+                file.Content = sb.ToString();
+            }
+            results[i] = (file, localDeadCode);
         });
-
-        var phase2Ms = methodsSw.ElapsedMilliseconds - phase1Ms;
-        Console.Error.WriteLine($"[perf] MethodFiles: phase1_filter={phase1Ms}ms phase2_parallel={phase2Ms}ms partitions={partitions.Count}");
+        phase2Sw.Stop($"partitions={partitionCount}" + (_streamDirectory != null ? ", streamed" : ""));
 
         // Merge per-partition dead-code diagnostics into the shared list.
-        var files = new List<GeneratedFile>(partitions.Count);
-        for (int i = 0; i < results.Length; i++)
+        var files = new List<GeneratedFile>(partitionCount);
+        foreach (var (file, deadCode) in results)
         {
-            files.Add(new GeneratedFile { FileName = results[i].FileName, Content = results[i].Content });
-            _deadCodeReplacements.AddRange(results[i].DeadCode);
+            files.Add(file);
+            _deadCodeReplacements.AddRange(deadCode);
         }
 
         return files;
@@ -995,16 +1051,16 @@ public partial class CppCodeGenerator
         var allFields = type.Fields.Concat(type.StaticFields).ToList();
         var reflectableMethods = type.Methods.Where(m => !CppNameMapper.IsCompilerGeneratedType(m.Name)).ToList();
         var reflectableProperties = type.Properties;
-        var reflectionTargets = _module.ReflectionTargetTypes;
-        // Field/method metadata: gated by reflection targets + enum types
+        // Field/method metadata: gated by reflection visibility + enum types
         var skipFieldMethodReflection = type.IsRuntimeProvided
             || CppNameMapper.IsRuntimeExceptionType(type.ILFullName)
             || (allFields.Count == 0 && reflectableMethods.Count == 0)
-            || (!type.IsEnum && !type.IsDelegate && reflectionTargets.Count > 0 && !reflectionTargets.Contains(type.ILFullName));
-        // Property metadata: always emitted for non-runtime types with properties
+            || (!type.IsEnum && !type.IsDelegate && !IsReflectionVisible(type));
+        // Property metadata: gated by reflection visibility
         var skipPropertyReflection = type.IsRuntimeProvided
             || CppNameMapper.IsRuntimeExceptionType(type.ILFullName)
-            || reflectableProperties.Count == 0;
+            || reflectableProperties.Count == 0
+            || !IsReflectionVisible(type);
         // When field/method reflection is skipped, still include constructors and property accessors.
         // Constructors are essential for runtime activation (serializers, DI, Activator.CreateInstance).
         // Property accessors must match function pointers to MethodInfo objects.
@@ -1153,6 +1209,13 @@ public partial class CppCodeGenerator
         // Metadata token (ECMA-335)
         if (type.MetadataToken != 0)
             sb.AppendLine($"    .metadata_token = 0x{type.MetadataToken:X8},");
+        // Sorted member name indexes (emitted alongside the arrays in EmitReflectionMetadata)
+        if (methodsExpr != "nullptr" && HasMemberNameIndex(reflectableMethods.Count))
+            sb.AppendLine($"    .method_name_index = {methodsExpr}_by_name,");
+        if (fieldsExpr != "nullptr" && HasMemberNameIndex(allFields.Count))
+            sb.AppendLine($"    .field_name_index = {fieldsExpr}_by_name,");
+        if (propsExpr != "nullptr" && HasMemberNameIndex(reflectableProperties.Count))
+            sb.AppendLine($"    .property_name_index = {propsExpr}_by_name,");
         sb.AppendLine("};");
     }
 
@@ -1229,7 +1292,8 @@ public partial class CppCodeGenerator
     }
 
     private void GenerateMethodImpl(StringBuilder sb, IRMethod method,
-        List<(string Category, string FunctionName, string InMethod)>? localDeadCode = null)
+        List<(string Category, string FunctionName, string InMethod)>? localDeadCode = null,
+        bool isCold = false)
     {
         if (method.CanonicalMethod != null && method.CanonicalMethod.BasicBlocks.Count > 0)
         {
@@ -1244,7 +1308,8 @@ public partial class CppCodeGenerator
             IRPeepholeOptimizer.EliminateSingleUseTemps(method, _undeclaredFunctionNames);
 
         sb.AppendLine($"// {method.DeclaringType?.ILFullName}::{method.Name}");
-        sb.AppendLine($"{method.GetCppSignature()} {{");
+        // Cold partitions (CallGraph layout): keep out of hot text and inline budgets
+        sb.AppendLine(isCold ? $"CIL2CPP_COLD {method.GetCppSignature()} {{" : $"{method.GetCppSignature()} {{");
 
         // MSVC /O2 can clobber register variables across setjmp/longjmp (CIL2CPP_TRY).
         // Declare pointer-type locals as volatile in methods that contain exception handlers.
@@ -1851,6 +1916,153 @@ public partial class CppCodeGenerator
         return BuildMethodPointerCast(method);
     }
 
+    /// <summary>
+    /// Whether the method was actually declared (has a valid signature) and can be
+    /// referenced from reflection metadata.
+    /// </summary>
+    private bool HasValidReflectionSignature(IRMethod method)
+        => !method.IsAbstract && !method.IsInternalCall
+            && method.BasicBlocks.Count > 0
+            && !method.Parameters.Any(p => p.CppTypeName.Contains("(") || p.CppTypeName.Contains(")"))
+            && !(method.ReturnTypeCpp?.Contains("(") == true)
+            && _declaredFunctionNames.Contains(method.CppName);
+
+    /// <summary>
+    /// MethodInfo.Invoke thunk for the method's C++ signature (MethodInfo::invoker).
+    /// Checks each argument against its parameter's TypeInfo (ArgumentException on a
+    /// mismatch), unboxes value-type arguments, calls through the method pointer and boxes
+    /// a value-type result. Byref arguments are copied back into the argument array like .NET does:
+    /// reference types are passed as pointers into the array, value types through a local
+    /// (default(T) for a null argument) that is boxed into a new object afterwards, so the
+    /// caller's original box is never written. Methods with identical signatures share one
+    /// thunk. Returns null — leaving the runtime's untyped fallback — for signatures that
+    /// can't be marshalled from object[]: unmanaged pointers, Nullable, unknown value-type TypeInfo.
+    /// </summary>
+    private string? GetOrEmitInvokeThunk(StringBuilder sb, IRMethod method,
+        Dictionary<string, string> typeInfoLookup, Dictionary<string, string> thunks)
+    {
+        var paramTypes = new List<string>();
+        var argExprs = new List<string>();
+        var refLocals = new StringBuilder();
+        var copyBacks = new StringBuilder();
+        if (!method.IsStatic && method.DeclaringType != null)
+        {
+            var thisType = method.DeclaringType.CppName;
+            paramTypes.Add($"{thisType}*");
+            argExprs.Add(method.DeclaringType.IsValueType
+                ? $"cil2cpp::unbox_ptr<{thisType}>(__obj)"
+                : $"reinterpret_cast<{thisType}*>(__obj)");
+        }
+        for (int i = 0; i < method.Parameters.Count; i++)
+        {
+            var p = method.Parameters[i];
+            var cppType = p.CppTypeName;
+            var ilType = p.ILTypeName;
+            if (ilType.EndsWith("*") || ilType.StartsWith("method") || IsNullableTypeName(ilType))
+                return null;
+            paramTypes.Add(cppType);
+            if (ilType.EndsWith("&"))
+            {
+                var elementType = cppType[..^1];
+                if (IsNullableTypeName(ilType[..^1])) return null;
+                var elementTypeInfo = typeInfoLookup.GetValueOrDefault(ilType[..^1]);
+                if (elementType.EndsWith("*"))
+                {
+                    var slotTypeInfo = ReferenceArgTypeInfo(ilType[..^1], typeInfoLookup);
+                    argExprs.Add(slotTypeInfo == null
+                        ? $"reinterpret_cast<{cppType}>(&__args[{i}])"
+                        : $"reinterpret_cast<{cppType}>(cil2cpp::invoke_ref_slot(&__args[{i}], {slotTypeInfo}))");
+                    continue;
+                }
+                if (elementTypeInfo == null) return null;
+                refLocals.Append($"    {elementType} __ref{i} = cil2cpp::invoke_arg<{elementType}>(__args[{i}], {elementTypeInfo});\n");
+                copyBacks.Append($"    __args[{i}] = cil2cpp::box<{elementType}>(__ref{i}, {elementTypeInfo});\n");
+                argExprs.Add($"&__ref{i}");
+            }
+            else if (cppType.EndsWith("*"))
+            {
+                var paramTypeInfo = ReferenceArgTypeInfo(ilType, typeInfoLookup);
+                argExprs.Add(paramTypeInfo == null
+                    ? $"reinterpret_cast<{cppType}>(__args[{i}])"
+                    : $"reinterpret_cast<{cppType}>(cil2cpp::invoke_ref_arg(__args[{i}], {paramTypeInfo}))");
+            }
+            else
+            {
+                var paramTypeInfo = typeInfoLookup.GetValueOrDefault(ilType);
+                if (paramTypeInfo == null) return null;
+                argExprs.Add($"cil2cpp::invoke_arg<{cppType}>(__args[{i}], {paramTypeInfo})");
+            }
+        }
+
+        var retType = method.ReturnTypeCpp ?? "void";
+        var call = $"reinterpret_cast<{retType}(*)({string.Join(", ", paramTypes)})>(__fn)" +
+            $"({string.Join(", ", argExprs)})";
+        string resultExpr;
+        if (retType == "void")
+            resultExpr = "";
+        else if (retType.EndsWith("*"))
+        {
+            if (method.ReturnType?.ILFullName.EndsWith("*") == true) return null;
+            resultExpr = "reinterpret_cast<cil2cpp::Object*>({0})";
+        }
+        else
+        {
+            var boxTypeInfo = GetReturnBoxTypeInfo(method, retType, typeInfoLookup);
+            if (boxTypeInfo == null) return null;
+            resultExpr = $"cil2cpp::box<{retType}>({{0}}, {boxTypeInfo})";
+        }
+
+        string body;
+        if (copyBacks.Length == 0)
+            body = retType == "void"
+                ? $"    {call};\n    return nullptr;"
+                : $"    return {resultExpr.Replace("{0}", call)};";
+        else if (retType == "void")
+            body = $"{refLocals}    {call};\n{copyBacks}    return nullptr;";
+        else
+            body = $"{refLocals}    auto __result = {call};\n{copyBacks}" +
+                $"    return {resultExpr.Replace("{0}", "__result")};";
+
+        if (thunks.TryGetValue(body, out var existing))
+            return existing;
+        var name = $"__reflection_invoke_{thunks.Count}";
+        thunks[body] = name;
+        var objName = argExprs.Any(a => a.Contains("__obj")) ? " __obj" : "";
+        var argsName = method.Parameters.Count > 0 ? " __args" : "";
+        sb.AppendLine($"static cil2cpp::Object* {name}(void* __fn, cil2cpp::Object*{objName}, cil2cpp::Object**{argsName}) {{");
+        sb.AppendLine(body);
+        sb.AppendLine("}");
+        return name;
+    }
+
+    /// <summary>
+    /// TypeInfo a reference-type invoke argument is checked against; null (unchecked) for
+    /// types without a TypeInfo symbol here (arrays) and for the roots boxes and runtime
+    /// objects derive from.
+    /// </summary>
+    private static string? ReferenceArgTypeInfo(string ilTypeName, Dictionary<string, string> typeInfoLookup)
+        => ilTypeName is "System.Object" or "System.ValueType" or "System.Enum"
+            ? null : typeInfoLookup.GetValueOrDefault(ilTypeName);
+
+    private static bool IsNullableTypeName(string ilTypeName)
+        => ilTypeName.StartsWith("System.Nullable`1", StringComparison.Ordinal);
+
+    /// <summary>
+    /// TypeInfo to box a value-type return with. ReturnType is only set for types in the
+    /// type cache, so primitives fall back to a unique C++-type match.
+    /// </summary>
+    private string? GetReturnBoxTypeInfo(IRMethod method, string retType,
+        Dictionary<string, string> typeInfoLookup)
+    {
+        if (method.ReturnType != null)
+        {
+            if (IsNullableTypeName(method.ReturnType.ILFullName)) return null;
+            return typeInfoLookup.GetValueOrDefault(method.ReturnType.ILFullName);
+        }
+        var primitives = _module.PrimitiveTypeInfos.Values.Where(e => e.CppTypeName == retType).ToList();
+        return primitives.Count == 1 ? $"&{primitives[0].CppMangledName}_TypeInfo" : null;
+    }
+
     /// <summary>
     /// Build a typed function pointer cast expression for a method.
     /// Unlike GetTypedMethodPointerCast, this does NOT check IsAbstract/BasicBlocks.
@@ -2514,7 +2726,9 @@ public partial class CppCodeGenerator
         var typeInfoLookup = BuildTypeInfoExprLookup();
         bool any = false;
         var emittedReflection = new HashSet<string>();
-        var reflectionTargets = _module.ReflectionTargetTypes;
+        var invokeThunks = new Dictionary<string, string>();
+        int fullCount = 0, strippedCount = 0;
+        int startLength = sb.Length;
 
         foreach (var type in userTypes)
         {
@@ -2523,12 +2737,12 @@ public partial class CppCodeGenerator
             // Deduplicate — BCL proxies may appear multiple times
             if (!emittedReflection.Add(type.CppName)) continue;
 
-            // Field/method metadata: gated by reflection targets + enum types
+            // Field/method metadata: gated by reflection visibility + enum types
             // Delegate types always get method metadata (Invoke needed for expression trees)
-            var skipFieldMethod = !type.IsEnum && !type.IsDelegate
-                && reflectionTargets.Count > 0 && !reflectionTargets.Contains(type.ILFullName);
-            // Property metadata: always emitted for types with properties
-            var reflectableProperties = type.Properties;
+            var skipFieldMethod = !type.IsEnum && !type.IsDelegate && !IsReflectionVisible(type);
+            // Property metadata: only for reflection-visible types
+            var reflectableProperties = IsReflectionVisible(type) ? type.Properties : new List<IRProperty>();
+            if (skipFieldMethod) strippedCount++; else fullCount++;
 
             var allFields = skipFieldMethod ? new List<IRField>()
                 : type.Fields.Concat(type.StaticFields).ToList();
@@ -2622,15 +2836,19 @@ public partial class CppCodeGenerator
                         $".constant_value = {constantExpr} }},");
                 }
                 sb.AppendLine("};");
+                EmitMemberNameIndex(sb, $"{type.CppName}_fields", allFields.Select(f => f.Name).ToList());
             }
 
             // Emit MethodInfo parameter type arrays and MethodInfo array
             if (reflectableMethods.Count > 0)
             {
-                // First: parameter type arrays for methods that have parameters
+                // First: invoke thunks and parameter type arrays for methods that have parameters
+                var invokers = new string?[reflectableMethods.Count];
                 for (int mi = 0; mi < reflectableMethods.Count; mi++)
                 {
                     var method = reflectableMethods[mi];
+                    if (HasValidReflectionSignature(method))
+                        invokers[mi] = GetOrEmitInvokeThunk(sb, method, typeInfoLookup, invokeThunks);
                     if (method.Parameters.Count == 0) continue;
                     var paramTypeExprs = method.Parameters
                         .Select(p => typeInfoLookup.GetValueOrDefault(p.ILTypeName, "nullptr"))
@@ -2647,13 +2865,7 @@ public partial class CppCodeGenerator
                         method.ReturnType?.ILFullName ?? "", "nullptr");
                     var paramTypesExpr = method.Parameters.Count > 0
                         ? $"{type.CppName}_m{mi}_param_types" : "nullptr";
-                    // Check if the method was actually declared (has valid signature)
-                    var hasValidSignature = !method.IsAbstract && !method.IsInternalCall
-                        && method.BasicBlocks.Count > 0
-                        && !method.Parameters.Any(p => p.CppTypeName.Contains("(") || p.CppTypeName.Contains(")"))
-                        && !(method.ReturnTypeCpp?.Contains("(") == true)
-                        && _declaredFunctionNames.Contains(method.CppName);
-                    var methodPtrExpr = hasValidSignature
+                    var methodPtrExpr = HasValidReflectionSignature(method)
                         ? GetTypedMethodPointerCast(method)
                         : "nullptr";
                     var methodAttrsExpr = method.CustomAttributes.Count > 0
@@ -2668,9 +2880,11 @@ public partial class CppCodeGenerator
                         $".flags = 0x{method.Attributes:X4}, " +
                         $".vtable_slot = {method.VTableSlot}, " +
                         $".custom_attributes = {methodAttrsExpr}, " +
-                        $".custom_attribute_count = {method.CustomAttributes.Count} }},");
+                        $".custom_attribute_count = {method.CustomAttributes.Count}" +
+                        (invokers[mi] != null ? $", .invoker = {invokers[mi]} }}," : " },"));
                 }
                 sb.AppendLine("};");
+                EmitMemberNameIndex(sb, $"{type.CppName}_methods", reflectableMethods.Select(m => m.Name).ToList());
             }
 
             // Property-level attributes
@@ -2707,9 +2921,63 @@ public partial class CppCodeGenerator
                         $".custom_attribute_count = {prop.CustomAttributes.Count} }},");
                 }
                 sb.AppendLine("};");
+                EmitMemberNameIndex(sb, $"{type.CppName}_properties", reflectableProperties.Select(p => p.Name).ToList());
             }
         }
         if (any) sb.AppendLine();
+
+        var fallback = _module.UntrackedReflectionSite != null
+            ? $", all user types kept (untracked reflection in {_module.UntrackedReflectionSite})" : "";
+        Timings.Note("Reflection metadata", $"{fullCount} full, {strippedCount} stripped types, " +
+            $"{(sb.Length - startLength) / 1024}K chars{fallback}");
+    }
+
+    /// <summary>
+    /// Whether a type keeps member metadata (FieldInfo/MethodInfo/PropertyInfo/attributes).
+    /// Everything else gets a stripped TypeInfo: identity, hierarchy, interfaces and constructors only.
+    /// Without <see cref="IRModule.TrimReflectionMetadata"/> (no reachability result) every type is visible.
+    /// </summary>
+    private bool IsReflectionVisible(IRType type)
+    {
+        return !_module.TrimReflectionMetadata || _module.ReflectionTargetTypes.Contains(type.ILFullName);
+    }
+
+    /// <summary>
+    /// Below this many members a linear strcmp scan beats a binary search, so no name index
+    /// is emitted and the runtime scans (TypeInfo.*_name_index = nullptr).
+    /// </summary>
+    internal const int MemberNameIndexMinCount = 8;
+
+    internal static bool HasMemberNameIndex(int memberCount)
+        => memberCount >= MemberNameIndexMinCount && memberCount <= ushort.MaxValue;
+
+    /// <summary>
+    /// Member positions sorted by name in strcmp order (UTF-8 bytes, ordinal). Stable, so
+    /// overloads keep declaration order and the runtime's first match is the first declared.
+    /// </summary>
+    internal static List<int> BuildMemberNameIndex(IReadOnlyList<string> names)
+    {
+        var utf8 = names.Select(n => System.Text.Encoding.UTF8.GetBytes(n)).ToArray();
+        return Enumerable.Range(0, names.Count)
+            .OrderBy(i => utf8[i], Utf8OrdinalComparer.Instance)
+            .ToList();
+    }
+
+    private sealed class Utf8OrdinalComparer : IComparer<byte[]>
+    {
+        public static readonly Utf8OrdinalComparer Instance = new();
+        public int Compare(byte[]? x, byte[]? y) => x.AsSpan().SequenceCompareTo(y);
+    }
+
+    /// <summary>
+    /// Emit "{arrayName}_by_name[]" for the runtime's GetMethod/GetField/GetProperty(name)
+    /// binary search (see for_each_named in memberinfo.cpp).
+    /// </summary>
+    private static void EmitMemberNameIndex(StringBuilder sb, string arrayName, List<string> names)
+    {
+        if (!HasMemberNameIndex(names.Count)) return;
+        sb.AppendLine($"static const uint16_t {arrayName}_by_name[] = {{ " +
+            $"{string.Join(", ", BuildMemberNameIndex(names))} }};");
     }
 
     /// <summary>
@@ -2870,11 +3138,49 @@ public partial class CppCodeGenerator
     // - No extern "C" declarations (runtime provides the functions via compression_interop.cpp etc.)
     // - No CMake target_link_libraries (already linked via cil2cpp::runtime)
     // Entry points are forward-declared as extern "C" in the generated code.
+    // Brotli entry points are libbrotli's own exports (bundled brotlienc/brotlidec).
     private static readonly HashSet<string> RuntimeProvidedPInvokeModules = new(StringComparer.OrdinalIgnoreCase)
     {
-        "System.IO.Compression.Native"
+        "System.IO.Compression.Native", "libSystem.IO.Compression.Native"
     };
 
+    // QCall entry points the CIL2CPP runtime implements itself (waithandle.cpp). On Unix,
+    // CoreLib creates and signals wait handles through Interop.Kernel32 QCalls that CoreCLR
+    // serves from its PAL; these get the same forward declarations + wrappers as
+    // RuntimeProvidedPInvokeModules. Other QCalls stay internal (icalls or stubs).
+    private static readonly HashSet<string> RuntimeProvidedQCallEntryPoints = new(StringComparer.Ordinal)
+    {
+        "CreateEventExW", "SetEvent", "ResetEvent",
+        "CreateMutexExW", "ReleaseMutex",
+        "CreateSemaphoreExW", "ReleaseSemaphore",
+        "CloseHandle"
+    };
+
+    // Native entry points that can block indefinitely (sockets, file/pipe I/O, waits).
+    // Their wrappers run the call in a GC-safe region (cil2cpp::gc::blocking), so a
+    // collection does not wait for a thread parked in the kernel.
+    private static readonly HashSet<string> BlockingPInvokeEntryPoints = new(StringComparer.Ordinal)
+    {
+        // Winsock
+        "accept", "connect", "recv", "recvfrom", "send", "sendto", "select", "WSAPoll",
+        "WSAAccept", "WSAConnect", "WSARecv", "WSARecvFrom", "WSASend", "WSASendTo",
+        "WSAWaitForMultipleEvents",
+        // Kernel32 I/O and waits
+        "ReadFile", "WriteFile", "ConnectNamedPipe", "WaitNamedPipeW", "ReadConsoleW",
+        "WaitForSingleObject", "WaitForSingleObjectEx", "WaitForMultipleObjects",
+        "WaitForMultipleObjectsEx", "SleepEx", "GetQueuedCompletionStatus",
+        "GetQueuedCompletionStatusEx",
+        // POSIX
+        "read", "write", "poll", "waitpid", "sleep", "usleep", "nanosleep"
+    };
+
+    private static bool IsRuntimeProvidedPInvoke(IRMethod method)
+    {
+        if (RuntimeProvidedPInvokeModules.Contains(method.PInvokeModule!)) return true;
+        return method.PInvokeModule is "QCall" or "QCall.dll"
+            && RuntimeProvidedQCallEntryPoints.Contains(method.PInvokeEntryPoint ?? method.Name);
+    }
+
     private void EmitPInvokeDeclarations(StringBuilder sb, List<IRType> userTypes,
         HashSet<string> emittedMethodSignatures)
     {
@@ -2985,7 +3291,7 @@ public partial class CppCodeGenerator
         // Forward-declare them so the wrapper generation gate passes; the linker resolves
         // against the runtime library (e.g., compression_interop.cpp).
         var runtimeProvidedMethods = allPInvokeMethods
-            .Where(m => RuntimeProvidedPInvokeModules.Contains(m.PInvokeModule!))
+            .Where(IsRuntimeProvidedPInvoke)
             .ToList();
         if (runtimeProvidedMethods.Count > 0)
         {
@@ -3212,13 +3518,38 @@ public partial class CppCodeGenerator
 
             // Execute native call — always capture return in __native_ret for non-void
             // so copy-back can be inserted between call and return.
-            if (retType == "void")
-                sb.AppendLine($"    {entryPoint}({argStr});");
+            if (BlockingPInvokeEntryPoints.Contains(entryPoint))
+            {
+                // GC-safe region; the error is captured inside, before the region's exit
+                // (which takes the GC lock) can overwrite it
+                var assign = retType == "void" ? "" : "auto __native_ret = ";
+                var ret = retType == "void" ? "" : "return ";
+                if (method.PInvokeSetLastError)
+                {
+                    sb.AppendLine($"    {assign}cil2cpp::gc::blocking([&] {{");
+                    sb.AppendLine(retType == "void"
+                        ? $"        {entryPoint}({argStr});"
+                        : $"        auto __r = {entryPoint}({argStr});");
+                    sb.AppendLine("        cil2cpp::capture_last_pinvoke_error();");
+                    if (retType != "void")
+                        sb.AppendLine("        return __r;");
+                    sb.AppendLine("    });");
+                }
+                else
+                {
+                    sb.AppendLine($"    {assign}cil2cpp::gc::blocking([&] {{ {ret}{entryPoint}({argStr}); }});");
+                }
+            }
             else
-                sb.AppendLine($"    auto __native_ret = {entryPoint}({argStr});");
+            {
+                if (retType == "void")
+                    sb.AppendLine($"    {entryPoint}({argStr});");
+                else
+                    sb.AppendLine($"    auto __native_ret = {entryPoint}({argStr});");
 
-            if (method.PInvokeSetLastError)
-                sb.AppendLine("    cil2cpp::capture_last_pinvoke_error();");
+                if (method.PInvokeSetLastError)
+                    sb.AppendLine("    cil2cpp::capture_last_pinvoke_error();");
+            }
 
             // C.7.2: [Out]/[InOut] parameter copy-back after native call.
             // For pointer-typed params (int*, struct*), native writes directly — no copy-back needed.
@@ -3435,6 +3766,48 @@ public partial class CppCodeGenerator
         sb.AppendLine();
     }
 
+    /// <summary>
+    /// Emit the compiled methods' entry addresses with their C++ and .NET names, registered
+    /// by __init_method_symbols() so profiler samples resolve to "Namespace.Type.Method".
+    /// Compiled only with -DCIL2CPP_PROFILER (CMake option of the same name): the table
+    /// takes every method's address, which would otherwise defeat --gc-sections.
+    /// </summary>
+    private void EmitMethodSymbolTable(StringBuilder sb)
+    {
+        var entries = new List<string>();
+        var seen = new HashSet<string>();
+        foreach (var type in _userTypes)
+        {
+            foreach (var method in type.Methods)
+            {
+                if (!HasValidReflectionSignature(method)) continue;
+                var pointer = GetTypedMethodPointerCast(method);
+                if (pointer == "nullptr" || !seen.Add(pointer)) continue;
+                var dotnetName = $"{type.ILFullName}.{method.Name}";
+                entries.Add($"    {{ {pointer}, \"{method.CppName}\", \"{EscapeCppString(dotnetName)}\" }},");
+            }
+        }
+
+        sb.AppendLine("// ===== Method Symbols (sampling profiler) =====");
+        sb.AppendLine("#ifdef CIL2CPP_PROFILER");
+        if (entries.Count > 0)
+        {
+            sb.AppendLine("static const cil2cpp::profiler::MethodSymbol __method_symbols[] = {");
+            foreach (var entry in entries)
+                sb.AppendLine(entry);
+            sb.AppendLine("};");
+            sb.AppendLine($"void __init_method_symbols() {{ cil2cpp::profiler::register_methods(__method_symbols, {entries.Count}); }}");
+        }
+        else
+        {
+            sb.AppendLine("void __init_method_symbols() {}");
+        }
+        sb.AppendLine("#else");
+        sb.AppendLine("void __init_method_symbols() {}");
+        sb.AppendLine("#endif");
+        sb.AppendLine();
+    }
+
     /// <summary>
     /// Emit compiler-generated trampolines for CreateObjectArrayDelegate and
     /// __init_delegate_trampolines() registration. Each trampoline converts typed
@@ -3575,6 +3948,42 @@ public partial class CppCodeGenerator
         sb.AppendLine();
     }
 
+    /// <summary>
+    /// Compiled Meter(string), Func&lt;T&gt; callback types and Meter.CreateObservable*&lt;T&gt;
+    /// factories the runtime publishes the "System.Runtime" meter through, in
+    /// <see cref="RuntimeMeter"/> order; null unless the program uses MeterListener and all
+    /// of them were generated.
+    /// </summary>
+    private (IRType Meter, IRMethod Ctor, IRType[] Callbacks, IRMethod[] Factories)? FindRuntimeMeterEntryPoints()
+    {
+        if (!_userTypes.Any(t => t.ILFullName == RuntimeMeter.ListenerTypeName)) return null;
+        var meterType = _userTypes.FirstOrDefault(t => t.ILFullName == RuntimeMeter.MeterTypeName);
+        var ctor = meterType?.Methods.FirstOrDefault(m => m.IsConstructor && !m.IsStaticConstructor
+            && m.Parameters.Count == 1 && m.Parameters[0].ILTypeName == "System.String");
+        if (ctor == null) return null;
+
+        var callbacks = new IRType[RuntimeMeter.Callbacks.Length];
+        for (int i = 0; i < callbacks.Length; i++)
+        {
+            var name = RuntimeMeter.CallbackTypeName(RuntimeMeter.Callbacks[i].TypeArgument);
+            var callback = _userTypes.FirstOrDefault(t => t.ILFullName == name);
+            if (callback == null) return null;
+            callbacks[i] = callback;
+        }
+
+        var factories = new IRMethod[RuntimeMeter.Factories.Length];
+        for (int i = 0; i < factories.Length; i++)
+        {
+            var (methodName, typeArgument, _) = RuntimeMeter.Factories[i];
+            var callbackName = RuntimeMeter.CallbackTypeName(typeArgument);
+            var factory = meterType!.Methods.FirstOrDefault(m => m.Name == methodName && m.IsGenericInstance
+                && m.Parameters.Count == 4 && m.Parameters[1].ILTypeName == callbackName);
+            if (factory == null) return null;
+            factories[i] = factory;
+        }
+        return (meterType!, ctor, callbacks, factories);
+    }
+
     /// <summary>
     /// Emit __init_runtime_vtables() — patches runtime built-in TypeInfos with codegen VTable
     /// and interface data. Must be emitted AFTER all VTable/interface data in the data file
@@ -3606,6 +4015,61 @@ public partial class CppCodeGenerator
             sb.AppendLine($"    cil2cpp::task_set_typeinfo(&{taskType.CppName}_TypeInfo);");
         }
 
+        // Register Task<bool> so SemaphoreSlim.WaitAsync (runtime ICall) can create its results
+        var boolTaskType = _userTypes.FirstOrDefault(t => t.ILFullName == "System.Threading.Tasks.Task`1<System.Boolean>");
+        var boolResultField = boolTaskType?.Fields.FirstOrDefault(f => f.Name == "m_result");
+        if (boolResultField != null)
+        {
+            sb.AppendLine("    // Register Task<bool> TypeInfo/layout for SemaphoreSlim.WaitAsync");
+            sb.AppendLine($"    cil2cpp::task_set_bool_typeinfo(&{boolTaskType!.CppName}_TypeInfo, sizeof({boolTaskType.CppName}),");
+            sb.AppendLine($"        offsetof({boolTaskType.CppName}, {boolResultField.CppName}));");
+        }
+
+        // Register CancellationTokenSource's compiled transition and callback steps so the
+        // NotifyCancellation ICall can wake runtime-parked waiters between them
+        var ctsType = _userTypes.FirstOrDefault(t => t.ILFullName == "System.Threading.CancellationTokenSource");
+        var ctsTransition = ctsType?.Methods.FirstOrDefault(m =>
+            m.Name == "TransitionToCancellationRequested" && m.Parameters.Count == 0);
+        var ctsCallbacks = ctsType?.Methods.FirstOrDefault(m =>
+            m.Name == "ExecuteCallbackHandlers" && m.Parameters.Count == 1);
+        if (ctsTransition != null && ctsCallbacks != null)
+        {
+            sb.AppendLine("    // Register CancellationTokenSource notification steps for NotifyCancellation");
+            sb.AppendLine("    cil2cpp::cts_set_notify_methods(");
+            sb.AppendLine($"        [](cil2cpp::CancellationTokenSource* cts) -> bool {{ return {ctsTransition.CppName}(cts); }},");
+            sb.AppendLine($"        [](cil2cpp::CancellationTokenSource* cts, bool throwOnFirst) {{ {ctsCallbacks.CppName}(cts, throwOnFirst); }});");
+        }
+
+        // Register the Meter factories so the runtime can publish the "System.Runtime" meter
+        // for MeterListener (main calls counters::publish_meter)
+        var runtimeMeter = FindRuntimeMeterEntryPoints();
+        if (runtimeMeter != null)
+        {
+            var (meterType, meterCtor, callbacks, factories) = runtimeMeter.Value;
+            var meterCpp = meterType.CppName;
+            sb.AppendLine("    // Register Meter factories for the System.Runtime meter (MeterListener)");
+            sb.AppendLine("    {");
+            sb.AppendLine("        cil2cpp::counters::MeterFactories meter{};");
+            sb.AppendLine("        meter.create_meter = [](cil2cpp::String* name) -> cil2cpp::Object* {");
+            sb.AppendLine($"            auto* m = ({meterCpp}*)cil2cpp::gc::alloc(sizeof({meterCpp}), &{meterCpp}_TypeInfo);");
+            sb.AppendLine($"            {meterCtor.CppName}(m, ({meterCtor.Parameters[0].CppTypeName})(void*)name);");
+            sb.AppendLine("            return (cil2cpp::Object*)m;");
+            sb.AppendLine("        };");
+            for (int i = 0; i < callbacks.Length; i++)
+                sb.AppendLine($"        meter.{RuntimeMeter.Callbacks[i].FactoryField} = &{callbacks[i].CppName}_TypeInfo;");
+            for (int i = 0; i < factories.Length; i++)
+            {
+                var p = factories[i].Parameters;
+                sb.AppendLine($"        meter.{RuntimeMeter.Factories[i].FactoryField} = [](cil2cpp::Object* m, cil2cpp::String* name, " +
+                    "cil2cpp::Delegate* observe, cil2cpp::String* unit, cil2cpp::String* description) {");
+                sb.AppendLine($"            {factories[i].CppName}(({meterCpp}*)(void*)m, ({p[0].CppTypeName})(void*)name, " +
+                    $"({p[1].CppTypeName})(void*)observe, ({p[2].CppTypeName})(void*)unit, ({p[3].CppTypeName})(void*)description);");
+                sb.AppendLine("        };");
+            }
+            sb.AppendLine("        cil2cpp::counters::set_meter_factories(meter);");
+            sb.AppendLine("    }");
+        }
+
         // Register System.Array TypeInfo so SZArray TypeInfos (T[]) inherit base_type/vtable/interfaces
         var arrayType = _userTypes.FirstOrDefault(t => t.ILFullName == "System.Array");
         if (arrayType != null)
@@ -3614,6 +4078,34 @@ public partial class CppCodeGenerator
             sb.AppendLine($"    cil2cpp::array_set_system_array_typeinfo(&{arrayType.CppName}_TypeInfo);");
         }
 
+        // Register the culture comparer's field layout so string sorts with
+        // StringComparer.Create/CurrentCulture/InvariantCulture can sort by ICU sort keys
+        var cultureComparerType = _userTypes.FirstOrDefault(t => t.ILFullName == "System.CultureAwareComparer");
+        var compareInfoType = _userTypes.FirstOrDefault(t => t.ILFullName == "System.Globalization.CompareInfo");
+        var compareInfoField = cultureComparerType?.Fields.FirstOrDefault(f => f.Name == "_compareInfo");
+        var optionsField = cultureComparerType?.Fields.FirstOrDefault(f => f.Name == "_options");
+        var sortHandleField = compareInfoType?.Fields.FirstOrDefault(f => f.Name == "_sortHandle");
+        if (compareInfoField != null && optionsField != null && sortHandleField != null)
+        {
+            sb.AppendLine("    // Register CultureAwareComparer layout for sort-key string sorting");
+            sb.AppendLine($"    cil2cpp::globalization::set_culture_comparer_layout(&{cultureComparerType!.CppName}_TypeInfo,");
+            sb.AppendLine($"        offsetof({cultureComparerType.CppName}, {compareInfoField.CppName}), " +
+                $"offsetof({cultureComparerType.CppName}, {optionsField.CppName}),");
+            sb.AppendLine($"        offsetof({compareInfoType!.CppName}, {sortHandleField.CppName}));");
+        }
+
+        // Register FirstChanceExceptionEventArgs so throw_exception can raise
+        // AppDomain.FirstChanceException (present only when a handler is subscribed)
+        var firstChanceArgsType = _userTypes.FirstOrDefault(t =>
+            t.ILFullName == "System.Runtime.ExceptionServices.FirstChanceExceptionEventArgs");
+        var firstChanceExceptionField = firstChanceArgsType?.Fields.FirstOrDefault(f => f.Name == "<Exception>k__BackingField");
+        if (firstChanceExceptionField != null)
+        {
+            sb.AppendLine("    // Register FirstChanceExceptionEventArgs layout for AppDomain.FirstChanceException");
+            sb.AppendLine($"    cil2cpp::exception_set_first_chance_args_typeinfo(&{firstChanceArgsType!.CppName}_TypeInfo,");
+            sb.AppendLine($"        sizeof({firstChanceArgsType.CppName}), offsetof({firstChanceArgsType.CppName}, {firstChanceExceptionField.CppName}));");
+        }
+
         // Patch System.Object's runtime TypeInfo with generated VTable.
         // The runtime defines System_Object_TypeInfo with vtable=nullptr.
         // Without this patch, virtual calls (GetHashCode, Equals, ToString) on
@@ -222,20 +222,43 @@ public partial class CppCodeGenerator
     /// </summary>
     private const int MinInstructionsPerPartition = 35000;
 
+    /// <summary>
+    /// Hot methods in link order (CallGraph layout only). Populated by GenerateMethodFiles,
+    /// written to the symbol-ordering file.
+    /// </summary>
+    private List<IRMethod>? _hotMethodOrder;
+
+    /// <summary>
+    /// Directory that method partitions are streamed into while they are rendered
+    /// (null = keep every file in memory). Set for the duration of <see cref="Generate(string?)"/>.
+    /// </summary>
+    private string? _streamDirectory;
+
+    /// <summary>
+    /// Per-phase timings (reported by the CLI with --timings).
+    /// </summary>
+    public CompilationTimings Timings { get; init; } = new();
+
     /// <summary>
     /// Generate all C++ files for the module.
+    /// With <paramref name="streamToDirectory"/>, method partitions — the bulk of the output —
+    /// are written straight to that directory as they are rendered (in parallel, unchanged
+    /// files left untouched) instead of being held in memory; see <see cref="GeneratedFile.IsStreamed"/>.
+    /// The remaining files still need <see cref="GeneratedOutput.WriteToDirectory"/>.
     /// </summary>
-    public GeneratedOutput Generate()
+    public GeneratedOutput Generate(string? streamToDirectory = null)
     {
-        var codegenSw = System.Diagnostics.Stopwatch.StartNew();
+        var codegenSw = Timings.Begin("CodeGen");
         var output = new GeneratedOutput();
+        _streamDirectory = streamToDirectory;
+        if (_streamDirectory != null)
+            Directory.CreateDirectory(_streamDirectory);
 
         // Generate header file with all type declarations
-        var headerSw = System.Diagnostics.Stopwatch.StartNew();
+        var headerSw = Timings.Begin("GenerateHeader");
         output.HeaderFile = GenerateHeader();
         output.PchFile = GeneratePch();
         headerSw.Stop();
-        Console.Error.WriteLine($"[perf] CodeGen GenerateHeader: {headerSw.ElapsedMilliseconds}ms");
 
         // Build shared userTypes list (used by all source generators)
         var seenTypeNames = new HashSet<string>();
@@ -285,19 +308,18 @@ public partial class CppCodeGenerator
         // Forward-declared types only support pointer usage (Type*), not value usage (sizeof/locals).
 
         // Generate split source files
-        var sourceSw = System.Diagnostics.Stopwatch.StartNew();
+        var dataSw = Timings.Begin("GenerateDataFile");
         output.DataFile = GenerateDataFile();
-        var dataMs = sourceSw.ElapsedMilliseconds;
+        dataSw.Stop();
         output.MethodFiles = GenerateMethodFiles();
-        var methodsMs = sourceSw.ElapsedMilliseconds - dataMs;
         // CoreRuntimeTypes method bodies are provided by the runtime library (core_methods.cpp).
         // No runtime_glue.cpp is generated — the compiler only generates stubs for
         // non-CoreRuntimeTypes methods that couldn't be compiled from IL.
+        var stubSw = Timings.Begin("GenerateStubFile");
         output.StubFile = GenerateStubFile();
-        sourceSw.Stop();
-        Console.Error.WriteLine($"[perf] CodeGen Data+Methods+Stubs: {sourceSw.ElapsedMilliseconds}ms " +
-            $"(data={dataMs}ms, methods={methodsMs}ms, stubs={sourceSw.ElapsedMilliseconds - dataMs - methodsMs}ms), " +
-            $"methodFiles={output.MethodFiles.Count}");
+        stubSw.Stop();
+        if (_hotMethodOrder != null)
+            output.SymbolOrderFile = GenerateSymbolOrderFile(_hotMethodOrder);
 
         // Generate main entry point only for executable projects (with entry point)
         if (_module.EntryPoint != null)
@@ -343,12 +365,35 @@ public partial class CppCodeGenerator
         // Structured stub count line — machine-parseable for CI tracking
         Console.Error.WriteLine($"[CIL2CPP] STUB_COUNT: unreachable={_stubCountUnreachable} glue={_stubCountGlue} undeclared={_skippedByUndeclaredFunction.Count} invalid_sig={_skippedByInvalidSignature.Count}");
 
-        codegenSw.Stop();
-        Console.Error.WriteLine($"[perf] CodeGen total: {codegenSw.ElapsedMilliseconds}ms");
+        codegenSw.Stop($"methodFiles={output.MethodFiles.Count}" +
+            (_streamDirectory != null ? $", streamed={output.MethodFiles.Count(f => f.StreamedChanged)} changed" : ""));
 
         return output;
     }
 
+    /// <summary>
+    /// Symbol-ordering file for the CallGraph layout: one C++ function name per line in
+    /// hot-first link order. Names are unmangled; the generated CMakeLists resolves them to
+    /// linker symbols from the object files (cil2cppSymbolOrder.cmake) before linking.
+    /// </summary>
+    private GeneratedFile GenerateSymbolOrderFile(List<IRMethod> hotOrder)
+    {
+        var sb = new StringBuilder();
+        sb.AppendLine("# Generated by CIL2CPP - DO NOT EDIT");
+        sb.AppendLine("# Hot function link order (call-graph layout), one C++ function name per line");
+        var seen = new HashSet<string>();
+        foreach (var method in hotOrder)
+        {
+            if (seen.Add(method.CppName))
+                sb.AppendLine(method.CppName);
+        }
+        return new GeneratedFile
+        {
+            FileName = $"{_module.Name}.order",
+            Content = sb.ToString()
+        };
+    }
+
     private GeneratedFile GenerateMain()
     {
         var sb = new StringBuilder();
@@ -374,6 +419,11 @@ public partial class CppCodeGenerator
         sb.AppendLine("    __init_resource_strings();");
         // Register compiler-generated delegate trampolines for CreateObjectArrayDelegate
         sb.AppendLine("    __init_delegate_trampolines();");
+        // Name compiled methods in CIL2CPP_PROFILE output (no-op unless CIL2CPP_PROFILER)
+        sb.AppendLine("    __init_method_symbols();");
+        // Publish the runtime counters as the "System.Runtime" meter before any listener starts
+        if (FindRuntimeMeterEntryPoints() != null)
+            sb.AppendLine("    cil2cpp::counters::publish_meter();");
         sb.AppendLine();
 
         // Call entry point
@@ -545,6 +595,46 @@ public partial class CppCodeGenerator
         }
         sb.AppendLine("endif()");
 
+        // Sampling profiler support: the method table in the data file plus frame pointers,
+        // so CIL2CPP_PROFILE=<file> stacks walk through generated code and carry .NET names.
+        if (isExe)
+        {
+            sb.AppendLine();
+            sb.AppendLine("# Sampling profiler: method names + frame pointers (run with CIL2CPP_PROFILE=<file>)");
+            sb.AppendLine("option(CIL2CPP_PROFILER \"Build for the runtime's sampling profiler\" OFF)");
+            sb.AppendLine("if(CIL2CPP_PROFILER)");
+            sb.AppendLine($"    target_compile_definitions({projectName} PRIVATE CIL2CPP_PROFILER)");
+            sb.AppendLine("    if(NOT MSVC)");
+            sb.AppendLine($"        target_compile_options({projectName} PRIVATE -fno-omit-frame-pointer -mno-omit-leaf-frame-pointer)");
+            sb.AppendLine("    endif()");
+            sb.AppendLine("endif()");
+        }
+
+        // Hot function ordering (CallGraph layout). The order file holds unmangled C++ names;
+        // a PRE_LINK step resolves them against the object files' symbol tables, and lld's
+        // --symbol-ordering-file lays the hot functions out contiguously. Opt-in: needs lld + nm.
+        if (isExe && output.SymbolOrderFile != null)
+        {
+            var orderFile = output.SymbolOrderFile.FileName;
+            sb.AppendLine();
+            sb.AppendLine("# Hot function link order (generated with --partition callgraph)");
+            sb.AppendLine("option(CIL2CPP_LINK_ORDER \"Order hot functions at link time (requires lld)\" OFF)");
+            sb.AppendLine("if(CIL2CPP_LINK_ORDER AND NOT MSVC AND CIL2CPP_SYMBOL_ORDER_SCRIPT)");
+            sb.AppendLine($"    target_compile_options({projectName} PRIVATE -ffunction-sections)");
+            sb.AppendLine($"    add_custom_command(TARGET {projectName} PRE_LINK");
+            sb.AppendLine("        COMMAND ${CMAKE_COMMAND}");
+            sb.AppendLine("            -DNM=${CMAKE_NM}");
+            sb.AppendLine($"            \"-DOBJECTS=$<JOIN:$<TARGET_OBJECTS:{projectName}>,|>\"");
+            sb.AppendLine($"            -DINPUT=${{CMAKE_CURRENT_SOURCE_DIR}}/{orderFile}");
+            sb.AppendLine($"            -DOUTPUT=${{CMAKE_CURRENT_BINARY_DIR}}/{orderFile}.sym");
+            sb.AppendLine("            -P ${CIL2CPP_SYMBOL_ORDER_SCRIPT}");
+            sb.AppendLine("        VERBATIM)");
+            sb.AppendLine($"    target_link_options({projectName} PRIVATE -fuse-ld=lld");
+            sb.AppendLine($"        \"LINKER:--symbol-ordering-file=${{CMAKE_CURRENT_BINARY_DIR}}/{orderFile}.sym\"");
+            sb.AppendLine("        \"LINKER:--no-warn-symbol-ordering\")");
+            sb.AppendLine("endif()");
+        }
+
         // Copy ICU DLLs to output directory (Windows only)
         // ICU::uc and ICU::dt SHARED IMPORTED targets are created by cil2cppConfig.cmake
         if (isExe)
@@ -838,6 +928,7 @@ public class GeneratedOutput
     /// <summary>
     /// Concatenation of all source file contents (data + methods + stubs).
     /// Useful for tests that search across all generated C++ code.
+    /// Streamed method files (see <see cref="GeneratedFile.IsStreamed"/>) contribute nothing.
     /// </summary>
     public string AllSourceContent
     {
@@ -869,21 +960,47 @@ public class GeneratedOutput
     public GeneratedFile? MainFile { get; set; }
     public GeneratedFile? CMakeFile { get; set; }
 
+    /// <summary>
+    /// Hot function link order (CallGraph layout only), consumed by the generated CMakeLists.
+    /// </summary>
+    public GeneratedFile? SymbolOrderFile { get; set; }
+
+    /// <summary>
+    /// Every generated file (header, pch, sources, main, symbol order, CMakeLists.txt).
+    /// </summary>
+    public IEnumerable<GeneratedFile> AllFiles
+    {
+        get
+        {
+            yield return HeaderFile;
+            yield return PchFile;
+            foreach (var sf in AllSourceFiles)
+                yield return sf;
+            if (MainFile != null)
+                yield return MainFile;
+            if (SymbolOrderFile != null)
+                yield return SymbolOrderFile;
+            if (CMakeFile != null)
+                yield return CMakeFile;
+        }
+    }
+
     /// <summary>
     /// Write all generated files to a directory.
+    /// Files whose content is unchanged are left untouched (timestamps preserved),
+    /// so CMake/ninja only recompile the partitions that actually changed.
+    /// Files already streamed to disk during generation are not written again.
+    /// Returns the number of files written (including streamed files that changed).
     /// </summary>
-    public void WriteToDirectory(string outputDir)
+    public int WriteToDirectory(string outputDir)
     {
         Directory.CreateDirectory(outputDir);
 
         // Clean stale generated files from previous runs.
         // When dedup reduces method count, the partition count shrinks, leaving
         // orphan methods_N.cpp files that cause duplicate symbol linker errors.
-        var generatedFileNames = new HashSet<string>(StringComparer.OrdinalIgnoreCase)
-            { HeaderFile.FileName, PchFile.FileName };
-        foreach (var sf in AllSourceFiles) generatedFileNames.Add(sf.FileName);
-        if (MainFile != null) generatedFileNames.Add(MainFile.FileName);
-        if (CMakeFile != null) generatedFileNames.Add(CMakeFile.FileName);
+        var generatedFileNames = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+        foreach (var file in AllFiles) generatedFileNames.Add(file.FileName);
         foreach (var existing in Directory.GetFiles(outputDir, "*.cpp")
             .Concat(Directory.GetFiles(outputDir, "*.h")))
         {
@@ -892,20 +1009,33 @@ public class GeneratedOutput
                 File.Delete(existing);
         }
 
-        File.WriteAllText(Path.Combine(outputDir, HeaderFile.FileName), HeaderFile.Content);
-        File.WriteAllText(Path.Combine(outputDir, PchFile.FileName), PchFile.Content);
-        foreach (var sourceFile in AllSourceFiles)
+        int written = 0;
+        Parallel.ForEach(AllFiles, file =>
         {
-            File.WriteAllText(Path.Combine(outputDir, sourceFile.FileName), sourceFile.Content);
-        }
-        if (MainFile != null)
-        {
-            File.WriteAllText(Path.Combine(outputDir, MainFile.FileName), MainFile.Content);
-        }
-        if (CMakeFile != null)
+            bool changed = file.IsStreamed
+                ? file.StreamedChanged
+                : WriteIfChanged(Path.Combine(outputDir, file.FileName), file.Content);
+            if (changed)
+                Interlocked.Increment(ref written);
+        });
+        return written;
+    }
+
+    /// <summary>
+    /// Write content to path unless the file already holds exactly that content.
+    /// Returns true if the file was (re)written.
+    /// </summary>
+    internal static bool WriteIfChanged(string path, string content)
+    {
+        var bytes = Encoding.UTF8.GetBytes(content);
+        if (File.Exists(path))
         {
-            File.WriteAllText(Path.Combine(outputDir, CMakeFile.FileName), CMakeFile.Content);
+            var info = new FileInfo(path);
+            if (info.Length == bytes.Length && File.ReadAllBytes(path).AsSpan().SequenceEqual(bytes))
+                return false;
         }
+        File.WriteAllBytes(path, bytes);
+        return true;
     }
 }
 
@@ -913,4 +1043,16 @@ public class GeneratedFile
 {
     public string FileName { get; set; } = "";
     public string Content { get; set; } = "";
+
+    /// <summary>
+    /// SHA-256 of the file on disk when it was streamed there during generation
+    /// (<see cref="CppCodeGenerator.Generate(string?)"/> with an output directory).
+    /// <see cref="Content"/> is empty for streamed files.
+    /// </summary>
+    public string? StreamedHash { get; set; }
+
+    /// <summary>Streamed files only: whether streaming replaced the file on disk.</summary>
+    public bool StreamedChanged { get; set; }
+
+    public bool IsStreamed => StreamedHash != null;
 }
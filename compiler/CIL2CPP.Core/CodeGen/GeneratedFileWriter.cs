@@ -0,0 +1,123 @@
+using System.Security.Cryptography;
+using System.Text;
+
+namespace CIL2CPP.Core.CodeGen;
+
+/// <summary>
+/// Streams one generated file to disk while hashing it, so large method partitions never
+/// exist as a single string. Content goes to "&lt;path&gt;.tmp"; <see cref="Commit"/> compares
+/// the SHA-256 with the existing file and only replaces it when the content changed, leaving
+/// unchanged files (and their timestamps) alone so CMake/ninja skip recompiling them.
+/// Not thread-safe: one writer per file, one thread per writer.
+/// </summary>
+public sealed class GeneratedFileWriter : IDisposable
+{
+    private static readonly UTF8Encoding Utf8NoBom = new(encoderShouldEmitUTF8Identifier: false);
+    private const int BufferSize = 1 << 16;
+
+    private readonly string _path;
+    private readonly string _tempPath;
+    private readonly HashingStream _stream;
+    private readonly StreamWriter _writer;
+    private bool _committed;
+
+    public GeneratedFileWriter(string path)
+    {
+        _path = path;
+        _tempPath = path + ".tmp";
+        _stream = new HashingStream(new FileStream(_tempPath, FileMode.Create, FileAccess.Write,
+            FileShare.None, BufferSize));
+        _writer = new StreamWriter(_stream, Utf8NoBom, BufferSize);
+    }
+
+    /// <summary>SHA-256 of the written content (lowercase hex). Valid after <see cref="Commit"/>.</summary>
+    public string Hash { get; private set; } = "";
+
+    public void Write(string text) => _writer.Write(text);
+
+    /// <summary>Append the builder's chunks without materializing it as a string.</summary>
+    public void Write(StringBuilder sb) => _writer.Write(sb);
+
+    /// <summary>
+    /// Finish the file. Returns true if the target was (re)written, false if it already
+    /// held identical content.
+    /// </summary>
+    public bool Commit()
+    {
+        _writer.Flush();
+        Hash = Convert.ToHexString(_stream.GetHash()).ToLowerInvariant();
+        long length = _stream.Length;
+        _writer.Dispose();
+        _committed = true;
+
+        if (File.Exists(_path) && new FileInfo(_path).Length == length && HashFile(_path) == Hash)
+        {
+            File.Delete(_tempPath);
+            return false;
+        }
+        File.Move(_tempPath, _path, overwrite: true);
+        return true;
+    }
+
+    public void Dispose()
+    {
+        if (_committed) return;
+        // Abandoned (exception during rendering): never leave a partial file behind
+        _writer.Dispose();
+        File.Delete(_tempPath);
+    }
+
+    private static string HashFile(string path)
+    {
+        using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read, BufferSize);
+        return Convert.ToHexString(SHA256.HashData(stream)).ToLowerInvariant();
+    }
+
+    /// <summary>Write-only pass-through stream that hashes and counts every byte.</summary>
+    private sealed class HashingStream : Stream
+    {
+        private readonly Stream _inner;
+        private readonly IncrementalHash _hash = IncrementalHash.CreateHash(HashAlgorithmName.SHA256);
+        private long _length;
+
+        public HashingStream(Stream inner) => _inner = inner;
+
+        public byte[] GetHash() => _hash.GetHashAndReset();
+
+        public override bool CanRead => false;
+        public override bool CanSeek => false;
+        public override bool CanWrite => true;
+        public override long Length => _length;
+
+        public override long Position
+        {
+            get => _length;
+            set => throw new NotSupportedException();
+        }
+
+        public override void Write(byte[] buffer, int offset, int count)
+            => Write(buffer.AsSpan(offset, count));
+
+        public override void Write(ReadOnlySpan<byte> buffer)
+        {
+            _hash.AppendData(buffer);
+            _inner.Write(buffer);
+            _length += buffer.Length;
+        }
+
+        public override void Flush() => _inner.Flush();
+        public override int Read(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+        public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+        public override void SetLength(long value) => throw new NotSupportedException();
+
+        protected override void Dispose(bool disposing)
+        {
+            if (disposing)
+            {
+                _inner.Dispose();
+                _hash.Dispose();
+            }
+            base.Dispose(disposing);
+        }
+    }
+}
@@ -0,0 +1,216 @@
+using System.Diagnostics;
+using System.Text;
+using System.Text.Json;
+
+namespace CIL2CPP.Core;
+
+/// <summary>
+/// Per-phase wall time and memory for one compilation (<c>--timings</c>).
+///
+/// Phases are opened with <see cref="Begin"/> and closed with <see cref="Phase.Stop"/>.
+/// Nesting is derived from time intervals (a phase that starts and ends inside another is its
+/// child), so callers never pass parent handles around. Recording is always on and costs a
+/// few dozen entries per run; the CLI only prints the report when <c>--timings</c> is given.
+///
+/// Memory columns: Alloc = bytes allocated on all threads during the phase
+/// (<see cref="GC.GetTotalAllocatedBytes"/>), Heap = managed heap size when the phase ended.
+/// </summary>
+public sealed class CompilationTimings
+{
+    public sealed record Entry(
+        string Name,
+        int Sequence,
+        TimeSpan Start,
+        TimeSpan Elapsed,
+        long AllocatedBytes,
+        long HeapBytes,
+        string? Detail)
+    {
+        public TimeSpan End => Start + Elapsed;
+    }
+
+    /// <summary>An open phase. <see cref="Stop"/> records it; later calls are ignored.</summary>
+    public sealed class Phase
+    {
+        private readonly CompilationTimings _owner;
+        private readonly string _name;
+        private readonly int _sequence;
+        private readonly TimeSpan _start;
+        private readonly long _startAllocated;
+        private readonly Stopwatch _sw = Stopwatch.StartNew();
+        private int _stopped;
+
+        internal Phase(CompilationTimings owner, string name, int sequence)
+        {
+            _owner = owner;
+            _name = name;
+            _sequence = sequence;
+            _start = owner._clock.Elapsed;
+            _startAllocated = GC.GetTotalAllocatedBytes(false);
+        }
+
+        public long ElapsedMilliseconds => _sw.ElapsedMilliseconds;
+
+        public TimeSpan Elapsed => _sw.Elapsed;
+
+        public void Stop(string? detail = null)
+        {
+            if (Interlocked.Exchange(ref _stopped, 1) != 0) return;
+            _sw.Stop();
+            _owner.Add(new Entry(_name, _sequence, _start, _sw.Elapsed,
+                GC.GetTotalAllocatedBytes(false) - _startAllocated, GC.GetTotalMemory(false), detail));
+        }
+    }
+
+    private readonly Stopwatch _clock = Stopwatch.StartNew();
+    private readonly List<Entry> _entries = new();
+    private readonly List<(string Name, string Detail)> _notes = new();
+    private int _nextSequence;
+
+    public Phase Begin(string name) => new(this, name, Interlocked.Increment(ref _nextSequence));
+
+    /// <summary>Record a count-only fact that has no duration (e.g. "Resource strings: 12").</summary>
+    public void Note(string name, string detail)
+    {
+        lock (_notes) _notes.Add((name, detail));
+    }
+
+    /// <summary>Recorded phases in start order.</summary>
+    public IReadOnlyList<Entry> Entries
+    {
+        get
+        {
+            lock (_entries)
+                return _entries.OrderBy(e => e.Start).ThenBy(e => e.Sequence).ToList();
+        }
+    }
+
+    public IReadOnlyList<(string Name, string Detail)> Notes
+    {
+        get { lock (_notes) return _notes.ToList(); }
+    }
+
+    private void Add(Entry entry)
+    {
+        lock (_entries) _entries.Add(entry);
+    }
+
+    /// <summary>Nesting depth of each entry: number of earlier-started entries enclosing it.</summary>
+    internal static int[] ComputeDepths(IReadOnlyList<Entry> entries)
+    {
+        var depths = new int[entries.Count];
+        for (int i = 0; i < entries.Count; i++)
+        {
+            for (int j = 0; j < i; j++)
+            {
+                if (entries[j].Start <= entries[i].Start && entries[j].End >= entries[i].End)
+                    depths[i]++;
+            }
+        }
+        return depths;
+    }
+
+    /// <summary>A report row: one phase, or several same-named calls under the same parent.</summary>
+    internal sealed record Row(string Name, int Depth, int Calls, TimeSpan Elapsed,
+        long AllocatedBytes, long HeapBytes, string? Detail);
+
+    /// <summary>
+    /// Collapse repeated phases (e.g. CreateGenericSpecializations runs once per deferred-body
+    /// iteration) into one row per (parent row, name), summing time and allocations.
+    /// </summary>
+    internal static List<Row> BuildRows(IReadOnlyList<Entry> entries)
+    {
+        var depths = ComputeDepths(entries);
+        var rows = new List<Row>();
+        var rowOfEntry = new int[entries.Count];
+        var rowByKey = new Dictionary<(int ParentRow, string Name), int>();
+        var openParents = new List<int>(); // entry index of the enclosing phase at each depth
+
+        for (int i = 0; i < entries.Count; i++)
+        {
+            var e = entries[i];
+            int depth = depths[i];
+            if (openParents.Count > depth) openParents.RemoveRange(depth, openParents.Count - depth);
+            int parentRow = depth > 0 && openParents.Count >= depth ? rowOfEntry[openParents[depth - 1]] : -1;
+
+            if (rowByKey.TryGetValue((parentRow, e.Name), out var r))
+            {
+                var row = rows[r];
+                rows[r] = row with
+                {
+                    Calls = row.Calls + 1,
+                    Elapsed = row.Elapsed + e.Elapsed,
+                    AllocatedBytes = row.AllocatedBytes + e.AllocatedBytes,
+                    HeapBytes = e.HeapBytes,
+                    Detail = e.Detail,
+                };
+            }
+            else
+            {
+                r = rows.Count;
+                rowByKey[(parentRow, e.Name)] = r;
+                rows.Add(new Row(e.Name, depth, 1, e.Elapsed, e.AllocatedBytes, e.HeapBytes, e.Detail));
+            }
+            rowOfEntry[i] = r;
+            openParents.Add(i);
+        }
+        return rows;
+    }
+
+    /// <summary>Human-readable table, one row per phase, children indented under parents.</summary>
+    public string FormatReport()
+    {
+        var rows = BuildRows(Entries);
+        var labels = rows.Select(r => new string(' ', r.Depth * 2) + r.Name
+            + (r.Calls > 1 ? $" (x{r.Calls})" : "")).ToList();
+        int nameWidth = Math.Max(40, labels.Count > 0 ? labels.Max(l => l.Length) : 0);
+
+        var sb = new StringBuilder();
+        sb.AppendLine("Timings:");
+        sb.AppendLine($"  {"Phase".PadRight(nameWidth)} {"Time(ms)",10} {"Alloc(MB)",10} {"Heap(MB)",10}  Detail");
+        for (int i = 0; i < rows.Count; i++)
+        {
+            var r = rows[i];
+            var line = $"  {labels[i].PadRight(nameWidth)} {r.Elapsed.TotalMilliseconds,10:F0} " +
+                $"{ToMB(r.AllocatedBytes),10:F1} {ToMB(r.HeapBytes),10:F1}  {r.Detail}";
+            sb.AppendLine(line.TrimEnd());
+        }
+        foreach (var (name, detail) in Notes)
+            sb.AppendLine($"  {name}: {detail}");
+
+        using var process = Process.GetCurrentProcess();
+        sb.AppendLine($"  Total: {_clock.Elapsed.TotalMilliseconds:F0}ms, " +
+            $"allocated {ToMB(GC.GetTotalAllocatedBytes(false)):F1} MB, " +
+            $"peak working set {ToMB(process.PeakWorkingSet64):F1} MB, " +
+            $"gen0/1/2 collections {GC.CollectionCount(0)}/{GC.CollectionCount(1)}/{GC.CollectionCount(2)}");
+        return sb.ToString();
+    }
+
+    /// <summary>Same data as <see cref="FormatReport"/>, for tooling (tools/dev.py, CI trend tracking).</summary>
+    public string ToJson()
+    {
+        var entries = Entries;
+        var depths = ComputeDepths(entries);
+        using var process = Process.GetCurrentProcess();
+        var report = new
+        {
+            totalMs = _clock.Elapsed.TotalMilliseconds,
+            allocatedBytes = GC.GetTotalAllocatedBytes(false),
+            peakWorkingSetBytes = process.PeakWorkingSet64,
+            phases = entries.Select((e, i) => new
+            {
+                name = e.Name,
+                depth = depths[i],
+                startMs = e.Start.TotalMilliseconds,
+                elapsedMs = e.Elapsed.TotalMilliseconds,
+                allocatedBytes = e.AllocatedBytes,
+                heapBytes = e.HeapBytes,
+                detail = e.Detail,
+            }),
+            notes = Notes.Select(n => new { name = n.Name, detail = n.Detail }),
+        };
+        return JsonSerializer.Serialize(report, new JsonSerializerOptions { WriteIndented = true });
+    }
+
+    private static double ToMB(long bytes) => bytes / (1024.0 * 1024.0);
+}
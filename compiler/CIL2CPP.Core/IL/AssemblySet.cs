@@ -33,18 +33,22 @@ public class AssemblySet : IDisposable
     /// <summary>Name of the root assembly.</summary>
     public string RootAssemblyName => RootAssembly.Name.Name;
 
+    /// <summary>Where referenced assemblies are looked up for this root.</summary>
+    public AssemblySearchPaths SearchPaths { get; }
+
     /// <summary>
-    /// Create an AssemblySet from a root DLL path.
-    /// Discovers dependencies via deps.json and runtimeconfig.json.
+    /// Compute the resolver's search directories for a root DLL without loading anything:
+    /// the root's directory, NuGet package directories from deps.json, then the .NET
+    /// runtime directory chosen from runtimeconfig.json.
     /// </summary>
-    public AssemblySet(string rootDllPath, BuildConfiguration? config = null)
+    public static AssemblySearchPaths DiscoverSearchPaths(string rootDllPath)
     {
-        _rootAssemblyDir = Path.GetDirectoryName(Path.GetFullPath(rootDllPath))!;
-        _resolver = new CIL2CPPAssemblyResolver();
-        _resolver.AddSearchDirectory(_rootAssemblyDir);
+        var rootDir = Path.GetDirectoryName(Path.GetFullPath(rootDllPath))!;
+        var directories = new List<string> { rootDir };
+        var packageNames = new HashSet<string>();
 
         // Discover NuGet package names from deps.json
-        var depsJsonPath = Path.Combine(_rootAssemblyDir,
+        var depsJsonPath = Path.Combine(rootDir,
             Path.GetFileNameWithoutExtension(rootDllPath) + ".deps.json");
         if (File.Exists(depsJsonPath))
         {
@@ -52,7 +56,7 @@ public class AssemblySet : IDisposable
             foreach (var lib in deps)
             {
                 if (lib.Type == "package")
-                    _packageNames.Add(lib.Name);
+                    packageNames.Add(lib.Name);
             }
 
             // Add resolved NuGet package paths as search directories
@@ -60,15 +64,33 @@ public class AssemblySet : IDisposable
             foreach (var pkgPath in packagePaths)
             {
                 var pkgDir = Path.GetDirectoryName(pkgPath);
-                if (pkgDir != null)
-                    _resolver.AddSearchDirectory(pkgDir);
+                if (pkgDir != null && !directories.Contains(pkgDir))
+                    directories.Add(pkgDir);
             }
         }
 
         // Add .NET runtime directory for BCL resolution
-        _runtimeDir = RuntimeLocator.FindRuntimeDirectory(rootDllPath);
-        if (_runtimeDir != null)
-            _resolver.AddSearchDirectory(_runtimeDir);
+        var runtimeDir = RuntimeLocator.FindRuntimeDirectory(rootDllPath);
+        if (runtimeDir != null && !directories.Contains(runtimeDir))
+            directories.Add(runtimeDir);
+
+        return new AssemblySearchPaths(directories, runtimeDir, packageNames);
+    }
+
+    /// <summary>
+    /// Create an AssemblySet from a root DLL path.
+    /// Discovers dependencies via deps.json and runtimeconfig.json.
+    /// </summary>
+    public AssemblySet(string rootDllPath, BuildConfiguration? config = null)
+    {
+        _rootAssemblyDir = Path.GetDirectoryName(Path.GetFullPath(rootDllPath))!;
+        _resolver = new CIL2CPPAssemblyResolver();
+
+        SearchPaths = DiscoverSearchPaths(rootDllPath);
+        foreach (var dir in SearchPaths.Directories)
+            _resolver.AddSearchDirectory(dir);
+        _packageNames.UnionWith(SearchPaths.PackageNames);
+        _runtimeDir = SearchPaths.RuntimeDirectory;
 
         // Load the root assembly
         var readSymbols = config?.ReadDebugSymbols ?? false;
@@ -207,3 +229,25 @@ public class AssemblySet : IDisposable
         _loadedAssemblies.Clear();
     }
 }
+
+/// <summary>
+/// Ordered search directories of an <see cref="AssemblySet"/>; the first directory holding
+/// &lt;name&gt;.dll wins, as in <see cref="CIL2CPPAssemblyResolver"/>.
+/// </summary>
+public sealed record AssemblySearchPaths(
+    IReadOnlyList<string> Directories,
+    string? RuntimeDirectory,
+    IReadOnlySet<string> PackageNames)
+{
+    /// <summary>Path the resolver would load <paramref name="assemblyName"/> from, or null.</summary>
+    public string? Locate(string assemblyName)
+    {
+        foreach (var dir in Directories)
+        {
+            var candidate = Path.Combine(dir, assemblyName + ".dll");
+            if (File.Exists(candidate))
+                return Path.GetFullPath(candidate);
+        }
+        return null;
+    }
+}
@@ -68,12 +68,17 @@ public static class CppNameMapper
         ["System.ArrayTypeMismatchException"] = "cil2cpp::ArrayTypeMismatchException",
         ["System.TypeInitializationException"] = "cil2cpp::TypeInitializationException",
         ["System.TimeoutException"] = "cil2cpp::TimeoutException",
+        ["System.ApplicationException"] = "cil2cpp::ApplicationException",
         // Task-related
         ["System.AggregateException"] = "cil2cpp::AggregateException",
         ["System.OperationCanceledException"] = "cil2cpp::OperationCanceledException",
         ["System.Threading.Tasks.TaskCanceledException"] = "cil2cpp::TaskCanceledException",
         // Collections
         ["System.Collections.Generic.KeyNotFoundException"] = "cil2cpp::KeyNotFoundException",
+        // Threading
+        ["System.Threading.SemaphoreFullException"] = "cil2cpp::SemaphoreFullException",
+        // Reflection
+        ["System.Reflection.TargetParameterCountException"] = "cil2cpp::TargetParameterCountException",
         // IO
         ["System.IO.IOException"] = "cil2cpp::IOException",
         ["System.IO.FileNotFoundException"] = "cil2cpp::FileNotFoundException",
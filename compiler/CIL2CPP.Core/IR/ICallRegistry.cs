@@ -220,6 +220,7 @@ public static class ICallRegistry
         RegisterICall("System.Threading.Monitor", "Wait", 2, "cil2cpp::icall::Monitor_Wait");
         RegisterICall("System.Threading.Monitor", "Pulse", 1, "cil2cpp::icall::Monitor_Pulse");
         RegisterICall("System.Threading.Monitor", "PulseAll", 1, "cil2cpp::icall::Monitor_PulseAll");
+        RegisterICall("System.Threading.Monitor", "get_LockContentionCount", 0, "cil2cpp::icall::Monitor_get_LockContentionCount");
 
         // ===== System.Threading.Interlocked =====
         RegisterICallTyped("System.Threading.Interlocked", "Increment", 1, "System.Int32&", "cil2cpp::icall::Interlocked_Increment_i32");
@@ -290,6 +291,7 @@ public static class ICallRegistry
         RegisterICall("System.Environment", "get_ProcessorCount", 0, "cil2cpp::icall::Environment_get_ProcessorCount");
         RegisterICall("System.Environment", "GetProcessorCount", 0, "cil2cpp::icall::Environment_get_ProcessorCount");
         RegisterICall("System.Environment", "get_CurrentManagedThreadId", 0, "cil2cpp::icall::Environment_get_CurrentManagedThreadId");
+        RegisterICall("System.Environment", "get_WorkingSet", 0, "cil2cpp::icall::Environment_get_WorkingSet");
         RegisterICall("System.Environment", "Exit", 1, "cil2cpp::icall::Environment_Exit");
         RegisterICall("System.Environment", "GetCommandLineArgs", 0, "cil2cpp::icall::Environment_GetCommandLineArgs");
         RegisterICall("System.Environment", "GetEnvironmentVariable", 1, "cil2cpp::icall::Environment_GetEnvironmentVariable");
@@ -306,6 +308,14 @@ public static class ICallRegistry
         RegisterICall("System.GC", "GetMemoryInfo", 2, "cil2cpp::gc_get_memory_info"); // fills GCMemoryInfoData with BoehmGC stats
         // AllocateUninitializedArray<T> is a compiler intrinsic (IRBuilder.Emit.cs) — no ICall needed
         RegisterICall("System.GC", "GetAllocatedBytesForCurrentThread", 0, "cil2cpp::gc_get_total_memory_simple");
+        // Runtime counters (System.Runtime EventCounters / RuntimeMetrics poll these)
+        RegisterICall("System.GC", "CollectionCount", 1, "cil2cpp::gc_collection_count");
+        RegisterICall("System.GC", "GetTotalAllocatedBytes", 1, "cil2cpp::gc_get_total_allocated_bytes");
+        RegisterICall("System.GC", "_GetTotalPauseDuration", 0, "cil2cpp::gc_get_total_pause_duration");
+        RegisterICall("System.Exception", "GetExceptionCount", 0, "cil2cpp::exception_get_count");
+        // AppDomain.FirstChanceException forwards here; the runtime raises it from throw_exception
+        RegisterICall("System.AppContext", "add_FirstChanceException", 1, "cil2cpp::exception_add_first_chance_handler");
+        RegisterICall("System.AppContext", "remove_FirstChanceException", 1, "cil2cpp::exception_remove_first_chance_handler");
 
         // ===== System.Buffer =====
         RegisterICall("System.Buffer", "Memmove", 3, "cil2cpp::icall::Buffer_Memmove");
@@ -320,6 +330,17 @@ public static class ICallRegistry
         RegisterICall("System.Runtime.InteropServices.GCHandle", "InternalSet", 2, "cil2cpp::icall::GCHandle_InternalSet");
         RegisterICall("System.Runtime.InteropServices.GCHandle", "InternalGet", 1, "cil2cpp::icall::GCHandle_InternalGet");
 
+        // ===== System.Runtime.DependentHandle (ConditionalWeakTable ephemerons) =====
+        // InternalGetTarget has a managed Release body that dereferences the handle as an
+        // object slot — our handles are table indices, so it is mapped like the rest.
+        RegisterICall("System.Runtime.DependentHandle", "InternalInitialize", 2, "cil2cpp::icall::DependentHandle_InternalInitialize");
+        RegisterICall("System.Runtime.DependentHandle", "InternalGetTarget", 1, "cil2cpp::icall::DependentHandle_InternalGetTarget");
+        RegisterICall("System.Runtime.DependentHandle", "InternalGetDependent", 1, "cil2cpp::icall::DependentHandle_InternalGetDependent");
+        RegisterICall("System.Runtime.DependentHandle", "InternalGetTargetAndDependent", 2, "cil2cpp::icall::DependentHandle_InternalGetTargetAndDependent");
+        RegisterICall("System.Runtime.DependentHandle", "InternalSetDependent", 2, "cil2cpp::icall::DependentHandle_InternalSetDependent");
+        RegisterICall("System.Runtime.DependentHandle", "InternalSetTargetToNull", 1, "cil2cpp::icall::DependentHandle_InternalSetTargetToNull");
+        RegisterICall("System.Runtime.DependentHandle", "InternalFree", 1, "cil2cpp::icall::DependentHandle_InternalFree");
+
         // ===== System.Runtime.InteropServices.Marshal =====
         RegisterICall("System.Runtime.InteropServices.Marshal", "AllocHGlobal", 1, "cil2cpp::icall::Marshal_AllocHGlobal");
         RegisterICall("System.Runtime.InteropServices.Marshal", "FreeHGlobal", 1, "cil2cpp::icall::Marshal_FreeHGlobal");
@@ -353,6 +374,28 @@ public static class ICallRegistry
 
         // ===== WaitHandle =====
         RegisterICall("System.Threading.WaitHandle", "WaitOneCore", 2, "cil2cpp::icall::WaitHandle_WaitOneCore");
+        // WaitAny/WaitAll (≤64 handles) and SignalAndWait — native multi-object waits
+        RegisterICall("System.Threading.WaitHandle", "WaitMultipleIgnoringSyncContext", 4, "cil2cpp::icall::WaitHandle_WaitMultipleIgnoringSyncContext");
+        RegisterICall("System.Threading.WaitHandle", "SignalAndWaitNative", 3, "cil2cpp::icall::WaitHandle_SignalAndWaitNative");
+
+        // ===== SemaphoreSlim / ManualResetEventSlim =====
+        // Wait/Release/Set/Reset are runtime-native (CAS + spin + futex park) instead of the
+        // BCL's Monitor.Wait/PulseAll; the other overloads funnel into these from IL.
+        RegisterICallTyped("System.Threading.SemaphoreSlim", "Wait", 2, "System.Int32", "cil2cpp::icall::SemaphoreSlim_Wait");
+        RegisterICallTyped("System.Threading.SemaphoreSlim", "WaitAsync", 2, "System.Int32", "cil2cpp::icall::SemaphoreSlim_WaitAsync");
+        RegisterICall("System.Threading.SemaphoreSlim", "Release", 1, "cil2cpp::icall::SemaphoreSlim_Release");
+        // Dispose cancels the runtime's queued WaitAsync nodes (the BCL just drops its own)
+        RegisterICall("System.Threading.SemaphoreSlim", "Dispose", 1, "cil2cpp::icall::SemaphoreSlim_Dispose");
+        RegisterICall("System.Threading.ManualResetEventSlim", "Set", 0, "cil2cpp::icall::ManualResetEventSlim_Set");
+        RegisterICall("System.Threading.ManualResetEventSlim", "Set", 1, "cil2cpp::icall::ManualResetEventSlim_Set_Cancellation");
+        RegisterICall("System.Threading.ManualResetEventSlim", "Reset", 0, "cil2cpp::icall::ManualResetEventSlim_Reset");
+        RegisterICallTyped("System.Threading.ManualResetEventSlim", "Wait", 2, "System.Int32", "cil2cpp::icall::ManualResetEventSlim_Wait");
+
+        // ===== CancellationTokenSource =====
+        // Cancel/CancelAfter/linked sources funnel into NotifyCancellation; the ICall runs the
+        // compiled transition and callbacks (registered at startup) around the runtime's wakes
+        RegisterICall("System.Threading.CancellationTokenSource", "NotifyCancellation", 1,
+            "cil2cpp::icall::CancellationTokenSource_NotifyCancellation");
 
         // ===== System.IO =====
         // File, Path, and Directory methods compile from BCL IL.
@@ -748,6 +791,12 @@ public static class ICallRegistry
             "cil2cpp::icall::ThreadPool_RequestWorkerThread"); // same impl
         RegisterICall("System.Threading.ThreadPool", "BindHandlePortableCore", 1,
             "cil2cpp::icall::ThreadPool_BindHandlePortableCore");
+        RegisterICall("System.Threading.ThreadPool", "get_ThreadCount", 0,
+            "cil2cpp::icall::ThreadPool_get_ThreadCount");
+        RegisterICall("System.Threading.ThreadPool", "get_PendingWorkItemCount", 0,
+            "cil2cpp::icall::ThreadPool_get_PendingWorkItemCount");
+        RegisterICall("System.Threading.ThreadPool", "get_CompletedWorkItemCount", 0,
+            "cil2cpp::icall::ThreadPool_get_CompletedWorkItemCount");
 
         // ===== System.Threading.Interlocked (additional) =====
         RegisterICallTyped("System.Threading.Interlocked", "ExchangeAdd", 2, "System.Int32&",
@@ -774,6 +823,7 @@ public static class ICallRegistry
         RegisterICall("Interop/Globalization", "EndsWith", 7, "cil2cpp::interop_globalization_ends_with");
         RegisterICall("Interop/Globalization", "GetSortHandle", 2, "cil2cpp::interop_globalization_get_sort_handle");
         RegisterICall("Interop/Globalization", "CloseSortHandle", 1, "cil2cpp::interop_globalization_close_sort_handle");
+        RegisterICall("Interop/Globalization", "GetSortKey", 6, "cil2cpp::interop_globalization_get_sort_key");
         RegisterICall("Interop/Globalization", "GetLocaleName", 3, "cil2cpp::interop_globalization_get_locale_name");
         RegisterICall("Interop/Globalization", "GetLocaleInfoString", 5, "cil2cpp::interop_globalization_get_locale_info_string");
         RegisterICall("Interop/Globalization", "GetLocaleInfoInt", 3, "cil2cpp::interop_globalization_get_locale_info_int");
@@ -1605,8 +1605,8 @@ public partial class IRBuilder
         if (TryEmitSpanHelpersSearch(block, stack, methodRef, ref tempCounter))
             return;
 
-        // BitOperations intrinsics — PopCount/ResetLowestSetBit use X86.Popcnt hardware
-        // intrinsics that are unavailable in AOT. Replace with portable C++ equivalents.
+        // BitOperations intrinsics — PopCount/ResetLowestSetBit/Crc32C use X86/Arm hardware
+        // intrinsics that are unavailable in AOT. Replace with C++ runtime equivalents.
         if (TryEmitBitOperationsIntrinsic(block, stack, methodRef, ref tempCounter))
             return;
 
@@ -5158,9 +5158,76 @@ public partial class IRBuilder
             return true;
         }
 
+        // Crc32C(uint32, uint8/uint16/uint32/uint64) → cil2cpp::bit_crc32c_u8..u64
+        // (SSE4.2 / ARMv8 CRC32C instructions when the CPU has them, table walk otherwise)
+        if (name == "Crc32C" && paramCount == 2)
+        {
+            var (suffix, dataType) = methodRef.Parameters[1].ParameterType.FullName switch
+            {
+                "System.Byte" => ("u8", "uint8_t"),
+                "System.UInt16" => ("u16", "uint16_t"),
+                "System.UInt32" => ("u32", "uint32_t"),
+                "System.UInt64" => ("u64", "uint64_t"),
+                _ => (null, null),
+            };
+            if (suffix == null) return false;
+            var data = stack.PopExpr();
+            var crc = stack.PopExpr();
+            var tmp = $"__t{tempCounter++}";
+            block.Instructions.Add(new IRRawCpp
+            {
+                Code = $"auto {tmp} = cil2cpp::bit_crc32c_{suffix}((uint32_t)({crc}), ({dataType})({data}));",
+                ResultVar = tmp,
+                ResultTypeCpp = "uint32_t",
+            });
+            stack.Push(new StackEntry(tmp, "uint32_t"));
+            return true;
+        }
+
         return false;
     }
 
+    /// <summary>
+    /// Array.Sort/List.Sort of strings with a comparer all funnel into
+    /// ArraySortHelper&lt;string&gt;.IntrospectiveSort(Span&lt;string&gt;, Comparison&lt;string&gt;).
+    /// Open a guard in front of that call: when the comparison is a culture comparer, the
+    /// runtime sorts by precomputed ICU sort keys and the comparison sort is skipped.
+    /// Returns true if the guard was opened; the caller closes it after emitting the call.
+    /// </summary>
+    private bool TryEmitCultureSortKeyGuard(IRBasicBlock block, Stack<StackEntry> stack,
+        MethodReference methodRef)
+    {
+        if (methodRef.Name != "IntrospectiveSort" || methodRef.Parameters.Count != 2
+            || stack.Count < 2
+            || methodRef.DeclaringType is not GenericInstanceType git
+            || git.ElementType.FullName != "System.Collections.Generic.ArraySortHelper`1")
+            return false;
+        // Shared (__Canon) bodies qualify too: the runtime checks the elements are strings
+        var elemIlName = ResolveTypeRefOperand(git.GenericArguments[0]);
+        if (elemIlName is not ("System.String" or "__Canon")) return false;
+
+        // Opaque Span stubs have no fields to read the elements from
+        if (!_typeCache.TryGetValue($"System.Span`1<{elemIlName}>", out var spanType)
+            || !spanType.Fields.Any(f => f.Name is "_reference" or "f__reference"))
+            return false;
+
+        // Both arguments are referenced again by the guarded call: only plain variables
+        var comparison = stack.Peek().Expr;
+        var keys = stack.ElementAt(1).Expr;
+        if (!IsPlainIdentifier(comparison) || !IsPlainIdentifier(keys)) return false;
+
+        block.Instructions.Add(new IRRawCpp
+        {
+            Code = $"if (!cil2cpp::globalization::sort_strings_by_key(" +
+                $"(cil2cpp::String**){keys}.f__reference, {keys}.f__length, " +
+                $"(cil2cpp::Object*){comparison})) {{",
+        });
+        return true;
+
+        static bool IsPlainIdentifier(string expr)
+            => expr.Length > 0 && !char.IsDigit(expr[0]) && expr.All(c => char.IsLetterOrDigit(c) || c == '_');
+    }
+
     /// <summary>
     /// Intercept MemoryMarshal JIT intrinsics at call sites.
     /// Their IL bodies use Unsafe.*/RuntimeHelpers.* which are also JIT intrinsics,
@@ -571,6 +571,17 @@ public partial class IRBuilder
     /// </summary>
     private void EnsureComparerCompanionType(string openTypeName, List<string> typeArgs)
     {
+        // IEnumerable<T>.GetEnumerator on a T[] is array_iface_get_enumerator, which looks up
+        // SZGenericArrayEnumerator<T> by name. Its SZGenericArrayEnumerator<Object> fallback
+        // only fits reference elements, so value-type elements need their own specialization
+        // (e.g. the Measurement<T>[] ObservableInstrument<T>.Observe returns).
+        if (openTypeName == "System.Collections.Generic.IEnumerable`1"
+            && typeArgs.Count == 1 && CppNameMapper.IsValueType(typeArgs[0]))
+        {
+            EnsureGenericCompanionInstantiation("System.SZGenericArrayEnumerator`1", typeArgs);
+            return;
+        }
+
         // Determine which companion types are needed for AOT.
         // BCL factory methods use MakeGenericType + CreateInstanceForAnotherGenericParameter
         // at runtime, so we must pre-generate all possible result types.
@@ -671,6 +682,35 @@ public partial class IRBuilder
             companionOpenName, typeArgs, companionMangled, companionCecil));
     }
 
+    /// <summary>
+    /// Instantiate the Meter factories and Func callbacks the runtime calls from C++ to
+    /// publish the "System.Runtime" meter (see <see cref="RuntimeMeter"/>). No IL names
+    /// these instantiations, so Pass 0 would not find them.
+    /// </summary>
+    private void SeedRuntimeMeterInstantiations()
+    {
+        var meter = _allTypes.FirstOrDefault(t => t.FullName == RuntimeMeter.MeterTypeName)?.GetCecilType();
+        var ctor = meter != null ? RuntimeMeter.FindMeterConstructor(meter) : null;
+        if (ctor == null || !_reachability.IsReachable(ctor)) return;
+
+        var typeSystem = meter!.Module.TypeSystem;
+        TypeReference TypeArgument(string name) => name == "System.Double" ? typeSystem.Double : typeSystem.Int64;
+
+        foreach (var (methodName, typeArgument, _) in RuntimeMeter.Factories)
+        {
+            var factory = RuntimeMeter.FindFactory(meter, methodName);
+            if (factory == null || !_reachability.IsReachable(factory)) continue;
+
+            var instance = new GenericInstanceMethod(factory);
+            instance.GenericArguments.Add(TypeArgument(typeArgument));
+            CollectGenericMethod(instance);
+
+            var callback = new GenericInstanceType(((GenericInstanceType)factory.Parameters[1].ParameterType).ElementType);
+            callback.GenericArguments.Add(TypeArgument(typeArgument));
+            CollectGenericType(callback);
+        }
+    }
+
     /// <summary>
     /// Check if a type argument IL name refers to an enum type.
     /// Resolves through Cecil to check the base type chain.
@@ -2416,7 +2456,7 @@ public partial class IRBuilder
     {
         if (_pendingGenericKeys.Count == 0) return;
 
-        var specTotalSw = System.Diagnostics.Stopwatch.StartNew();
+        var specTotalSw = Timings.Begin("CreateGenericSpecializations");
         long firstPassMs = 0, nestedMs = 0, secondPassMs = 0;
         int totalBatches = 0, totalKeysProcessed = 0;
 
@@ -2722,10 +2762,8 @@ public partial class IRBuilder
 
         secondPassSw.Stop();
         secondPassMs = secondPassSw.ElapsedMilliseconds;
-        specTotalSw.Stop();
-        Console.Error.WriteLine($"[perf]   CreateGenericSpecializations: {specTotalSw.ElapsedMilliseconds}ms " +
-            $"(batches={totalBatches}, keys={totalKeysProcessed}, processed={allProcessed.Count}, " +
-            $"firstPass={firstPassMs}ms, nested={nestedMs}ms, secondPass={secondPassMs}ms)");
+        specTotalSw.Stop($"batches={totalBatches}, keys={totalKeysProcessed}, processed={allProcessed.Count}, " +
+            $"firstPass={firstPassMs}ms, nested={nestedMs}ms, secondPass={secondPassMs}ms");
     }
 
     /// <summary>
@@ -4382,9 +4420,11 @@ public partial class IRBuilder
         var parallelOpts = new ParallelOptions { MaxDegreeOfParallelism = Environment.ProcessorCount };
         int iterationCount = 0;
         long totalPhaseA = 0, totalPhaseB = 0, totalPhaseC = 0, totalVtable = 0;
+        var deferredSw = Timings.Begin("DeferredBodies");
         while (_deferredGenericBodies.Count > 0)
         {
             iterationCount++;
+            var iterationSw = Timings.Begin("DeferredBodies iteration");
             var batch = new List<(MethodDefinition CecilMethod, IRMethod IrMethod,
                 Dictionary<string, string> TypeParamMap)>(_deferredGenericBodies);
             _deferredGenericBodies.Clear();
@@ -4484,14 +4524,16 @@ public partial class IRBuilder
             phaseCSw.Stop();
             totalPhaseC += phaseCSw.ElapsedMilliseconds;
 
-            Console.Error.WriteLine($"[perf]   DeferredBodies iter {iterationCount}: batch={batch.Count}, " +
+            iterationSw.Stop($"batch={batch.Count}, " +
                 $"compiled={bodiesToCompile.Count}, phaseA={phaseASw.ElapsedMilliseconds}ms, " +
                 $"phaseB={phaseBSw.ElapsedMilliseconds}ms, phaseC={phaseCSw.ElapsedMilliseconds}ms " +
                 $"(recover={recoverSw.ElapsedMilliseconds} specType={specTypeSw} specMethod={specSw.ElapsedMilliseconds - specTypeSw} vt={vtPostSw.ElapsedMilliseconds}), " +
                 $"vtable={vtSw.ElapsedMilliseconds}ms, newDeferred={_deferredGenericBodies.Count}");
         }
-        Console.Error.WriteLine($"[perf] DeferredBodies total: {iterationCount} iterations, " +
-            $"phaseA={totalPhaseA}ms, phaseB={totalPhaseB}ms, phaseC={totalPhaseC}ms, vtable={totalVtable}ms");
+        // An empty queue records nothing (an unstopped phase is dropped)
+        if (iterationCount > 0)
+            deferredSw.Stop($"iterations={iterationCount}, " +
+                $"phaseA={totalPhaseA}ms, phaseB={totalPhaseB}ms, phaseC={totalPhaseC}ms, vtable={totalVtable}ms");
 
         // Post-condition: all deferred vtables must have been resolved.
         // If any remain, it indicates a bug in the deferral/resolution logic.
@@ -2393,7 +2393,10 @@ public partial class IRBuilder
                 var methodRef = (MethodReference)instr.Operand!;
                 var constrainedType = _ctx.Value.ConstrainedType;
                 _ctx.Value.ConstrainedType = null; // Consume the constrained prefix
+                bool sortKeyGuard = TryEmitCultureSortKeyGuard(block, stack, methodRef);
                 EmitMethodCall(block, stack, methodRef, instr.OpCode == Code.Callvirt, ref tempCounter, constrainedType);
+                if (sortKeyGuard)
+                    block.Instructions.Add(new IRRawCpp { Code = "}" });
                 break;
             }
 
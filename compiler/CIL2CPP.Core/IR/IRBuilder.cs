@@ -376,6 +376,12 @@ public partial class IRBuilder
         MethodDefinition CecilMethod
     );
 
+    /// <summary>
+    /// Per-pass timings (reported by the CLI with --timings). Share one instance across the
+    /// pipeline so IR passes nest under the caller's phases.
+    /// </summary>
+    public CompilationTimings Timings { get; init; } = new();
+
     public IRBuilder(AssemblyReader reader, BuildConfiguration? config = null)
     {
         _reader = reader;
@@ -464,6 +470,8 @@ public partial class IRBuilder
 
         // Pass reflection target types to IRModule for codegen filtering
         _module.ReflectionTargetTypes = reachability.ReflectionTargetTypes;
+        _module.TrimReflectionMetadata = true;
+        _module.UntrackedReflectionSite = reachability.UntrackedReflectionSite;
 
         // Pass constructed types to IRModule for TypeInfo tiering
         _module.ConstructedTypes = new HashSet<string>(reachability.ConstructedTypes.Select(t => t.FullName));
@@ -527,17 +535,16 @@ public partial class IRBuilder
         PreRegisterAllValueTypes();
 
         // Pass 0: Scan for generic instantiations in all method bodies
-        var pass0sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass0sw = Timings.Begin("Pass 0 ScanGenericInstantiations");
         ScanGenericInstantiations();
-        pass0sw.Stop();
-        Console.Error.WriteLine($"[perf] Pass 0 ScanGenericInstantiations: {pass0sw.ElapsedMilliseconds}ms, " +
-            $"types={_genericInstantiations.Count}, specMethodKeys={_calledSpecializedMethods.Count}");
+        SeedRuntimeMeterInstantiations();
+        pass0sw.Stop($"types={_genericInstantiations.Count}, specMethodKeys={_calledSpecializedMethods.Count}");
 
         // Pass 1: Create all type shells (no fields/methods yet)
         // Skip open generic types — they are templates, not concrete types
         // Partial classes (e.g., Interop.Kernel32) may span multiple assemblies —
         // reuse the existing IRType so methods from all assemblies merge onto one type.
-        var pass1sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass1sw = Timings.Begin("Pass 1 TypeShells");
         foreach (var typeDef in _allTypes)
         {
             if (typeDef.HasGenericParameters)
@@ -564,18 +571,15 @@ public partial class IRBuilder
         // (via EnsureBodyReferencedTypesExist in ConvertDeferredGenericBodies fixpoint).
         // This avoids the exponential blowup from scanning all methods of all discovered types.
 
-        pass1sw.Stop();
-        Console.Error.WriteLine($"[perf] Pass 1 TypeShells: {pass1sw.ElapsedMilliseconds}ms, types={_module.Types.Count}");
+        pass1sw.Stop($"types={_module.Types.Count}");
 
         // Pass 1.5: Create specialized types for each generic instantiation
-        var pass15sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass15sw = Timings.Begin("Pass 1.5 CreateGenericSpecializations");
         CreateGenericSpecializations();
-        pass15sw.Stop();
-        Console.Error.WriteLine($"[perf] Pass 1.5 CreateGenericSpecializations: {pass15sw.ElapsedMilliseconds}ms, " +
-            $"types={_module.Types.Count}, genericInstantiations={_genericInstantiations.Count}");
+        pass15sw.Stop($"types={_module.Types.Count}, genericInstantiations={_genericInstantiations.Count}");
 
         // Pass 2: Fill in fields, base types, interfaces
-        var pass2sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass2sw = Timings.Begin("Pass 2 PopulateTypeDetails+Interfaces+Cctor");
         foreach (var typeDef in _allTypes)
         {
             if (typeDef.HasGenericParameters) continue;
@@ -628,11 +632,10 @@ public partial class IRBuilder
         }
 
         pass2sw.Stop();
-        Console.Error.WriteLine($"[perf] Pass 2 PopulateTypeDetails+Interfaces+Cctor: {pass2sw.ElapsedMilliseconds}ms");
 
         // Pass 3: Create method shells (no body yet — needed for VTable)
         // Skip open generic methods — they are templates, specialized in Pass 3.5
-        var pass3sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass3sw = Timings.Begin("Pass 3 MethodShells+Disambig");
         var methodBodies = new List<(IL.MethodInfo MethodDef, IRMethod IRMethod)>();
         foreach (var typeDef in _allTypes)
         {
@@ -713,8 +716,7 @@ public partial class IRBuilder
         // (e.g. different C# enum types collapse to same C++ type via using aliases)
         DisambiguateOverloadedMethods();
 
-        pass3sw.Stop();
-        Console.Error.WriteLine($"[perf] Pass 3 MethodShells+Disambig: {pass3sw.ElapsedMilliseconds}ms, methods={methodBodies.Count}");
+        pass3sw.Stop($"methods={methodBodies.Count}");
 
         // Pass 3.3b: Build vtables for types discovered so far.
         // This enables virtual dispatch resolution in Pass 3.4/3.5 method body compilation.
@@ -722,16 +724,14 @@ public partial class IRBuilder
         // and fall back to direct calls, breaking polymorphic dispatch (e.g., Iterator_1.ToArray).
         // BuildVTable is idempotent (skips if already built), so Pass 4 safely handles
         // any new types created in Pass 3.6.
-        var pass34sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass34sw = Timings.Begin("Pass 3.3b-3.4 VTable+DeferredBodies");
         BuildVTablesFixpoint();
 
         // Pass 3.4: Convert deferred generic specialization bodies.
         // Must happen AFTER disambiguation (Pass 3.3) so that call sites in generic method
         // bodies resolve to the correct disambiguated function names.
         ConvertDeferredGenericBodies();
-        pass34sw.Stop();
-        Console.Error.WriteLine($"[perf] Pass 3.3b-3.4 VTable+DeferredBodies: {pass34sw.ElapsedMilliseconds}ms, " +
-            $"types={_module.Types.Count}, deferredRemaining={_deferredGenericBodies.Count}");
+        pass34sw.Stop($"types={_module.Types.Count}, deferredRemaining={_deferredGenericBodies.Count}");
 
         // Post-3.4: Re-evaluate HasCctor for GENERIC types whose cctor body was never compiled.
         // CreateGenericSpecializations sets HasCctor=true when the cctor is in _deferredGenericBodies,
@@ -749,7 +749,7 @@ public partial class IRBuilder
         }
 
         // Pass 3.5: Create specialized methods for each generic method instantiation
-        var pass35sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass35sw = Timings.Begin("Pass 3.5-3.5b GenericMethodSpecs+Drain");
         CreateGenericMethodSpecializations();
 
         // Pass 3.5a: Recover specialized methods whose keys were added during Pass 3.5.
@@ -770,9 +770,7 @@ public partial class IRBuilder
             DisambiguateOverloadedMethods();
             ConvertDeferredGenericBodies();
         }
-        pass35sw.Stop();
-        Console.Error.WriteLine($"[perf] Pass 3.5-3.5b GenericMethodSpecs+Drain: {pass35sw.ElapsedMilliseconds}ms, " +
-            $"types={_module.Types.Count}");
+        pass35sw.Stop($"types={_module.Types.Count}");
 
         // Pass 3.6: Post-specialization cleanup (demand-driven replaced bulk scanning).
         // Ensure disambiguation is up to date for types created during 3.4/3.5/3.5b.
@@ -803,7 +801,7 @@ public partial class IRBuilder
 
         // Pass 4: Build vtables for new types from Pass 3.6 (re-discovery).
         // Types from Pass 3.3b already have VTables (BuildVTable is idempotent).
-        var pass45sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass45sw = Timings.Begin("Pass 4-5.5 VTable+InterfaceImpls+Attrs");
         BuildVTablesFixpoint();
 
         // Pass 4.5: Re-resolve interfaces for non-generic types.
@@ -845,12 +843,11 @@ public partial class IRBuilder
         PopulateCustomAttributes();
 
         pass45sw.Stop();
-        Console.Error.WriteLine($"[perf] Pass 4-5.5 VTable+InterfaceImpls+Attrs: {pass45sw.ElapsedMilliseconds}ms");
 
         // Pass 6: Convert method bodies (vtables are now available for virtual dispatch)
         // Parallel compilation: per-method state is in ThreadLocal<MethodCompilationContext>,
         // shared-accumulate collections (StringLiterals, ArrayInitData, etc.) are thread-safe.
-        var pass6sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass6sw = Timings.Begin("Pass 6 MethodBodies+GenericMethodSpecs+MissingCallees");
 
         // Phase A: Filter out methods that don't need body compilation (sequential, fast)
         var compilableBodies = new List<(IL.MethodInfo MethodDef, IRMethod IrMethod)>();
@@ -872,7 +869,7 @@ public partial class IRBuilder
         // Cecil's internal resolver uses mutable state (lazy property caching, MetadataResolver)
         // that isn't thread-safe. Pre-resolving populates all internal caches so parallel
         // body compilation only reads cached values.
-        var preResolveSw = System.Diagnostics.Stopwatch.StartNew();
+        var preResolveSw = Timings.Begin("Pass 6 B1 PreResolveCecilBodies");
         PreResolveCecilBodies(compilableBodies);
         preResolveSw.Stop();
 
@@ -888,22 +885,18 @@ public partial class IRBuilder
         {
             MaxDegreeOfParallelism = Environment.ProcessorCount,
         };
-        var parallelSw = System.Diagnostics.Stopwatch.StartNew();
+        var parallelSw = Timings.Begin("Pass 6 B2 Parallel body compile");
         Parallel.ForEach(compilableBodies, parallelOpts, entry =>
         {
             ConvertMethodBody(entry.MethodDef, entry.IrMethod);
         });
-        parallelSw.Stop();
-        Console.Error.WriteLine(
-            $"[perf] Pass 6 bodies: {compilableBodies.Count} methods, " +
-            $"preResolve={preResolveSw.ElapsedMilliseconds}ms, " +
-            $"compile={parallelSw.ElapsedMilliseconds}ms (DOP={Environment.ProcessorCount})");
+        parallelSw.Stop($"methods={compilableBodies.Count}, DOP={Environment.ProcessorCount}");
 
         // Drain deferred BCL delegate registrations before VTable/specialization passes
         DrainDeferredBclDelegates();
 
         // Pass 6.1: Compile generic method specializations discovered during Pass 6.
-        var pass61sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass61sw = Timings.Begin("Pass 6.1 GenericMethodSpecs+Drain");
         CreateGenericMethodSpecializations();
 
         // Pass 6.1b: Drain deferred generic bodies discovered during Pass 6.1.
@@ -916,7 +909,7 @@ public partial class IRBuilder
         pass61sw.Stop();
 
         // Pass 6.2: Recover specialized methods whose keys were added during Pass 6/6.1.
-        var pass62sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass62sw = Timings.Begin("Pass 6.2 RecoverSkippedSpecializations");
         int pass62Iterations = 0;
         {
             int prevSkipped = _skippedSpecializedMethods.Count;
@@ -935,10 +928,10 @@ public partial class IRBuilder
                 CreateGenericMethodSpecializations();
             } while (_skippedSpecializedMethods.Count < prevSkipped || _deferredGenericBodies.Count > 0);
         }
-        pass62sw.Stop();
+        pass62sw.Stop($"iterations={pass62Iterations}");
 
         // Pass 6.4: Compile methods discovered during deferred generic body compilation.
-        var pass64sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass64sw = Timings.Begin("Pass 6.4 MissingCallees+Shells");
         CompileMissingCallees();
 
         // Pass 6.4b: Fixpoint loop — create missing types and compile their methods.
@@ -952,53 +945,45 @@ public partial class IRBuilder
             int newMethodCount = _module.Types.Sum(t => t.Methods.Count);
             if (newMethodCount == prevMethodCount) break;
         }
-        pass64sw.Stop();
+        pass64sw.Stop($"shellPasses={shellPassCount}");
 
         // Pass 6.5-6.9b: Post-processing
-        var pass65sw = System.Diagnostics.Stopwatch.StartNew();
+        var pass65sw = Timings.Begin("Pass 6.5-6.9b Post-processing");
 
         // Pass 6.5: Discover types referenced by compiled method bodies but not yet in the module
-        var p65sw = System.Diagnostics.Stopwatch.StartNew();
+        var p65sw = Timings.Begin("Pass 6.5 DiscoverMissingReferencedTypes");
         DiscoverMissingReferencedTypes();
         p65sw.Stop();
 
         // Pass 6.6: Re-scan for external enum types
-        var p66sw = System.Diagnostics.Stopwatch.StartNew();
+        var p66sw = Timings.Begin("Pass 6.6 ExternalEnumTypes");
         var newEnums2 = ScanExternalEnumTypes();
         FixupExternalEnumTypes(newEnums2);
         p66sw.Stop();
 
         // Pass 6.7: Fix up vtable entries for CoreRuntimeTypes
-        var p67sw = System.Diagnostics.Stopwatch.StartNew();
+        var p67sw = Timings.Begin("Pass 6.7 CoreRuntimeVTables");
         FixupCoreRuntimeVTables();
         p67sw.Stop();
 
         // Pass 6.8: Fix abstract vtable slots
-        var p68sw = System.Diagnostics.Stopwatch.StartNew();
+        var p68sw = Timings.Begin("Pass 6.8 AbstractVTableSlots");
         FixupAbstractVTableSlots();
         p68sw.Stop();
 
         // Pass 6.9: Ensure attribute constructors are compiled.
-        var p69sw = System.Diagnostics.Stopwatch.StartNew();
+        var p69sw = Timings.Begin("Pass 6.9 AttributeConstructors");
         EnsureAttributeConstructorsCompiled();
         p69sw.Stop();
 
         // Pass 6.9b: Final disambiguation fixup
-        var p69bsw = System.Diagnostics.Stopwatch.StartNew();
+        var p69bsw = Timings.Begin("Pass 6.9b Disambiguation fixup");
         DisambiguateOverloadedMethods();
         FixupDisambiguatedCalls();
         p69bsw.Stop();
 
         pass65sw.Stop();
-        Console.Error.WriteLine($"[perf] Pass 6.5-9b detail: p6.5={p65sw.ElapsedMilliseconds}ms, " +
-            $"p6.6={p66sw.ElapsedMilliseconds}ms, p6.7={p67sw.ElapsedMilliseconds}ms, " +
-            $"p6.8={p68sw.ElapsedMilliseconds}ms, p6.9={p69sw.ElapsedMilliseconds}ms, " +
-            $"p6.9b={p69bsw.ElapsedMilliseconds}ms");
         pass6sw.Stop();
-        Console.Error.WriteLine($"[perf] Pass 6 breakdown: compile={parallelSw.ElapsedMilliseconds}ms, " +
-            $"p6.1={pass61sw.ElapsedMilliseconds}ms, p6.2={pass62sw.ElapsedMilliseconds}ms({pass62Iterations}iter), " +
-            $"p6.4={pass64sw.ElapsedMilliseconds}ms({shellPassCount}iter), p6.5-9={pass65sw.ElapsedMilliseconds}ms");
-        Console.Error.WriteLine($"[perf] Pass 6 MethodBodies+GenericMethodSpecs+MissingCallees: {pass6sw.ElapsedMilliseconds}ms");
 
         // Pass 7: Synthesize record method bodies (replace compiler-generated bodies
         // that reference unsupported BCL types like StringBuilder, EqualityComparer<T>)
@@ -1019,10 +1004,10 @@ public partial class IRBuilder
         var resourceStrings = IL.ResourceExtractor.ExtractReferencedResources(_assemblySet, referencedLiterals);
         foreach (var (key, value) in resourceStrings)
             _module.ResourceStrings[key] = value;
-        Console.Error.WriteLine($"[perf] Resource strings: {resourceStrings.Count} extracted from assemblies");
+        Timings.Note("Resource strings", $"{resourceStrings.Count} extracted from assemblies");
 
         var totalMethods = _module.Types.Sum(t => t.Methods.Count);
-        Console.Error.WriteLine($"[perf] IRBuilder total: types={_module.Types.Count}, methods={totalMethods}");
+        Timings.Note("IRBuilder total", $"types={_module.Types.Count}, methods={totalMethods}");
 
         return _module;
     }
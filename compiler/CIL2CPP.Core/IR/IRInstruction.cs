@@ -193,9 +193,18 @@ public class IRCall : IRInstruction
     }
 
     /// <summary>
-    /// Emit type-check dispatch chain for generic virtual method calls.
-    /// Each constructed subtype gets a branch checking __type_info, calling its
-    /// monomorphized override. Falls back to the direct function name (stub) if no match.
+    /// Sites with at most this many targets keep the plain type-check chain: one or two
+    /// pointer compares are cheaper than an inline cache lookup.
+    /// </summary>
+    internal const int GvmInlineChainMaxTargets = 2;
+
+    /// <summary>
+    /// Emit dispatch for generic virtual method calls.
+    /// Small sites: if/else chain checking __type_info against each constructed subtype.
+    /// Larger sites: per-callsite inline cache (cil2cpp::GvmCallSite, function-local static)
+    /// that maps the receiver TypeInfo to a target index, then a switch over direct calls —
+    /// O(1) instead of O(targets) per call. Falls back to the direct function name (stub)
+    /// if no target matches.
     /// </summary>
     private string EmitGenericVirtualDispatch()
     {
@@ -207,41 +216,51 @@ public class IRCall : IRInstruction
         var sb = new System.Text.StringBuilder();
         sb.Append(nullCheck);
 
-        // Pre-declare result variable before if-else chain (AddAutoDeclarations can't
+        // Pre-declare result variable before the dispatch (AddAutoDeclarations can't
         // handle variable assignments inside branches of a GVM dispatch chain)
         if (ResultVar != null && ResultTypeCpp != null)
             sb.Append($"{ResultTypeCpp} {ResultVar}{{}}; ");
         else if (ResultVar != null)
             sb.Append($"auto {ResultVar} = decltype({ResultVar}){{}}; ");
 
-        // Emit: if/else chain checking __type_info.
-        // Each branch casts `this` to the concrete target type (flat struct model — no C++ inheritance).
-        for (int i = 0; i < GenericVirtualTargets!.Count; i++)
+        // Each target casts `this` to the declaring type of the override method (not the
+        // concrete type), since the override may be declared on a base class (e.g.,
+        // OrderedEnumerable`1 declares CreateOrderedEnumerable but we're dispatching on
+        // OrderedEnumerable`2). Flat struct model — no C++ inheritance.
+        string TargetCall(int i)
         {
-            var (typeInfo, funcName, declTypeCppName) = GenericVirtualTargets[i];
-            var prefix = i == 0 ? "if" : "else if";
-            sb.Append($"{prefix} (((cil2cpp::Object*){thisExpr})->__type_info == &{typeInfo}) ");
-
-            // Cast `this` to the declaring type of the override method (not the concrete type),
-            // since the override may be declared on a base class (e.g., OrderedEnumerable`1
-            // declares CreateOrderedEnumerable but we're dispatching on OrderedEnumerable`2).
+            var (_, funcName, declTypeCppName) = GenericVirtualTargets![i];
             var castThis = $"({declTypeCppName}*){thisExpr}";
             var branchArgs = otherArgs.Length > 0 ? $"{castThis}, {otherArgs}" : castThis;
-            var callExpr = $"{funcName}({branchArgs})";
-            if (ResultVar != null)
-                sb.Append($"{{ {ResultVar} = {callExpr}; }} ");
-            else
-                sb.Append($"{{ {callExpr}; }} ");
+            return ResultVar != null ? $"{ResultVar} = {funcName}({branchArgs});" : $"{funcName}({branchArgs});";
         }
 
         // Fallback: direct call with original args (may be a stub, but ensures linkability)
-        var fallbackArgs = string.Join(", ", Arguments);
-        var fallbackCall = $"{FunctionName}({fallbackArgs})";
-        if (ResultVar != null)
-            sb.Append($"else {{ {ResultVar} = {fallbackCall}; }}");
-        else
-            sb.Append($"else {{ {fallbackCall}; }}");
+        var fallbackCall = $"{FunctionName}({string.Join(", ", Arguments)})";
+        var fallback = ResultVar != null ? $"{ResultVar} = {fallbackCall};" : $"{fallbackCall};";
+
+        var targetCount = GenericVirtualTargets!.Count;
+        if (targetCount <= GvmInlineChainMaxTargets)
+        {
+            for (int i = 0; i < targetCount; i++)
+            {
+                var prefix = i == 0 ? "if" : "else if";
+                sb.Append($"{prefix} (((cil2cpp::Object*){thisExpr})->__type_info == &{GenericVirtualTargets[i].TypeInfoName}) ");
+                sb.Append($"{{ {TargetCall(i)} }} ");
+            }
+            sb.Append($"else {{ {fallback} }}");
+            return sb.ToString();
+        }
 
+        // Inline cache: constant-initialized statics scoped to this call site's block
+        sb.Append("{ static cil2cpp::TypeInfo* const __gvm_types[] = { ");
+        sb.Append(string.Join(", ", GenericVirtualTargets.Select(t => $"&{t.TypeInfoName}")));
+        sb.Append(" }; ");
+        sb.Append($"static cil2cpp::GvmCallSite __gvm_site(__gvm_types, {targetCount}); ");
+        sb.Append($"switch (cil2cpp::gvm_lookup(&__gvm_site, ((cil2cpp::Object*){thisExpr})->__type_info)) {{ ");
+        for (int i = 0; i < targetCount; i++)
+            sb.Append($"case {i}: {{ {TargetCall(i)} break; }} ");
+        sb.Append($"default: {{ {fallback} break; }} }} }}");
         return sb.ToString();
     }
 
@@ -683,8 +702,8 @@ public class IRCatchBegin : IRInstruction
                 ? $"CIL2CPP_CATCH({ExceptionTypeCppName})" : "CIL2CPP_CATCH_ALL";
         // After a filter: we're already inside the else block, use conditional check
         if (ExceptionTypeCppName != null)
-            return $"if (!__exc_caught && cil2cpp::object_is_instance_of(reinterpret_cast<cil2cpp::Object*>(__exc_ctx.current_exception), &{ExceptionTypeCppName}_TypeInfo)) {{ __exc_caught = true;";
-        return "if (!__exc_caught) { __exc_caught = true;";
+            return $"if (!__exc_caught && cil2cpp::object_is_instance_of(reinterpret_cast<cil2cpp::Object*>(__exc_ctx.current_exception), &{ExceptionTypeCppName}_TypeInfo)) {{ CIL2CPP_MARK_CAUGHT;";
+        return "if (!__exc_caught) { CIL2CPP_MARK_CAUGHT;";
     }
 }
 
@@ -730,14 +749,14 @@ public class IRFilterBegin : IRInstruction
 
 public class IREndFilter : IRInstruction
 {
-    /// <summary>True if this is the last filter in the chain — rejection rethrows to outer scope.</summary>
+    /// <summary>True if this is the last filter in the chain — rejection keeps unwinding to the outer scope.</summary>
     public bool IsLastFilter { get; set; } = true;
     /// <summary>Index of the NEXT filter (used for goto on rejection).</summary>
     public int NextFilterIndex { get; set; }
-    /// <summary>Complete filter result check: accepts (sets __exc_caught) or jumps to next filter/rethrows.</summary>
+    /// <summary>Complete filter result check: accepts (CIL2CPP_MARK_CAUGHT) or jumps to next filter/propagates.</summary>
     public override string ToCpp() => IsLastFilter
-        ? $"if (__filter_result) {{ __exc_caught = true; }} else {{ CIL2CPP_RETHROW; }}"
-        : $"if (__filter_result) {{ __exc_caught = true; }} else {{ goto __filter_next_{NextFilterIndex}; }}";
+        ? $"if (__filter_result) {{ CIL2CPP_MARK_CAUGHT; }} else {{ CIL2CPP_FILTER_REJECT; }}"
+        : $"if (__filter_result) {{ CIL2CPP_MARK_CAUGHT; }} else {{ goto __filter_next_{NextFilterIndex}; }}";
 }
 
 /// <summary>Marks the end of a filter handler body (no-op — IREndFilter is self-contained).</summary>
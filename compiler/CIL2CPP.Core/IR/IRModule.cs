@@ -96,12 +96,27 @@ public class IRModule
     public Dictionary<string, string> ExternalEnumTypes { get; } = new();
 
     /// <summary>
-    /// Types that need full reflection metadata (FieldInfo[], MethodInfo[], CustomAttributeInfo[]).
-    /// Contains IL full names. Types NOT in this set get TypeInfo with fields=nullptr, methods=nullptr.
+    /// Types that need full reflection metadata (FieldInfo[], MethodInfo[], PropertyInfo[],
+    /// CustomAttributeInfo[]). Contains IL full names. Types NOT in this set get stripped TypeInfo
+    /// (fields/methods/properties=nullptr, constructors only).
     /// Populated from ReachabilityResult.ReflectionTargetTypes.
     /// </summary>
     public HashSet<string> ReflectionTargetTypes { get; set; } = new();
 
+    /// <summary>
+    /// Whether <see cref="ReflectionTargetTypes"/> is authoritative (set when the module was
+    /// built from a reachability result). Then an empty set means nothing is reflected on and
+    /// every type gets a stripped TypeInfo. Modules assembled without reachability (unit tests)
+    /// leave it false and keep member metadata on every type.
+    /// </summary>
+    public bool TrimReflectionMetadata { get; set; }
+
+    /// <summary>
+    /// First non-framework method whose reflection target could not be determined statically,
+    /// which forces full metadata on all user types. Null when reflection was fully tracked.
+    /// </summary>
+    public string? UntrackedReflectionSite { get; set; }
+
     /// <summary>
     /// Types that are actually instantiated (newobj/newarr/box/Activator).
     /// Contains IL full names. Non-constructed types get minimal TypeInfo (no VTable/interfaces/instance_size).
@@ -22,12 +22,20 @@ public class ReachabilityResult
     public HashSet<TypeDefinition> ConstructedTypes { get; } = new();
 
     /// <summary>
-    /// Types that are accessed via reflection APIs (GetFields, GetMethods, typeof, GetType, etc.).
-    /// Only these types get full FieldInfo[]/MethodInfo[]/CustomAttributeInfo[] arrays in codegen.
-    /// Non-reflection types still get TypeInfo but with fields=nullptr, methods=nullptr.
+    /// Types that are accessed via reflection APIs (GetFields, GetMethods, GetCustomAttributes, ...),
+    /// serializers, DAM or rd.xml. Only these types get full FieldInfo[]/MethodInfo[]/PropertyInfo[]/
+    /// CustomAttributeInfo[] arrays in codegen. Other types still get TypeInfo (name, hierarchy,
+    /// interfaces, constructors) but with fields/methods/properties=nullptr.
     /// </summary>
     public HashSet<string> ReflectionTargetTypes { get; } = new();
 
+    /// <summary>
+    /// First non-framework method ("Type::Method") that reflects on a Type not known statically,
+    /// e.g. obj.GetType().GetProperties() or JsonSerializer.Serialize(object). When set, every
+    /// user-assembly type is a reflection target. Null when all reflection use was tracked.
+    /// </summary>
+    public string? UntrackedReflectionSite { get; set; }
+
     /// <summary>
     /// Open generic interface names that are actually dispatched on (callvirt, castclass, isinst,
     /// constrained, ldtoken, ldftn/ldvirtftn). Generic interface specializations NOT in this set
@@ -69,6 +77,11 @@ public class ReachabilityAnalyzer
     // D.2: rd.xml preservation rules
     private List<RdXmlParser.PreservationRule>? _preservationRules;
 
+    // Strip member metadata from types that are never reflected on. Only for applications:
+    // libraries (and the forced-library test mode) can be reflected on by unknown callers.
+    private bool _trimReflectionMetadata;
+    private readonly HashSet<string> _serializationTargets = new();
+
     // Performance: cache InheritsFromOrImplements results to avoid repeated hierarchy walks
     private readonly Dictionary<(string TypeName, string TargetName), bool> _inheritsCache = new();
 
@@ -94,6 +107,12 @@ public class ReachabilityAnalyzer
         _featureSwitchResolver = featureSwitchResolver;
     }
 
+    /// <summary>
+    /// Strip reflection metadata from user types nothing reflects on (see
+    /// <see cref="BuildConfiguration.TrimReflectionMetadata"/>). Executables only.
+    /// </summary>
+    public bool TrimReflectionMetadata { get; init; } = true;
+
     /// <summary>
     /// Apply rd.xml preservation rules before running analysis.
     /// Call this before Analyze() to inject external preservation directives.
@@ -111,6 +130,7 @@ public class ReachabilityAnalyzer
     {
         // Seed: find the entry point
         var entryPoint = _assemblySet.RootAssembly.EntryPoint;
+        _trimReflectionMetadata = TrimReflectionMetadata && !forceLibraryMode && entryPoint != null;
         if (forceLibraryMode)
         {
             // Forced library mode: seed ALL types and methods (used by test fixture)
@@ -165,6 +185,8 @@ public class ReachabilityAnalyzer
         // The runtime's SafeHandle_Dispose icall dispatches ReleaseHandle() via vtable scan,
         // but no IL ever does callvirt SafeHandle.ReleaseHandle — so RTA misses it.
         SeedICallVirtualDependencies(method);
+        SeedICallConstructedTypes(method);
+        SeedRuntimeMeter(method);
     }
 
     /// <summary>
@@ -235,6 +257,62 @@ public class ReachabilityAnalyzer
 
     private readonly HashSet<int> _activeICallVirtualDeps = new();
 
+    /// <summary>
+    /// ICalls whose runtime implementation allocates instances of a managed type (no IL newobj).
+    /// When the ICall method becomes reachable, the type must be constructed so its layout
+    /// and TypeInfo are emitted for the runtime to use.
+    /// </summary>
+    private static readonly (string TypeFullName, string MethodName, int ParamCount,
+                              string ConstructedTypeName)[] ICallConstructedTypes =
+    [
+        // exception_add_first_chance_handler: throw_exception allocates the event args
+        ("System.AppContext", "add_FirstChanceException", 1,
+            "System.Runtime.ExceptionServices.FirstChanceExceptionEventArgs"),
+    ];
+
+    private void SeedICallConstructedTypes(MethodDefinition method)
+    {
+        foreach (var dep in ICallConstructedTypes)
+        {
+            if (method.DeclaringType.FullName != dep.TypeFullName
+                || method.Name != dep.MethodName
+                || method.Parameters.Count != dep.ParamCount)
+                continue;
+
+            foreach (var (_, asm) in _assemblySet.LoadedAssemblies)
+            {
+                var typeDef = asm.MainModule.GetType(dep.ConstructedTypeName);
+                if (typeDef != null)
+                {
+                    MarkTypeConstructed(typeDef);
+                    break;
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Once MeterListener.Start is reachable, the runtime publishes the "System.Runtime"
+    /// Meter by calling Meter(string) and the CreateObservable* factories from C++.
+    /// </summary>
+    private void SeedRuntimeMeter(MethodDefinition method)
+    {
+        if (!RuntimeMeter.IsTrigger(method)) return;
+
+        var meter = method.DeclaringType.Module.GetType(RuntimeMeter.MeterTypeName);
+        var ctor = meter != null ? RuntimeMeter.FindMeterConstructor(meter) : null;
+        if (ctor == null) return;
+
+        MarkTypeConstructed(meter!);
+        SeedMethod(ctor);
+        foreach (var (methodName, _, _) in RuntimeMeter.Factories)
+        {
+            var factory = RuntimeMeter.FindFactory(meter!, methodName);
+            if (factory != null)
+                SeedMethod(factory);
+        }
+    }
+
     /// <summary>
     /// P/Invoke methods that return class types create instances via the marshaller
     /// (invisible to IL — no newobj). Mark the return type as constructed so RTA
@@ -392,25 +470,41 @@ public class ReachabilityAnalyzer
     /// Mark a type as needing full reflection metadata (FieldInfo[], MethodInfo[], CustomAttributeInfo[]).
     /// Called for types referenced via typeof(T), GetType(), reflection APIs, DAM, rd.xml.
     /// </summary>
-    private void MarkReflectionTarget(TypeReference typeRef)
+    private bool MarkReflectionTarget(TypeReference typeRef)
     {
         var resolved = TryResolve(typeRef);
-        if (resolved != null)
-            _result.ReflectionTargetTypes.Add(resolved.FullName);
+        if (resolved == null) return false;
+        _result.ReflectionTargetTypes.Add(resolved.FullName);
+        return true;
     }
 
     /// <summary>
-    /// Post-fixpoint pass: mark all user-assembly types as reflection targets.
-    /// User-defined types are always reflection targets (small count, user expects reflection).
-    /// Also mark rd.xml preserved types.
+    /// Post-fixpoint pass: mark user-assembly types and rd.xml preserved types as reflection targets.
+    /// User types are all targets in library mode or when some non-framework code reflects on a
+    /// Type we couldn't resolve statically; otherwise only the tracked ones are (typeof(T).GetX,
+    /// serializer type arguments, DAM, GetCurrentMethod, expression-tree member tokens).
     /// </summary>
     private void MarkUserAndPreservedReflectionTargets()
     {
         // All types from the root assembly → reflection targets
-        foreach (var type in _result.ReachableTypes)
+        if (!_trimReflectionMetadata || _result.UntrackedReflectionSite != null)
         {
-            if (IsUserAssembly(type))
-                _result.ReflectionTargetTypes.Add(type.FullName);
+            foreach (var type in _result.ReachableTypes)
+            {
+                if (IsUserAssembly(type))
+                    _result.ReflectionTargetTypes.Add(type.FullName);
+            }
+        }
+        else if (_result.ReachableMethods.Any(m => m.Name == "Equals" && m.DeclaringType.FullName == "System.ValueType"))
+        {
+            // ValueType.Equals compares fields through GetFields() (CanCompareBits is always
+            // false here), so structs relying on the default Equals keep their FieldInfos
+            foreach (var type in _result.ReachableTypes)
+            {
+                if (type.IsValueType && !type.IsEnum && !IsBclAssembly(type.Module.Assembly)
+                    && !type.Methods.Any(m => m.Name == "Equals" && m.IsVirtual && m.Parameters.Count == 1))
+                    _result.ReflectionTargetTypes.Add(type.FullName);
+            }
         }
 
         // rd.xml preserved types → reflection targets
@@ -419,7 +513,18 @@ public class ReachabilityAnalyzer
             foreach (var rule in _preservationRules)
             {
                 if (!string.IsNullOrEmpty(rule.TypeName))
+                {
                     _result.ReflectionTargetTypes.Add(rule.TypeName);
+                }
+                else if (rule.AssemblyName != null && rule.MemberTypes != 0)
+                {
+                    // <Assembly Name="X" Dynamic="Required All"/>: every reachable type of X
+                    foreach (var type in _result.ReachableTypes)
+                    {
+                        if (type.Module.Assembly.Name.Name == rule.AssemblyName)
+                            _result.ReflectionTargetTypes.Add(type.FullName);
+                    }
+                }
             }
         }
     }
@@ -1180,7 +1285,7 @@ public class ReachabilityAnalyzer
                             TrackDispatchedInterface(callRef.DeclaringType);
 
                         // Detect reflection API calls that require full metadata on target types
-                        DetectReflectionApiCall(callRef, instr);
+                        DetectReflectionApiCall(callRef, instr, method);
 
                         // P/Invoke returning SafeHandle-derived types: the marshaller creates
                         // an instance (via Activator.CreateInstance<T>) that's invisible to IL.
@@ -1206,6 +1311,7 @@ public class ReachabilityAnalyzer
                         var ctorTypeDef = TryResolve(ctorRef.DeclaringType);
                         if (ctorTypeDef != null)
                             MarkTypeConstructed(ctorTypeDef);
+                        DetectSerializerConstruction(ctorRef, instr, method);
                     }
                     break;
 
@@ -1292,6 +1398,11 @@ public class ReachabilityAnalyzer
                     }
                     else if (instr.Operand is FieldReference tokenField)
                         ProcessFieldRef(tokenField);
+                    // Expression trees: ldtoken member → MethodBase.GetMethodFromHandle /
+                    // FieldInfo.GetFieldFromHandle needs the declaring type's member metadata
+                    if (instr.Operand is MemberReference tokenMember and not TypeReference
+                        && instr.Next?.Operand is MethodReference { Name: "GetMethodFromHandle" or "GetFieldFromHandle" })
+                        MarkReflectionTarget(tokenMember.DeclaringType);
                     break;
             }
         }
@@ -1604,43 +1715,248 @@ public class ReachabilityAnalyzer
         "GetFields", "GetField", "GetMethods", "GetMethod",
         "GetProperties", "GetProperty", "GetMembers", "GetMember",
         "GetConstructor", "GetConstructors", "GetEvents", "GetEvent",
-        "GetNestedType", "GetNestedTypes", "InvokeMember",
+        "GetNestedType", "GetNestedTypes", "InvokeMember", "FindMembers", "GetDefaultMembers",
+        "GetCustomAttributes", "GetCustomAttributesData", "IsDefined",
+        "get_DeclaredFields", "get_DeclaredMethods", "get_DeclaredProperties",
+        "get_DeclaredMembers", "get_DeclaredConstructors", "get_DeclaredEvents",
+    };
+
+    // Static helpers whose first argument is the reflected Type/MemberInfo
+    // (Attribute.GetCustomAttribute(typeof(T), ...), typeof(T).GetRuntimeProperties(), ...).
+    private static readonly HashSet<string> ReflectionHelperTypes = new()
+    {
+        "System.Attribute",
+        "System.Reflection.CustomAttributeExtensions",
+        "System.Reflection.RuntimeReflectionExtensions",
+        "System.Reflection.TypeExtensions",
+    };
+
+    // Serializer entry points that walk the members of their generic argument (or Type argument)
+    // with reflection. Methods taking a source-generated JsonTypeInfo/JsonSerializerContext don't.
+    private static readonly HashSet<string> SerializerTypes = new()
+    {
+        "System.Text.Json.JsonSerializer",
+        "Newtonsoft.Json.JsonConvert",
+        "Newtonsoft.Json.JsonSerializer",
+        "Microsoft.Extensions.Configuration.ConfigurationBinder",
+        "Microsoft.Extensions.DependencyInjection.OptionsConfigurationServiceCollectionExtensions",
+    };
+
+    // Serializers constructed from a Type: new XmlSerializer(typeof(T)), ...
+    private static readonly HashSet<string> SerializerConstructorTypes = new()
+    {
+        "System.Xml.Serialization.XmlSerializer",
+        "System.Runtime.Serialization.DataContractSerializer",
+        "System.Runtime.Serialization.Json.DataContractJsonSerializer",
     };
 
     /// <summary>
     /// Detect reflection API calls and mark target types as needing full reflection metadata.
-    /// Conservative: if we can statically determine the target type (e.g., typeof(T).GetFields()),
-    /// only mark that type. Otherwise, mark all constructed types (very conservative fallback).
+    /// Precise when the target type is statically known (typeof(T).GetFields(), JsonSerializer
+    /// .Serialize&lt;T&gt;). Otherwise, calls from non-framework code record an untracked site,
+    /// which makes every user type a reflection target (see MarkUserAndPreservedReflectionTargets).
+    /// Untracked calls inside the framework are ignored, as they always have been.
     /// </summary>
-    private void DetectReflectionApiCall(MethodReference callRef, Mono.Cecil.Cil.Instruction instr)
+    private void DetectReflectionApiCall(MethodReference callRef, Mono.Cecil.Cil.Instruction instr,
+        MethodDefinition caller)
     {
         var declType = callRef.DeclaringType?.FullName ?? "";
         var methodName = callRef.Name;
 
         // Type.GetFields(), Type.GetMethods(), etc. on System.Type
-        if ((declType == "System.Type" || declType == "System.RuntimeType") &&
+        if ((declType is "System.Type" or "System.RuntimeType" or "System.Reflection.TypeInfo") &&
             ReflectionApiMethods.Contains(methodName))
         {
-            // Try to find the type operand from a preceding ldtoken (typeof pattern)
-            // Pattern: ldtoken T → call GetTypeFromHandle → callvirt GetFields
-            var prev = instr.Previous;
-            if (prev?.OpCode.Code is Code.Call or Code.Callvirt &&
-                prev.Operand is MethodReference getTypeFromHandle &&
-                getTypeFromHandle.Name == "GetTypeFromHandle")
+            // Pattern: ldtoken T → call GetTypeFromHandle → [simple args] → callvirt GetFields
+            var typeToken = FindTypeofArgument(instr.Previous, callRef.Parameters.Count);
+            if (typeToken == null || !MarkReflectionTarget(typeToken))
+                RecordUntrackedReflection(caller);
+            return;
+        }
+
+        if (ReflectionHelperTypes.Contains(declType) && callRef.Parameters.Count > 0
+            && (methodName.StartsWith("GetCustomAttribute") || methodName == "IsDefined"
+                || methodName.StartsWith("GetRuntime")))
+        {
+            var typeToken = FindTypeofArgument(instr.Previous, callRef.Parameters.Count - 1);
+            if (typeToken == null || !MarkReflectionTarget(typeToken))
+                RecordUntrackedReflection(caller);
+            return;
+        }
+
+        // MethodBase.GetCurrentMethod(): the caller's own MethodInfo
+        if (declType == "System.Reflection.MethodBase" && methodName == "GetCurrentMethod")
+        {
+            _result.ReflectionTargetTypes.Add(caller.DeclaringType.FullName);
+            return;
+        }
+
+        if (SerializerTypes.Contains(declType))
+        {
+            if (callRef.Parameters.Any(p => p.ParameterType.Name.StartsWith("JsonTypeInfo")
+                    || p.ParameterType.Name == "JsonSerializerContext"))
+                return;
+            if (callRef is GenericInstanceMethod gim)
             {
-                var ldtoken = prev.Previous;
-                if (ldtoken?.OpCode.Code == Code.Ldtoken &&
-                    ldtoken.Operand is TypeReference typeToken)
+                foreach (var arg in gim.GenericArguments)
                 {
-                    MarkReflectionTarget(typeToken);
-                    return;
+                    if (!MarkSerializationTarget(arg))
+                        RecordUntrackedReflection(caller);
                 }
             }
+            else if (callRef.Parameters.Any(p => p.ParameterType.FullName is "System.Object" or "System.Type"))
+            {
+                // Serialize(object) / Deserialize(string, Type): target only known at runtime
+                RecordUntrackedReflection(caller);
+            }
+            return;
+        }
+
+        DetectTypeHandoffToFramework(callRef, instr, caller);
+    }
+
+    /// <summary>
+    /// User code handing a Type to the framework (Activator.CreateInstance(typeof(T)),
+    /// Enum.GetValues(t), TypeDescriptor.GetProperties(t), ...): the framework may reflect on it
+    /// out of our sight, so typeof(T) makes T a target and an unknown Type is an untracked site.
+    /// Calls on System.Type itself (IsAssignableFrom, ==) were handled above when they reflect;
+    /// Activator.CreateInstance&lt;T&gt;() is specialized at compile time and needs no metadata.
+    /// </summary>
+    private void DetectTypeHandoffToFramework(MethodReference callRef, Mono.Cecil.Cil.Instruction instr,
+        MethodDefinition caller)
+    {
+        if (IsBclAssembly(caller.Module.Assembly)) return;
+        var declType = callRef.DeclaringType?.FullName ?? "";
+        if (declType is "System.Type" or "System.RuntimeType" or "System.Reflection.TypeInfo") return;
+        var declDef = TryResolve(callRef.DeclaringType!);
+        if (declDef == null || !IsBclAssembly(declDef.Module.Assembly)) return;
 
-            // Fallback: can't determine target type statically (e.g., Type.GetFields() on `this`).
-            // Skip blanket marking — it would mark ALL constructed types as reflection targets.
-            // FIXME: implement more precise tracking (e.g., track Type variable assignments)
+        foreach (var typeToken in TypeArgumentsPassed(callRef, instr))
+        {
+            if (typeToken == null || !MarkReflectionTarget(typeToken))
+                RecordUntrackedReflection(caller);
+        }
+    }
+
+    /// <summary>
+    /// For each System.Type parameter of <paramref name="callRef"/>, the T of a typeof(T)
+    /// passed there by <paramref name="call"/>, or null when the argument isn't a typeof.
+    /// </summary>
+    internal static IEnumerable<TypeReference?> TypeArgumentsPassed(MethodReference callRef,
+        Mono.Cecil.Cil.Instruction call)
+    {
+        var parameters = callRef.Parameters;
+        for (int i = 0; i < parameters.Count; i++)
+        {
+            if (parameters[i].ParameterType.FullName == "System.Type")
+                yield return FindTypeofArgument(call.Previous, parameters.Count - 1 - i);
+        }
+    }
+
+    /// <summary>
+    /// new XmlSerializer(typeof(T)) and friends: T's members are reflected over.
+    /// </summary>
+    private void DetectSerializerConstruction(MethodReference ctorRef, Mono.Cecil.Cil.Instruction instr,
+        MethodDefinition caller)
+    {
+        if (!SerializerConstructorTypes.Contains(ctorRef.DeclaringType.FullName)) return;
+        if (ctorRef.Parameters.Count == 0 || ctorRef.Parameters[0].ParameterType.FullName != "System.Type")
+            return;
+        var typeToken = FindTypeofArgument(instr.Previous, ctorRef.Parameters.Count - 1);
+        if (typeToken == null || !MarkSerializationTarget(typeToken))
+            RecordUntrackedReflection(caller);
+    }
+
+    /// <summary>
+    /// Walk back over <paramref name="argsAfter"/> simply-pushed arguments from
+    /// <paramref name="instr"/> and return T if the value below them is typeof(T)
+    /// (ldtoken T; call Type.GetTypeFromHandle). Null when the value isn't a typeof.
+    /// </summary>
+    internal static TypeReference? FindTypeofArgument(Mono.Cecil.Cil.Instruction? instr, int argsAfter)
+    {
+        for (int i = 0; i < argsAfter && instr != null; i++)
+        {
+            if (IsTypeofCall(instr))
+                instr = instr.Previous.Previous;
+            else if (IsSimplePush(instr.OpCode.Code))
+                instr = instr.Previous;
+            else
+                return null;
+        }
+        return instr != null && IsTypeofCall(instr) ? (TypeReference)instr.Previous.Operand : null;
+    }
+
+    private static bool IsTypeofCall(Mono.Cecil.Cil.Instruction instr) =>
+        instr.OpCode.Code is Code.Call or Code.Callvirt
+        && instr.Operand is MethodReference { Name: "GetTypeFromHandle" }
+        && instr.Previous?.OpCode.Code == Code.Ldtoken
+        && instr.Previous.Operand is TypeReference;
+
+    private static bool IsSimplePush(Code code) => code is
+        Code.Ldc_I4 or Code.Ldc_I4_S or Code.Ldc_I4_M1 or Code.Ldc_I4_0 or Code.Ldc_I4_1
+        or Code.Ldc_I4_2 or Code.Ldc_I4_3 or Code.Ldc_I4_4 or Code.Ldc_I4_5 or Code.Ldc_I4_6
+        or Code.Ldc_I4_7 or Code.Ldc_I4_8 or Code.Ldc_I8 or Code.Ldstr or Code.Ldnull
+        or Code.Ldloc or Code.Ldloc_S or Code.Ldloc_0 or Code.Ldloc_1 or Code.Ldloc_2 or Code.Ldloc_3
+        or Code.Ldarg or Code.Ldarg_S or Code.Ldarg_0 or Code.Ldarg_1 or Code.Ldarg_2 or Code.Ldarg_3
+        or Code.Ldsfld;
+
+    /// <summary>
+    /// Record a reflection use whose target type is unknown. Only non-framework code counts:
+    /// the framework reflects on its own types through paths that are handled elsewhere.
+    /// </summary>
+    private void RecordUntrackedReflection(MethodDefinition caller)
+    {
+        if (_result.UntrackedReflectionSite != null || IsBclAssembly(caller.Module.Assembly)) return;
+        _result.UntrackedReflectionSite = $"{caller.DeclaringType.FullName}::{caller.Name}";
+    }
+
+    /// <summary>
+    /// Mark a serialized type and, transitively, the types of its public fields and properties,
+    /// generic arguments and array elements. Framework types are not walked (serializers use
+    /// built-in converters for them) but their generic arguments are (List&lt;Order&gt; → Order).
+    /// Returns false if the type is an open generic parameter (target unknown).
+    /// </summary>
+    private bool MarkSerializationTarget(TypeReference typeRef)
+    {
+        switch (typeRef)
+        {
+            case GenericParameter:
+                return false;
+            case ArrayType array:
+                return MarkSerializationTarget(array.ElementType);
+            case ByReferenceType byRef:
+                return MarkSerializationTarget(byRef.ElementType);
+            case GenericInstanceType git:
+            {
+                bool known = true;
+                foreach (var arg in git.GenericArguments)
+                    known &= MarkSerializationTarget(arg);
+                return MarkSerializationTarget(git.ElementType) && known;
+            }
+        }
+
+        var def = TryResolve(typeRef);
+        if (def == null || IsBclAssembly(def.Module.Assembly)) return true;
+        if (!_serializationTargets.Add(def.FullName)) return true;
+        _result.ReflectionTargetTypes.Add(def.FullName);
+
+        bool allKnown = true;
+        for (var t = def; t != null && !IsBclAssembly(t.Module.Assembly);
+             t = t.BaseType != null ? TryResolve(t.BaseType) : null)
+        {
+            _result.ReflectionTargetTypes.Add(t.FullName);
+            foreach (var field in t.Fields)
+            {
+                if (!field.IsStatic && field.IsPublic)
+                    allKnown &= MarkSerializationTarget(field.FieldType);
+            }
+            foreach (var prop in t.Properties)
+            {
+                if (prop.GetMethod is { IsPublic: true, IsStatic: false })
+                    allKnown &= MarkSerializationTarget(prop.PropertyType);
+            }
         }
+        return allKnown;
     }
 
     /// Without this, static abstract interface methods (e.g., IUtfChar&lt;Char&gt;.CastFrom)
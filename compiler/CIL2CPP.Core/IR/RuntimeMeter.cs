@@ -0,0 +1,53 @@
+using Mono.Cecil;
+
+namespace CIL2CPP.Core.IR;
+
+/// <summary>
+/// The "System.Runtime" Meter the runtime publishes for programs that use MeterListener
+/// (counters::publish_meter). The runtime creates it from C++ through new Meter(name) and
+/// the Meter.CreateObservable*&lt;T&gt;(name, Func&lt;T&gt;, unit, description) overloads —
+/// calls no IL makes — so when MeterListener.Start is reachable the analyzer seeds those
+/// methods, the IRBuilder instantiates them, and the generated __init_runtime_vtables
+/// registers their compiled forms.
+/// </summary>
+public static class RuntimeMeter
+{
+    public const string MeterTypeName = "System.Diagnostics.Metrics.Meter";
+    public const string ListenerTypeName = "System.Diagnostics.Metrics.MeterListener";
+
+    /// <summary>
+    /// Instrument factories: Meter method, type argument, and the counters::MeterFactories
+    /// field the generated code stores it in.
+    /// </summary>
+    public static readonly (string MethodName, string TypeArgument, string FactoryField)[] Factories =
+    [
+        ("CreateObservableCounter", "System.Int64", "counter_int64"),
+        ("CreateObservableUpDownCounter", "System.Int64", "up_down_counter_int64"),
+        ("CreateObservableCounter", "System.Double", "counter_double"),
+    ];
+
+    /// <summary>Delegate types the runtime creates observe callbacks of.</summary>
+    public static readonly (string TypeArgument, string FactoryField)[] Callbacks =
+    [
+        ("System.Int64", "func_int64"),
+        ("System.Double", "func_double"),
+    ];
+
+    /// <summary>MeterListener.Start — a listener can only see the meter once started.</summary>
+    public static bool IsTrigger(MethodDefinition method) =>
+        method.Name == "Start" && method.Parameters.Count == 0
+        && method.DeclaringType.FullName == ListenerTypeName;
+
+    /// <summary>Meter(string name).</summary>
+    public static MethodDefinition? FindMeterConstructor(TypeDefinition meter) =>
+        meter.Methods.FirstOrDefault(m => m.IsConstructor && !m.IsStatic && m.Parameters.Count == 1
+            && m.Parameters[0].ParameterType.FullName == "System.String");
+
+    /// <summary>The (string, Func&lt;T&gt;, string, string) overload of a factory method.</summary>
+    public static MethodDefinition? FindFactory(TypeDefinition meter, string methodName) =>
+        meter.Methods.FirstOrDefault(m => m.Name == methodName && m.HasGenericParameters
+            && m.Parameters.Count == 4 && m.Parameters[1].ParameterType.FullName == "System.Func`1<T>");
+
+    /// <summary>IL name of Func&lt;<paramref name="typeArgument"/>&gt;.</summary>
+    public static string CallbackTypeName(string typeArgument) => $"System.Func`1<{typeArgument}>";
+}
@@ -108,10 +108,13 @@ public static class RuntimeTypeRegistry
         RegisterException("System.ArrayTypeMismatchException", "cil2cpp::ArrayTypeMismatchException");
         RegisterException("System.TypeInitializationException", "cil2cpp::TypeInitializationException");
         RegisterException("System.TimeoutException", "cil2cpp::TimeoutException");
+        RegisterException("System.ApplicationException", "cil2cpp::ApplicationException");
         RegisterException("System.AggregateException", "cil2cpp::AggregateException");
         RegisterException("System.OperationCanceledException", "cil2cpp::OperationCanceledException");
         RegisterException("System.Threading.Tasks.TaskCanceledException", "cil2cpp::TaskCanceledException");
         RegisterException("System.Collections.Generic.KeyNotFoundException", "cil2cpp::KeyNotFoundException");
+        RegisterException("System.Threading.SemaphoreFullException", "cil2cpp::SemaphoreFullException");
+        RegisterException("System.Reflection.TargetParameterCountException", "cil2cpp::TargetParameterCountException");
 
         // ===== Async non-generic types (struct from runtime, methods compile from IL) =====
         Register("System.Threading.Tasks.Task", null,
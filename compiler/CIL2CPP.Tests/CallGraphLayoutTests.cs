@@ -0,0 +1,172 @@
+using Xunit;
+using CIL2CPP.Core.CodeGen;
+using CIL2CPP.Core.IR;
+
+namespace CIL2CPP.Tests;
+
+public class CallGraphLayoutTests
+{
+    /// <summary>
+    /// Create a static method whose body calls the given functions, padded to roughly
+    /// <paramref name="size"/> instructions, ending in return (or throw).
+    /// </summary>
+    private static IRMethod CreateMethod(string name, int size = 10, bool throws = false,
+        bool isCctor = false, params string[] callees)
+    {
+        var method = new IRMethod
+        {
+            Name = isCctor ? ".cctor" : name,
+            CppName = name,
+            IsStatic = true,
+            IsStaticConstructor = isCctor,
+            ReturnTypeCpp = "void"
+        };
+        var bb = new IRBasicBlock { Id = 0 };
+        foreach (var callee in callees)
+            bb.Instructions.Add(new IRCall { FunctionName = callee });
+        while (bb.Instructions.Count < size - 1)
+            bb.Instructions.Add(new IRComment { Text = "pad" });
+        bb.Instructions.Add(throws ? new IRThrow { ExceptionExpr = "__ex" } : new IRReturn());
+        method.BasicBlocks.Add(bb);
+        return method;
+    }
+
+    private static int PartitionOf(CallGraphLayout.Result layout, IRMethod method)
+        => layout.Partitions.FindIndex(p => p.Contains(method));
+
+    [Fact]
+    public void Build_CctorAndThrowHelper_GoToColdPartition()
+    {
+        var main = CreateMethod("App_Main", callees: new[] { "ThrowHelper_ThrowArgument" });
+        var throwHelper = CreateMethod("ThrowHelper_ThrowArgument", throws: true);
+        var cctor = CreateMethod("App__cctor", isCctor: true);
+
+        var layout = CallGraphLayout.Build(new[] { cctor, throwHelper, main }, 1000, entryPoint: main);
+
+        Assert.Equal(1, layout.HotPartitionCount);
+        Assert.Equal(2, layout.Partitions.Count);
+        Assert.Equal(new[] { main }, layout.Partitions[0]);
+        Assert.Contains(cctor, layout.ColdMethods);
+        Assert.Contains(throwHelper, layout.ColdMethods);
+        Assert.DoesNotContain(main, layout.ColdMethods);
+        Assert.Equal(new[] { main }, layout.HotOrder);
+    }
+
+    [Fact]
+    public void Build_CallersAndCalleesShareAPartition()
+    {
+        // Two independent call chains, interleaved in type order: a1 → a2, b1 → b2
+        var a1 = CreateMethod("A1", size: 50, callees: new[] { "A2" });
+        var b1 = CreateMethod("B1", size: 50, callees: new[] { "B2" });
+        var a2 = CreateMethod("A2", size: 50);
+        var b2 = CreateMethod("B2", size: 50);
+
+        var layout = CallGraphLayout.Build(new[] { a1, b1, a2, b2 }, 100);
+
+        Assert.Equal(2, layout.HotPartitionCount);
+        Assert.Equal(PartitionOf(layout, a1), PartitionOf(layout, a2));
+        Assert.Equal(PartitionOf(layout, b1), PartitionOf(layout, b2));
+        Assert.NotEqual(PartitionOf(layout, a1), PartitionOf(layout, b1));
+        // Callee follows caller in link order
+        Assert.True(layout.HotOrder.IndexOf(a1) < layout.HotOrder.IndexOf(a2));
+    }
+
+    [Fact]
+    public void Build_ClusterSizeCappedAtPartitionSize()
+    {
+        // A → B → C: merging all three would exceed one partition
+        var a = CreateMethod("A", size: 50, callees: new[] { "B" });
+        var b = CreateMethod("B", size: 50, callees: new[] { "C" });
+        var c = CreateMethod("C", size: 50);
+
+        var layout = CallGraphLayout.Build(new[] { a, b, c }, 100);
+
+        Assert.Equal(2, layout.HotPartitionCount);
+        Assert.Equal(PartitionOf(layout, a), PartitionOf(layout, b));
+        Assert.NotEqual(PartitionOf(layout, b), PartitionOf(layout, c));
+    }
+
+    [Fact]
+    public void Build_EntryPointClusterComesFirst()
+    {
+        var helper = CreateMethod("Helper");
+        var main = CreateMethod("Main", callees: new[] { "Work" });
+        var work = CreateMethod("Work");
+
+        var layout = CallGraphLayout.Build(new[] { helper, main, work }, 1000, entryPoint: main);
+
+        Assert.Equal(new[] { main, work, helper }, layout.HotOrder);
+    }
+
+    [Fact]
+    public void Build_Profile_UnsampledMethodsAreColdAndHotEdgesWin()
+    {
+        var main = CreateMethod("Main", callees: new[] { "Rare", "Hot" });
+        var rare = CreateMethod("Rare");
+        var hot = CreateMethod("Hot");
+        var unused = CreateMethod("Unused");
+        var profile = CallProfile.Parse(new[] { "Main;Hot 90", "Main;Rare 1", "Main 9" });
+
+        var layout = CallGraphLayout.Build(new[] { main, rare, hot, unused }, 1000, profile, main);
+
+        Assert.Equal(3, layout.ProfileMatches);
+        Assert.Contains(unused, layout.ColdMethods);
+        // Hot edge merges first, so Hot is placed directly after Main
+        Assert.Equal(new[] { main, hot, rare }, layout.HotOrder);
+    }
+
+    [Fact]
+    public void Build_ProfileMatchingNothing_FallsBackToStaticCallGraph()
+    {
+        var main = CreateMethod("Main", callees: new[] { "Work" });
+        var work = CreateMethod("Work");
+        var profile = CallProfile.Parse(new[] { "Other;Stale 5" });
+
+        var layout = CallGraphLayout.Build(new[] { main, work }, 1000, profile, main);
+
+        Assert.Equal(0, layout.ProfileMatches);
+        Assert.Empty(layout.ColdMethods);
+        Assert.Equal(new[] { main, work }, layout.HotOrder);
+    }
+
+    [Fact]
+    public void Build_IsDeterministic()
+    {
+        var methods = Enumerable.Range(0, 20)
+            .Select(i => CreateMethod($"M{i}", size: 15, callees: new[] { $"M{(i * 7) % 20}", $"M{(i + 3) % 20}" }))
+            .ToArray();
+
+        var first = CallGraphLayout.Build(methods, 60);
+        var second = CallGraphLayout.Build(methods, 60);
+
+        Assert.Equal(first.HotOrder, second.HotOrder);
+        Assert.Equal(first.Partitions.Count, second.Partitions.Count);
+    }
+
+    [Fact]
+    public void IsColdMethod_ReturningMethodWithThrow_IsHot()
+    {
+        var method = CreateMethod("Validate");
+        method.BasicBlocks[0].Instructions.Insert(0, new IRThrow { ExceptionExpr = "__ex" });
+        Assert.False(CallGraphLayout.IsColdMethod(method));
+    }
+
+    [Fact]
+    public void CallProfile_Parse_CollapsedStacks()
+    {
+        var profile = CallProfile.Parse(new[]
+        {
+            "# comment",
+            "main;A;B 10",
+            "main;A 5",
+            "main;A;B 2",
+            "garbage line",
+        });
+
+        Assert.Equal(12L, profile.SelfWeight("B"));
+        Assert.Equal(5L, profile.SelfWeight("A"));
+        Assert.Equal(17L, profile.TotalWeight("A"));
+        Assert.Equal(17L, profile.Edges[("main", "A")]);
+        Assert.Equal(12L, profile.Edges[("A", "B")]);
+    }
+}
@@ -0,0 +1,220 @@
+using System.Text.Json.Nodes;
+using Xunit;
+using CIL2CPP.Core;
+using CIL2CPP.Core.CodeGen;
+
+namespace CIL2CPP.Tests;
+
+public class CompilationCacheTests : IDisposable
+{
+    private readonly string _outputDir =
+        Path.Combine(Path.GetTempPath(), "cil2cpp_cache_" + Guid.NewGuid().ToString("N")[..8]);
+
+    // Any managed PE works as a fingerprinted "assembly" — use the test assembly itself
+    private static readonly string RootAssembly = typeof(CompilationCacheTests).Assembly.Location;
+
+    public void Dispose()
+    {
+        if (Directory.Exists(_outputDir))
+            Directory.Delete(_outputDir, true);
+    }
+
+    private static GeneratedOutput CreateOutput(string methodsContent = "int f() { return 1; }")
+    {
+        return new GeneratedOutput
+        {
+            HeaderFile = new GeneratedFile { FileName = "App.h", Content = "#pragma once\n" },
+            PchFile = new GeneratedFile { FileName = "pch.h", Content = "#include \"App.h\"\n" },
+            DataFile = new GeneratedFile { FileName = "App_data.cpp", Content = "// data\n" },
+            MethodFiles = { new GeneratedFile { FileName = "App_methods_0.cpp", Content = methodsContent } },
+            StubFile = new GeneratedFile { FileName = "App_stubs.cpp", Content = "// stubs\n" },
+        };
+    }
+
+    private GeneratedOutput WriteAndSave(CompilationCache cache)
+    {
+        var output = CreateOutput();
+        output.WriteToDirectory(_outputDir);
+        cache.Save("App", new[] { RootAssembly }, output);
+        return output;
+    }
+
+    [Fact]
+    public void TryHit_NoManifest_Misses()
+    {
+        var cache = new CompilationCache(_outputDir, BuildConfiguration.Release);
+        Assert.False(cache.TryHit(RootAssembly, out var reason));
+        Assert.Equal("no cache manifest", reason);
+    }
+
+    [Fact]
+    public void TryHit_AfterSave_Hits()
+    {
+        var cache = new CompilationCache(_outputDir, BuildConfiguration.Release);
+        WriteAndSave(cache);
+
+        Assert.True(cache.TryHit(RootAssembly, out _));
+        Assert.Equal("App", cache.CachedModuleName);
+    }
+
+    [Fact]
+    public void TryHit_DifferentConfiguration_Misses()
+    {
+        WriteAndSave(new CompilationCache(_outputDir, BuildConfiguration.Release));
+
+        var debugCache = new CompilationCache(_outputDir, BuildConfiguration.Debug);
+        Assert.False(debugCache.TryHit(RootAssembly, out var reason));
+        Assert.Equal("options changed", reason);
+    }
+
+    [Fact]
+    public void TryHit_FeatureSwitchChanged_Misses()
+    {
+        WriteAndSave(new CompilationCache(_outputDir, BuildConfiguration.Release));
+
+        var config = BuildConfiguration.Release with
+        {
+            FeatureSwitches = new Dictionary<string, bool> { ["System.Foo::IsSupported"] = true }
+        };
+        Assert.False(new CompilationCache(_outputDir, config).TryHit(RootAssembly, out _));
+    }
+
+    [Fact]
+    public void TryHit_DifferentRootAssembly_Misses()
+    {
+        var cache = new CompilationCache(_outputDir, BuildConfiguration.Release);
+        WriteAndSave(cache);
+
+        var otherAssembly = typeof(CompilationCache).Assembly.Location;
+        Assert.False(cache.TryHit(otherAssembly, out var reason));
+        Assert.Equal("root assembly changed", reason);
+    }
+
+    [Fact]
+    public void TryHit_GeneratedFileModified_Misses()
+    {
+        var cache = new CompilationCache(_outputDir, BuildConfiguration.Release);
+        WriteAndSave(cache);
+
+        File.AppendAllText(Path.Combine(_outputDir, "App_methods_0.cpp"), "// edited\n");
+        Assert.False(cache.TryHit(RootAssembly, out var reason));
+        Assert.Contains("App_methods_0.cpp", reason);
+    }
+
+    [Fact]
+    public void TryHit_GeneratedFileDeleted_Misses()
+    {
+        var cache = new CompilationCache(_outputDir, BuildConfiguration.Release);
+        WriteAndSave(cache);
+
+        File.Delete(Path.Combine(_outputDir, "App_data.cpp"));
+        Assert.False(cache.TryHit(RootAssembly, out var reason));
+        Assert.Contains("missing", reason);
+    }
+
+    [Fact]
+    public void Invalidate_RemovesManifest()
+    {
+        var cache = new CompilationCache(_outputDir, BuildConfiguration.Release);
+        WriteAndSave(cache);
+
+        cache.Invalidate();
+        Assert.False(File.Exists(cache.ManifestPath));
+        Assert.False(cache.TryHit(RootAssembly, out _));
+    }
+
+    [Fact]
+    public void TryReadMvid_ManagedAssembly_ReturnsModuleVersionId()
+    {
+        var expected = typeof(CompilationCacheTests).Assembly.ManifestModule.ModuleVersionId.ToString("N");
+        Assert.Equal(expected, CompilationCache.TryReadMvid(RootAssembly));
+    }
+
+    [Fact]
+    public void TryReadMvid_MissingFile_ReturnsNull()
+    {
+        Assert.Null(CompilationCache.TryReadMvid(Path.Combine(_outputDir, "missing.dll")));
+    }
+
+    [Fact]
+    public void ComputeKey_IndependentOfAssemblyOrder()
+    {
+        var a = new CompilationCache.AssemblyEntry("A", "/a.dll", "11");
+        var b = new CompilationCache.AssemblyEntry("B", "/b.dll", "22");
+        Assert.Equal(
+            CompilationCache.ComputeKey("opts", "/rt/8.0.1", new[] { a, b }),
+            CompilationCache.ComputeKey("opts", "/rt/8.0.1", new[] { b, a }));
+        Assert.NotEqual(
+            CompilationCache.ComputeKey("opts", "/rt/8.0.1", new[] { a, b }),
+            CompilationCache.ComputeKey("opts", "/rt/8.0.1", new[] { a, b with { Mvid = "33" } }));
+    }
+
+    [Fact]
+    public void ComputeKey_DependsOnRuntime()
+    {
+        var a = new CompilationCache.AssemblyEntry("A", "/a.dll", "11");
+        Assert.NotEqual(
+            CompilationCache.ComputeKey("opts", "/rt/8.0.1", new[] { a }),
+            CompilationCache.ComputeKey("opts", "/rt/8.0.2", new[] { a }));
+    }
+
+    [Fact]
+    public void TryHit_RuntimeChanged_Misses()
+    {
+        var cache = new CompilationCache(_outputDir, BuildConfiguration.Release);
+        WriteAndSave(cache);
+
+        // As if the previous run had resolved the BCL from another installed runtime
+        var manifest = JsonNode.Parse(File.ReadAllText(cache.ManifestPath))!;
+        manifest["Runtime"] = "/opt/dotnet/shared/Microsoft.NETCore.App/0.0.1";
+        File.WriteAllText(cache.ManifestPath, manifest.ToJsonString());
+
+        Assert.False(cache.TryHit(RootAssembly, out var reason));
+        Assert.StartsWith("runtime changed: 0.0.1 -> ", reason);
+    }
+
+    [Fact]
+    public void TryHit_SameNameAssemblyShadowsRecordedPath_Misses()
+    {
+        // The last run loaded xunit.core from elsewhere; the root's directory now provides one
+        var shared = typeof(FactAttribute).Assembly.Location;
+        Assert.Equal(Path.GetDirectoryName(RootAssembly), Path.GetDirectoryName(shared));
+        var elsewhere = Path.Combine(_outputDir, "elsewhere", Path.GetFileName(shared));
+        Directory.CreateDirectory(Path.GetDirectoryName(elsewhere)!);
+        File.Copy(shared, elsewhere);
+
+        var cache = new CompilationCache(_outputDir, BuildConfiguration.Release);
+        var output = CreateOutput();
+        output.WriteToDirectory(_outputDir);
+        cache.Save("App", new[] { RootAssembly, elsewhere }, output);
+
+        Assert.False(cache.TryHit(RootAssembly, out var reason));
+        Assert.StartsWith("assembly resolves elsewhere: xunit.core", reason);
+    }
+
+    // ===== Write-if-changed =====
+
+    [Fact]
+    public void WriteToDirectory_UnchangedContent_SkipsWrite()
+    {
+        var output = CreateOutput();
+        Assert.Equal(output.AllFiles.Count(), output.WriteToDirectory(_outputDir));
+
+        var methodsPath = Path.Combine(_outputDir, "App_methods_0.cpp");
+        var stamp = new DateTime(2020, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+        File.SetLastWriteTimeUtc(methodsPath, stamp);
+
+        Assert.Equal(0, CreateOutput().WriteToDirectory(_outputDir));
+        Assert.Equal(stamp, File.GetLastWriteTimeUtc(methodsPath));
+    }
+
+    [Fact]
+    public void WriteToDirectory_ChangedContent_RewritesOnlyThatFile()
+    {
+        CreateOutput().WriteToDirectory(_outputDir);
+
+        var written = CreateOutput("int f() { return 2; }").WriteToDirectory(_outputDir);
+        Assert.Equal(1, written);
+        Assert.Contains("return 2", File.ReadAllText(Path.Combine(_outputDir, "App_methods_0.cpp")));
+    }
+}
@@ -0,0 +1,120 @@
+using Xunit;
+using CIL2CPP.Core;
+
+namespace CIL2CPP.Tests;
+
+public class CompilationTimingsTests
+{
+    private static CompilationTimings.Entry Entry(string name, int seq, int startMs, int elapsedMs, string? detail = null)
+        => new(name, seq, TimeSpan.FromMilliseconds(startMs), TimeSpan.FromMilliseconds(elapsedMs), 1024, 2048, detail);
+
+    [Fact]
+    public void Begin_Stop_RecordsEntryOnce()
+    {
+        var timings = new CompilationTimings();
+        var phase = timings.Begin("Pass 1");
+        phase.Stop("types=3");
+        phase.Stop("ignored");
+
+        var entry = Assert.Single(timings.Entries);
+        Assert.Equal("Pass 1", entry.Name);
+        Assert.Equal("types=3", entry.Detail);
+    }
+
+    [Fact]
+    public void Begin_WithoutStop_RecordsNothing()
+    {
+        var timings = new CompilationTimings();
+        timings.Begin("Abandoned");
+        Assert.Empty(timings.Entries);
+    }
+
+    [Fact]
+    public void ComputeDepths_NestsByInterval()
+    {
+        var entries = new[]
+        {
+            Entry("Build IR", 1, 0, 100),
+            Entry("Pass 0", 2, 0, 10),
+            Entry("Pass 1", 3, 10, 50),
+            Entry("CreateGenericSpecializations", 4, 20, 5),
+            Entry("CodeGen", 5, 100, 40),
+        };
+
+        Assert.Equal(new[] { 0, 1, 1, 2, 0 }, CompilationTimings.ComputeDepths(entries));
+    }
+
+    [Fact]
+    public void BuildRows_MergesRepeatedPhasesUnderSameParent()
+    {
+        var entries = new[]
+        {
+            Entry("DeferredBodies", 1, 0, 100),
+            Entry("DeferredBodies iteration", 2, 0, 30, "batch=10"),
+            Entry("DeferredBodies iteration", 3, 30, 30, "batch=4"),
+            Entry("DeferredBodies iteration", 4, 60, 40, "batch=1"),
+            Entry("Pass 6", 5, 100, 10),
+        };
+
+        var rows = CompilationTimings.BuildRows(entries);
+
+        Assert.Equal(3, rows.Count);
+        var iteration = rows[1];
+        Assert.Equal("DeferredBodies iteration", iteration.Name);
+        Assert.Equal(1, iteration.Depth);
+        Assert.Equal(3, iteration.Calls);
+        Assert.Equal(TimeSpan.FromMilliseconds(100), iteration.Elapsed);
+        Assert.Equal(3 * 1024L, iteration.AllocatedBytes);
+        Assert.Equal("batch=1", iteration.Detail);
+    }
+
+    [Fact]
+    public void BuildRows_SameNameUnderDifferentParents_NotMerged()
+    {
+        var entries = new[]
+        {
+            Entry("Pass 1.5", 1, 0, 10),
+            Entry("CreateGenericSpecializations", 2, 0, 10),
+            Entry("Pass 3.5", 3, 20, 10),
+            Entry("CreateGenericSpecializations", 4, 20, 10),
+        };
+
+        var rows = CompilationTimings.BuildRows(entries);
+
+        Assert.Equal(4, rows.Count);
+        Assert.All(rows, r => Assert.Equal(1, r.Calls));
+    }
+
+    [Fact]
+    public void FormatReport_IncludesPhasesNotesAndTotal()
+    {
+        var timings = new CompilationTimings();
+        var outer = timings.Begin("Build IR");
+        timings.Begin("Pass 0").Stop("types=7");
+        outer.Stop();
+        timings.Note("Resource strings", "12 extracted from assemblies");
+
+        var report = timings.FormatReport();
+
+        Assert.Contains("Build IR", report);
+        Assert.Contains("  Pass 0", report);
+        Assert.Contains("types=7", report);
+        Assert.Contains("Resource strings: 12 extracted from assemblies", report);
+        Assert.Contains("peak working set", report);
+    }
+
+    [Fact]
+    public void ToJson_ContainsPhaseDepths()
+    {
+        var timings = new CompilationTimings();
+        var outer = timings.Begin("CodeGen");
+        timings.Begin("GenerateHeader").Stop();
+        outer.Stop();
+
+        using var doc = System.Text.Json.JsonDocument.Parse(timings.ToJson());
+        var phases = doc.RootElement.GetProperty("phases").EnumerateArray().ToList();
+        Assert.Equal(2, phases.Count);
+        Assert.Equal("CodeGen", phases[0].GetProperty("name").GetString());
+        Assert.Equal(1, phases[1].GetProperty("depth").GetInt32());
+    }
+}
@@ -297,6 +297,343 @@ public class CppCodeGeneratorTests
         Assert.Contains("add_library(TestApp STATIC", output.CMakeFile!.Content);
     }
 
+    // ===== Method Layout =====
+
+    [Fact]
+    public void Generate_SizeLayout_NoSymbolOrderFile()
+    {
+        var output = new CppCodeGenerator(CreateSimpleModule()).Generate();
+
+        Assert.Null(output.SymbolOrderFile);
+        Assert.DoesNotContain("CIL2CPP_LINK_ORDER", output.CMakeFile!.Content);
+    }
+
+    [Fact]
+    public void Generate_CallGraphLayout_EmitsOrderFileAndColdCctor()
+    {
+        var module = CreateSimpleModule();
+        var type = module.Types.First(t => t.CppName == "Calculator");
+        type.HasCctor = true;
+        var cctor = new IRMethod
+        {
+            Name = ".cctor", CppName = "Calculator__cctor", DeclaringType = type,
+            IsStatic = true, IsConstructor = true, IsStaticConstructor = true,
+            ReturnTypeCpp = "void"
+        };
+        var bb = new IRBasicBlock { Id = 0 };
+        bb.Instructions.Add(new IRReturn());
+        cctor.BasicBlocks.Add(bb);
+        type.Methods.Add(cctor);
+
+        var config = BuildConfiguration.Release with { MethodLayout = MethodLayout.CallGraph };
+        var output = new CppCodeGenerator(module, config).Generate();
+
+        Assert.NotNull(output.SymbolOrderFile);
+        Assert.Equal("TestApp.order", output.SymbolOrderFile!.FileName);
+        Assert.Contains("Program_Main", output.SymbolOrderFile.Content);
+        Assert.DoesNotContain("Calculator__cctor", output.SymbolOrderFile.Content);
+        Assert.Contains(output.AllFiles, f => f.FileName == "TestApp.order");
+
+        // cctor lives in a trailing cold partition, tagged for the cold text section
+        var cold = output.MethodFiles.Last();
+        Assert.Contains("CIL2CPP_COLD void Calculator__cctor()", cold.Content);
+        Assert.DoesNotContain("CIL2CPP_COLD", output.MethodFiles.First().Content);
+
+        Assert.Contains("CIL2CPP_LINK_ORDER", output.CMakeFile!.Content);
+        Assert.Contains("--symbol-ordering-file", output.CMakeFile.Content);
+    }
+
+    // ===== Sampling Profiler =====
+
+    [Fact]
+    public void Generate_ExeProject_EmitsProfilerMethodTable()
+    {
+        var output = new CppCodeGenerator(CreateSimpleModule()).Generate();
+
+        Assert.Contains("#ifdef CIL2CPP_PROFILER", output.DataFile.Content);
+        Assert.Contains("\"Calculator_Add\", \"Calculator.Add\" }", output.DataFile.Content);
+        Assert.Contains("__init_method_symbols();", output.MainFile!.Content);
+        Assert.Contains("option(CIL2CPP_PROFILER", output.CMakeFile!.Content);
+    }
+
+    // ===== Streaming Output =====
+
+    [Fact]
+    public void Generate_StreamToDirectory_WritesMethodFilesMatchingInMemoryOutput()
+    {
+        var dir = Path.Combine(Path.GetTempPath(), "cil2cpp_stream_" + Guid.NewGuid().ToString("N")[..8]);
+        try
+        {
+            var inMemory = new CppCodeGenerator(CreateSimpleModule()).Generate();
+            var streamed = new CppCodeGenerator(CreateSimpleModule()).Generate(dir);
+
+            Assert.Equal(inMemory.MethodFiles.Count, streamed.MethodFiles.Count);
+            for (int i = 0; i < streamed.MethodFiles.Count; i++)
+            {
+                var file = streamed.MethodFiles[i];
+                Assert.True(file.IsStreamed);
+                Assert.True(file.StreamedChanged);
+                Assert.Equal("", file.Content);
+                Assert.Equal(inMemory.MethodFiles[i].Content, File.ReadAllText(Path.Combine(dir, file.FileName)));
+                Assert.Equal(CompilationCache.HashString(inMemory.MethodFiles[i].Content), file.StreamedHash);
+            }
+            Assert.Empty(Directory.GetFiles(dir, "*.tmp"));
+
+            // Second run with identical IR leaves every partition untouched
+            var again = new CppCodeGenerator(CreateSimpleModule()).Generate(dir);
+            Assert.All(again.MethodFiles, f => Assert.False(f.StreamedChanged));
+            // Only the never-written, non-streamed files (header, data, stubs, ...) count as changed
+            Assert.Equal(again.AllFiles.Count() - again.MethodFiles.Count, again.WriteToDirectory(dir));
+        }
+        finally
+        {
+            if (Directory.Exists(dir)) Directory.Delete(dir, true);
+        }
+    }
+
+    [Fact]
+    public void Generate_RecordsCodegenTimings()
+    {
+        var timings = new CompilationTimings();
+        new CppCodeGenerator(CreateSimpleModule()) { Timings = timings }.Generate();
+
+        var names = timings.Entries.Select(e => e.Name).ToList();
+        Assert.Contains("CodeGen", names);
+        Assert.Contains("GenerateHeader", names);
+        Assert.Contains("MethodFiles render", names);
+    }
+
+    // ===== Reflection Metadata Trimming =====
+
+    private static IRModule CreateModuleWithReflectionTargets(params string[] targets)
+    {
+        var module = CreateSimpleModule();
+        var calc = module.Types.First(t => t.ILFullName == "Calculator");
+        calc.Properties.Add(new IRProperty { Name = "Result", PropertyTypeName = "System.Int32", DeclaringType = calc });
+        foreach (var target in targets)
+            module.ReflectionTargetTypes.Add(target);
+        module.TrimReflectionMetadata = true;
+        return module;
+    }
+
+    [Fact]
+    public void Generate_ReflectionTarget_EmitsMemberMetadata()
+    {
+        var output = new CppCodeGenerator(CreateModuleWithReflectionTargets("Calculator")).Generate();
+
+        var data = output.SourceFile.Content;
+        Assert.Contains("Calculator_fields[]", data);
+        Assert.Contains("Calculator_methods[]", data);
+        Assert.Contains("Calculator_properties[]", data);
+    }
+
+    [Fact]
+    public void Generate_NotReflectionTarget_EmitsStrippedTypeInfo()
+    {
+        var timings = new CompilationTimings();
+        var output = new CppCodeGenerator(CreateModuleWithReflectionTargets("Program")) { Timings = timings }.Generate();
+
+        var data = output.SourceFile.Content;
+        Assert.DoesNotContain("Calculator_fields[]", data);
+        Assert.DoesNotContain("Calculator_methods[]", data);
+        Assert.DoesNotContain("Calculator_properties[]", data);
+        // Identity is kept: GetType().Name / ToString() still work
+        Assert.Contains("Calculator_TypeInfo", data);
+        Assert.Contains(timings.Notes, n => n.Name == "Reflection metadata" && n.Detail.Contains("1 stripped"));
+    }
+
+    [Fact]
+    public void Generate_TrimmingWithNoReflectionTargets_StripsEveryType()
+    {
+        // An app that never reflects: the empty target set must not mean "keep everything"
+        var data = new CppCodeGenerator(CreateModuleWithReflectionTargets()).Generate().SourceFile.Content;
+
+        Assert.DoesNotContain("Calculator_fields[]", data);
+        Assert.DoesNotContain("Calculator_methods[]", data);
+        Assert.DoesNotContain("Calculator_properties[]", data);
+        Assert.Contains("Calculator_TypeInfo", data);
+    }
+
+    [Fact]
+    public void Generate_WithoutReachability_KeepsMemberMetadata()
+    {
+        var module = CreateModuleWithReflectionTargets();
+        module.TrimReflectionMetadata = false;
+
+        var data = new CppCodeGenerator(module).Generate().SourceFile.Content;
+
+        Assert.Contains("Calculator_fields[]", data);
+        Assert.Contains("Calculator_methods[]", data);
+    }
+
+    [Fact]
+    public void Generate_ManyMembers_EmitsSortedNameIndex()
+    {
+        var module = CreateModuleWithReflectionTargets("Calculator");
+        var calc = module.Types.First(t => t.ILFullName == "Calculator");
+        foreach (var name in new[] { "Zeta", "Beta", "Gamma", "Alpha", "Delta", "Epsilon", "Eta" })
+        {
+            calc.Methods.Add(new IRMethod
+            {
+                Name = name, CppName = $"Calculator_{name}", DeclaringType = calc, ReturnTypeCpp = "void"
+            });
+        }
+
+        var data = new CppCodeGenerator(module).Generate().SourceFile.Content;
+
+        // Methods: Add, Zeta, Beta, Gamma, Alpha, Delta, Epsilon, Eta (strcmp order)
+        Assert.Contains("static const uint16_t Calculator_methods_by_name[] = { 0, 4, 2, 5, 6, 7, 3, 1 };", data);
+        Assert.Contains(".method_name_index = Calculator_methods_by_name,", data);
+        // Two fields: below the threshold, the runtime scans linearly
+        Assert.DoesNotContain("Calculator_fields_by_name", data);
+    }
+
+    [Fact]
+    public void BuildMemberNameIndex_OrdinalUtf8AndStable()
+    {
+        var index = CppCodeGenerator.BuildMemberNameIndex(new[] { "b", "get_X", "Add", "\u00e9", "Add", "Z" });
+        // Uppercase < lowercase < non-ASCII; equal names keep declaration order
+        Assert.Equal(new[] { 2, 4, 5, 0, 1, 3 }, index);
+    }
+
+    [Fact]
+    public void Generate_ReflectableMethods_ShareTypedInvokeThunk()
+    {
+        var module = CreateModuleWithReflectionTargets("Calculator");
+        module.RegisterPrimitiveTypeInfo("System.Int32");
+        var calc = module.Types.First(t => t.ILFullName == "Calculator");
+        foreach (var name in new[] { "Reset", "Clear" })
+        {
+            var method = new IRMethod
+            {
+                Name = name, CppName = $"Calculator_{name}", DeclaringType = calc,
+                IsStatic = true, ReturnTypeCpp = "void"
+            };
+            method.Parameters.Add(new IRParameter
+            {
+                Name = "value", CppName = "value", CppTypeName = "int32_t", ILTypeName = "System.Int32"
+            });
+            var bb = new IRBasicBlock { Id = 0 };
+            bb.Instructions.Add(new IRReturn());
+            method.BasicBlocks.Add(bb);
+            calc.Methods.Add(method);
+        }
+
+        var data = new CppCodeGenerator(module).Generate().SourceFile.Content;
+
+        var call = data.IndexOf("reinterpret_cast<void(*)(int32_t)>(__fn)(cil2cpp::invoke_arg<int32_t>(__args[0], &System_Int32_TypeInfo));",
+            StringComparison.Ordinal);
+        Assert.True(call >= 0);
+        // Reset and Clear have the same signature: one thunk, referenced twice
+        var header = "static cil2cpp::Object* ";
+        var thunkStart = data.LastIndexOf(header, call, StringComparison.Ordinal) + header.Length;
+        var thunkName = data.Substring(thunkStart).Split('(')[0];
+        Assert.StartsWith("__reflection_invoke_", thunkName);
+        Assert.Equal(2, System.Text.RegularExpressions.Regex.Matches(data, $@"\.invoker = {thunkName} }}").Count);
+    }
+
+    [Fact]
+    public void Generate_ByRefValueTypeParam_ThunkBoxesResultIntoArgs()
+    {
+        var module = CreateModuleWithReflectionTargets("Calculator");
+        module.RegisterPrimitiveTypeInfo("System.Int32");
+        module.RegisterPrimitiveTypeInfo("System.Boolean");
+        var calc = module.Types.First(t => t.ILFullName == "Calculator");
+        var method = new IRMethod
+        {
+            Name = "TryParse", CppName = "Calculator_TryParse", DeclaringType = calc,
+            IsStatic = true, ReturnTypeCpp = "bool"
+        };
+        method.Parameters.Add(new IRParameter
+        {
+            Name = "result", CppName = "result", CppTypeName = "int32_t*", ILTypeName = "System.Int32&"
+        });
+        var bb = new IRBasicBlock { Id = 0 };
+        bb.Instructions.Add(new IRReturn { Value = "true" });
+        method.BasicBlocks.Add(bb);
+        calc.Methods.Add(method);
+
+        var data = new CppCodeGenerator(module).Generate().SourceFile.Content;
+
+        // A null `out int` reads as default(int); the value comes back in a new box, not the caller's
+        Assert.Contains("    int32_t __ref0 = cil2cpp::invoke_arg<int32_t>(__args[0], &System_Int32_TypeInfo);\n" +
+            "    auto __result = reinterpret_cast<bool(*)(int32_t*)>(__fn)(&__ref0);\n" +
+            "    __args[0] = cil2cpp::box<int32_t>(__ref0, &System_Int32_TypeInfo);\n" +
+            "    return cil2cpp::box<bool>(__result, &System_Boolean_TypeInfo);", data);
+        Assert.DoesNotContain("unbox_ptr<int32_t>(__args[0])", data);
+    }
+
+    [Fact]
+    public void Generate_ReferenceTypeParams_ThunkChecksArgumentType()
+    {
+        var module = CreateModuleWithReflectionTargets("Calculator");
+        var calc = module.Types.First(t => t.ILFullName == "Calculator");
+        var method = new IRMethod
+        {
+            Name = "Combine", CppName = "Calculator_Combine", DeclaringType = calc,
+            IsStatic = true, ReturnTypeCpp = "void"
+        };
+        method.Parameters.Add(new IRParameter
+        {
+            Name = "other", CppName = "other", CppTypeName = "Calculator*", ILTypeName = "Calculator"
+        });
+        method.Parameters.Add(new IRParameter
+        {
+            Name = "state", CppName = "state", CppTypeName = "cil2cpp::Object*", ILTypeName = "System.Object"
+        });
+        var bb = new IRBasicBlock { Id = 0 };
+        bb.Instructions.Add(new IRReturn());
+        method.BasicBlocks.Add(bb);
+        calc.Methods.Add(method);
+
+        var data = new CppCodeGenerator(module).Generate().SourceFile.Content;
+
+        // A Calculator parameter rejects other types; object takes anything
+        Assert.Contains("reinterpret_cast<void(*)(Calculator*, cil2cpp::Object*)>(__fn)(" +
+            "reinterpret_cast<Calculator*>(cil2cpp::invoke_ref_arg(__args[0], &Calculator_TypeInfo)), " +
+            "reinterpret_cast<cil2cpp::Object*>(__args[1]));", data);
+    }
+
+    // ===== P/Invoke wrappers =====
+
+    private static IRMethod AddPInvoke(IRType type, string entryPoint, string returnTypeCpp,
+        bool setLastError = false)
+    {
+        var method = new IRMethod
+        {
+            Name = entryPoint, CppName = $"Native_{entryPoint}", DeclaringType = type,
+            IsStatic = true, ReturnTypeCpp = returnTypeCpp,
+            IsPInvoke = true, PInvokeModule = "ws2_32.dll", PInvokeEntryPoint = entryPoint,
+            PInvokeSetLastError = setLastError
+        };
+        method.Parameters.Add(new IRParameter
+        {
+            Name = "s", CppName = "s", CppTypeName = "int32_t", ILTypeName = "System.Int32"
+        });
+        type.Methods.Add(method);
+        return method;
+    }
+
+    [Fact]
+    public void Generate_BlockingPInvoke_RunsInGcSafeRegion()
+    {
+        var module = CreateSimpleModule();
+        var calc = module.Types.First(t => t.ILFullName == "Calculator");
+        AddPInvoke(calc, "recv", "int32_t");
+        AddPInvoke(calc, "accept", "int32_t", setLastError: true);
+        AddPInvoke(calc, "htons", "int32_t");
+
+        var source = new CppCodeGenerator(module).Generate().SourceFile.Content;
+
+        Assert.Contains("auto __native_ret = cil2cpp::gc::blocking([&] { return recv(s); });", source);
+        // The error is captured inside the region, right after the call
+        Assert.Contains("auto __native_ret = cil2cpp::gc::blocking([&] {", source);
+        Assert.Contains("        auto __r = accept(s);\n        cil2cpp::capture_last_pinvoke_error();", source.Replace("\r\n", "\n"));
+        // Non-blocking entry points are called directly
+        Assert.Contains("auto __native_ret = htons(s);", source);
+        Assert.DoesNotContain("blocking([&] { return htons", source);
+    }
+
     // ===== String Literals =====
 
     [Fact]
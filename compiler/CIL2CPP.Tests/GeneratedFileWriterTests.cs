@@ -0,0 +1,76 @@
+using System.Text;
+using Xunit;
+using CIL2CPP.Core.CodeGen;
+
+namespace CIL2CPP.Tests;
+
+public class GeneratedFileWriterTests : IDisposable
+{
+    private readonly string _dir =
+        Path.Combine(Path.GetTempPath(), "cil2cpp_writer_" + Guid.NewGuid().ToString("N")[..8]);
+
+    public GeneratedFileWriterTests() => Directory.CreateDirectory(_dir);
+
+    public void Dispose()
+    {
+        if (Directory.Exists(_dir))
+            Directory.Delete(_dir, true);
+    }
+
+    private bool WriteFile(string name, params string[] chunks)
+    {
+        using var writer = new GeneratedFileWriter(Path.Combine(_dir, name));
+        foreach (var chunk in chunks)
+            writer.Write(new StringBuilder(chunk));
+        return writer.Commit();
+    }
+
+    [Fact]
+    public void Commit_NewFile_WritesContentAndHash()
+    {
+        var path = Path.Combine(_dir, "a.cpp");
+        using (var writer = new GeneratedFileWriter(path))
+        {
+            writer.Write("int f() ");
+            writer.Write(new StringBuilder("{ return 1; }\n"));
+            Assert.True(writer.Commit());
+            Assert.Equal(CompilationCache.HashString("int f() { return 1; }\n"), writer.Hash);
+        }
+
+        Assert.Equal("int f() { return 1; }\n", File.ReadAllText(path));
+        Assert.False(File.Exists(path + ".tmp"));
+    }
+
+    [Fact]
+    public void Commit_UnchangedContent_KeepsFileAndTimestamp()
+    {
+        Assert.True(WriteFile("a.cpp", "// one\n", "// two\n"));
+        var path = Path.Combine(_dir, "a.cpp");
+        var stamp = new DateTime(2020, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+        File.SetLastWriteTimeUtc(path, stamp);
+
+        // Same bytes, different chunking
+        Assert.False(WriteFile("a.cpp", "// one\n// two\n"));
+        Assert.Equal(stamp, File.GetLastWriteTimeUtc(path));
+        Assert.False(File.Exists(path + ".tmp"));
+    }
+
+    [Fact]
+    public void Commit_ChangedContent_ReplacesFile()
+    {
+        WriteFile("a.cpp", "int f() { return 1; }\n");
+        Assert.True(WriteFile("a.cpp", "int f() { return 2; }\n"));
+        Assert.Contains("return 2", File.ReadAllText(Path.Combine(_dir, "a.cpp")));
+    }
+
+    [Fact]
+    public void Dispose_WithoutCommit_LeavesNoFiles()
+    {
+        var path = Path.Combine(_dir, "a.cpp");
+        using (var writer = new GeneratedFileWriter(path))
+            writer.Write("partial");
+
+        Assert.False(File.Exists(path));
+        Assert.False(File.Exists(path + ".tmp"));
+    }
+}
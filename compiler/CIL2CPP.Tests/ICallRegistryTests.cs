@@ -72,6 +72,19 @@ public class ICallRegistryTests
         Assert.Equal(expected, result);
     }
 
+    // System.Runtime.DependentHandle (ConditionalWeakTable)
+    [Theory]
+    [InlineData("System.Runtime.DependentHandle", "InternalInitialize", 2, "cil2cpp::icall::DependentHandle_InternalInitialize")]
+    [InlineData("System.Runtime.DependentHandle", "InternalGetTarget", 1, "cil2cpp::icall::DependentHandle_InternalGetTarget")]
+    [InlineData("System.Runtime.DependentHandle", "InternalGetTargetAndDependent", 2, "cil2cpp::icall::DependentHandle_InternalGetTargetAndDependent")]
+    [InlineData("System.Runtime.DependentHandle", "InternalSetTargetToNull", 1, "cil2cpp::icall::DependentHandle_InternalSetTargetToNull")]
+    [InlineData("System.Runtime.DependentHandle", "InternalFree", 1, "cil2cpp::icall::DependentHandle_InternalFree")]
+    public void Lookup_DependentHandle_ReturnsCorrectCppName(string type, string method, int paramCount, string expected)
+    {
+        var result = ICallRegistry.Lookup(type, method, paramCount);
+        Assert.Equal(expected, result);
+    }
+
     // System.Type
     [Fact]
     public void Lookup_SystemType_GetTypeFromHandle()
@@ -91,6 +104,45 @@ public class ICallRegistryTests
         Assert.Equal(expected, result);
     }
 
+    // System.Threading.WaitHandle
+    [Theory]
+    [InlineData("System.Threading.WaitHandle", "WaitOneCore", 2, "cil2cpp::icall::WaitHandle_WaitOneCore")]
+    [InlineData("System.Threading.WaitHandle", "WaitMultipleIgnoringSyncContext", 4, "cil2cpp::icall::WaitHandle_WaitMultipleIgnoringSyncContext")]
+    [InlineData("System.Threading.WaitHandle", "SignalAndWaitNative", 3, "cil2cpp::icall::WaitHandle_SignalAndWaitNative")]
+    public void Lookup_SystemThreadingWaitHandle_ReturnsCorrectCppName(string type, string method, int paramCount, string expected)
+    {
+        var result = ICallRegistry.Lookup(type, method, paramCount);
+        Assert.Equal(expected, result);
+    }
+
+    // SemaphoreSlim / ManualResetEventSlim
+    [Theory]
+    [InlineData("System.Threading.SemaphoreSlim", "Wait", 2, "System.Int32", "cil2cpp::icall::SemaphoreSlim_Wait")]
+    [InlineData("System.Threading.SemaphoreSlim", "WaitAsync", 2, "System.Int32", "cil2cpp::icall::SemaphoreSlim_WaitAsync")]
+    [InlineData("System.Threading.SemaphoreSlim", "Release", 1, "System.Int32", "cil2cpp::icall::SemaphoreSlim_Release")]
+    [InlineData("System.Threading.SemaphoreSlim", "Dispose", 1, "System.Boolean", "cil2cpp::icall::SemaphoreSlim_Dispose")]
+    [InlineData("System.Threading.ManualResetEventSlim", "Set", 1, "System.Boolean", "cil2cpp::icall::ManualResetEventSlim_Set_Cancellation")]
+    [InlineData("System.Threading.ManualResetEventSlim", "Wait", 2, "System.Int32", "cil2cpp::icall::ManualResetEventSlim_Wait")]
+    public void Lookup_SyncSlim_ReturnsCorrectCppName(string type, string method, int paramCount, string firstParam, string expected)
+    {
+        var result = ICallRegistry.Lookup(type, method, paramCount, firstParam);
+        Assert.Equal(expected, result);
+    }
+
+    [Fact]
+    public void Lookup_CancellationTokenSource_NotifyCancellation_ReturnsCorrectCppName()
+    {
+        Assert.Equal("cil2cpp::icall::CancellationTokenSource_NotifyCancellation",
+            ICallRegistry.Lookup("System.Threading.CancellationTokenSource", "NotifyCancellation", 1));
+    }
+
+    [Fact]
+    public void Lookup_SyncSlim_TimeSpanOverloads_CompileFromIL()
+    {
+        Assert.Null(ICallRegistry.Lookup("System.Threading.SemaphoreSlim", "Wait", 2, "System.TimeSpan"));
+        Assert.Null(ICallRegistry.Lookup("System.Threading.ManualResetEventSlim", "Wait", 2, "System.TimeSpan"));
+    }
+
     // RuntimeHelpers
     [Fact]
     public void Lookup_RuntimeHelpers_InitializeArray_ReturnsCorrectCppName()
@@ -1204,4 +1204,42 @@ public class IRBuilderFeaturesTests
         Assert.Equal("System.Int64", longField.FieldTypeName);
         Assert.Equal("System.Double", doubleField.FieldTypeName);
     }
+
+    // ===== Culture string sort guard =====
+
+    [Fact]
+    public void Build_FeatureTest_CultureStringSort_GuardsOnlyStringIntrospectiveSortCall()
+    {
+        var module = BuildFeatureTest();
+        var guarded = module.Types
+            .SelectMany(t => t.Methods.Select(m => (Type: t, Method: m)))
+            .Where(tm => tm.Method.BasicBlocks.SelectMany(b => b.Instructions)
+                .OfType<IRRawCpp>().Any(r => r.Code.Contains("sort_strings_by_key")))
+            .ToList();
+
+        // TestCultureStringSort reaches the Sort(Span, IComparer) bodies of ArraySortHelper<string>
+        // and GenericArraySortHelper<string>, which call ArraySortHelper<T>.IntrospectiveSort(keys, comparison)
+        Assert.NotEmpty(guarded);
+        Assert.All(guarded, tm =>
+        {
+            var typeName = tm.Type.ILFullName;
+            Assert.True(typeName.StartsWith("System.Collections.Generic.ArraySortHelper`1<")
+                || typeName.StartsWith("System.Collections.Generic.GenericArraySortHelper`1<"),
+                $"guard emitted outside the sort helpers: {typeName}");
+            Assert.True(typeName.EndsWith("<System.String>") || typeName.EndsWith("<__Canon>"),
+                $"guard emitted in a non-string instantiation: {typeName}");
+            Assert.Equal("Sort", tm.Method.Name);
+
+            // The guard opens right before the IntrospectiveSort call it can skip
+            var instrs = tm.Method.BasicBlocks.SelectMany(b => b.Instructions).ToList();
+            var guard = instrs.FindIndex(i => i is IRRawCpp r && r.Code.Contains("sort_strings_by_key"));
+            var call = instrs.Skip(guard + 1).OfType<IRCall>().FirstOrDefault();
+            Assert.NotNull(call);
+            Assert.Contains("IntrospectiveSort", call!.FunctionName);
+        });
+
+        // The user method that sorts stays unguarded
+        var userInstrs = GetMethodInstructions(module, "Program", "TestCultureStringSort");
+        Assert.DoesNotContain(userInstrs.OfType<IRRawCpp>(), r => r.Code.Contains("sort_strings_by_key"));
+    }
 }
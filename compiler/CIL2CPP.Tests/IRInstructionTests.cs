@@ -459,8 +459,8 @@ public class IRInstructionTests
         var instr = new IREndFilter();
         var code = instr.ToCpp();
         Assert.Contains("__filter_result", code);
-        Assert.Contains("__exc_caught", code);
-        Assert.Contains("CIL2CPP_RETHROW", code);
+        Assert.Contains("CIL2CPP_MARK_CAUGHT", code);
+        Assert.Contains("CIL2CPP_FILTER_REJECT", code);
     }
 
     [Fact]
@@ -535,6 +535,56 @@ public class IRInstructionTests
         Assert.Contains("obj, 1, 2", code);
     }
 
+    // ===== Generic virtual method dispatch ToCpp =====
+
+    private static IRCall CreateGvmCall(int targetCount, string? resultVar = "__t0")
+    {
+        var instr = new IRCall
+        {
+            FunctionName = "Base_Visit_T",
+            IsVirtual = true,
+            ResultVar = resultVar,
+            ResultTypeCpp = resultVar != null ? "int32_t" : null,
+            GenericVirtualTargets = Enumerable.Range(0, targetCount)
+                .Select(i => ($"Derived{i}_TypeInfo", $"Derived{i}_Visit_T", $"Derived{i}"))
+                .ToList()
+        };
+        instr.Arguments.Add("obj");
+        instr.Arguments.Add("42");
+        return instr;
+    }
+
+    [Fact]
+    public void IRCall_GenericVirtual_FewTargets_EmitsTypeCheckChain()
+    {
+        var code = CreateGvmCall(2).ToCpp();
+        Assert.Contains("if (((cil2cpp::Object*)obj)->__type_info == &Derived0_TypeInfo) { __t0 = Derived0_Visit_T((Derived0*)obj, 42); }", code);
+        Assert.Contains("else if (((cil2cpp::Object*)obj)->__type_info == &Derived1_TypeInfo)", code);
+        Assert.Contains("else { __t0 = Base_Visit_T(obj, 42); }", code);
+        Assert.DoesNotContain("GvmCallSite", code);
+    }
+
+    [Fact]
+    public void IRCall_GenericVirtual_ManyTargets_EmitsInlineCache()
+    {
+        var code = CreateGvmCall(4).ToCpp();
+        Assert.StartsWith("cil2cpp::null_check((void*)obj); int32_t __t0{}; ", code);
+        Assert.Contains("static cil2cpp::TypeInfo* const __gvm_types[] = { &Derived0_TypeInfo, &Derived1_TypeInfo, &Derived2_TypeInfo, &Derived3_TypeInfo };", code);
+        Assert.Contains("static cil2cpp::GvmCallSite __gvm_site(__gvm_types, 4);", code);
+        Assert.Contains("switch (cil2cpp::gvm_lookup(&__gvm_site, ((cil2cpp::Object*)obj)->__type_info))", code);
+        Assert.Contains("case 3: { __t0 = Derived3_Visit_T((Derived3*)obj, 42); break; }", code);
+        Assert.Contains("default: { __t0 = Base_Visit_T(obj, 42); break; }", code);
+        Assert.DoesNotContain("else if", code);
+    }
+
+    [Fact]
+    public void IRCall_GenericVirtual_ManyTargets_NoResult()
+    {
+        var code = CreateGvmCall(3, resultVar: null).ToCpp();
+        Assert.Contains("case 0: { Derived0_Visit_T((Derived0*)obj, 42); break; }", code);
+        Assert.Contains("default: { Base_Visit_T(obj, 42); break; }", code);
+    }
+
     // ===== Phase 3: Delegate instructions ToCpp =====
 
     [Fact]
@@ -1,4 +1,6 @@
 using Xunit;
+using Mono.Cecil;
+using Mono.Cecil.Cil;
 using CIL2CPP.Core.IL;
 using CIL2CPP.Core.IR;
 using CIL2CPP.Tests.Fixtures;
@@ -373,4 +375,116 @@ public class ReachabilityAnalyzerTests
 
         Assert.Contains(result.ReachableTypes, t => t.Name == "MathUtils");
     }
+
+    // ===== Reflection metadata trimming =====
+
+    [Fact]
+    public void ReflectionTargets_AppWithoutReflection_StripsUserTypes()
+    {
+        var (_, result) = _fixture.GetHelloWorldReleaseContext();
+
+        // HelloWorld never reflects: Calculator keeps a TypeInfo but no member metadata
+        Assert.Null(result.UntrackedReflectionSite);
+        Assert.Contains(result.ReachableTypes, t => t.Name == "Calculator");
+        Assert.DoesNotContain("Calculator", result.ReflectionTargetTypes);
+    }
+
+    [Fact]
+    public void ReflectionTargets_LibraryMode_KeepsAllUserTypes()
+    {
+        var (_, result) = _fixture.GetMathLibReleaseContext();
+
+        var mathUtils = result.ReachableTypes.First(t => t.Name == "MathUtils");
+        Assert.Contains(mathUtils.FullName, result.ReflectionTargetTypes);
+    }
+
+    private static (ModuleDefinition Module, ILProcessor IL) CreateILBody()
+    {
+        var module = ModuleDefinition.CreateModule("ReflectionIL", ModuleKind.Dll);
+        var method = new MethodDefinition("M", MethodAttributes.Static, module.TypeSystem.Void);
+        return (module, method.Body.GetILProcessor());
+    }
+
+    private static MethodReference TypeMethod(ModuleDefinition module, string name, TypeReference returnType)
+    {
+        var systemType = new TypeReference("System", "Type", module, module.TypeSystem.CoreLibrary);
+        return new MethodReference(name, returnType, systemType);
+    }
+
+    [Fact]
+    public void FindTypeofArgument_SkipsSimpleArguments()
+    {
+        // typeof(Target).GetMethod("Run", BindingFlags.Public)
+        var (module, il) = CreateILBody();
+        var target = new TypeReference("App", "Target", module, module.TypeSystem.CoreLibrary);
+        var systemType = new TypeReference("System", "Type", module, module.TypeSystem.CoreLibrary);
+        il.Emit(OpCodes.Ldtoken, target);
+        il.Emit(OpCodes.Call, TypeMethod(module, "GetTypeFromHandle", systemType));
+        il.Emit(OpCodes.Ldstr, "Run");
+        il.Emit(OpCodes.Ldc_I4_S, (sbyte)16);
+        var call = il.Create(OpCodes.Callvirt, TypeMethod(module, "GetMethod", module.TypeSystem.Object));
+        il.Append(call);
+
+        Assert.Same(target, ReachabilityAnalyzer.FindTypeofArgument(call.Previous, 2));
+        Assert.Null(ReachabilityAnalyzer.FindTypeofArgument(call.Previous, 1));
+    }
+
+    [Fact]
+    public void FindTypeofArgument_UnknownReceiver_ReturnsNull()
+    {
+        // obj.GetType().GetProperties()
+        var (module, il) = CreateILBody();
+        var systemType = new TypeReference("System", "Type", module, module.TypeSystem.CoreLibrary);
+        il.Emit(OpCodes.Ldarg_0);
+        il.Emit(OpCodes.Callvirt, new MethodReference("GetType", systemType, module.TypeSystem.Object));
+        var call = il.Create(OpCodes.Callvirt, TypeMethod(module, "GetProperties", module.TypeSystem.Object));
+        il.Append(call);
+
+        Assert.Null(ReachabilityAnalyzer.FindTypeofArgument(call.Previous, 0));
+    }
+
+    [Fact]
+    public void TypeArgumentsPassed_ReturnsTypeofForEachTypeParameter()
+    {
+        // Activator.CreateInstance(typeof(Target), true) / Enum.IsDefined(t, 1)
+        var (module, il) = CreateILBody();
+        var target = new TypeReference("App", "Target", module, module.TypeSystem.CoreLibrary);
+        var systemType = new TypeReference("System", "Type", module, module.TypeSystem.CoreLibrary);
+        var activator = new TypeReference("System", "Activator", module, module.TypeSystem.CoreLibrary);
+        var createInstance = new MethodReference("CreateInstance", module.TypeSystem.Object, activator);
+        createInstance.Parameters.Add(new ParameterDefinition(systemType));
+        createInstance.Parameters.Add(new ParameterDefinition(module.TypeSystem.Boolean));
+        il.Emit(OpCodes.Ldtoken, target);
+        il.Emit(OpCodes.Call, TypeMethod(module, "GetTypeFromHandle", systemType));
+        il.Emit(OpCodes.Ldc_I4_1);
+        var create = il.Create(OpCodes.Call, createInstance);
+        il.Append(create);
+
+        var isDefined = new MethodReference("IsDefined", module.TypeSystem.Boolean,
+            new TypeReference("System", "Enum", module, module.TypeSystem.CoreLibrary));
+        isDefined.Parameters.Add(new ParameterDefinition(systemType));
+        isDefined.Parameters.Add(new ParameterDefinition(module.TypeSystem.Object));
+        il.Emit(OpCodes.Ldarg_0);
+        il.Emit(OpCodes.Ldc_I4_1);
+        var check = il.Create(OpCodes.Call, isDefined);
+        il.Append(check);
+
+        Assert.Same(target, Assert.Single(ReachabilityAnalyzer.TypeArgumentsPassed(createInstance, create)));
+        Assert.Null(Assert.Single(ReachabilityAnalyzer.TypeArgumentsPassed(isDefined, check)));
+    }
+
+    [Fact]
+    public void TypeArgumentsPassed_NoTypeParameters_ReturnsNothing()
+    {
+        // Console.WriteLine(obj): nothing handed over
+        var (module, il) = CreateILBody();
+        var writeLine = new MethodReference("WriteLine", module.TypeSystem.Void,
+            new TypeReference("System", "Console", module, module.TypeSystem.CoreLibrary));
+        writeLine.Parameters.Add(new ParameterDefinition(module.TypeSystem.Object));
+        il.Emit(OpCodes.Ldarg_0);
+        var call = il.Create(OpCodes.Call, writeLine);
+        il.Append(call);
+
+        Assert.Empty(ReachabilityAnalyzer.TypeArgumentsPassed(writeLine, call));
+    }
 }
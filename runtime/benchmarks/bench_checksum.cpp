@@ -0,0 +1,53 @@
+/**
+ * CIL2CPP Runtime Benchmarks - CRC32 / CRC32C / Adler-32
+ *
+ *   - Crc32/Crc32C/Adler32:   64 KB buffer through the CPU-dispatched kernels
+ *                             (arg 1) and the portable slicing-by-8 / scalar code (arg 0).
+ *   - Zlib_Crc32/Adler32:     zlib's own table-driven implementation, for reference.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cil2cpp/checksum.h>
+#include <zlib.h>
+
+#include <vector>
+
+namespace {
+
+constexpr size_t kSize = 64 * 1024;
+
+std::vector<uint8_t> buffer() {
+    std::vector<uint8_t> v(kSize);
+    uint32_t seed = 1;
+    for (auto& b : v) b = static_cast<uint8_t>((seed = seed * 1664525 + 1013904223) >> 24);
+    return v;
+}
+
+template <uint32_t (*Fn)(uint32_t, const void*, size_t), uint32_t Seed>
+void BM_Checksum(benchmark::State& state) {
+    auto data = buffer();
+    cil2cpp::checksum::use_hardware(state.range(0) != 0);
+    state.SetLabel(cil2cpp::checksum::implementation());
+    for (auto _ : state) benchmark::DoNotOptimize(Fn(Seed, data.data(), data.size()));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(kSize));
+    cil2cpp::checksum::use_hardware(true);
+}
+BENCHMARK_TEMPLATE(BM_Checksum, cil2cpp::checksum::crc32, 0)->Name("BM_Crc32")->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(BM_Checksum, cil2cpp::checksum::crc32c, 0)->Name("BM_Crc32C")->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(BM_Checksum, cil2cpp::checksum::adler32, 1)->Name("BM_Adler32")->Arg(1)->Arg(0);
+
+void BM_Zlib_Crc32(benchmark::State& state) {
+    auto data = buffer();
+    for (auto _ : state) benchmark::DoNotOptimize(crc32(0, data.data(), static_cast<uInt>(data.size())));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(kSize));
+}
+BENCHMARK(BM_Zlib_Crc32);
+
+void BM_Zlib_Adler32(benchmark::State& state) {
+    auto data = buffer();
+    for (auto _ : state) benchmark::DoNotOptimize(adler32(1, data.data(), static_cast<uInt>(data.size())));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(kSize));
+}
+BENCHMARK(BM_Zlib_Adler32);
+
+} // namespace
@@ -0,0 +1,152 @@
+/**
+ * CIL2CPP Runtime Benchmarks - Culture-aware string comparison under contention
+ *
+ * Each benchmark thread sorts its own copy of the same word list with
+ * CompareInfo.Compare semantics (what OrderBy(x => x.Name) does with the default
+ * comparer). Threads share nothing but the runtime's collator state, so any
+ * process-wide lock in the compare path shows up as flat or falling throughput
+ * from 1 to 16 threads.
+ * Arg = CompareOptions (0 = None, 1 = IgnoreCase).
+ *
+ * BM_Compare / BM_IndexOf / BM_ToUpper run pure-ASCII identifiers (Arg 0, served by the
+ * ASCII weight tables) against the same text with one accented letter (Arg 1, ICU).
+ *
+ * BM_SortDirect / BM_SortByKey sort the first Arg words with the culture comparer's
+ * semantics: one collation per comparison vs. one sort key per element (what
+ * Array.Sort/List.Sort with StringComparer.CurrentCulture does from kSortKeyThreshold on).
+ */
+
+#include <benchmark/benchmark.h>
+#include <cil2cpp/cil2cpp.h>
+#include <cil2cpp/globalization.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace cil2cpp;
+
+namespace {
+
+constexpr int kWords = 2000;
+
+const std::vector<String*>& word_list() {
+    static const std::vector<String*> words = [] {
+        runtime_init();
+        std::atexit(runtime_shutdown);
+        // Mixed-case identifiers with a shared prefix and some accented letters, so the
+        // collator has to look past the first few characters
+        static const char* syllables[] = { "al", "Be", "co", "Dé", "er", "fa", "Gi", "ho", "ïn", "ju" };
+        std::mt19937 rng(42);
+        std::vector<String*> list;
+        list.reserve(kWords);
+        for (int i = 0; i < kWords; i++) {
+            std::string word = "Customer";
+            int parts = 2 + static_cast<int>(rng() % 4);
+            for (int p = 0; p < parts; p++) word += syllables[rng() % 10];
+            list.push_back(string_literal(word.c_str()));
+        }
+        return list;
+    }();
+    return words;
+}
+
+void BM_CultureSort(benchmark::State& state) {
+    const auto& words = word_list();
+    Int32 options = static_cast<Int32>(state.range(0));
+    std::vector<String*> work;
+    int64_t comparisons = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        work = words;
+        state.ResumeTiming();
+        std::sort(work.begin(), work.end(), [&](String* a, String* b) {
+            comparisons++;
+            return globalization::compareinfo_compare_string_string(nullptr, a, b, options) < 0;
+        });
+        benchmark::DoNotOptimize(work.data());
+    }
+    state.counters["compares/s"] = benchmark::Counter(
+        static_cast<double>(comparisons), benchmark::Counter::kIsRate);
+}
+
+const char16_t* kAsciiPair[] = { u"System.Collections.Generic.Dictionary",
+                                 u"System.Collections.Generic.dictionary" };
+const char16_t* kAccentPair[] = { u"System.Collections.Generic.Dictionnaire\u00e9",
+                                  u"System.Collections.Generic.dictionnaire\u00e9" };
+
+void BM_Compare(benchmark::State& state) {
+    word_list(); // runtime_init
+    auto* root = globalization::base_collator("");
+    const char16_t** pair = state.range(0) ? kAccentPair : kAsciiPair;
+    Int32 len = static_cast<Int32>(std::char_traits<char16_t>::length(pair[0]));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(globalization::collator_compare(root, pair[0], len, pair[1], len, 0));
+        benchmark::DoNotOptimize(globalization::collator_compare(root, pair[0], len, pair[1], len, 1));
+    }
+}
+
+void BM_IndexOf(benchmark::State& state) {
+    word_list();
+    auto* root = globalization::base_collator("");
+    const char16_t* source = state.range(0) ? kAccentPair[0] : kAsciiPair[0];
+    Int32 len = static_cast<Int32>(std::char_traits<char16_t>::length(source));
+    for (auto _ : state) {
+        Int32 matched;
+        benchmark::DoNotOptimize(globalization::collator_index_of(root, source, len,
+            u"GENERIC", 7, 1, false, &matched));
+    }
+}
+
+void BM_ToUpper(benchmark::State& state) {
+    word_list();
+    const char16_t* source = state.range(0) ? kAccentPair[0] : kAsciiPair[0];
+    Int32 len = static_cast<Int32>(std::char_traits<char16_t>::length(source));
+    std::vector<Char> src(source, source + len), dst(static_cast<size_t>(len));
+    for (auto _ : state) {
+        globalization::textinfo_change_case_core(nullptr, src.data(), len, dst.data(), len, true);
+        benchmark::DoNotOptimize(dst.data());
+    }
+}
+
+void BM_SortDirect(benchmark::State& state) {
+    const auto& words = word_list();
+    auto* root = globalization::base_collator("");
+    std::vector<String*> work;
+    for (auto _ : state) {
+        state.PauseTiming();
+        work.assign(words.begin(), words.begin() + state.range(0));
+        state.ResumeTiming();
+        std::sort(work.begin(), work.end(), [root](String* a, String* b) {
+            return globalization::collator_compare(root, &a->f__firstChar, a->length,
+                &b->f__firstChar, b->length, 0) < 0;
+        });
+        benchmark::DoNotOptimize(work.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SortByKey(benchmark::State& state) {
+    const auto& words = word_list();
+    auto* root = globalization::base_collator("");
+    std::vector<String*> work;
+    for (auto _ : state) {
+        state.PauseTiming();
+        work.assign(words.begin(), words.begin() + state.range(0));
+        state.ResumeTiming();
+        globalization::sort_strings_by_key(work.data(), static_cast<Int32>(work.size()), root, 0);
+        benchmark::DoNotOptimize(work.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Compare)->Arg(0)->Arg(1);
+BENCHMARK(BM_IndexOf)->Arg(0)->Arg(1);
+BENCHMARK(BM_ToUpper)->Arg(0)->Arg(1);
+BENCHMARK(BM_CultureSort)->Arg(0)->Arg(1)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_SortDirect)->Arg(64)->Arg(256)->Arg(kWords);
+BENCHMARK(BM_SortByKey)->Arg(64)->Arg(256)->Arg(kWords);
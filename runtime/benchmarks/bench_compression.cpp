@@ -0,0 +1,107 @@
+/**
+ * CIL2CPP Runtime Benchmarks - zlib interop
+ *
+ *   - Deflate_InitEnd:        CompressionNative_DeflateInit2_ + DeflateEnd (GZipStream
+ *                             construction + Dispose) on the per-thread pool, compared
+ *                             with plain deflateInit2 + deflateEnd.
+ *   - Inflate_InitEnd:        same for the decompression side.
+ *   - GZip_Stream:            compress a small (4 KB) payload as gzip through a pooled
+ *                             stream (Init2_, Deflate, End) versus a fresh zlib stream.
+ */
+
+#include <benchmark/benchmark.h>
+#include <interop/compression_interop.h>
+#include <zlib.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int32_t kGZip = 31;
+
+std::vector<uint8_t> payload(size_t size) {
+    std::string text;
+    for (int i = 0; text.size() < size; i++)
+        text += "{\"id\":" + std::to_string(i) + ",\"name\":\"item" + std::to_string(i % 17) + "\"},";
+    return std::vector<uint8_t>(text.begin(), text.begin() + size);
+}
+
+void BM_Zlib_Deflate_InitEnd_Pooled(benchmark::State& state) {
+    for (auto _ : state) {
+        PAL_ZStream s{};
+        CompressionNative_DeflateInit2_(&s, -1, Z_DEFLATED, kGZip, 8, Z_DEFAULT_STRATEGY);
+        benchmark::DoNotOptimize(s.internalState);
+        CompressionNative_DeflateEnd(&s);
+    }
+}
+BENCHMARK(BM_Zlib_Deflate_InitEnd_Pooled);
+
+void BM_Zlib_Deflate_InitEnd_Unpooled(benchmark::State& state) {
+    for (auto _ : state) {
+        z_stream zs{};
+        deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, kGZip, 8, Z_DEFAULT_STRATEGY);
+        benchmark::DoNotOptimize(zs.state);
+        deflateEnd(&zs);
+    }
+}
+BENCHMARK(BM_Zlib_Deflate_InitEnd_Unpooled);
+
+void BM_Zlib_Inflate_InitEnd_Pooled(benchmark::State& state) {
+    for (auto _ : state) {
+        PAL_ZStream s{};
+        CompressionNative_InflateInit2_(&s, kGZip);
+        benchmark::DoNotOptimize(s.internalState);
+        CompressionNative_InflateEnd(&s);
+    }
+}
+BENCHMARK(BM_Zlib_Inflate_InitEnd_Pooled);
+
+void BM_Zlib_Inflate_InitEnd_Unpooled(benchmark::State& state) {
+    for (auto _ : state) {
+        z_stream zs{};
+        inflateInit2(&zs, kGZip);
+        benchmark::DoNotOptimize(zs.state);
+        inflateEnd(&zs);
+    }
+}
+BENCHMARK(BM_Zlib_Inflate_InitEnd_Unpooled);
+
+void BM_Zlib_GZip_Stream(benchmark::State& state) {
+    auto input = payload(4096);
+    std::vector<uint8_t> out(compressBound(static_cast<uLong>(input.size())) + 12);   // gzip wrapper
+    for (auto _ : state) {
+        PAL_ZStream s{};
+        CompressionNative_DeflateInit2_(&s, -1, Z_DEFLATED, kGZip, 8, Z_DEFAULT_STRATEGY);
+        s.nextIn = input.data();
+        s.availIn = static_cast<uint32_t>(input.size());
+        s.nextOut = out.data();
+        s.availOut = static_cast<uint32_t>(out.size());
+        CompressionNative_Deflate(&s, Z_NO_FLUSH);
+        CompressionNative_Deflate(&s, Z_FINISH);
+        benchmark::DoNotOptimize(s.availOut);
+        CompressionNative_DeflateEnd(&s);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_Zlib_GZip_Stream);
+
+void BM_Zlib_GZip_Stream_Unpooled(benchmark::State& state) {
+    auto input = payload(4096);
+    std::vector<uint8_t> out(compressBound(static_cast<uLong>(input.size())) + 12);
+    for (auto _ : state) {
+        z_stream zs{};
+        deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, kGZip, 8, Z_DEFAULT_STRATEGY);
+        zs.next_in = input.data();
+        zs.avail_in = static_cast<uInt>(input.size());
+        zs.next_out = out.data();
+        zs.avail_out = static_cast<uInt>(out.size());
+        deflate(&zs, Z_FINISH);
+        benchmark::DoNotOptimize(zs.avail_out);
+        deflateEnd(&zs);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_Zlib_GZip_Stream_Unpooled);
+
+} // namespace
@@ -0,0 +1,87 @@
+/**
+ * CIL2CPP Runtime Benchmarks - Generic virtual method dispatch
+ *
+ * Compares the two shapes the compiler emits for a GVM call site:
+ *   - IfChain:     `if (type == &A) ... else if (type == &B) ...` over every known override
+ *   - InlineCache: GvmCallSite + gvm_lookup + switch (sites with more than two targets)
+ * Arg = number of distinct receiver types flowing through the call site (1 = monomorphic).
+ * Receivers are always the LAST types in the site's target list, the if-chain's worst case,
+ * which is what large generic hierarchies hit in practice.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cil2cpp/type_info.h>
+
+#include <vector>
+
+using namespace cil2cpp;
+
+namespace {
+
+constexpr int kSiteTargets = 32;
+
+TypeInfo g_types[kSiteTargets] = {};
+TypeInfo* g_site_types[kSiteTargets];
+
+struct SiteInit {
+    SiteInit() {
+        for (int i = 0; i < kSiteTargets; i++) g_site_types[i] = &g_types[i];
+    }
+} g_site_init;
+
+template <int N>
+[[gnu::noinline]] int override_impl(int x) { return x + N; }
+
+template <int... Is>
+[[gnu::always_inline]] inline int dispatch_if_chain(TypeInfo* type, int x,
+                                                    std::integer_sequence<int, Is...>) {
+    int result = -1;
+    // Mirrors the generated if/else chain: first matching target wins
+    (void)((type == &g_types[Is] ? (result = override_impl<Is>(x), true) : false) || ...);
+    return result;
+}
+
+template <int... Is>
+[[gnu::always_inline]] inline int dispatch_inline_cache(GvmCallSite* site, TypeInfo* type, int x,
+                                                        std::integer_sequence<int, Is...>) {
+    int result = -1;
+    int index = gvm_lookup(site, type);
+    (void)((index == Is ? (result = override_impl<Is>(x), true) : false) || ...);
+    return result;
+}
+
+std::vector<TypeInfo*> make_receivers(int distinct) {
+    // Round-robin over the last `distinct` targets
+    std::vector<TypeInfo*> receivers(1024);
+    for (size_t i = 0; i < receivers.size(); i++)
+        receivers[i] = &g_types[kSiteTargets - 1 - static_cast<int>(i % distinct)];
+    return receivers;
+}
+
+void BM_GvmDispatch_IfChain(benchmark::State& state) {
+    auto receivers = make_receivers(static_cast<int>(state.range(0)));
+    size_t i = 0;
+    for (auto _ : state) {
+        auto* type = receivers[i++ & (receivers.size() - 1)];
+        benchmark::DoNotOptimize(type);
+        benchmark::DoNotOptimize(
+            dispatch_if_chain(type, 1, std::make_integer_sequence<int, kSiteTargets>{}));
+    }
+}
+
+void BM_GvmDispatch_InlineCache(benchmark::State& state) {
+    auto receivers = make_receivers(static_cast<int>(state.range(0)));
+    static GvmCallSite site(g_site_types, kSiteTargets);
+    size_t i = 0;
+    for (auto _ : state) {
+        auto* type = receivers[i++ & (receivers.size() - 1)];
+        benchmark::DoNotOptimize(type);
+        benchmark::DoNotOptimize(
+            dispatch_inline_cache(&site, type, 1, std::make_integer_sequence<int, kSiteTargets>{}));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_GvmDispatch_IfChain)->Arg(1)->Arg(4)->Arg(32);
+BENCHMARK(BM_GvmDispatch_InlineCache)->Arg(1)->Arg(4)->Arg(32);
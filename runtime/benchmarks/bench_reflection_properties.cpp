@@ -0,0 +1,222 @@
+/**
+ * CIL2CPP Runtime Benchmarks - Reflection-based property serialization
+ *
+ * Serializes a 20-property POCO (10 int, 10 string) to JSON the way a reflection
+ * serializer does without source generation: walk Type.GetProperties(), read each value,
+ * append "name":value. Variants differ only in how the value is read:
+ *   - GetValue_Invoker:  PropertyInfo.GetValue through the compiler-emitted typed thunk
+ *   - GetValue_Untyped:  PropertyInfo.GetValue on metadata without thunks (ABI switch)
+ *   - CreateDelegate:    open-instance getter delegates created once, then called directly
+ *   - Direct:            hand-written serializer (lower bound)
+ * Metadata is laid out exactly as the compiler emits it for a reflection-visible type.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace cil2cpp;
+
+namespace {
+
+#define POCO_INT_PROPERTIES(X) X(Id) X(Age) X(Score) X(Rank) X(Level) \
+    X(Count) X(Flags) X(Year) X(Month) X(Day)
+#define POCO_STRING_PROPERTIES(X) X(Name) X(Email) X(City) X(Country) X(Street) \
+    X(Phone) X(Company) X(Title) X(Notes) X(Tag)
+
+struct Poco : Object {
+#define DECLARE_INT(N) Int32 f_##N;
+#define DECLARE_STRING(N) String* f_##N;
+    POCO_INT_PROPERTIES(DECLARE_INT)
+    POCO_STRING_PROPERTIES(DECLARE_STRING)
+};
+
+TypeInfo Int32Type = {
+    .name = "Int32", .namespace_name = "System", .full_name = "System.Int32",
+    .instance_size = sizeof(Object) + sizeof(Int32), .element_size = sizeof(Int32),
+    .flags = TypeFlags::ValueType | TypeFlags::Primitive, .cor_element_type = 0x08,
+};
+
+#define DEFINE_INT_GETTER(N) \
+    [[gnu::noinline]] Int32 Poco_get_##N(Poco* self) { return self->f_##N; }
+#define DEFINE_STRING_GETTER(N) \
+    [[gnu::noinline]] String* Poco_get_##N(Poco* self) { return self->f_##N; }
+POCO_INT_PROPERTIES(DEFINE_INT_GETTER)
+POCO_STRING_PROPERTIES(DEFINE_STRING_GETTER)
+
+// Shared per-signature thunks, as emitted by the compiler (__reflection_invoke_N)
+Object* invoke_int_getter(void* fn, Object* obj, Object**) {
+    return box<Int32>(reinterpret_cast<Int32(*)(Poco*)>(fn)(reinterpret_cast<Poco*>(obj)), &Int32Type);
+}
+Object* invoke_ref_getter(void* fn, Object* obj, Object**) {
+    return reinterpret_cast<Object*>(reinterpret_cast<String*(*)(Poco*)>(fn)(reinterpret_cast<Poco*>(obj)));
+}
+
+#define INT_METHOD(N) { .name = "get_" #N, .return_type = &Int32Type, \
+    .method_pointer = reinterpret_cast<void*>(&Poco_get_##N), .flags = 0x0886, .vtable_slot = -1, \
+    .invoker = Invoker ? &invoke_int_getter : nullptr },
+#define STRING_METHOD(N) { .name = "get_" #N, .return_type = &System_String_TypeInfo, \
+    .method_pointer = reinterpret_cast<void*>(&Poco_get_##N), .flags = 0x0886, .vtable_slot = -1, \
+    .invoker = Invoker ? &invoke_ref_getter : nullptr },
+#define INT_PROPERTY(N) { .name = #N, .property_type = &Int32Type, \
+    .getter = reinterpret_cast<void*>(&Poco_get_##N) },
+#define STRING_PROPERTY(N) { .name = #N, .property_type = &System_String_TypeInfo, \
+    .getter = reinterpret_cast<void*>(&Poco_get_##N) },
+
+template <bool Invoker>
+struct PocoMetadata {
+    static inline MethodInfo methods[] = {
+        POCO_INT_PROPERTIES(INT_METHOD)
+        POCO_STRING_PROPERTIES(STRING_METHOD)
+    };
+    static inline PropertyInfo properties[] = {
+        POCO_INT_PROPERTIES(INT_PROPERTY)
+        POCO_STRING_PROPERTIES(STRING_PROPERTY)
+    };
+    static inline TypeInfo type = {
+        .name = "Poco", .namespace_name = "Bench", .full_name = "Bench.Poco",
+        .base_type = &System_Object_TypeInfo,
+        .instance_size = sizeof(Poco),
+        .flags = TypeFlags::Sealed,
+        .methods = methods, .method_count = 20,
+        .properties = properties, .property_count = 20,
+    };
+
+    static TypeInfo* init() {
+        for (auto& m : methods) m.declaring_type = &type;
+        for (auto& p : properties) p.declaring_type = &type;
+        return &type;
+    }
+};
+
+MethodInfo OpenFuncInvoke[] = { { .name = "Invoke", .parameter_count = 1 } };
+TypeInfo OpenFuncType = {
+    .name = "Func`2", .namespace_name = "System", .full_name = "System.Func`2",
+    .instance_size = sizeof(Delegate), .flags = TypeFlags::Delegate,
+    .methods = OpenFuncInvoke, .method_count = 1,
+};
+
+Poco* make_poco(TypeInfo* type) {
+    static bool initialized = (runtime_init(), std::atexit(runtime_shutdown), true);
+    (void)initialized;
+    auto* poco = static_cast<Poco*>(gc::alloc(sizeof(Poco), type));
+    Int32 i = 1;
+#define INIT_INT(N) poco->f_##N = i++ * 1000;
+#define INIT_STRING(N) poco->f_##N = string_literal(#N "-value");
+    POCO_INT_PROPERTIES(INIT_INT)
+    POCO_STRING_PROPERTIES(INIT_STRING)
+    return poco;
+}
+
+void append_value(std::string& out, Object* value) {
+    if (!value) { out += "null"; return; }
+    if (value->__type_info == &Int32Type) {
+        out += std::to_string(unbox<Int32>(value));
+        return;
+    }
+    out += '"';
+    out += string_to_utf8(reinterpret_cast<String*>(value));
+    out += '"';
+}
+
+template <bool Invoker>
+void BM_ReflectionJson_GetValue(benchmark::State& state) {
+    auto* type = PocoMetadata<Invoker>::init();
+    auto* poco = make_poco(type);
+    auto* props = type_get_properties(type_get_type_object(type));
+    auto** items = static_cast<ManagedPropertyInfo**>(array_data(props));
+    Int32 count = array_length(props);
+    std::string out;
+    for (auto _ : state) {
+        out.clear();
+        out += '{';
+        for (Int32 i = 0; i < count; i++) {
+            out += '"';
+            out += items[i]->native_info->name;
+            out += "\":";
+            append_value(out, propertyinfo_get_value(items[i], poco, nullptr));
+            out += ',';
+        }
+        out.back() = '}';
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.counters["props/s"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * count, benchmark::Counter::kIsRate);
+}
+
+void BM_ReflectionJson_GetValue_Invoker(benchmark::State& state) {
+    BM_ReflectionJson_GetValue<true>(state);
+}
+
+void BM_ReflectionJson_GetValue_Untyped(benchmark::State& state) {
+    BM_ReflectionJson_GetValue<false>(state);
+}
+
+void BM_ReflectionJson_CreateDelegate(benchmark::State& state) {
+    auto* type = PocoMetadata<true>::init();
+    auto* poco = make_poco(type);
+    auto* props = type_get_properties(type_get_type_object(type));
+    auto** items = static_cast<ManagedPropertyInfo**>(array_data(props));
+    Int32 count = array_length(props);
+
+    // What a serializer caches per property: name + Func<Poco, T>
+    struct Accessor { const char* name; bool is_int; Delegate* getter; };
+    std::vector<Accessor> accessors;
+    for (Int32 i = 0; i < count; i++) {
+        auto* getter = propertyinfo_get_get_method(items[i]);
+        accessors.push_back({ items[i]->native_info->name,
+            items[i]->native_info->property_type == &Int32Type,
+            reinterpret_cast<Delegate*>(methodinfo_create_delegate(
+                getter, type_get_type_object(&OpenFuncType), nullptr)) });
+    }
+
+    std::string out;
+    for (auto _ : state) {
+        out.clear();
+        out += '{';
+        for (auto& a : accessors) {
+            out += '"';
+            out += a.name;
+            out += "\":";
+            if (a.is_int) {
+                out += std::to_string(reinterpret_cast<Int32(*)(Poco*)>(a.getter->method_ptr)(poco));
+            } else {
+                out += '"';
+                out += string_to_utf8(reinterpret_cast<String*(*)(Poco*)>(a.getter->method_ptr)(poco));
+                out += '"';
+            }
+            out += ',';
+        }
+        out.back() = '}';
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.counters["props/s"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * count, benchmark::Counter::kIsRate);
+}
+
+void BM_ReflectionJson_Direct(benchmark::State& state) {
+    auto* poco = make_poco(PocoMetadata<true>::init());
+    std::string out;
+    for (auto _ : state) {
+        out.clear();
+        out += '{';
+#define WRITE_INT(N) out += "\"" #N "\":"; out += std::to_string(poco->f_##N); out += ',';
+#define WRITE_STRING(N) out += "\"" #N "\":\""; out += string_to_utf8(poco->f_##N); out += "\",";
+        POCO_INT_PROPERTIES(WRITE_INT)
+        POCO_STRING_PROPERTIES(WRITE_STRING)
+        out.back() = '}';
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.counters["props/s"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * 20, benchmark::Counter::kIsRate);
+}
+
+} // namespace
+
+BENCHMARK(BM_ReflectionJson_GetValue_Invoker);
+BENCHMARK(BM_ReflectionJson_GetValue_Untyped);
+BENCHMARK(BM_ReflectionJson_CreateDelegate);
+BENCHMARK(BM_ReflectionJson_Direct);
@@ -0,0 +1,297 @@
+/**
+ * CIL2CPP Runtime Benchmarks - core primitives every generated program leans on
+ *
+ *   - GC_Alloc:              gc::alloc of a small object (arg = instance size in bytes).
+ *   - IsInstanceOf_*:        object_is_instance_of for an exact match, a base class four
+ *                            levels up, the last of eight interfaces, and a miss.
+ *   - InterfaceVTable:       obj_get_interface_vtable (arg = interface slot, 1st or 8th).
+ *   - Monitor_EnterExit:     uncontended monitor::enter/exit (C# lock), then the same
+ *                            lock shared by 2/4 threads.
+ *   - String_Concat:         string_concat of two / three short strings.
+ *   - Dict_*:                Dictionary<string,int> set (update), TryGetValue hit / miss.
+ *   - Task_CreateComplete:   task_create_pending + task_complete, with and without a
+ *                            queued continuation.
+ *   - ThreadPool_QueueWork:  queue_work a batch of 256 items and wait for all of them;
+ *                            items_per_second is the pool's dispatch throughput.
+ *
+ * Run with --benchmark_format=json (or --benchmark_out=<file> --benchmark_out_format=json)
+ * for machine-readable results; `python tools/dev.py bench` does both and compares runs.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace cil2cpp;
+
+namespace {
+
+void ensure_runtime() {
+    static bool initialized = (runtime_init(), std::atexit(runtime_shutdown), true);
+    (void)initialized;
+}
+
+// Objects are sized like an Array header so obj_get_interface_vtable's array probe reads
+// zeroed fields rather than whatever follows a bare Object.
+constexpr uint32_t kObjectSize = sizeof(Array) + 16;
+
+// ===== Type hierarchy: Leaf : Mid3 : Mid2 : Mid1 : Root, Leaf implements I0..I7 =====
+
+constexpr int kInterfaces = 8;
+
+TypeInfo g_interfaces[kInterfaces] = {};
+TypeInfo* g_interface_list[kInterfaces];
+void* g_interface_methods[kInterfaces][1];
+InterfaceVTable g_interface_vtables[kInterfaces];
+
+TypeInfo g_root{}, g_mid1{}, g_mid2{}, g_mid3{}, g_leaf{}, g_unrelated{};
+
+struct HierarchyInit {
+    HierarchyInit() {
+        static const char* names[kInterfaces] = {"I0", "I1", "I2", "I3", "I4", "I5", "I6", "I7"};
+        for (int i = 0; i < kInterfaces; i++) {
+            g_interfaces[i].name = names[i];
+            g_interfaces[i].full_name = names[i];
+            g_interfaces[i].flags = TypeFlags::Interface;
+            g_interface_list[i] = &g_interfaces[i];
+            g_interface_methods[i][0] = reinterpret_cast<void*>(static_cast<uintptr_t>(i + 1));
+            g_interface_vtables[i] = {&g_interfaces[i], g_interface_methods[i], 1};
+        }
+        TypeInfo* chain[] = {&g_root, &g_mid1, &g_mid2, &g_mid3, &g_leaf};
+        const char* chain_names[] = {"Root", "Mid1", "Mid2", "Mid3", "Leaf"};
+        for (int i = 0; i < 5; i++) {
+            chain[i]->name = chain_names[i];
+            chain[i]->full_name = chain_names[i];
+            chain[i]->instance_size = kObjectSize;
+            chain[i]->base_type = i > 0 ? chain[i - 1] : nullptr;
+        }
+        g_leaf.interfaces = g_interface_list;
+        g_leaf.interface_count = kInterfaces;
+        g_leaf.interface_vtables = g_interface_vtables;
+        g_leaf.interface_vtable_count = kInterfaces;
+        g_unrelated.name = g_unrelated.full_name = "Unrelated";
+        g_unrelated.instance_size = kObjectSize;
+    }
+} g_hierarchy_init;
+
+Object* make_leaf() {
+    ensure_runtime();
+    return object_alloc(&g_leaf);
+}
+
+// ===== GC =====
+
+void BM_GC_Alloc(benchmark::State& state) {
+    ensure_runtime();
+    auto size = static_cast<size_t>(state.range(0));
+    for (auto _ : state) benchmark::DoNotOptimize(gc::alloc(size, &g_root));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+BENCHMARK(BM_GC_Alloc)->Arg(24)->Arg(64)->Arg(256);
+
+// ===== Casts and interface dispatch =====
+
+void BM_IsInstanceOf_Exact(benchmark::State& state) {
+    auto* obj = make_leaf();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(obj);
+        benchmark::DoNotOptimize(object_is_instance_of(obj, &g_leaf));
+    }
+}
+BENCHMARK(BM_IsInstanceOf_Exact);
+
+void BM_IsInstanceOf_BaseClass(benchmark::State& state) {
+    auto* obj = make_leaf();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(obj);
+        benchmark::DoNotOptimize(object_is_instance_of(obj, &g_root));
+    }
+}
+BENCHMARK(BM_IsInstanceOf_BaseClass);
+
+void BM_IsInstanceOf_Interface(benchmark::State& state) {
+    auto* obj = make_leaf();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(obj);
+        benchmark::DoNotOptimize(object_is_instance_of(obj, &g_interfaces[kInterfaces - 1]));
+    }
+}
+BENCHMARK(BM_IsInstanceOf_Interface);
+
+void BM_IsInstanceOf_Miss(benchmark::State& state) {
+    auto* obj = make_leaf();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(obj);
+        benchmark::DoNotOptimize(object_is_instance_of(obj, &g_unrelated));
+    }
+}
+BENCHMARK(BM_IsInstanceOf_Miss);
+
+void BM_InterfaceVTable(benchmark::State& state) {
+    auto* obj = make_leaf();
+    auto* itf = &g_interfaces[state.range(0) - 1];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(obj);
+        benchmark::DoNotOptimize(obj_get_interface_vtable(obj, itf)->methods[0]);
+    }
+}
+BENCHMARK(BM_InterfaceVTable)->Arg(1)->Arg(kInterfaces);
+
+// ===== Monitor =====
+
+void BM_Monitor_EnterExit(benchmark::State& state) {
+    auto* obj = make_leaf();
+    for (auto _ : state) {
+        monitor::enter(obj);
+        monitor::exit(obj);
+    }
+}
+BENCHMARK(BM_Monitor_EnterExit);
+
+Object* g_shared_lock = nullptr;
+
+void BM_Monitor_Contended(benchmark::State& state) {
+    if (state.thread_index() == 0) g_shared_lock = make_leaf();
+    // Google Benchmark starts timing only once every thread reaches the loop
+    for (auto _ : state) {
+        monitor::enter(g_shared_lock);
+        benchmark::ClobberMemory();
+        monitor::exit(g_shared_lock);
+    }
+}
+BENCHMARK(BM_Monitor_Contended)->Threads(2)->Threads(4)->UseRealTime();
+
+// ===== Strings =====
+
+void BM_String_Concat2(benchmark::State& state) {
+    ensure_runtime();
+    auto* a = string_literal("Hello, ");
+    auto* b = string_literal("World");
+    for (auto _ : state) benchmark::DoNotOptimize(string_concat(a, b));
+}
+BENCHMARK(BM_String_Concat2);
+
+void BM_String_Concat3(benchmark::State& state) {
+    ensure_runtime();
+    auto* a = string_literal("key=");
+    auto* b = string_literal("value");
+    auto* c = string_literal(";");
+    for (auto _ : state) benchmark::DoNotOptimize(string_concat(a, b, c));
+}
+BENCHMARK(BM_String_Concat3);
+
+// ===== Dictionary<string, int> =====
+
+TypeInfo g_int32_type = {
+    .name = "Int32", .namespace_name = "System", .full_name = "System.Int32",
+    .instance_size = sizeof(Int32), .element_size = sizeof(Int32),
+    .flags = TypeFlags::ValueType | TypeFlags::Primitive,
+};
+
+TypeInfo g_dict_type = {
+    .name = "Dictionary_String_Int32",
+    .namespace_name = "System.Collections.Generic",
+    .full_name = "System.Collections.Generic.Dictionary`2<System.String,System.Int32>",
+    .instance_size = sizeof(DictBase),
+};
+
+constexpr int kDictKeys = 1024;
+
+struct DictFixture {
+    void* dict;
+    std::vector<String*> keys;
+    std::vector<String*> missing;
+
+    DictFixture() {
+        ensure_runtime();
+        dict = dict_create(&g_dict_type, &System_String_TypeInfo, &g_int32_type);
+        for (Int32 i = 0; i < kDictKeys; i++) {
+            keys.push_back(string_literal(("key" + std::to_string(i)).c_str()));
+            missing.push_back(string_literal(("absent" + std::to_string(i)).c_str()));
+            dict_set(dict, &keys.back(), &i);
+        }
+    }
+};
+
+DictFixture& dict_fixture() {
+    static DictFixture fixture;
+    return fixture;
+}
+
+void BM_Dict_Set(benchmark::State& state) {
+    auto& f = dict_fixture();
+    Int32 i = 0;
+    for (auto _ : state) {
+        dict_set(f.dict, &f.keys[i & (kDictKeys - 1)], &i);
+        i++;
+    }
+}
+BENCHMARK(BM_Dict_Set);
+
+void BM_Dict_TryGetValue_Hit(benchmark::State& state) {
+    auto& f = dict_fixture();
+    Int32 i = 0, value = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dict_try_get_value(f.dict, &f.keys[i++ & (kDictKeys - 1)], &value));
+    }
+}
+BENCHMARK(BM_Dict_TryGetValue_Hit);
+
+void BM_Dict_TryGetValue_Miss(benchmark::State& state) {
+    auto& f = dict_fixture();
+    Int32 i = 0, value = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dict_try_get_value(f.dict, &f.missing[i++ & (kDictKeys - 1)], &value));
+    }
+}
+BENCHMARK(BM_Dict_TryGetValue_Miss);
+
+// ===== Task =====
+
+void BM_Task_CreateComplete(benchmark::State& state) {
+    ensure_runtime();
+    for (auto _ : state) {
+        auto* t = task_create_pending();
+        task_complete(t);
+        benchmark::DoNotOptimize(t);
+    }
+}
+BENCHMARK(BM_Task_CreateComplete);
+
+void BM_Task_CreateComplete_Continuation(benchmark::State& state) {
+    ensure_runtime();
+    int64_t ran = 0;
+    for (auto _ : state) {
+        auto* t = task_create_pending();
+        task_add_continuation(t, [](void* s) { ++*static_cast<int64_t*>(s); }, &ran);
+        task_complete(t);
+    }
+    benchmark::DoNotOptimize(ran);
+}
+BENCHMARK(BM_Task_CreateComplete_Continuation);
+
+// ===== ThreadPool =====
+
+void BM_ThreadPool_QueueWork(benchmark::State& state) {
+    ensure_runtime();
+    constexpr int kBatch = 256;
+    std::atomic<int> done{0};
+    for (auto _ : state) {
+        done.store(0, std::memory_order_relaxed);
+        for (int i = 0; i < kBatch; i++) {
+            threadpool::queue_work([](void* s) {
+                static_cast<std::atomic<int>*>(s)->fetch_add(1, std::memory_order_release);
+            }, &done);
+        }
+        while (done.load(std::memory_order_acquire) < kBatch) std::this_thread::yield();
+    }
+    state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK(BM_ThreadPool_QueueWork)->UseRealTime();
+
+} // namespace
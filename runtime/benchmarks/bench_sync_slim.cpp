@@ -0,0 +1,142 @@
+/**
+ * CIL2CPP Runtime Benchmarks - SemaphoreSlim / ManualResetEventSlim
+ *
+ *   - Semaphore_Uncontended: Wait(0) + Release(1) on a free semaphore (CAS fast path).
+ *   - Semaphore_Lock:        threads use a count-1 semaphore as a lock around a tiny
+ *                            critical section (spin-then-park under contention).
+ *   - Semaphore_PingPong:    two threads hand a count back and forth over a pair of
+ *                            semaphores; one iteration is a full round trip (compare
+ *                            BM_WaitHandle_SignalToWake).
+ *   - Semaphore_WaitAsync:   WaitAsync on an empty semaphore, then Release hands the count
+ *                            to the queued waiter and completes its Task<bool>.
+ *   - Event_PingPong:        round trip over a pair of ManualResetEventSlims (Wait, Reset, Set).
+ */
+
+#include <benchmark/benchmark.h>
+#include <cil2cpp/sync_slim.h>
+#include <cil2cpp/type_info.h>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+using namespace cil2cpp;
+using namespace cil2cpp::icall;
+
+namespace {
+
+constexpr CancellationToken kNone{nullptr};
+
+struct BenchStrongBox {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    bool f_Value;
+};
+
+struct BenchSemaphore {
+    BenchStrongBox disposed{};
+    SemaphoreSlimLayout layout{};
+
+    BenchSemaphore(Int32 initial, Int32 max) {
+        layout.f_m_currentCount = initial;
+        layout.f_m_maxCount = max;
+        layout.f_m_lockObjAndDisposed = &disposed;
+    }
+};
+
+ManualResetEventSlimLayout make_event() {
+    ManualResetEventSlimLayout e{};
+    e.f_m_combinedState = 35 << 19;   // default SpinCount on multiprocessors
+    return e;
+}
+
+// Task<bool> stand-in (Task fields followed by m_result), registered once
+struct BenchBoolTask {
+    Task base;
+    bool f_m_result;
+};
+
+TypeInfo g_bool_task_type{};
+
+void BM_SyncSlim_Semaphore_Uncontended(benchmark::State& state) {
+    BenchSemaphore s(1, 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(SemaphoreSlim_Wait(&s.layout, 0, kNone));
+        SemaphoreSlim_Release(&s.layout, 1);
+    }
+}
+BENCHMARK(BM_SyncSlim_Semaphore_Uncontended);
+
+BenchSemaphore g_lock(1, 1);
+
+void BM_SyncSlim_Semaphore_Lock(benchmark::State& state) {
+    static long long counter = 0;
+    for (auto _ : state) {
+        SemaphoreSlim_Wait(&g_lock.layout, -1, kNone);
+        benchmark::DoNotOptimize(++counter);
+        SemaphoreSlim_Release(&g_lock.layout, 1);
+    }
+}
+BENCHMARK(BM_SyncSlim_Semaphore_Lock)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_SyncSlim_Semaphore_PingPong(benchmark::State& state) {
+    BenchSemaphore ping(0, 1);
+    BenchSemaphore pong(0, 1);
+    std::atomic<bool> stop{false};
+    std::thread echo([&] {
+        for (;;) {
+            SemaphoreSlim_Wait(&ping.layout, -1, kNone);
+            if (stop.load(std::memory_order_relaxed)) break;
+            SemaphoreSlim_Release(&pong.layout, 1);
+        }
+    });
+
+    for (auto _ : state) {
+        SemaphoreSlim_Release(&ping.layout, 1);
+        SemaphoreSlim_Wait(&pong.layout, -1, kNone);
+    }
+
+    stop = true;
+    SemaphoreSlim_Release(&ping.layout, 1);
+    echo.join();
+}
+BENCHMARK(BM_SyncSlim_Semaphore_PingPong)->UseRealTime();
+
+void BM_SyncSlim_Semaphore_WaitAsync(benchmark::State& state) {
+    g_bool_task_type.instance_size = sizeof(BenchBoolTask);
+    task_set_bool_typeinfo(&g_bool_task_type, sizeof(BenchBoolTask), offsetof(BenchBoolTask, f_m_result));
+    BenchSemaphore s(0, 1);
+    for (auto _ : state) {
+        Task* t = SemaphoreSlim_WaitAsync(&s.layout, -1, kNone);
+        SemaphoreSlim_Release(&s.layout, 1);   // no thread pool here: completes inline
+        benchmark::DoNotOptimize(task_is_completed(t));
+    }
+}
+BENCHMARK(BM_SyncSlim_Semaphore_WaitAsync);
+
+void BM_SyncSlim_Event_PingPong(benchmark::State& state) {
+    auto ping = make_event();
+    auto pong = make_event();
+    std::atomic<bool> stop{false};
+    std::thread echo([&] {
+        for (;;) {
+            ManualResetEventSlim_Wait(&ping, -1, kNone);
+            ManualResetEventSlim_Reset(&ping);
+            if (stop.load(std::memory_order_relaxed)) break;
+            ManualResetEventSlim_Set(&pong);
+        }
+    });
+
+    for (auto _ : state) {
+        ManualResetEventSlim_Set(&ping);
+        ManualResetEventSlim_Wait(&pong, -1, kNone);
+        ManualResetEventSlim_Reset(&pong);
+    }
+
+    stop = true;
+    ManualResetEventSlim_Set(&ping);
+    echo.join();
+}
+BENCHMARK(BM_SyncSlim_Event_PingPong)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,95 @@
+/**
+ * CIL2CPP Runtime Benchmarks - Wait handles
+ *
+ *   - SignalToWake:  two threads ping-pong over a pair of auto-reset events; one iteration
+ *                    is a full round trip (two signal-to-wake hand-offs).
+ *   - WaitAny64:     a waiter blocks in WaitAny over 64 auto-reset events while another
+ *                    thread sets one of them (round-robin); acknowledged via a reply event.
+ *   - WaitAny64_Signaled: WaitAny over 64 events where Arg is the index already set
+ *                    (no blocking; measures the scan).
+ */
+
+#include <benchmark/benchmark.h>
+#include <cil2cpp/waithandle.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace cil2cpp;
+using namespace cil2cpp::icall;
+
+namespace {
+
+constexpr Int32 kAutoReset = 0;
+constexpr int kHandles = 64;
+
+void BM_WaitHandle_SignalToWake(benchmark::State& state) {
+    intptr_t ping = EventWaitHandle_CreateEventCoreWin32(false, kAutoReset);
+    intptr_t pong = EventWaitHandle_CreateEventCoreWin32(false, kAutoReset);
+    std::atomic<bool> stop{false};
+    std::thread echo([&] {
+        for (;;) {
+            WaitHandle_WaitOneCore(ping, -1);
+            if (stop.load(std::memory_order_relaxed)) break;
+            EventWaitHandle_Set(pong);
+        }
+    });
+
+    for (auto _ : state) {
+        EventWaitHandle_Set(ping);
+        WaitHandle_WaitOneCore(pong, -1);
+    }
+
+    stop = true;
+    EventWaitHandle_Set(ping);
+    echo.join();
+    WaitHandle_CloseHandle(ping);
+    WaitHandle_CloseHandle(pong);
+}
+BENCHMARK(BM_WaitHandle_SignalToWake)->UseRealTime();
+
+void BM_WaitHandle_WaitAny64(benchmark::State& state) {
+    std::vector<intptr_t> events(kHandles);
+    for (auto& h : events) h = EventWaitHandle_CreateEventCoreWin32(false, kAutoReset);
+    intptr_t reply = EventWaitHandle_CreateEventCoreWin32(false, kAutoReset);
+    std::atomic<bool> stop{false};
+    std::thread waiter([&] {
+        for (;;) {
+            WaitHandle_WaitMultipleIgnoringSyncContext(events.data(), kHandles, false, -1);
+            if (stop.load(std::memory_order_relaxed)) break;
+            EventWaitHandle_Set(reply);
+        }
+    });
+
+    int next = 0;
+    for (auto _ : state) {
+        EventWaitHandle_Set(events[next]);
+        next = (next + 1) % kHandles;
+        WaitHandle_WaitOneCore(reply, -1);
+    }
+
+    stop = true;
+    EventWaitHandle_Set(events[0]);
+    waiter.join();
+    for (auto h : events) WaitHandle_CloseHandle(h);
+    WaitHandle_CloseHandle(reply);
+}
+BENCHMARK(BM_WaitHandle_WaitAny64)->UseRealTime();
+
+void BM_WaitHandle_WaitAny64_Signaled(benchmark::State& state) {
+    std::vector<intptr_t> events(kHandles);
+    for (auto& h : events) h = EventWaitHandle_CreateEventCoreWin32(false, kAutoReset);
+    intptr_t signaled = events[state.range(0)];
+
+    for (auto _ : state) {
+        EventWaitHandle_Set(signaled);
+        benchmark::DoNotOptimize(
+            WaitHandle_WaitMultipleIgnoringSyncContext(events.data(), kHandles, false, 0));
+    }
+
+    for (auto h : events) WaitHandle_CloseHandle(h);
+}
+BENCHMARK(BM_WaitHandle_WaitAny64_Signaled)->Arg(0)->Arg(63);
+
+} // namespace
@@ -0,0 +1,64 @@
+# CIL2CPP - resolve a hot-function order file to linker symbols (script mode).
+#
+# The compiler's call-graph layout writes <Project>.order: one unmangled C++ function
+# name per line. Generated methods have C++ linkage, so the linker sees Itanium-mangled
+# names (_Z<len><name><params>). This script scans the object files' symbol tables and
+# emits the mangled symbols in order, ready for lld's --symbol-ordering-file.
+#
+# Usage:
+#   cmake -DNM=<nm> -DOBJECTS=<a.o|b.o|...> -DINPUT=<Project.order> -DOUTPUT=<file> -P cil2cppSymbolOrder.cmake
+
+if(NOT NM OR NOT OBJECTS OR NOT INPUT OR NOT OUTPUT)
+    message(FATAL_ERROR "cil2cppSymbolOrder: NM, OBJECTS, INPUT and OUTPUT are required")
+endif()
+
+string(REPLACE "|" ";" _objects "${OBJECTS}")
+execute_process(
+    COMMAND "${NM}" --defined-only ${_objects}
+    OUTPUT_VARIABLE _nm_out
+    RESULT_VARIABLE _nm_result
+    ERROR_QUIET)
+if(NOT _nm_result EQUAL 0)
+    # Ordering is an optimization: never fail the link over it
+    message(WARNING "cil2cppSymbolOrder: ${NM} failed (${_nm_result}), writing empty order")
+    file(WRITE "${OUTPUT}" "")
+    return()
+endif()
+
+# Index text symbols by the function name they mangle: _Z<len><name>... → name
+string(REPLACE "\n" ";" _nm_lines "${_nm_out}")
+foreach(_line IN LISTS _nm_lines)
+    if(NOT _line MATCHES "^[0-9a-fA-F]+ [Tt] (.+)$")
+        continue()
+    endif()
+    set(_sym "${CMAKE_MATCH_1}")
+    if(_sym MATCHES "^_Z([0-9]+)")
+        set(_len "${CMAKE_MATCH_1}")
+        string(LENGTH "_Z${_len}" _prefix)
+        string(SUBSTRING "${_sym}" ${_prefix} ${_len} _name)
+    else()
+        set(_name "${_sym}")
+    endif()
+    list(APPEND _cil2cpp_sym_${_name} "${_sym}")
+endforeach()
+
+file(STRINGS "${INPUT}" _order)
+set(_content "")
+set(_resolved 0)
+foreach(_name IN LISTS _order)
+    if(_name STREQUAL "" OR _name MATCHES "^#")
+        continue()
+    endif()
+    if(NOT DEFINED _cil2cpp_sym_${_name})
+        continue()
+    endif()
+    # Inline/COMDAT definitions appear once per object file
+    list(REMOVE_DUPLICATES _cil2cpp_sym_${_name})
+    foreach(_sym IN LISTS _cil2cpp_sym_${_name})
+        string(APPEND _content "${_sym}\n")
+        math(EXPR _resolved "${_resolved} + 1")
+    endforeach()
+endforeach()
+
+file(WRITE "${OUTPUT}" "${_content}")
+message(STATUS "cil2cppSymbolOrder: ${_resolved} hot symbols -> ${OUTPUT}")
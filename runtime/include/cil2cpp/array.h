@@ -167,6 +167,11 @@ TypeInfo* get_szarray_type_info(TypeInfo* element_type);
  */
 void array_set_system_array_typeinfo(TypeInfo* system_array_ti);
 
+/**
+ * Call visit(type, context) for every SZArray TypeInfo created so far (heap snapshots).
+ */
+void array_for_each_szarray_type_info(void (*visit)(TypeInfo* type, void* context), void* context);
+
 /// Array generic interface vtable adapter: T[] implements IList<T>, ICollection<T>, etc.
 /// Returns a synthesized InterfaceVTable for array-to-generic-interface dispatch, or nullptr.
 InterfaceVTable* array_get_generic_interface_vtable(TypeInfo* array_type, TypeInfo* interface_type);
@@ -14,6 +14,7 @@ namespace cil2cpp {
 
 // Forward declarations
 struct String;
+struct ManagedMethodInfo;
 
 // TypeInfo for assembly/property reflection types
 extern TypeInfo System_Reflection_Assembly_TypeInfo;
@@ -32,6 +33,9 @@ struct ManagedAssembly : Object {
  */
 struct ManagedPropertyInfo : Object {
     PropertyInfo* native_info;
+    String* cached_name;                // Name, materialized on first access
+    ManagedMethodInfo* cached_getter;   // GetGetMethod()/GetSetMethod() results
+    ManagedMethodInfo* cached_setter;
 };
 
 } // namespace cil2cpp
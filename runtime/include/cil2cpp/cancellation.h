@@ -45,18 +45,19 @@ void cts_cancel(CancellationTokenSource* cts);
 /** Cancel after a delay in milliseconds (thread pool). */
 void cts_cancel_after(CancellationTokenSource* cts, Int32 milliseconds);
 
-/** Check if cancellation has been requested. Thread-safe (acquire load). */
+/**
+ * Check if cancellation has been requested. Thread-safe (acquire load).
+ * _state is the BCL's: 0 = not canceled, 1 = notifying callbacks, 2 = notification done.
+ */
 inline Boolean cts_is_cancellation_requested(CancellationTokenSource* cts) {
     if (!cts) return false;
-    return std::atomic_ref<Int32>(cts->f__state).load(std::memory_order_acquire) == 1;
+    return std::atomic_ref<Int32>(cts->f__state).load(std::memory_order_acquire) != 0;
 }
 
-/** Dispose the token source (prevents further cancellation). Thread-safe CAS. */
+/** Dispose the token source. Like the BCL's, this does not cancel it. */
 inline void cts_dispose(CancellationTokenSource* cts) {
     if (!cts) return;
-    Int32 expected = 0;
-    std::atomic_ref<Int32>(cts->f__state).compare_exchange_strong(
-        expected, 2, std::memory_order_acq_rel);
+    std::atomic_ref<Boolean>(cts->f__disposed).store(true, std::memory_order_release);
 }
 
 /** Get the CancellationToken for this source. */
@@ -64,12 +65,72 @@ inline CancellationToken cts_get_token(CancellationTokenSource* cts) {
     return CancellationToken{ cts };
 }
 
+// ===== Runtime cancellation wakes =====
+
+/**
+ * A runtime waiter's interest in a source's cancellation (SemaphoreSlim and
+ * ManualResetEventSlim waits). The runtime cannot register managed callbacks, so sources
+ * keep these in a side table and cancellation runs them before the managed callbacks.
+ *
+ * `wake` runs on the canceling thread with no runtime lock held, and must end with
+ * cts_wake_done(node) (or free nothing the unregistering thread still waits on).
+ */
+struct CancelWake {
+    void (*wake)(CancelWake* node);
+    void* context;
+    CancellationTokenSource* cts;
+    CancelWake* next;
+    CancelWake* prev;
+    std::atomic<Int32> state;   // 0 = registered, 1 = waking, 2 = woken
+};
+
+/**
+ * Register `node` (wake, context and cts set) to be woken when its source is canceled.
+ * Returns false, leaving it unregistered, if the source is already canceled.
+ */
+bool cts_register_wake(CancelWake* node);
+
+/**
+ * Unregister `node`. If cancellation already took it, waits until its wake has called
+ * cts_wake_done and returns true.
+ */
+bool cts_unregister_wake(CancelWake* node);
+
+/** True once cancellation has taken `node` (its wake is running or done). */
+inline bool cts_wake_fired(const CancelWake* node) {
+    return node->state.load(std::memory_order_acquire) != 0;
+}
+
+/** Called by a wake when it no longer touches `node`. */
+inline void cts_wake_done(CancelWake* node) {
+    node->state.store(2, std::memory_order_release);
+}
+
+/** Run the wakes registered on `cts`; called once, when it transitions to canceled. */
+void cts_fire_wakes(CancellationTokenSource* cts);
+
+/**
+ * Register the generated CancellationTokenSource.TransitionToCancellationRequested and
+ * ExecuteCallbackHandlers, which the NotifyCancellation ICall runs around the wakes.
+ */
+void cts_set_notify_methods(bool (*transition)(CancellationTokenSource*),
+                            void (*execute_callbacks)(CancellationTokenSource*, bool));
+
+namespace icall {
+
+/**
+ * CancellationTokenSource.NotifyCancellation(bool throwOnFirstException)
+ * Every Cancel / CancelAfter / linked-source path funnels here.
+ */
+void CancellationTokenSource_NotifyCancellation(void* self, bool throwOnFirstException);
+
+} // namespace icall
+
 // ===== CancellationToken API =====
 
 /** Check if cancellation has been requested. Thread-safe (acquire load). */
 inline Boolean ct_is_cancellation_requested(CancellationToken token) {
-    if (!token.f__source) return false;
-    return std::atomic_ref<Int32>(token.f__source->f__state).load(std::memory_order_acquire) == 1;
+    return cts_is_cancellation_requested(token.f__source);
 }
 
 /** Check if this token can be canceled (has a non-null source). */
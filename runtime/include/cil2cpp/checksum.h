@@ -0,0 +1,41 @@
+/**
+ * CIL2CPP Runtime - CRC32 / CRC32C / Adler-32
+ *
+ * Checksums behind CompressionNative_Crc32 (ZipArchive entry CRCs) and
+ * BitOperations.Crc32C. The implementation is picked once per process from the CPU:
+ *
+ *   x86-64: CRC32 by PCLMULQDQ folding, CRC32C by the SSE4.2 crc32 instruction,
+ *           Adler-32 by SSSE3 multiply-add.
+ *   arm64:  CRC32 / CRC32C by the ARMv8 CRC32 instructions.
+ *   other:  slicing-by-8 tables and a scalar Adler-32.
+ *
+ * crc32/crc32c/adler32 use zlib's conventions: pass the previous result (0 or 1 to
+ * start) and get the finished checksum back, so calls chain over split buffers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cil2cpp {
+namespace checksum {
+
+/// CRC-32 (IEEE 802.3, reflected 0xEDB88320) — same values as zlib's crc32().
+uint32_t crc32(uint32_t crc, const void* data, size_t length);
+
+/// CRC-32C (Castagnoli, reflected 0x82F63B78) — iSCSI / ext4 / Crc32C.
+uint32_t crc32c(uint32_t crc, const void* data, size_t length);
+
+/// Adler-32 — same values as zlib's adler32(); start with 1.
+uint32_t adler32(uint32_t adler, const void* data, size_t length);
+
+/// Name of the selected implementation, e.g. "x86-64 pclmul/sse4.2/ssse3" or "portable".
+const char* implementation();
+
+/// Switch between the CPU-specific and the portable implementation (tests, benchmarks).
+/// Returns whether hardware acceleration is in effect afterwards.
+bool use_hardware(bool enabled);
+
+} // namespace checksum
+} // namespace cil2cpp
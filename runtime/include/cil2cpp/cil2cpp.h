@@ -35,6 +35,13 @@
 #include "interop.h"
 #include "safe_handle.h"
 #include "waithandle.h"
+#include "sync_slim.h"
+#include "checksum.h"
+#include "profiler.h"
+#include "counters.h"
+#include "contention.h"
+#include "exception_stats.h"
+#include "heap_snapshot.h"
 #include "eventsource.h"
 #include "interop_stubs.h"
 
@@ -276,6 +283,13 @@ inline int32_t bit_pop_count64(uint64_t value) {
 #endif
 }
 
+// BitOperations.Crc32C: one CRC-32C step, no pre/post inversion (the Sse42.Crc32 /
+// ArmBase.Crc32C contract). Hardware instruction when available (see checksum.h).
+uint32_t bit_crc32c_u8(uint32_t crc, uint8_t data);
+uint32_t bit_crc32c_u16(uint32_t crc, uint16_t data);
+uint32_t bit_crc32c_u32(uint32_t crc, uint32_t data);
+uint32_t bit_crc32c_u64(uint32_t crc, uint64_t data);
+
 /**
  * Initialize the CIL2CPP runtime.
  * Must be called before any other runtime functions.
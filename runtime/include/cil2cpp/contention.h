@@ -0,0 +1,121 @@
+/**
+ * CIL2CPP Runtime - Lock Contention Profiler
+ *
+ * Opt-in: records how long threads wait for a contended lock, per lock site.
+ *   - Monitors (C# `lock`, Monitor.Enter): the locked object's type plus the calling
+ *     method, named from a short stack captured only when the enter had to wait.
+ *   - Runtime-internal locks: each is a contention::Mutex with a static name
+ *     ("monitor.sync_table", "threadpool.queue", ...).
+ * Uncontended acquisitions cost one relaxed load plus the try_lock they already did.
+ *
+ * Enabled by environment variables read in runtime_init:
+ *
+ *   CIL2CPP_LOCK_PROFILE=<target>     stderr | stdout | <path> ("%p" expands to the pid);
+ *                                     the report is written there at runtime_shutdown.
+ *   CIL2CPP_LOCK_PROFILE_TOP=<n>      sites in the report, by total wait (default 20).
+ *
+ * Monitor.LockContentionCount counts contended monitor enters whether or not this is on.
+ * Re-acquiring a lock inside a condition-variable wait is not measured.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cil2cpp {
+
+struct TypeInfo;
+
+namespace contention {
+
+/// Per-site totals of a named runtime lock; registers itself for the report.
+struct Site {
+    explicit Site(const char* name);
+    Site(const Site&) = delete;
+    Site& operator=(const Site&) = delete;
+
+    const char* name;
+    std::atomic<uint64_t> contentions{0};
+    std::atomic<uint64_t> wait_ns{0};
+    std::atomic<uint64_t> max_wait_ns{0};
+    Site* next = nullptr;
+};
+
+inline std::atomic<bool> g_enabled{false};
+
+inline bool is_enabled() { return g_enabled.load(std::memory_order_relaxed); }
+
+int64_t now_ns();
+
+/// Add one contended acquisition that waited `wait_ns`.
+void record(Site& site, int64_t wait_ns);
+
+/// Same, for a monitor on an object of `type`; captures the caller's stack.
+void record_monitor(const TypeInfo* type, int64_t wait_ns);
+
+/// Lock any Lockable (a mutex, or a deferred std::unique_lock), timing the wait if the
+/// lock was held and profiling is on.
+template <class Lockable>
+void lock(Lockable& lockable, Site& site) {
+    if (!is_enabled()) {
+        lockable.lock();
+        return;
+    }
+    if (lockable.try_lock()) return;
+    int64_t start = now_ns();
+    lockable.lock();
+    record(site, now_ns() - start);
+}
+
+/// std::mutex whose contention is reported under a static name.
+class Mutex {
+public:
+    explicit Mutex(const char* name) : site_(name) {}
+
+    void lock() { contention::lock(mutex_, site_); }
+    bool try_lock() { return mutex_.try_lock(); }
+    void unlock() { mutex_.unlock(); }
+
+    /// Locked std::unique_lock on the underlying mutex, for condition_variable waits.
+    std::unique_lock<std::mutex> acquire() {
+        std::unique_lock<std::mutex> guard(mutex_, std::defer_lock);
+        contention::lock(guard, site_);
+        return guard;
+    }
+
+private:
+    std::mutex mutex_;
+    Site site_;
+};
+
+/// One row of the report.
+struct Entry {
+    std::string site;           // "monitor System.Object @ MyApp.Worker.Run" / "runtime threadpool.queue"
+    uint64_t contentions;
+    uint64_t wait_ns;
+    uint64_t max_wait_ns;
+};
+
+void enable();
+void disable();
+
+/// Drop everything recorded so far.
+void reset();
+
+/// Sites with at least one contention, by total wait descending.
+std::vector<Entry> entries();
+
+/// Text table of the top `top` entries (all if 0).
+std::string report(size_t top = 20);
+
+/// runtime_init / runtime_shutdown: honour CIL2CPP_LOCK_PROFILE, write the report at exit.
+void init();
+void shutdown();
+
+} // namespace contention
+} // namespace cil2cpp
@@ -0,0 +1,118 @@
+/**
+ * CIL2CPP Runtime - Runtime Counters
+ *
+ * Native source of the `System.Runtime` counter set dashboards read with dotnet-counters
+ * (cpu-usage, gc-heap-size, gen-N-gc-count, alloc-rate, threadpool-*, exception-count, ...).
+ * The same readings back the BCL APIs those counters poll — GC.CollectionCount,
+ * GC.GetTotalAllocatedBytes, ThreadPool.ThreadCount / PendingWorkItemCount /
+ * CompletedWorkItemCount, Monitor.LockContentionCount, Environment.WorkingSet — so
+ * `Meter` observable instruments built on them report real values. EventSource is a
+ * no-op in compiled programs (eventsource.h), so the counters are not published as
+ * EventCounters. A program that uses MeterListener gets them as the "System.Runtime"
+ * Meter instead (publish_meter), and any program can dump them periodically, with no
+ * tooling attached.
+ *
+ * Enabled by environment variables read in runtime_init:
+ *
+ *   CIL2CPP_COUNTERS=<target>         stderr | stdout | fd:<n> | <path> ("%p" expands to
+ *                                     the pid; a file is truncated first).
+ *   CIL2CPP_COUNTERS_INTERVAL=<sec>   refresh interval, fractions allowed (default 1).
+ *   CIL2CPP_COUNTERS_FORMAT=json      one JSON object per line instead of the text table;
+ *                                     the default for a path ending in .json / .jsonl.
+ *
+ * A final record is written at runtime_shutdown.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace cil2cpp {
+
+struct Delegate;
+struct Object;
+struct String;
+struct TypeInfo;
+
+namespace counters {
+
+/// Cumulative readings at one instant; rates come from the difference of two.
+struct Sample {
+    int64_t timestamp_ns = 0;            // steady clock
+    int64_t cpu_time_ns = 0;             // process user + system time
+    int64_t working_set_bytes = 0;
+    int64_t gc_heap_size_bytes = 0;      // in use (GC.GetTotalMemory(false))
+    int64_t gc_committed_bytes = 0;
+    int64_t gc_fragmented_bytes = 0;     // free space inside the committed heap
+    int64_t gc_count = 0;
+    int64_t gc_pause_ns = 0;
+    int64_t allocated_bytes = 0;
+    int64_t threadpool_thread_count = 0;
+    int64_t threadpool_queue_length = 0;
+    int64_t threadpool_completed_items = 0;
+    int64_t lock_contention_count = 0;
+    int64_t exception_count = 0;
+};
+
+/// One counter as dotnet-counters names and displays it.
+struct Value {
+    const char* name;            // "gc-heap-size"
+    const char* display_name;    // "GC Heap Size (MB)"
+    double value;
+};
+
+enum class Format { Text, Json };
+
+Sample read();
+
+/// Counter values for the interval between two samples; rates are per second.
+std::vector<Value> compute(const Sample& previous, const Sample& current);
+
+/// One dump record: a "[System.Runtime]" table, or a JSON object line.
+std::string format(const std::vector<Value>& values, Format format);
+
+/// Current resident set size of the process (Environment.WorkingSet).
+int64_t working_set();
+
+/// Dump to `out` every `interval_ms` from a background thread. `out` stays open after
+/// stop(). Returns false if a dump is already running.
+bool start(FILE* out, int interval_ms = 1000, Format format = Format::Text);
+
+/// Stop the dump thread, writing one last record.
+void stop();
+
+bool is_running();
+
+/// System.Diagnostics.Metrics entry points of the compiled program, registered by generated
+/// code when it uses MeterListener. The instrument factories are the
+/// Meter.CreateObservable*<T>(name, Func<T>, unit, description) overloads.
+struct MeterFactories {
+    using CreateInstrument = void (*)(Object* meter, String* name, Delegate* observe,
+                                      String* unit, String* description);
+
+    Object* (*create_meter)(String* name);       // new Meter(name)
+    TypeInfo* func_int64;                        // Func<long>
+    TypeInfo* func_double;                       // Func<double>
+    CreateInstrument counter_int64;
+    CreateInstrument up_down_counter_int64;
+    CreateInstrument counter_double;
+};
+
+void set_meter_factories(const MeterFactories& factories);
+
+/// Create the "System.Runtime" Meter with one observable instrument per reading, named as
+/// .NET 9's RuntimeMetrics names them (dotnet.gc.collections, dotnet.process.cpu.time, ...).
+/// The meter registers itself like any other, so a MeterListener started afterwards is
+/// offered its instruments and RecordObservableInstruments reads them. Runs once; false
+/// if no factories are registered.
+bool publish_meter();
+
+/// runtime_init / runtime_shutdown: honour CIL2CPP_COUNTERS.
+void init();
+void shutdown();
+
+} // namespace counters
+} // namespace cil2cpp
@@ -102,6 +102,7 @@ struct TypeInitializationException : Exception {
     String* f__typeName;  // System.TypeInitializationException._typeName
 };
 struct TimeoutException : Exception {};
+struct ApplicationException : Exception {};
 
 // --- Task-related exceptions ---
 struct AggregateException : Exception {
@@ -126,6 +127,9 @@ struct TaskCanceledException : OperationCanceledException {
     void* f__canceledTask;  // System.Threading.Tasks.TaskCanceledException._canceledTask
 };
 
+// --- Threading ---
+struct SemaphoreFullException : Exception {};
+
 // --- IO ---
 struct IOException : Exception {};
 struct FileNotFoundException : IOException {};
@@ -133,6 +137,7 @@ struct DirectoryNotFoundException : IOException {};
 
 // --- Reflection ---
 struct MissingMethodException : Exception {};
+struct TargetParameterCountException : Exception {};
 struct DllNotFoundException : Exception {};
 
 // --- Collections ---
@@ -158,6 +163,35 @@ extern thread_local ExceptionContext* g_exception_context;
  */
 [[noreturn]] void throw_exception(Exception* ex);
 
+/**
+ * Continue unwinding an exception that is already in flight (left a finally block or
+ * matched no catch). Unlike throw_exception, this is not a new throw.
+ */
+[[noreturn]] void propagate_exception(Exception* ex);
+
+/**
+ * A catch clause (or an accepting filter) took the exception this thread was unwinding.
+ */
+void exception_caught();
+
+/**
+ * Number of throws so far, rethrows included (the exception-count runtime counter).
+ */
+uint64_t exception_count();
+
+/// Exception.GetExceptionCount
+inline UInt32 exception_get_count() { return static_cast<UInt32>(exception_count()); }
+
+/**
+ * AppDomain.FirstChanceException (AppContext.add_/remove_FirstChanceException ICalls).
+ * Handlers run on every throw, rethrows included, before any catch or finally runs.
+ * The compiler registers the FirstChanceExceptionEventArgs layout in
+ * __init_runtime_vtables; until then handlers are kept but not raised.
+ */
+void exception_set_first_chance_args_typeinfo(TypeInfo* type, size_t size, size_t exception_offset);
+void exception_add_first_chance_handler(void* handler);
+void exception_remove_first_chance_handler(void* handler);
+
 /**
  * Create and throw a NullReferenceException.
  */
@@ -198,6 +232,8 @@ extern thread_local ExceptionContext* g_exception_context;
 [[noreturn]] void throw_object_disposed();
 [[noreturn]] void throw_key_not_found();
 [[noreturn]] void throw_timeout();
+[[noreturn]] void throw_mutex_not_owned();
+[[noreturn]] void throw_semaphore_full();
 [[noreturn]] void throw_rank();
 [[noreturn]] void throw_array_type_mismatch();
 [[noreturn]] void throw_type_initialization(const char* type_name);
@@ -209,6 +245,7 @@ extern thread_local ExceptionContext* g_exception_context;
 [[noreturn]] void throw_file_not_found(const char* path);
 [[noreturn]] void throw_directory_not_found(const char* path);
 [[noreturn]] void throw_missing_method();
+[[noreturn]] void throw_target_parameter_count();
 [[noreturn]] void throw_dll_not_found(String* libraryName);
 
 /**
@@ -265,13 +302,16 @@ extern TypeInfo RankException_TypeInfo;
 extern TypeInfo ArrayTypeMismatchException_TypeInfo;
 extern TypeInfo TypeInitializationException_TypeInfo;
 extern TypeInfo TimeoutException_TypeInfo;
+extern TypeInfo ApplicationException_TypeInfo;
 extern TypeInfo AggregateException_TypeInfo;
 extern TypeInfo OperationCanceledException_TypeInfo;
 extern TypeInfo TaskCanceledException_TypeInfo;
 extern TypeInfo KeyNotFoundException_TypeInfo;
+extern TypeInfo SemaphoreFullException_TypeInfo;
 extern TypeInfo IOException_TypeInfo;
 extern TypeInfo FileNotFoundException_TypeInfo;
 extern TypeInfo DirectoryNotFoundException_TypeInfo;
+extern TypeInfo TargetParameterCountException_TypeInfo;
 
 /// System.Exception.ExceptionMessageKind enum values
 /// Used by GetMessageFromNativeResources to select a generic error message.
@@ -284,6 +324,14 @@ enum class ExceptionMessageKind : Int32 {
 } // namespace cil2cpp
 
 // Exception handling macros for generated code
+
+// The current handler takes the exception: END_TRY won't propagate it further.
+#define CIL2CPP_MARK_CAUGHT \
+    do { \
+        __exc_caught = true; \
+        cil2cpp::exception_caught(); \
+    } while(0)
+
 #define CIL2CPP_TRY \
     { \
         cil2cpp::ExceptionContext __exc_ctx; \
@@ -297,14 +345,14 @@ enum class ExceptionMessageKind : Int32 {
 #define CIL2CPP_CATCH_ALL \
         } else { \
             __exc_ctx.state = 1; \
-            __exc_caught = true;
+            CIL2CPP_MARK_CAUGHT;
 
 #define CIL2CPP_CATCH(ExceptionType) \
         } else if (cil2cpp::object_is_instance_of( \
             reinterpret_cast<cil2cpp::Object*>(__exc_ctx.current_exception), \
             &ExceptionType##_TypeInfo)) { \
             __exc_ctx.state = 1; \
-            __exc_caught = true;
+            CIL2CPP_MARK_CAUGHT;
 
 #define CIL2CPP_FINALLY \
         } \
@@ -317,13 +365,13 @@ enum class ExceptionMessageKind : Int32 {
             cil2cpp::Exception* __pending = __exc_ctx.current_exception; \
             cil2cpp::g_exception_context = __exc_ctx.previous; \
             if (__pending && !__exc_caught) { \
-                cil2cpp::throw_exception(__pending); \
+                cil2cpp::propagate_exception(__pending); \
             } \
         } \
     }
 
 // Filter begin: like CATCH_ALL but does NOT set __exc_caught.
-// The endfilter instruction decides whether to accept (set __exc_caught) or reject (rethrow).
+// The endfilter instruction decides whether to accept (CIL2CPP_MARK_CAUGHT) or reject.
 #define CIL2CPP_FILTER_BEGIN \
         } else { \
             __exc_ctx.state = 1;
@@ -334,3 +382,12 @@ enum class ExceptionMessageKind : Int32 {
         cil2cpp::g_exception_context = cil2cpp::g_exception_context->previous; \
         cil2cpp::throw_exception(__rethrow_ex); \
     } while(0)
+
+// Filter rejected the exception: keep unwinding it to the outer scope. Unlike
+// CIL2CPP_RETHROW this is not a new throw (no exception count, no FirstChanceException).
+#define CIL2CPP_FILTER_REJECT \
+    do { \
+        cil2cpp::Exception* __rejected_ex = cil2cpp::g_exception_context->current_exception; \
+        cil2cpp::g_exception_context = cil2cpp::g_exception_context->previous; \
+        cil2cpp::propagate_exception(__rejected_ex); \
+    } while(0)
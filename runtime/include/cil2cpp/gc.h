@@ -6,6 +6,8 @@
 
 #include "types.h"
 
+#include <type_traits>
+
 namespace cil2cpp {
 namespace gc {
 
@@ -74,6 +76,31 @@ void register_thread();
  */
 void unregister_thread();
 
+/**
+ * Run fn(data) in a GC-safe region (BoehmGC's GC_do_blocking): a collection does not
+ * wait for this thread while fn runs, so a thread parked in a blocking native call
+ * (accept(), recv(), a futex wait) cannot hold up a stop-the-world. The caller's frames
+ * are still scanned, so objects it holds stay alive; fn itself must not allocate or
+ * store managed references. Unregistered threads and nested calls just run fn.
+ */
+void do_blocking(void (*fn)(void*), void* data);
+
+/// do_blocking for a callable; returns its result.
+template <class Fn>
+auto blocking(Fn fn) -> decltype(fn()) {
+    using Result = decltype(fn());
+    if constexpr (std::is_void_v<Result>) {
+        do_blocking([](void* f) { (*static_cast<Fn*>(f))(); }, &fn);
+    } else {
+        struct Call { Fn* fn; Result result; } call{&fn, Result{}};
+        do_blocking([](void* c) {
+            auto* call = static_cast<Call*>(c);
+            call->result = (*call->fn)();
+        }, &call);
+        return call.result;
+    }
+}
+
 /**
  * Allocate memory that the GC scans for pointers but never collects.
  * Use for native containers (std::unordered_map etc.) that store GC-allocated pointers.
@@ -108,11 +135,12 @@ inline void write_barrier(Object* obj, Object* value) {
  * GC statistics.
  */
 struct GCStats {
-    size_t total_allocated;
-    size_t total_freed;
-    size_t current_heap_size;
+    size_t total_allocated;       // bytes allocated since startup
+    size_t total_freed;           // total_allocated minus bytes still in use
+    size_t current_heap_size;     // mapped heap, including free blocks
     size_t collection_count;
-    double total_pause_time_ms;
+    double total_pause_time_ms;   // world-stopped time, summed over collections
+    size_t free_bytes;            // free space inside current_heap_size
 };
 
 /**
@@ -143,10 +171,12 @@ inline void gc_keep_alive(void* obj) {
 inline void gc_noop() {}
 inline void gc_noop(void*) {}
 
-/// GC.GetTotalMemory — returns approximate heap size
+/// GC.GetTotalMemory — bytes currently in use (heap minus its free blocks)
 inline Int64 gc_get_total_memory(bool forceFullCollection) {
     if (forceFullCollection) gc::collect();
-    return static_cast<Int64>(gc::get_stats().current_heap_size);
+    auto stats = gc::get_stats();
+    return static_cast<Int64>(stats.current_heap_size > stats.free_bytes
+        ? stats.current_heap_size - stats.free_bytes : 0);
 }
 
 /// GC.GetTotalMemory (no param version)
@@ -170,11 +200,29 @@ inline void gc_get_memory_info(void* data, Int32 /*kind*/) {
     // fields[2] = memoryLoadBytes               (leave 0)
     // fields[3] = heapSizeBytes
     fields[3] = static_cast<int64_t>(stats.current_heap_size);
-    // fields[4] = fragmentedBytes               (leave 0)
+    // fields[4] = fragmentedBytes
+    fields[4] = static_cast<int64_t>(stats.free_bytes);
     // fields[5] = totalCommittedBytes
     fields[5] = static_cast<int64_t>(stats.current_heap_size);
 }
 
+/// GC.CollectionCount — BoehmGC is not generational: every collection is a full one,
+/// which .NET counts in every generation up to the one collected.
+inline Int32 gc_collection_count(Int32 generation) {
+    if (generation < 0) return 0;
+    return static_cast<Int32>(gc::get_stats().collection_count);
+}
+
+/// GC.GetTotalAllocatedBytes
+inline Int64 gc_get_total_allocated_bytes(bool /*precise*/) {
+    return static_cast<Int64>(gc::get_stats().total_allocated);
+}
+
+/// GC._GetTotalPauseDuration — TimeSpan ticks (100 ns)
+inline Int64 gc_get_total_pause_duration() {
+    return static_cast<Int64>(gc::get_stats().total_pause_time_ms * 10000.0);
+}
+
 // GC.AllocateUninitializedArray<T>() is handled as a compiler intrinsic —
 // the IR builder replaces it with array_create(&ElementType_TypeInfo, length).
 // No runtime ICall needed.
@@ -1,9 +1,11 @@
 /**
  * CIL2CPP Runtime - GCHandle Implementation
  *
- * Provides pinned/normal/weak object handles that prevent GC collection.
- * With BoehmGC (conservative scanning), handles are simulated using a
- * simple handle table since BoehmGC scans all roots automatically.
+ * Provides pinned/normal/weak object handles. Normal/Pinned handles keep their target
+ * alive; Weak/WeakTrackResurrection handles read as null once the collector has
+ * reclaimed (or, for Weak, started finalizing) the target.
+ * All operations are thread-safe; Get on a strong handle and Alloc/Free on a thread with
+ * spare released handles take no lock.
  */
 
 #pragma once
@@ -17,14 +19,15 @@ enum class GCHandleType : Int32 {
     Weak = 0,
     WeakTrackResurrection = 1,
     Normal = 2,
-    Pinned = 3
+    Pinned = 3,
+    Dependent = 6  // runtime-internal (CoreCLR HNDTYPE_DEPENDENT): see dependent_handle_alloc
 };
 
 /// Initialize the GCHandle subsystem
 void gchandle_init();
 
 /// Allocate a GC handle for the given object
-/// Returns an opaque handle (intptr_t)
+/// Returns an opaque handle (intptr_t, always even), or 0 if the table is exhausted
 intptr_t gchandle_alloc(void* obj, GCHandleType type);
 
 /// Free a previously allocated GC handle
@@ -36,9 +39,36 @@ void* gchandle_get(intptr_t handle);
 /// Set the object referenced by a handle
 void gchandle_set(intptr_t handle, void* obj);
 
+/// Atomically replace the handle's target with `obj` if it currently is `comparand`.
+/// Returns the previous target.
+void* gchandle_compare_exchange(intptr_t handle, void* obj, void* comparand);
+
 /// Check if a handle is allocated
 bool gchandle_is_allocated(intptr_t handle);
 
+// ===== Dependent handles (System.Runtime.DependentHandle) =====
+// The ephemeron behind ConditionalWeakTable<TKey,TValue>: the target is held weakly and
+// the dependent only while the target is alive, even if the dependent references the
+// target. When a collection finds the target dead it clears both. Freed with
+// gchandle_free; all reads are lock-free.
+
+/// Allocate a dependent handle. Returns 0 if the table is exhausted.
+intptr_t dependent_handle_alloc(void* target, void* dependent);
+
+/// Target, or null once collected / cleared
+void* dependent_handle_get_target(intptr_t handle);
+
+/// Dependent (only meaningful while the target is non-null)
+void* dependent_handle_get_dependent(intptr_t handle);
+
+/// Target, and its dependent in *dependent (null when the target is null)
+void* dependent_handle_get_target_and_dependent(intptr_t handle, void** dependent);
+
+void dependent_handle_set_dependent(intptr_t handle, void* dependent);
+
+/// Clear the target and release the dependent (ConditionalWeakTable.Remove)
+void dependent_handle_set_target_to_null(intptr_t handle);
+
 namespace icall {
 
 /// System.Runtime.InteropServices.GCHandle.InternalAlloc(object, GCHandleType)
@@ -53,5 +83,14 @@ void GCHandle_InternalSet(intptr_t handle, void* obj);
 /// System.Runtime.InteropServices.GCHandle.InternalGet(IntPtr)
 void* GCHandle_InternalGet(intptr_t handle);
 
+/// System.Runtime.DependentHandle internal calls
+intptr_t DependentHandle_InternalInitialize(void* target, void* dependent);
+void* DependentHandle_InternalGetTarget(intptr_t handle);
+void* DependentHandle_InternalGetDependent(intptr_t handle);
+void* DependentHandle_InternalGetTargetAndDependent(intptr_t handle, Object** dependent);
+void DependentHandle_InternalSetDependent(intptr_t handle, void* dependent);
+void DependentHandle_InternalSetTargetToNull(intptr_t handle);
+void DependentHandle_InternalFree(intptr_t handle);
+
 } // namespace icall
 } // namespace cil2cpp
@@ -11,6 +11,8 @@
 #include "types.h"
 #include "string.h"
 
+struct UCollator; // ICU4C, <unicode/ucol.h>
+
 namespace cil2cpp {
 namespace globalization {
 
@@ -20,6 +22,66 @@ void init();
 /// Shutdown globalization subsystem. Called from runtime_shutdown().
 void shutdown();
 
+// ===== Collators =====
+// Shared base collators are never reconfigured after opening; every comparison runs on a
+// per-thread clone, so culture-sensitive compares take no process-wide lock.
+
+/// Cached base collator for an ICU locale id ("" = root/invariant). Opened on first use and
+/// kept until shutdown(); this is the value behind CompareInfo sort handles.
+/// Returns nullptr if ICU cannot open the locale.
+UCollator* base_collator(const char* locale);
+
+/// The calling thread's clone of `base`, configured for CompareOptions `options`
+/// (IgnoreCase/IgnoreNonSpace → strength, IgnoreSymbols → alternate=shifted).
+/// Cloned on first use per (base, options); afterwards a lock-free thread_local lookup.
+/// Must not be shared with other threads. Returns nullptr if base is null.
+UCollator* thread_collator(const UCollator* base, Int32 options);
+
+/// Culture-sensitive compare (-1/0/1) on `base` with CompareOptions. When both strings are
+/// pure ASCII and `base` leaves ASCII untailored (invariant, en, de, fr, ...), the result
+/// comes from root weight tables built at init(); otherwise from ucol_strcoll.
+Int32 collator_compare(const UCollator* base,
+    const Char* s1, Int32 len1, const Char* s2, Int32 len2, Int32 options);
+
+/// Culture-sensitive search for `value` in `source` on `base` (first match, or last if
+/// `last`). Returns the match position or -1; *matchLength receives the matched length.
+/// Pure-ASCII text without control characters uses the same weight tables as
+/// collator_compare; other input goes through usearch on this thread's collator clone.
+Int32 collator_index_of(const UCollator* base, const Char* source, Int32 sourceLen,
+    const Char* value, Int32 valueLen, Int32 options, bool last, Int32* matchLength);
+
+// ===== Sort Keys =====
+
+/// ICU sort key of `s` on `base` with CompareOptions, written to `key` (ucol_getSortKey).
+/// Returns the full key length including the terminating zero byte; when that exceeds
+/// `keyLength` the buffer contents are unspecified and the caller retries with a larger one.
+/// Byte-wise key order equals collator_compare order. Returns 0 if base is null.
+Int32 collator_sort_key(const UCollator* base, const Char* s, Int32 length, Int32 options,
+    uint8_t* key, Int32 keyLength);
+
+/// Below this many elements a culture sort compares strings directly; from here on
+/// building one sort key per element beats the ~n·log2(n) collations of the sort
+/// (crossover measured at ~200 with bench_collation BM_SortDirect/BM_SortByKey).
+constexpr Int32 kSortKeyThreshold = 192;
+
+/// Sort `items` in place by culture order on `base` (CultureAwareComparer semantics: nulls
+/// first) by computing each element's sort key once and sorting the keys (a Schwartzian
+/// transform). Returns false without touching `items` when count < kSortKeyThreshold or
+/// `base` is null; the caller then runs its comparison sort.
+bool sort_strings_by_key(String** items, Int32 count, const UCollator* base, Int32 options);
+
+/// Same, for ArraySortHelper<string>.IntrospectiveSort(keys, comparison): applies only
+/// when `comparison` is a single-cast delegate bound to a CultureAwareComparer
+/// (StringComparer.Create/CurrentCulture/InvariantCulture[IgnoreCase]). The comparer's
+/// layout comes from set_culture_comparer_layout(); returns false for any other comparison.
+bool sort_strings_by_key(String** items, Int32 count, Object* comparison);
+
+/// Called from generated __init_runtime_vtables() when System.CultureAwareComparer is
+/// compiled: its TypeInfo and the offsets of _compareInfo, _options and
+/// CompareInfo._sortHandle.
+void set_culture_comparer_layout(TypeInfo* comparer, size_t compareInfoOffset,
+    size_t optionsOffset, size_t sortHandleOffset);
+
 // ===== CompareInfo ICalls =====
 // CompareOptions enum values (System.Globalization.CompareOptions):
 //   None=0, IgnoreCase=1, IgnoreNonSpace=2, IgnoreSymbols=4,
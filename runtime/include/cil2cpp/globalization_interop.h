@@ -59,6 +59,14 @@ int32_t interop_globalization_ends_with(
     char16_t* source, int32_t sourceLength, int32_t options,
     int32_t* matchLengthPtr);
 
+// ===== Sort Keys =====
+
+/// GetSortKey — ICU sort key (ucol_getSortKey) of a string; returns the required length.
+/// Called twice by CompareInfo.GetSortKey/GetHashCode: size query, then fill.
+int32_t interop_globalization_get_sort_key(
+    intptr_t sortHandle, char16_t* str, int32_t strLength,
+    uint8_t* sortKey, int32_t sortKeyLength, int32_t options);
+
 // ===== Locale Data =====
 
 /// GetLocaleName — copy locale name string to output buffer.
@@ -0,0 +1,89 @@
+/**
+ * CIL2CPP Runtime - Heap Snapshot
+ *
+ * In-process stand-in for `dotnet-gcdump`: a full collection, then a walk over every block
+ * the collector marked reachable, attributed to a type through the object header's
+ * TypeInfo*. A header counts only if it names a type the runtime knows (registered
+ * types, array types created so far, runtime-defined types and their bases); blocks
+ * without one (native buffers, runtime containers) are reported together as "other".
+ * Sizes are GC block sizes, so they include the allocator's rounding. Boehm is
+ * conservative: anything a stale stack slot or integer happens to point at stays live.
+ *
+ * The collection and the walk are not atomic: Boehm takes its allocation lock for each
+ * separately, so another thread can allocate in between. Collections are disabled for
+ * the walk, and the pair is retried if such an allocation completed another collection
+ * (three times at most, then the latest complete marks are walked) or left an
+ * incremental cycle under way (until none is, as its mark bits are half rebuilt).
+ *
+ * Enabled by environment variables read in runtime_init (POSIX):
+ *
+ *   CIL2CPP_HEAPDUMP=<target>        stderr | stdout | <path>; a census is written there on
+ *                                    each SIGUSR1. "%p" expands to the pid, "%n" to the
+ *                                    dump number (from 1); a path without "%n" is appended to.
+ *   CIL2CPP_HEAPDUMP_TOP=<n>         types in the census, by bytes (default 20, 0 = all).
+ *   CIL2CPP_HEAPDUMP_GRAPH=<path>    also write the object graph there on each dump
+ *                                    ("%p", "%n" as above; replaced, never appended).
+ *
+ * Graph format (text, one record per line, fields separated by single spaces):
+ *
+ *   # cil2cpp heap graph 1
+ *   node <id> <bytes> <retained> <type>     every live block; ids count from 1,
+ *                                            <type> is "[other]" for blocks without a type
+ *   edge <from> <to>                         a pointer-sized word in <from> holding the
+ *                                            address of <to> (scanned conservatively)
+ *
+ * All node lines come before the edge lines. <retained> is the size of the node's
+ * dominator subtree in this graph. The collector does not expose its roots, so blocks
+ * nothing on the heap points to stand in for them (and one block per cycle that nothing
+ * outside the cycle points to). A block that a root also references is still attributed
+ * to its heap referrers, so <retained> is an upper bound on what freeing the node would
+ * reclaim, not the exact amount.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace cil2cpp {
+
+struct TypeInfo;
+
+namespace heap_snapshot {
+
+/// Live instances of one type.
+struct TypeCount {
+    const TypeInfo* type;
+    uint64_t count;
+    uint64_t bytes;
+};
+
+struct Census {
+    uint64_t objects = 0;           // live managed objects
+    uint64_t bytes = 0;
+    uint64_t other_blocks = 0;      // live blocks without a known TypeInfo header
+    uint64_t other_bytes = 0;
+    std::vector<TypeCount> types;   // by bytes descending
+};
+
+/// Collect, then count reachable objects per type. Stops allocation while walking.
+Census census();
+
+/// Text table of the top `top` types (all if 0).
+std::string format(const Census& census, size_t top = 20);
+
+/// Collect, then write the object graph with retained sizes (format above).
+bool write_graph(FILE* out);
+
+/// Write a census (and graph) to the CIL2CPP_HEAPDUMP targets; false if not configured.
+bool dump();
+
+/// runtime_init / runtime_shutdown: honour CIL2CPP_HEAPDUMP, dump on SIGUSR1.
+void init();
+void shutdown();
+
+} // namespace heap_snapshot
+} // namespace cil2cpp
@@ -22,6 +22,7 @@ Int32 Environment_get_TickCount();
 Int64 Environment_get_TickCount64();
 Int32 Environment_get_ProcessorCount();
 Int32 Environment_get_CurrentManagedThreadId();
+Int64 Environment_get_WorkingSet();
 void Environment_Exit(Int32 exitCode);
 Object* Environment_GetCommandLineArgs();
 String* Environment_GetEnvironmentVariable(String* variable);
@@ -187,6 +188,7 @@ bool Monitor_Wait(Object* obj, Int32 timeout_ms);
 inline bool Monitor_Wait(Object* obj) { return Monitor_Wait(obj, -1); }
 void Monitor_Pulse(Object* obj);
 void Monitor_PulseAll(Object* obj);
+Int64 Monitor_get_LockContentionCount();
 
 // System.Threading.Interlocked
 Int32 Interlocked_Increment_i32(Int32* location);
@@ -251,6 +253,15 @@ void GCHandle_InternalFree(intptr_t handle);
 void GCHandle_InternalSet(intptr_t handle, void* obj);
 void* GCHandle_InternalGet(intptr_t handle);
 
+// System.Runtime.DependentHandle (ConditionalWeakTable ephemerons)
+intptr_t DependentHandle_InternalInitialize(void* target, void* dependent);
+void* DependentHandle_InternalGetTarget(intptr_t handle);
+void* DependentHandle_InternalGetDependent(intptr_t handle);
+void* DependentHandle_InternalGetTargetAndDependent(intptr_t handle, Object** dependent);
+void DependentHandle_InternalSetDependent(intptr_t handle, void* dependent);
+void DependentHandle_InternalSetTargetToNull(intptr_t handle);
+void DependentHandle_InternalFree(intptr_t handle);
+
 // System.Enum
 Object* Enum_InternalBoxEnum(void* enumType, Int64 value);
 Int32 Enum_InternalGetCorElementType(void* enumType);
@@ -269,6 +280,9 @@ void ThreadPool_RequestWorkerThread();
 bool ThreadPoolWorkQueue_Dispatch();
 void ThreadPoolWorkQueue_Enqueue(void* __this, Object* callback, bool forceGlobal);
 bool ThreadPool_BindHandlePortableCore(void* osHandle);
+Int32 ThreadPool_get_ThreadCount();
+Int64 ThreadPool_get_PendingWorkItemCount();
+Int64 ThreadPool_get_CompletedWorkItemCount();
 
 // System.Math (double)
 double Math_Abs_double(double value);
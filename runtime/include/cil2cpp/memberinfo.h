@@ -11,6 +11,7 @@
 #include "object.h"
 #include "type_info.h"
 #include "assembly.h"
+#include "boxing.h"
 
 namespace cil2cpp {
 
@@ -29,6 +30,7 @@ extern TypeInfo System_Reflection_ParameterInfo_TypeInfo;
  */
 struct ManagedMethodInfo : Object {
     MethodInfo* native_info;
+    String* cached_name;    // Name, materialized on first access
 };
 
 /**
@@ -36,6 +38,7 @@ struct ManagedMethodInfo : Object {
  */
 struct ManagedFieldInfo : Object {
     FieldInfo* native_info;
+    String* cached_name;    // Name, materialized on first access
 };
 
 /**
@@ -137,11 +140,60 @@ Array*   methodinfo_get_parameters(ManagedMethodInfo* mi);
 
 /**
  * MethodInfo.Invoke(object obj, object[] parameters) → object
- * Invokes the method via its stored function pointer.
- * For value type returns, boxes the result.
+ * Calls the method through its compiler-emitted invoker thunk (MethodInfo::invoker),
+ * which unboxes value-type arguments and boxes a value-type return. Methods without
+ * a thunk (runtime-provided metadata) are called with every argument as Object*.
+ * ByRef value-type arguments are passed through a local and boxed back into
+ * `parameters`, so a null `out` argument comes back holding the result.
+ * Throws TargetParameterCountException unless the argument count (0 for a null
+ * array) equals the parameter count.
  */
 Object* methodinfo_invoke(ManagedMethodInfo* mi, Object* obj, Array* parameters);
 
+/**
+ * MethodInfo.CreateDelegate(Type delegateType, object target) → Delegate
+ * Closed over target when given, otherwise static or open-instance (the delegate's first
+ * parameter is 'this'). A virtual or interface method closed over a target binds the
+ * implementation the target's type dispatches to; for a boxed value type that is the
+ * value type's own method, which Invoke calls with the unboxed 'this'. Other methods bind
+ * the compiled method directly. Throws ArgumentException when the delegate's Invoke arity
+ * does not match, the target's type does not implement the method, or there is no body
+ * to bind (an open-instance abstract method, an inherited method on a boxed value type).
+ */
+Object* methodinfo_create_delegate(ManagedMethodInfo* mi, Type* delegateType, Object* target);
+
+/**
+ * Argument check of a generated invoker thunk: throws ArgumentException unless `arg` is
+ * null or can be passed for a parameter of `type`. A reference type takes any instance of
+ * it; a value type takes a box of the same type, or of an enum whose underlying type is
+ * the same as the parameter's (enum ↔ underlying primitive, like .NET). Widening
+ * conversions (a boxed int for a long parameter) are not applied and are rejected.
+ */
+void invoke_check_arg(Object* arg, TypeInfo* type);
+
+/**
+ * Value-type argument of a generated invoker thunk. Like MethodInfo.Invoke,
+ * a null argument for a value-type parameter means default(T).
+ */
+template<typename T>
+inline T invoke_arg(Object* arg, TypeInfo* type) {
+    if (!arg) return T{};
+    invoke_check_arg(arg, type);
+    return unbox<T>(arg);
+}
+
+/** Reference-type argument of a generated invoker thunk, checked against `type`. */
+inline Object* invoke_ref_arg(Object* arg, TypeInfo* type) {
+    invoke_check_arg(arg, type);
+    return arg;
+}
+
+/** ByRef reference-type argument: the `object[]` slot, its current value checked. */
+inline Object** invoke_ref_slot(Object** slot, TypeInfo* type) {
+    invoke_check_arg(*slot, type);
+    return slot;
+}
+
 // ===== FieldInfo Property Accessors =====
 
 String*  fieldinfo_get_name(ManagedFieldInfo* fi);
@@ -199,8 +251,9 @@ Int32   parameterinfo_get_position(ManagedParameterInfo* pi);
 MethodInfo* find_method_info(TypeInfo* type_info, const char* name, uint32_t param_count);
 
 /**
- * Create a managed ManagedMethodInfo wrapper around a native MethodInfo.
- * Used by GetMethodFromHandle ICall.
+ * Get the managed ManagedMethodInfo wrapper for a native MethodInfo.
+ * The wrapper is created once and cached in the descriptor, so repeated calls return
+ * the same object (reference equality, as in CoreCLR). Lock-free.
  */
 ManagedMethodInfo* create_managed_method_info(MethodInfo* native);
 
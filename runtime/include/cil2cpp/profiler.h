@@ -0,0 +1,92 @@
+/**
+ * CIL2CPP Runtime - Sampling CPU Profiler
+ *
+ * In-process alternative to `perf` for compiled programs (Linux). Each attached thread
+ * gets a CPU-time timer (timer_create + SIGEV_THREAD_ID) that delivers SIGPROF; the
+ * handler walks the frame-pointer chain and pushes the stack into a lock-free ring that a
+ * background thread folds into per-stack counts.
+ *
+ * Enabled by environment variables read in runtime_init:
+ *
+ *   CIL2CPP_PROFILE=<path>        output file; "%p" expands to the pid. A .pb / .pprof
+ *                                 extension writes pprof protobuf, anything else writes
+ *                                 collapsed stacks ("Root;Caller;Leaf 42", flamegraph.pl).
+ *   CIL2CPP_PROFILE_HZ=<n>        samples per CPU-second per thread (default 99).
+ *   CIL2CPP_PROFILE_NAMES=cpp     name generated frames by their C++ function instead of
+ *                                 the .NET method — the input `cil2cpp codegen --profile`
+ *                                 expects for call-graph layout.
+ *
+ * The profile is written at runtime_shutdown, and a snapshot on SIGUSR2.
+ *
+ * Frames are named from the method table the code generator emits when the program is
+ * built with -DCIL2CPP_PROFILER=ON (which also keeps frame pointers), refined by the
+ * executable's ELF symbol table when it is not stripped. Other platforms: start() fails.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace cil2cpp {
+namespace profiler {
+
+/// Compiler-emitted address → method entry (<Module>_data.cpp, __init_method_symbols).
+struct MethodSymbol {
+    const void* address;    // function entry
+    const char* cpp_name;   // generated C++ function name
+    const char* name;       // .NET name, e.g. "MyApp.Parser.ReadToken"
+};
+
+enum class Format { Auto, Collapsed, Pprof };
+enum class FrameNames { DotNet, Cpp };
+
+/// Add compiler-emitted method entries (copied; may be called more than once).
+void register_methods(const MethodSymbol* symbols, size_t count);
+
+/// Start sampling every attached thread at `hz`. Clears previously collected samples.
+/// Returns false if sampling is unsupported or already running.
+bool start(int hz = 99);
+
+/// Stop sampling; collected samples stay available to write().
+void stop();
+
+bool is_running();
+
+/// Write the samples collected so far. Auto picks pprof for .pb/.pprof, else collapsed.
+bool write(const char* path, Format format = Format::Auto, FrameNames names = FrameNames::DotNet);
+
+/// Samples folded so far / samples lost because the ring was full.
+uint64_t sample_count();
+uint64_t dropped_count();
+
+/// Drop all collected samples.
+void reset();
+
+/// Add one stack (leaf first, return addresses as sampled) as if it had been sampled.
+void record(const void* const* frames, int depth);
+
+/// Name of the function containing `pc`, e.g. "MyApp.Parser.ReadToken" or
+/// "cil2cpp::gc::alloc"; empty if unknown.
+std::string symbolize(const void* pc, FrameNames names = FrameNames::DotNet);
+
+/// Return addresses on the calling thread's stack, starting with the caller of
+/// capture_stack (backtrace / CaptureStackBackTrace); 0 where unsupported.
+int capture_stack(const void** frames, int max_depth);
+
+/// Name of the first frame in `frames` outside the runtime ("cil2cpp::" / "std::"),
+/// "[unknown]" if there is none.
+std::string calling_method(const void* const* frames, int depth);
+
+/// Register / unregister the calling thread (called next to gc::register_thread).
+/// Threads attached while sampling is stopped are picked up by the next start().
+void thread_attach();
+void thread_detach();
+
+/// runtime_init / runtime_shutdown: honour CIL2CPP_PROFILE, write the profile at exit.
+void init();
+void shutdown();
+
+} // namespace profiler
+} // namespace cil2cpp
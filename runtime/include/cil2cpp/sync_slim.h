@@ -0,0 +1,96 @@
+/**
+ * CIL2CPP Runtime - SemaphoreSlim / ManualResetEventSlim
+ *
+ * Runtime-provided replacements for the BCL's Monitor-based slim primitives.
+ * The BCL types keep their generated structs (constructors, properties and Dispose
+ * still compile from IL); the waiting and signaling methods are ICalls that work
+ * directly on the state word: an atomic compare-and-swap fast path, an adaptive
+ * spin, then parking on the word itself (see threading/futex.h).
+ *
+ * SemaphoreSlim.WaitAsync queues a waiter node instead of blocking: Release hands
+ * counts to queued waiters and completes their Task<bool> on the thread pool. Timeouts
+ * and cancellation claim the node without polling (a deadline heap and a CancelWake).
+ */
+
+#pragma once
+
+#include "object.h"
+#include "exception.h"
+#include "task.h"
+
+namespace cil2cpp {
+
+/**
+ * Layout of System.Threading.SemaphoreSlim (BCL field order; Object header inlined
+ * like Task). The generated header static_asserts these offsets.
+ *
+ * The runtime reuses two fields the Monitor-based implementation needed:
+ * m_countOfWaitersPulsedToWake holds the adaptive spin budget and m_asyncHead points
+ * to the runtime's async waiter queue.
+ */
+struct SemaphoreSlimLayout {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 f_m_currentCount;                 // count word (volatile in IL; accessed atomically)
+    Int32 f_m_maxCount;
+    Int32 f_m_waitCount;                    // threads parked in Wait
+    Int32 f_m_countOfWaitersPulsedToWake;   // runtime: adaptive spin budget
+    void* f_m_lockObjAndDisposed;           // StrongBox<bool>: Value = disposed
+    void* f_m_waitHandle;                   // AvailableWaitHandle (ManualResetEvent), lazy
+    void* f_m_asyncHead;                    // runtime: first queued WaitAsync waiter
+    void* f_m_asyncTail;                    // runtime: last queued WaitAsync waiter
+};
+
+/**
+ * Layout of System.Threading.ManualResetEventSlim.
+ * m_combinedState: bit 31 = set, bit 30 = disposed, bits 19-29 = spin count,
+ * bits 0-18 = number of parked waiters.
+ */
+struct ManualResetEventSlimLayout {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    void* f_m_lock;
+    void* f_m_eventObj;                     // WaitHandle (ManualResetEvent), lazy
+    Int32 f_m_combinedState;
+};
+
+namespace icall {
+
+/**
+ * SemaphoreSlim.Wait(int millisecondsTimeout, CancellationToken) → bool
+ * Every synchronous Wait overload funnels here.
+ */
+bool SemaphoreSlim_Wait(void* self, Int32 millisecondsTimeout, CancellationToken cancellationToken);
+
+/**
+ * SemaphoreSlim.WaitAsync(int millisecondsTimeout, CancellationToken) → Task<bool>
+ * Every WaitAsync overload funnels here.
+ */
+Task* SemaphoreSlim_WaitAsync(void* self, Int32 millisecondsTimeout, CancellationToken cancellationToken);
+
+/**
+ * SemaphoreSlim.Release(int releaseCount) → int (previous count)
+ */
+Int32 SemaphoreSlim_Release(void* self, Int32 releaseCount);
+
+/**
+ * SemaphoreSlim.Dispose(bool disposing)
+ * As the BCL's, and cancels the queued WaitAsync waiters instead of abandoning them.
+ */
+void SemaphoreSlim_Dispose(void* self, bool disposing);
+
+/** ManualResetEventSlim.Set() / Set(bool duringCancellation) */
+void ManualResetEventSlim_Set(void* self);
+void ManualResetEventSlim_Set_Cancellation(void* self, bool duringCancellation);
+
+/** ManualResetEventSlim.Reset() */
+void ManualResetEventSlim_Reset(void* self);
+
+/**
+ * ManualResetEventSlim.Wait(int millisecondsTimeout, CancellationToken) → bool
+ * Every Wait overload funnels here.
+ */
+bool ManualResetEventSlim_Wait(void* self, Int32 millisecondsTimeout, CancellationToken cancellationToken);
+
+} // namespace icall
+} // namespace cil2cpp
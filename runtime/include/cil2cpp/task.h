@@ -104,6 +104,21 @@ void task_init_pending(Task* t);
  */
 void task_init_completed(Task* t);
 
+/**
+ * Register the generated Task<bool> TypeInfo, instance size and m_result offset so the
+ * runtime can create Task<bool> results (SemaphoreSlim.WaitAsync).
+ */
+void task_set_bool_typeinfo(TypeInfo* ti, size_t size, size_t result_offset);
+
+/** Create a pending Task<bool>. Returns nullptr if Task<bool> was never registered. */
+Task* task_create_bool_pending();
+
+/** Create a completed Task<bool> with the given result (nullptr if unregistered). */
+Task* task_create_bool_completed(bool result);
+
+/** Set a pending Task<bool>'s result and complete it. Thread-safe. */
+void task_complete_bool(Task* t, bool result);
+
 /** Check if a Task has completed (status >= 1). Thread-safe (acquire load). */
 inline bool task_is_completed(Task* t) {
     if (!t) return false;
@@ -53,6 +53,11 @@ void pulse(Object* obj);
  */
 void pulse_all(Object* obj);
 
+/**
+ * Number of times enter found the lock held by another thread (Monitor.LockContentionCount).
+ */
+int64_t get_contention_count();
+
 } // namespace monitor
 
 // ===== Interlocked =====
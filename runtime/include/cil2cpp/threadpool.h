@@ -70,6 +70,9 @@ void request_worker();
 /** Check if there are pending work items in the queue. */
 bool has_pending_work();
 
+/** Get number of queued work items not yet picked up by a worker. */
+int64_t get_queue_length();
+
 /** Notify that work item progress was made (prevents idle shrinking). */
 void notify_progress();
 
@@ -6,6 +6,8 @@
 
 #include "types.h"
 
+#include <atomic>
+
 namespace cil2cpp {
 
 // ECMA-335 II.23.1.16 — CorElementType constants
@@ -280,6 +282,11 @@ struct MethodInfo {
     Int32 vtable_slot;          // -1 if not virtual
     CustomAttributeInfo* custom_attributes;
     UInt32 custom_attribute_count;
+    Object* managed;            // Runtime-owned: canonical managed MethodInfo (memberinfo.cpp)
+    // Compiler-emitted MethodInfo.Invoke thunk, shared by methods with the same C++ signature:
+    // unboxes args[], calls method_pointer, boxes the result (nullptr for void).
+    // nullptr → methodinfo_invoke's untyped fallback (runtime-provided metadata).
+    Object* (*invoker)(void* method_pointer, Object* target, Object** args);
 };
 
 /**
@@ -294,6 +301,7 @@ struct PropertyInfo {
     UInt32 flags;               // ECMA-335 PropertyAttributes
     CustomAttributeInfo* custom_attributes;
     UInt32 custom_attribute_count;
+    Object* managed;            // Runtime-owned: canonical managed PropertyInfo (memberinfo.cpp)
 };
 
 /**
@@ -308,6 +316,7 @@ struct FieldInfo {
     CustomAttributeInfo* custom_attributes;
     UInt32 custom_attribute_count;
     int64_t constant_value;     // For Literal fields (enum constants, const fields)
+    Object* managed;            // Runtime-owned: canonical managed FieldInfo (memberinfo.cpp)
 };
 
 /**
@@ -398,6 +407,13 @@ struct TypeInfo {
 
     // ECMA-335 metadata token
     UInt32 metadata_token;              // 0 if not available
+
+    // Reflection name lookup: member indices sorted by ordinal name, stable so overloads keep
+    // declaration order. Binary-searched by GetMethod/GetField/GetProperty(name).
+    // nullptr → linear scan (runtime-provided TypeInfos, hand-written test metadata).
+    const UInt16* method_name_index;
+    const UInt16* field_name_index;
+    const UInt16* property_name_index;
 };
 
 /**
@@ -432,6 +448,41 @@ InterfaceVTable* type_get_interface_vtable_checked(TypeInfo* type, TypeInfo* int
  */
 InterfaceVTable* obj_get_interface_vtable(Object* obj, TypeInfo* interface_type);
 
+/**
+ * Per-callsite inline cache for generic virtual method (GVM) dispatch.
+ *
+ * A GVM call can't go through a vtable slot (one slot, many method instantiations), so
+ * the compiler lists every receiver type it knows an override for. Instead of an if-chain
+ * over all of them, each call site gets one function-local static GvmCallSite; gvm_lookup
+ * maps the receiver's TypeInfo to the index of its override (or -1 → fallback) and the
+ * generated switch calls that override directly.
+ *   - Hit on the last resolved type (monomorphic sites): one load + one compare.
+ *   - Miss: linear scan for small sites, lazily built hash table for large ones.
+ * `types` is constant-initialized static data; `last` points into it, so a single
+ * relaxed atomic carries both the type and its index.
+ */
+struct GvmCallSite {
+    TypeInfo* const* types;
+    Int32 count;
+    std::atomic<TypeInfo* const*> last;    // last resolved entry in types[]
+    std::atomic<void*> table;              // GvmHashTable*, built on first miss (count > linear max)
+
+    constexpr GvmCallSite(TypeInfo* const* site_types, Int32 site_count)
+        : types(site_types), count(site_count), last(nullptr), table(nullptr) {}
+};
+
+/**
+ * GVM slow path: resolve the override index for a receiver type and update the site cache.
+ * Returns -1 if the type has no known override.
+ */
+Int32 gvm_resolve(GvmCallSite* site, TypeInfo* type);
+
+inline Int32 gvm_lookup(GvmCallSite* site, TypeInfo* type) {
+    auto* last = site->last.load(std::memory_order_relaxed);
+    if (last && *last == type) return static_cast<Int32>(last - site->types);
+    return gvm_resolve(site, type);
+}
+
 /**
  * Get type by full name (for reflection).
  */
@@ -442,6 +493,11 @@ TypeInfo* type_get_by_name(const char* full_name);
  */
 void type_register(TypeInfo* type);
 
+/**
+ * Call visit(type, context) for every registered type (heap snapshots).
+ */
+void type_for_each_registered(void (*visit)(TypeInfo* type, void* context), void* context);
+
 /**
  * Check if a type has a specific custom attribute.
  */
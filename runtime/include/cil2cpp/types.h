@@ -8,6 +8,15 @@
 #include <cstddef>
 #include <cstring>
 
+// Cold code marker for compiler-emitted definitions placed in cold partitions
+// (static constructors, throw helpers). GCC/Clang move them to .text.unlikely and
+// optimize for size; MSVC only keeps them out of callers' inline budgets.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define CIL2CPP_COLD __declspec(noinline)
+#else
+#define CIL2CPP_COLD __attribute__((cold, noinline))
+#endif
+
 namespace cil2cpp {
 
 // Safe bitcast for IL interop: reinterprets any value as the target type.
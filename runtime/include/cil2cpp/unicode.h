@@ -68,6 +68,14 @@ bool is_low_surrogate(Char c);
 
 // ===== Case Conversion =====
 
+/// ASCII-only case mapping; every other code unit is returned unchanged.
+inline Char ascii_to_upper(Char c) {
+    return (c >= u'a' && c <= u'z') ? static_cast<Char>(c - 0x20) : c;
+}
+inline Char ascii_to_lower(Char c) {
+    return (c >= u'A' && c <= u'Z') ? static_cast<Char>(c + 0x20) : c;
+}
+
 /// Culture-independent (simple Unicode mapping, ≈ InvariantCulture)
 Char to_upper(Char c);
 Char to_lower(Char c);
@@ -76,6 +84,12 @@ Char to_lower(Char c);
 Char to_upper_locale(Char c);
 Char to_lower_locale(Char c);
 
+// ===== ASCII Detection =====
+
+/// True if every UTF-16 code unit is below 0x80. Scans 16 code units per step with
+/// SSE2/NEON where available, 4 per step (64-bit words) otherwise.
+bool is_ascii(const Char* chars, Int32 length);
+
 // ===== UTF-8 ↔ UTF-16 Conversion =====
 
 /// Convert UTF-8 string to UTF-16. Returns number of UTF-16 code units written.
@@ -64,6 +64,23 @@ namespace icall {
  */
 Int32 WaitHandle_WaitOneCore(intptr_t waitHandle, Int32 millisecondsTimeout);
 
+/**
+ * WaitHandle.WaitMultipleIgnoringSyncContext(IntPtr* waitHandles, int numHandles, bool waitAll,
+ *     int millisecondsTimeout) → int
+ * WaitAny (returns 0+index of the acquired handle) or WaitAll (returns 0); 258 on timeout.
+ * At most 64 handles.
+ */
+Int32 WaitHandle_WaitMultipleIgnoringSyncContext(intptr_t* waitHandles, Int32 numHandles,
+    bool waitAll, Int32 millisecondsTimeout);
+
+/**
+ * WaitHandle.SignalAndWaitNative(IntPtr toSignal, IntPtr toWaitOn, int millisecondsTimeout) → int
+ * Signals one handle and waits on another. Returns 298 (ERROR_TOO_MANY_POSTS) if
+ * toSignal is a semaphore already at its maximum count.
+ */
+Int32 WaitHandle_SignalAndWaitNative(intptr_t waitHandleToSignal, intptr_t waitHandleToWaitOn,
+    Int32 millisecondsTimeout);
+
 /**
  * EventWaitHandle.CreateEventCoreWin32(bool initialState, int eventResetMode) → IntPtr
  * Creates an OS event. eventResetMode: 0=AutoReset, 1=ManualReset.
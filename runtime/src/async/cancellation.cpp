@@ -8,6 +8,7 @@
 #include "cil2cpp/type_info.h"
 #include "cil2cpp/threadpool.h"
 #include <atomic>
+#include <mutex>
 #include <thread>
 
 namespace cil2cpp {
@@ -26,10 +27,112 @@ void cts_cancel(CancellationTokenSource* cts) {
     if (!cts) return;
     // Atomic CAS: only cancel if currently active (state 0 -> 1)
     Int32 expected = 0;
-    std::atomic_ref<Int32>(cts->f__state).compare_exchange_strong(
-        expected, 1, std::memory_order_acq_rel);
+    if (std::atomic_ref<Int32>(cts->f__state).compare_exchange_strong(
+            expected, 1, std::memory_order_acq_rel))
+        cts_fire_wakes(cts);
 }
 
+// ===== Runtime cancellation wakes =====
+
+namespace {
+
+// Registered wakes, by source address stripe. Registration checks the source's state under
+// the stripe lock and cancellation flips it before taking the lock, so a wake is either
+// found by cts_fire_wakes or never registered.
+struct WakeStripe {
+    std::mutex mutex;
+    CancelWake* head = nullptr;
+};
+
+WakeStripe g_wake_stripes[16];
+
+WakeStripe& wake_stripe(CancellationTokenSource* cts) {
+    return g_wake_stripes[(reinterpret_cast<uintptr_t>(cts) >> 4) % 16];
+}
+
+enum : Int32 { kWakeRegistered = 0, kWakeFiring = 1 };
+
+bool (*g_transition)(CancellationTokenSource*) = nullptr;
+void (*g_execute_callbacks)(CancellationTokenSource*, bool) = nullptr;
+
+} // anonymous namespace
+
+bool cts_register_wake(CancelWake* node) {
+    auto& stripe = wake_stripe(node->cts);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    if (cts_is_cancellation_requested(node->cts)) return false;
+    node->state.store(kWakeRegistered, std::memory_order_relaxed);
+    node->prev = nullptr;
+    node->next = stripe.head;
+    if (stripe.head) stripe.head->prev = node;
+    stripe.head = node;
+    return true;
+}
+
+bool cts_unregister_wake(CancelWake* node) {
+    {
+        auto& stripe = wake_stripe(node->cts);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        if (node->state.load(std::memory_order_relaxed) == kWakeRegistered) {
+            if (node->prev) node->prev->next = node->next; else stripe.head = node->next;
+            if (node->next) node->next->prev = node->prev;
+            return false;
+        }
+    }
+    // Taken by cts_fire_wakes: its wake may still be using the node
+    while (node->state.load(std::memory_order_acquire) == kWakeFiring)
+        std::this_thread::yield();
+    return true;
+}
+
+void cts_fire_wakes(CancellationTokenSource* cts) {
+    CancelWake* fired = nullptr;
+    {
+        auto& stripe = wake_stripe(cts);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        for (CancelWake* node = stripe.head; node;) {
+            CancelWake* next = node->next;
+            if (node->cts == cts) {
+                if (node->prev) node->prev->next = next; else stripe.head = next;
+                if (next) next->prev = node->prev;
+                node->state.store(kWakeFiring, std::memory_order_relaxed);
+                node->next = fired;
+                fired = node;
+            }
+            node = next;
+        }
+    }
+    while (fired) {
+        CancelWake* next = fired->next;   // the wake may end the node's lifetime
+        fired->wake(fired);
+        fired = next;
+    }
+}
+
+void cts_set_notify_methods(bool (*transition)(CancellationTokenSource*),
+                            void (*execute_callbacks)(CancellationTokenSource*, bool)) {
+    g_transition = transition;
+    g_execute_callbacks = execute_callbacks;
+}
+
+namespace icall {
+
+void CancellationTokenSource_NotifyCancellation(void* self, bool throwOnFirstException) {
+    auto* cts = static_cast<CancellationTokenSource*>(self);
+    if (!g_transition || !g_execute_callbacks) {
+        cts_cancel(cts);
+        return;
+    }
+    // The BCL body, with the runtime's waiters woken between the transition and the
+    // managed callbacks (which may throw). CancelAsync transitions without coming through
+    // here, so it does not wake runtime-parked waiters.
+    if (!g_transition(cts)) return;
+    cts_fire_wakes(cts);
+    g_execute_callbacks(cts, throwOnFirstException);
+}
+
+} // namespace icall
+
 // Context struct for delayed cancellation (avoids std::pair template issues)
 struct CancelAfterContext {
     CancellationTokenSource* cts;
@@ -139,6 +139,45 @@ void task_init_completed(Task* t) {
     t->f_lock = nullptr;
 }
 
+// Generated Task<bool> layout, registered by __init_runtime_vtables when instantiated
+static TypeInfo* s_bool_task_typeinfo = nullptr;
+static size_t s_bool_task_size = 0;
+static size_t s_bool_task_result_offset = 0;
+
+void task_set_bool_typeinfo(TypeInfo* ti, size_t size, size_t result_offset) {
+    if (!ti) return;
+    if (!ti->finalizer) ti->finalizer = task_finalizer;
+    s_bool_task_size = size;
+    s_bool_task_result_offset = result_offset;
+    s_bool_task_typeinfo = ti;
+}
+
+static Task* bool_task_alloc() {
+    if (!s_bool_task_typeinfo) return nullptr;
+    return reinterpret_cast<Task*>(gc::alloc(s_bool_task_size, s_bool_task_typeinfo));
+}
+
+Task* task_create_bool_pending() {
+    auto* t = bool_task_alloc();
+    if (t) task_init_pending(t);
+    return t;
+}
+
+Task* task_create_bool_completed(bool result) {
+    auto* t = bool_task_alloc();
+    if (!t) return nullptr;
+    *reinterpret_cast<bool*>(reinterpret_cast<char*>(t) + s_bool_task_result_offset) = result;
+    task_init_completed(t);
+    return t;
+}
+
+void task_complete_bool(Task* t, bool result) {
+    if (!t) return;
+    // Published by the release in task_complete's status store
+    *reinterpret_cast<bool*>(reinterpret_cast<char*>(t) + s_bool_task_result_offset) = result;
+    task_complete(t);
+}
+
 void task_complete(Task* t) {
     if (!t) return;
     TaskContinuation* conts = nullptr;
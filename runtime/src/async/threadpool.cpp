@@ -10,7 +10,9 @@
  */
 
 #include <cil2cpp/threadpool.h>
+#include <cil2cpp/contention.h>
 #include <cil2cpp/gc.h>
+#include <cil2cpp/profiler.h>
 #include <cil2cpp/delegate.h>
 
 #include "hill_climbing.h"
@@ -55,7 +57,7 @@ struct Metrics {
 static std::vector<WorkerState*> s_workers;
 static std::mutex s_workers_mutex;          // Protects s_workers vector
 static std::queue<WorkItem> s_queue;
-static std::mutex s_mutex;                  // Protects s_queue + s_shutdown
+static contention::Mutex s_mutex{"threadpool.queue"};  // Protects s_queue + s_shutdown
 static std::condition_variable s_cv;
 static bool s_shutdown = false;
 static bool s_initialized = false;
@@ -128,11 +130,12 @@ static void cleanup_retired_workers() {
 
 static void worker_loop(WorkerState* self) {
     gc::register_thread();
+    profiler::thread_attach();
 
     while (true) {
         WorkItem item;
         {
-            std::unique_lock<std::mutex> lock(s_mutex);
+            auto lock = s_mutex.acquire();
             s_cv.wait(lock, [self] {
                 return s_shutdown || !s_queue.empty() ||
                        self->should_exit.load(std::memory_order_relaxed);
@@ -164,6 +167,7 @@ static void worker_loop(WorkerState* self) {
 
     s_metrics.total_workers.fetch_sub(1, std::memory_order_relaxed);
     self->exited.store(true, std::memory_order_relaxed);
+    profiler::thread_detach();
     gc::unregister_thread();
 }
 
@@ -241,7 +245,7 @@ void shutdown() {
 
     // Signal all workers to stop
     {
-        std::lock_guard<std::mutex> lock(s_mutex);
+        std::lock_guard<contention::Mutex> lock(s_mutex);
         s_shutdown = true;
     }
     s_cv.notify_all();
@@ -270,7 +274,7 @@ bool is_initialized() {
 
 void queue_work(void (*func)(void*), void* state) {
     {
-        std::lock_guard<std::mutex> lock(s_mutex);
+        std::lock_guard<contention::Mutex> lock(s_mutex);
         if (s_shutdown) {
             // Pool shut down — run synchronously to avoid silent data loss.
         } else {
@@ -352,6 +356,10 @@ bool has_pending_work() {
     return s_metrics.queued_items.load(std::memory_order_relaxed) > 0;
 }
 
+int64_t get_queue_length() {
+    return s_metrics.queued_items.load(std::memory_order_relaxed);
+}
+
 void notify_progress() {
     s_metrics.last_progress_time.store(elapsed_ms(), std::memory_order_relaxed);
 }
@@ -9,6 +9,7 @@
 #include <cil2cpp/exception.h>
 #include <cil2cpp/type_info.h>
 #include <cil2cpp/boxing.h>
+#include <cil2cpp/contention.h>
 #include <cstring>
 #include <mutex>
 #include <string>
@@ -17,7 +18,7 @@
 namespace cil2cpp {
 
 // Cache of element_type → SZArray TypeInfo. Protected by mutex for thread safety.
-static std::mutex g_szarray_cache_mutex;
+static contention::Mutex g_szarray_cache_mutex{"array.szarray_cache"};
 static std::unordered_map<TypeInfo*, TypeInfo*> g_szarray_cache;
 
 // The generated System.Array TypeInfo — set by __init_runtime_vtables() via
@@ -28,7 +29,7 @@ TypeInfo* get_szarray_type_info(TypeInfo* element_type) {
     if (!element_type) return nullptr;
 
     {
-        std::lock_guard<std::mutex> lock(g_szarray_cache_mutex);
+        std::lock_guard<contention::Mutex> lock(g_szarray_cache_mutex);
         auto it = g_szarray_cache.find(element_type);
         if (it != g_szarray_cache.end()) return it->second;
     }
@@ -83,7 +84,7 @@ TypeInfo* get_szarray_type_info(TypeInfo* element_type) {
         // to fall through to the array-specific adapter which provides correct methods.
     }
 
-    std::lock_guard<std::mutex> lock(g_szarray_cache_mutex);
+    std::lock_guard<contention::Mutex> lock(g_szarray_cache_mutex);
     auto [it, inserted] = g_szarray_cache.emplace(element_type, ti);
     if (!inserted) {
         // Another thread beat us — free our copy and return theirs
@@ -97,7 +98,7 @@ TypeInfo* get_szarray_type_info(TypeInfo* element_type) {
 void array_set_system_array_typeinfo(TypeInfo* system_array_ti) {
     if (!system_array_ti) return;
 
-    std::lock_guard<std::mutex> lock(g_szarray_cache_mutex);
+    std::lock_guard<contention::Mutex> lock(g_szarray_cache_mutex);
     g_system_array_typeinfo = system_array_ti;
 
     // Patch all already-cached SZArray TypeInfos — base_type = System.Array itself
@@ -110,6 +111,11 @@ void array_set_system_array_typeinfo(TypeInfo* system_array_ti) {
     }
 }
 
+void array_for_each_szarray_type_info(void (*visit)(TypeInfo* type, void* context), void* context) {
+    std::lock_guard<contention::Mutex> lock(g_szarray_cache_mutex);
+    for (auto& [elem, ti] : g_szarray_cache) visit(ti, context);
+}
+
 Array* array_create(TypeInfo* element_type, Int32 length) {
     if (length < 0) {
         throw_argument_out_of_range();
@@ -6,6 +6,7 @@
 #include <cil2cpp/bcl/System.Object.h>
 #include <cil2cpp/gc.h>
 #include <cil2cpp/array.h>
+#include <cil2cpp/contention.h>
 #include <cil2cpp/exception.h>
 #include <cil2cpp/type_info.h>
 #include <cil2cpp/unicode.h>
@@ -26,7 +27,7 @@ static std::unordered_map<std::string, String*,
     std::hash<std::string>, std::equal_to<std::string>,
     cil2cpp::gc_allocator<std::pair<const std::string, String*>>>
     g_string_pool;
-static std::mutex g_string_pool_mutex;
+static contention::Mutex g_string_pool_mutex{"string.intern_pool"};
 
 namespace System {
 
@@ -90,7 +91,7 @@ String* string_literal(const char* utf8) {
         return nullptr;
     }
 
-    std::lock_guard<std::mutex> lock(g_string_pool_mutex);
+    std::lock_guard<contention::Mutex> lock(g_string_pool_mutex);
     // Check intern pool
     auto it = g_string_pool.find(utf8);
     if (it != g_string_pool.end()) {
@@ -1014,9 +1014,9 @@ extern "C" void* System_Reflection_MethodBase_Invoke__System_Object_System_Refle
 
 // ===== System.Reflection.MethodInfo =====
 extern "C" void System_Reflection_MethodInfo__ctor(void* /*__this*/) { }
-extern "C" void* System_Reflection_MethodInfo_CreateDelegate__System_Type_System_Object(void* /*__this*/, void* /*delegateType*/, void* /*target*/) {
-    // Runtime delegate creation from MethodInfo is not supported in AOT
-    cil2cpp::throw_not_supported();
+extern "C" void* System_Reflection_MethodInfo_CreateDelegate__System_Type_System_Object(void* __this, void* delegateType, void* target) {
+    return cil2cpp::methodinfo_create_delegate(reinterpret_cast<cil2cpp::ManagedMethodInfo*>(__this),
+        reinterpret_cast<cil2cpp::Type*>(delegateType), reinterpret_cast<cil2cpp::Object*>(target));
 }
 extern "C" void* System_Reflection_MethodInfo_CreateDelegate_System_Text_RegularExpressions_CompiledRegexRunner_ScanDelegate(void* /*__this*/) {
     // CompiledRegex delegate creation not supported in AOT
@@ -1258,8 +1258,9 @@ extern "C" System_Reflection_InvocationFlags System_Reflection_RuntimeMethodInfo
 }
 
 // ===== System.Reflection.RuntimeMethodInfo.CreateDelegateInternal =====
-extern "C" void* System_Reflection_RuntimeMethodInfo_CreateDelegateInternal(void* /*__this*/, void* /*delegateType*/, void* /*firstArgument*/, System_DelegateBindingFlags /*bindingFlags*/) {
-    return nullptr; // Runtime delegate creation not commonly used in AOT
+extern "C" void* System_Reflection_RuntimeMethodInfo_CreateDelegateInternal(void* __this, void* delegateType, void* firstArgument, System_DelegateBindingFlags /*bindingFlags*/) {
+    return cil2cpp::methodinfo_create_delegate(reinterpret_cast<cil2cpp::ManagedMethodInfo*>(__this),
+        reinterpret_cast<cil2cpp::Type*>(delegateType), reinterpret_cast<cil2cpp::Object*>(firstArgument));
 }
 
 // ===== System.Reflection.RuntimeMethodInfo.FetchNonReturnParameters =====
@@ -1276,10 +1277,7 @@ extern "C" void* System_Reflection_RuntimeMethodInfo_GetParentDefinition(void* _
     for (uint32_t i = 0; i < baseTi->method_count; i++) {
         auto& bm = baseTi->methods[i];
         if (bm.name && ni->name && std::strcmp(bm.name, ni->name) == 0 && bm.parameter_count == ni->parameter_count) {
-            auto* mi = static_cast<cil2cpp::ManagedMethodInfo*>(
-                cil2cpp::gc::alloc(sizeof(cil2cpp::ManagedMethodInfo), &cil2cpp::System_Reflection_MethodInfo_TypeInfo));
-            mi->native_info = &bm;
-            return mi;
+            return cil2cpp::create_managed_method_info(&bm);
         }
     }
     return nullptr;
@@ -2340,10 +2338,7 @@ extern "C" void* System_Type_GetConstructorImpl(void* __this, System_Reflection_
     for (uint32_t i = 0; i < t->type_info->method_count; i++) {
         auto& m = t->type_info->methods[i];
         if (m.name && std::strcmp(m.name, ".ctor") == 0) {
-            auto* mi = static_cast<cil2cpp::ManagedMethodInfo*>(
-                cil2cpp::gc::alloc(sizeof(cil2cpp::ManagedMethodInfo), &cil2cpp::System_Reflection_MethodInfo_TypeInfo));
-            mi->native_info = &m;
-            return mi;
+            return cil2cpp::create_managed_method_info(&m);
         }
     }
     return nullptr;
@@ -2363,10 +2358,7 @@ extern "C" void* System_Type_GetConstructors__System_Reflection_BindingFlags(voi
     for (uint32_t i = 0; i < t->type_info->method_count; i++) {
         auto& m = t->type_info->methods[i];
         if (m.name && std::strcmp(m.name, ".ctor") == 0) {
-            auto* mi = static_cast<cil2cpp::ManagedMethodInfo*>(
-                cil2cpp::gc::alloc(sizeof(cil2cpp::ManagedMethodInfo), &cil2cpp::System_Reflection_MethodInfo_TypeInfo));
-            mi->native_info = &m;
-            data[idx++] = mi;
+            data[idx++] = cil2cpp::create_managed_method_info(&m);
         }
     }
     return arr;
@@ -0,0 +1,146 @@
+/**
+ * CIL2CPP Runtime - Lock Contention Profiler
+ *
+ * Named runtime locks keep their totals in their own Site, linked into a list at static
+ * initialisation (the list head is constant-initialised, so construction order across
+ * translation units doesn't matter). Monitor waits go to a site table keyed by object
+ * type and the raw return addresses above the enter; the report merges them with the
+ * named locks by site name.
+ */
+
+#include <cil2cpp/contention.h>
+#include <cil2cpp/profiler.h>
+
+#include "report_target.h"
+#include "site_table.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace cil2cpp {
+namespace contention {
+
+namespace {
+
+std::atomic<Site*> g_sites{nullptr};
+
+diagnostics::SiteTable& monitor_sites() {
+    static auto* sites = new diagnostics::SiteTable();
+    return *sites;
+}
+
+void update_max(std::atomic<uint64_t>& max, uint64_t value) {
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (value > current &&
+        !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+std::string g_output;
+size_t g_top = 20;
+
+} // namespace
+
+Site::Site(const char* site_name) : name(site_name) {
+    next = g_sites.load(std::memory_order_relaxed);
+    while (!g_sites.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed)) {}
+}
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void record(Site& site, int64_t wait_ns) {
+    auto wait = static_cast<uint64_t>(wait_ns > 0 ? wait_ns : 0);
+    site.contentions.fetch_add(1, std::memory_order_relaxed);
+    site.wait_ns.fetch_add(wait, std::memory_order_relaxed);
+    update_max(site.max_wait_ns, wait);
+}
+
+void record_monitor(const TypeInfo* type, int64_t wait_ns) {
+    diagnostics::SiteKey key{};
+    key.type = type;
+    // Starts at the runtime's enter path; the report skips to the calling method
+    key.depth = profiler::capture_stack(key.frames, diagnostics::kSiteFrames);
+
+    auto wait = static_cast<uint64_t>(wait_ns > 0 ? wait_ns : 0);
+    monitor_sites().add(key, 1, wait, wait);
+}
+
+void enable() {
+    g_enabled.store(true, std::memory_order_relaxed);
+}
+
+void disable() {
+    g_enabled.store(false, std::memory_order_relaxed);
+}
+
+void reset() {
+    for (Site* s = g_sites.load(std::memory_order_acquire); s; s = s->next) {
+        s->contentions.store(0, std::memory_order_relaxed);
+        s->wait_ns.store(0, std::memory_order_relaxed);
+        s->max_wait_ns.store(0, std::memory_order_relaxed);
+    }
+    monitor_sites().clear();
+}
+
+std::vector<Entry> entries() {
+    diagnostics::SiteRows merged;
+    for (Site* s = g_sites.load(std::memory_order_acquire); s; s = s->next) {
+        uint64_t count = s->contentions.load(std::memory_order_relaxed);
+        if (count == 0) continue;
+        merged[std::string("runtime ") + s->name].add(count,
+            s->wait_ns.load(std::memory_order_relaxed), s->max_wait_ns.load(std::memory_order_relaxed));
+    }
+    // First frame outside the runtime: the method that executed the lock statement
+    for (const auto& [key, totals] : monitor_sites().snapshot())
+        merged["monitor " + diagnostics::site_name(key)].add(totals.count, totals.total_ns, totals.max_ns);
+
+    return diagnostics::sorted_entries<Entry>(merged, [](const Entry& a, const Entry& b) {
+        return a.wait_ns > b.wait_ns;
+    });
+}
+
+std::string report(size_t top) {
+    auto all = entries();
+    size_t shown = top == 0 ? all.size() : std::min(top, all.size());
+
+    std::string out;
+    char line[256];
+    std::snprintf(line, sizeof(line), "cil2cpp lock contention: top %zu of %zu sites by total wait\n",
+        shown, all.size());
+    out += line;
+    std::snprintf(line, sizeof(line), "%12s %12s %10s  %s\n", "contentions", "total ms", "max ms", "site");
+    out += line;
+    for (size_t i = 0; i < shown; i++) {
+        const auto& e = all[i];
+        std::snprintf(line, sizeof(line), "%12llu %12.3f %10.3f  ",
+            static_cast<unsigned long long>(e.contentions), e.wait_ns / 1e6, e.max_wait_ns / 1e6);
+        out += line;
+        out += e.site;
+        out += '\n';
+    }
+    return out;
+}
+
+void init() {
+    const char* target = std::getenv("CIL2CPP_LOCK_PROFILE");
+    if (!target || !*target) return;
+
+    g_output = diagnostics::expand_target(target);
+    const char* top = std::getenv("CIL2CPP_LOCK_PROFILE_TOP");
+    g_top = top ? static_cast<size_t>(std::max(0, std::atoi(top))) : 20;
+    enable();
+}
+
+void shutdown() {
+    if (g_output.empty()) return;
+    disable();
+    diagnostics::write_report(g_output, report(g_top), "CIL2CPP_LOCK_PROFILE");
+    g_output.clear();
+}
+
+} // namespace contention
+} // namespace cil2cpp
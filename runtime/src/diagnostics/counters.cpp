@@ -0,0 +1,418 @@
+/**
+ * CIL2CPP Runtime - Runtime Counters
+ *
+ * Every reading is a cheap load of a counter some subsystem already maintains (GC stats,
+ * thread pool metrics, monitor / exception counts) plus one process-level query for CPU
+ * time and working set. The dump thread samples on its interval and formats the
+ * difference to the previous sample, so rates cover exactly the elapsed interval.
+ * Meter instruments report cumulative totals and current levels instead; the listener
+ * computes rates from its own observations.
+ */
+
+#include <cil2cpp/counters.h>
+#include <cil2cpp/delegate.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/string.h>
+#include <cil2cpp/threading.h>
+#include <cil2cpp/threadpool.h>
+
+#include "report_target.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <thread>
+
+#ifdef CIL2CPP_WINDOWS
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <psapi.h>
+#define fdopen _fdopen
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace cil2cpp {
+namespace counters {
+
+namespace {
+
+constexpr double kMB = 1000000.0;   // RuntimeEventSource reports MB as bytes / 1,000,000
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t process_cpu_time_ns() {
+#ifdef CIL2CPP_WINDOWS
+    FILETIME created, exited, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) return 0;
+    auto ticks = [](const FILETIME& ft) {
+        return (static_cast<int64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+    };
+    return (ticks(kernel) + ticks(user)) * 100;
+#else
+    timespec ts{};
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0) return 0;
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+void append_number(std::string& out, double value) {
+    char buf[64];
+    if (value == static_cast<double>(static_cast<int64_t>(value)))
+        std::snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(value));
+    else
+        std::snprintf(buf, sizeof(buf), "%.3f", value);
+    out += buf;
+}
+
+std::string utc_timestamp() {
+    auto now = std::chrono::system_clock::now();
+    std::time_t secs = std::chrono::system_clock::to_time_t(now);
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+    std::tm tm{};
+#ifdef CIL2CPP_WINDOWS
+    gmtime_s(&tm, &secs);
+#else
+    gmtime_r(&secs, &tm);
+#endif
+    char buf[40];
+    std::snprintf(buf, sizeof(buf), "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ",
+        tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+        static_cast<int>(ms));
+    return buf;
+}
+
+struct Dumper {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread thread;
+    bool running = false;
+    bool stopping = false;
+    FILE* out = nullptr;
+    int interval_ms = 1000;
+    Format format = Format::Text;
+    Sample last;
+};
+
+Dumper& dumper() {
+    static auto* d = new Dumper();
+    return *d;
+}
+
+// Stream opened by init() for a path target; closed at shutdown
+FILE* g_owned_output = nullptr;
+
+void dump(Dumper& d, const Sample& current) {
+    auto text = format(compute(d.last, current), d.format);
+    d.last = current;
+    std::fwrite(text.data(), 1, text.size(), d.out);
+    std::fflush(d.out);
+}
+
+void dump_loop() {
+    auto& d = dumper();
+    std::unique_lock<std::mutex> lock(d.mutex);
+    while (!d.stopping) {
+        if (d.cv.wait_for(lock, std::chrono::milliseconds(d.interval_ms),
+                [&] { return d.stopping; }))
+            break;
+        dump(d, read());
+    }
+}
+
+// One instrument of the "System.Runtime" meter. BoehmGC has no generations, so the
+// instruments .NET tags per generation report the whole heap, untagged.
+struct MeterInstrument {
+    enum Kind { CounterInt64, UpDownCounterInt64, CounterDouble };
+
+    Kind kind;
+    const char* name;
+    const char* unit;
+    const char* description;
+    int64_t (*observe_int64)();
+    double (*observe_double)();
+};
+
+const MeterInstrument kMeterInstruments[] = {
+    { MeterInstrument::CounterInt64, "dotnet.gc.collections", "{collection}",
+        "The number of garbage collections that have occurred since the process has started.",
+        [] { return static_cast<int64_t>(gc::get_stats().collection_count); }, nullptr },
+    { MeterInstrument::UpDownCounterInt64, "dotnet.process.memory.working_set", "By",
+        "The number of bytes of physical memory mapped to the process context.",
+        [] { return working_set(); }, nullptr },
+    { MeterInstrument::CounterInt64, "dotnet.gc.heap.total_allocated", "By",
+        "The approximate number of bytes allocated on the managed GC heap since the process has started.",
+        [] { return static_cast<int64_t>(gc::get_stats().total_allocated); }, nullptr },
+    { MeterInstrument::UpDownCounterInt64, "dotnet.gc.last_collection.memory.committed_size", "By",
+        "The amount of committed virtual memory in use by the GC.",
+        [] { return static_cast<int64_t>(gc::get_stats().current_heap_size); }, nullptr },
+    { MeterInstrument::UpDownCounterInt64, "dotnet.gc.last_collection.heap.size", "By",
+        "The managed GC heap size, excluding free space.",
+        [] { auto s = gc::get_stats();
+             return static_cast<int64_t>(s.current_heap_size > s.free_bytes ? s.current_heap_size - s.free_bytes : 0); },
+        nullptr },
+    { MeterInstrument::UpDownCounterInt64, "dotnet.gc.last_collection.heap.fragmentation.size", "By",
+        "The heap fragmentation: free space inside the committed GC heap.",
+        [] { return static_cast<int64_t>(gc::get_stats().free_bytes); }, nullptr },
+    { MeterInstrument::CounterDouble, "dotnet.gc.pause.time", "s",
+        "The total amount of time paused in GC since the process has started.",
+        nullptr, [] { return gc::get_stats().total_pause_time_ms / 1000.0; } },
+    { MeterInstrument::UpDownCounterInt64, "dotnet.thread_pool.thread.count", "{thread}",
+        "The number of thread pool threads that currently exist.",
+        [] { return static_cast<int64_t>(threadpool::get_thread_count()); }, nullptr },
+    { MeterInstrument::CounterInt64, "dotnet.thread_pool.work_item.count", "{work_item}",
+        "The number of work items that the thread pool has completed since the process has started.",
+        [] { return static_cast<int64_t>(threadpool::get_completions()); }, nullptr },
+    { MeterInstrument::UpDownCounterInt64, "dotnet.thread_pool.queue.length", "{work_item}",
+        "The number of work items that are currently queued to be processed by the thread pool.",
+        [] { return static_cast<int64_t>(threadpool::get_queue_length()); }, nullptr },
+    { MeterInstrument::CounterInt64, "dotnet.monitor.lock_contentions", "{contention}",
+        "The number of times there was contention when trying to acquire a monitor lock since the process has started.",
+        [] { return static_cast<int64_t>(monitor::get_contention_count()); }, nullptr },
+    { MeterInstrument::CounterInt64, "dotnet.exceptions", "{exception}",
+        "The number of exceptions that have been thrown in managed code.",
+        [] { return static_cast<int64_t>(exception_count()); }, nullptr },
+    { MeterInstrument::CounterDouble, "dotnet.process.cpu.time", "s",
+        "CPU time used by the process, user and system combined.",
+        nullptr, [] { return static_cast<double>(process_cpu_time_ns()) / 1e9; } },
+    { MeterInstrument::UpDownCounterInt64, "dotnet.process.cpu.count", "{cpu}",
+        "The number of processors available to the process.",
+        [] { return static_cast<int64_t>(std::thread::hardware_concurrency()); }, nullptr },
+};
+
+std::mutex g_meter_mutex;
+MeterFactories g_meter_factories{};
+bool g_meter_published = false;
+
+} // namespace
+
+int64_t working_set() {
+#if defined(CIL2CPP_WINDOWS)
+    PROCESS_MEMORY_COUNTERS pmc{};
+    if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0;
+    return static_cast<int64_t>(pmc.WorkingSetSize);
+#elif defined(__linux__)
+    FILE* f = std::fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+    long long size = 0, resident = 0;
+    int fields = std::fscanf(f, "%lld %lld", &size, &resident);
+    std::fclose(f);
+    if (fields != 2) return 0;
+    return static_cast<int64_t>(resident) * sysconf(_SC_PAGESIZE);
+#else
+    // No portable current-RSS query; the peak is the closest available figure
+    rusage ru{};
+    if (getrusage(RUSAGE_SELF, &ru) != 0) return 0;
+#ifdef __APPLE__
+    return static_cast<int64_t>(ru.ru_maxrss);
+#else
+    return static_cast<int64_t>(ru.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+Sample read() {
+    auto gc_stats = gc::get_stats();
+    Sample s;
+    s.timestamp_ns = now_ns();
+    s.cpu_time_ns = process_cpu_time_ns();
+    s.working_set_bytes = working_set();
+    s.gc_committed_bytes = static_cast<int64_t>(gc_stats.current_heap_size);
+    s.gc_fragmented_bytes = static_cast<int64_t>(gc_stats.free_bytes);
+    s.gc_heap_size_bytes = s.gc_committed_bytes > s.gc_fragmented_bytes
+        ? s.gc_committed_bytes - s.gc_fragmented_bytes : 0;
+    s.gc_count = static_cast<int64_t>(gc_stats.collection_count);
+    s.gc_pause_ns = static_cast<int64_t>(gc_stats.total_pause_time_ms * 1e6);
+    s.allocated_bytes = static_cast<int64_t>(gc_stats.total_allocated);
+    s.threadpool_thread_count = threadpool::get_thread_count();
+    s.threadpool_queue_length = threadpool::get_queue_length();
+    s.threadpool_completed_items = threadpool::get_completions();
+    s.lock_contention_count = monitor::get_contention_count();
+    s.exception_count = static_cast<int64_t>(exception_count());
+    return s;
+}
+
+std::vector<Value> compute(const Sample& previous, const Sample& current) {
+    double elapsed_ns = static_cast<double>(current.timestamp_ns - previous.timestamp_ns);
+    double seconds = elapsed_ns / 1e9;
+    auto rate = [&](int64_t prev, int64_t cur) {
+        return seconds > 0 ? static_cast<double>(cur - prev) / seconds : 0.0;
+    };
+    auto percent = [&](int64_t prev, int64_t cur) {
+        return elapsed_ns > 0 ? static_cast<double>(cur - prev) * 100.0 / elapsed_ns : 0.0;
+    };
+
+    unsigned cpus = std::thread::hardware_concurrency();
+    // BoehmGC collections are all full: .NET counts a gen-2 GC in every generation
+    double gc_rate = rate(previous.gc_count, current.gc_count);
+    double fragmentation = current.gc_committed_bytes > 0
+        ? static_cast<double>(current.gc_fragmented_bytes) * 100.0 / static_cast<double>(current.gc_committed_bytes)
+        : 0.0;
+
+    return {
+        { "cpu-usage", "CPU Usage (%)",
+            percent(previous.cpu_time_ns, current.cpu_time_ns) / (cpus ? cpus : 1) },
+        { "working-set", "Working Set (MB)", static_cast<double>(current.working_set_bytes) / kMB },
+        { "gc-heap-size", "GC Heap Size (MB)", static_cast<double>(current.gc_heap_size_bytes) / kMB },
+        { "gen-0-gc-count", "Gen 0 GC Count (Count / 1 sec)", gc_rate },
+        { "gen-1-gc-count", "Gen 1 GC Count (Count / 1 sec)", gc_rate },
+        { "gen-2-gc-count", "Gen 2 GC Count (Count / 1 sec)", gc_rate },
+        { "threadpool-thread-count", "ThreadPool Thread Count",
+            static_cast<double>(current.threadpool_thread_count) },
+        { "monitor-lock-contention-count", "Monitor Lock Contention Count (Count / 1 sec)",
+            rate(previous.lock_contention_count, current.lock_contention_count) },
+        { "threadpool-queue-length", "ThreadPool Queue Length",
+            static_cast<double>(current.threadpool_queue_length) },
+        { "threadpool-completed-items-count", "ThreadPool Completed Work Item Count (Count / 1 sec)",
+            rate(previous.threadpool_completed_items, current.threadpool_completed_items) },
+        { "alloc-rate", "Allocation Rate (B / 1 sec)",
+            rate(previous.allocated_bytes, current.allocated_bytes) },
+        { "gc-fragmentation", "GC Fragmentation (%)", fragmentation },
+        { "gc-committed", "GC Committed Bytes (MB)", static_cast<double>(current.gc_committed_bytes) / kMB },
+        { "exception-count", "Exception Count (Count / 1 sec)",
+            rate(previous.exception_count, current.exception_count) },
+        { "time-in-gc", "% Time in GC since last GC (%)", percent(previous.gc_pause_ns, current.gc_pause_ns) },
+    };
+}
+
+std::string format(const std::vector<Value>& values, Format format) {
+    std::string out;
+    if (format == Format::Json) {
+        out += "{\"timestamp\":\"" + utc_timestamp() + "\",\"provider\":\"System.Runtime\",\"counters\":{";
+        for (size_t i = 0; i < values.size(); i++) {
+            if (i) out += ',';
+            out += '"';
+            out += values[i].name;
+            out += "\":";
+            append_number(out, values[i].value);
+        }
+        out += "}}\n";
+        return out;
+    }
+
+    out += "[System.Runtime] " + utc_timestamp() + "\n";
+    for (const auto& v : values) {
+        std::string number;
+        append_number(number, v.value);
+        char line[160];
+        std::snprintf(line, sizeof(line), "    %-56s %16s\n", v.display_name, number.c_str());
+        out += line;
+    }
+    return out;
+}
+
+bool start(FILE* out, int interval_ms, Format format) {
+    if (!out) return false;
+    auto& d = dumper();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    if (d.running) return false;
+    d.out = out;
+    d.interval_ms = interval_ms > 0 ? interval_ms : 1000;
+    d.format = format;
+    d.stopping = false;
+    d.last = read();
+    d.running = true;
+    d.thread = std::thread(dump_loop);
+    return true;
+}
+
+void stop() {
+    auto& d = dumper();
+    {
+        std::lock_guard<std::mutex> lock(d.mutex);
+        if (!d.running) return;
+        d.stopping = true;
+    }
+    d.cv.notify_all();
+    d.thread.join();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    dump(d, read());
+    d.running = false;
+}
+
+void set_meter_factories(const MeterFactories& factories) {
+    std::lock_guard<std::mutex> lock(g_meter_mutex);
+    g_meter_factories = factories;
+}
+
+bool publish_meter() {
+    std::lock_guard<std::mutex> lock(g_meter_mutex);
+    const auto& f = g_meter_factories;
+    if (!f.create_meter || !f.func_int64 || !f.func_double
+        || !f.counter_int64 || !f.up_down_counter_int64 || !f.counter_double)
+        return false;
+    if (g_meter_published) return true;
+    g_meter_published = true;
+
+    // The Meter adds itself to the static list of all meters, which keeps it and its
+    // instruments alive
+    Object* meter = f.create_meter(string_literal("System.Runtime"));
+    for (const auto& instrument : kMeterInstruments) {
+        bool is_double = instrument.kind == MeterInstrument::CounterDouble;
+        void* observe = is_double ? reinterpret_cast<void*>(instrument.observe_double)
+                                  : reinterpret_cast<void*>(instrument.observe_int64);
+        Delegate* callback = delegate_create(is_double ? f.func_double : f.func_int64, nullptr, observe);
+        auto create = instrument.kind == MeterInstrument::CounterInt64 ? f.counter_int64
+            : instrument.kind == MeterInstrument::UpDownCounterInt64 ? f.up_down_counter_int64
+            : f.counter_double;
+        create(meter, string_literal(instrument.name), callback,
+            string_literal(instrument.unit), string_literal(instrument.description));
+    }
+    return true;
+}
+
+bool is_running() {
+    auto& d = dumper();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    return d.running;
+}
+
+void init() {
+    const char* target = std::getenv("CIL2CPP_COUNTERS");
+    if (!target || !*target) return;
+
+    FILE* out = nullptr;
+    bool json = false;
+    if (std::strncmp(target, "fd:", 3) == 0) {
+        out = fdopen(std::atoi(target + 3), "w");
+        if (!out) std::fprintf(stderr, "cil2cpp: CIL2CPP_COUNTERS: cannot open %s\n", target);
+    } else {
+        auto path = diagnostics::expand_target(target);
+        auto ends_with = [&](const char* suffix) {
+            size_t n = std::strlen(suffix);
+            return path.size() >= n && path.compare(path.size() - n, n, suffix) == 0;
+        };
+        json = ends_with(".json") || ends_with(".jsonl");
+        out = diagnostics::open_target(path, "w", "CIL2CPP_COUNTERS");
+        if (out && out != stderr && out != stdout) g_owned_output = out;
+    }
+    if (!out) return;
+
+    const char* fmt = std::getenv("CIL2CPP_COUNTERS_FORMAT");
+    if (fmt && *fmt) json = std::strcmp(fmt, "json") == 0;
+    const char* interval = std::getenv("CIL2CPP_COUNTERS_INTERVAL");
+    int interval_ms = interval ? static_cast<int>(std::atof(interval) * 1000.0) : 1000;
+
+    start(out, interval_ms, json ? Format::Json : Format::Text);
+}
+
+void shutdown() {
+    stop();
+    if (g_owned_output) {
+        diagnostics::close_target(g_owned_output);
+        g_owned_output = nullptr;
+    }
+}
+
+} // namespace counters
+} // namespace cil2cpp
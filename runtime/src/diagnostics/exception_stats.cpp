@@ -0,0 +1,168 @@
+/**
+ * CIL2CPP Runtime - Exception Throw Profiler
+ *
+ * Throws go to a site table keyed by exception type and the raw return addresses above
+ * the throw. Each thread remembers the exception it is unwinding and when it last did
+ * so: every hop to a handler (a finally block, a catch that didn't match, the catch that
+ * did) adds the time since the previous one, so the total runs from the throw to the
+ * last longjmp. The catch that takes the exception ends the measurement.
+ */
+
+#include <cil2cpp/exception_stats.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/profiler.h>
+
+#include "report_target.h"
+#include "site_table.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace cil2cpp {
+namespace exception_stats {
+
+namespace {
+
+diagnostics::SiteTable& sites() {
+    static auto* table = new diagnostics::SiteTable();
+    return *table;
+}
+
+// The exception this thread is unwinding. Not a GC root: until the catch clears it, the
+// exception is also held by the ExceptionContext it is being delivered to.
+struct InFlight {
+    const Exception* ex = nullptr;
+    diagnostics::SiteKey key{};
+    int64_t mark_ns = 0;        // throw, or the previous hop
+    uint64_t elapsed_ns = 0;    // throw → previous hop
+};
+
+thread_local InFlight t_in_flight;
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::vector<Entry> sorted(const diagnostics::SiteRows& rows) {
+    return diagnostics::sorted_entries<Entry>(rows, [](const Entry& a, const Entry& b) {
+        return a.throws != b.throws ? a.throws > b.throws : a.unwind_ns > b.unwind_ns;
+    });
+}
+
+void append_table(std::string& out, const char* title, const char* column,
+                  const std::vector<Entry>& all, size_t top) {
+    size_t shown = top == 0 ? all.size() : std::min(top, all.size());
+    char line[256];
+    std::snprintf(line, sizeof(line), "\n%s: top %zu of %zu by throws\n", title, shown, all.size());
+    out += line;
+    std::snprintf(line, sizeof(line), "%10s %12s %10s %10s  %s\n", "throws", "total ms", "avg us", "max us", column);
+    out += line;
+    for (size_t i = 0; i < shown; i++) {
+        const auto& e = all[i];
+        std::snprintf(line, sizeof(line), "%10llu %12.3f %10.3f %10.3f  ",
+            static_cast<unsigned long long>(e.throws), e.unwind_ns / 1e6,
+            e.throws ? e.unwind_ns / 1e3 / e.throws : 0.0, e.max_unwind_ns / 1e3);
+        out += line;
+        out += e.name;
+        out += '\n';
+    }
+}
+
+std::string g_output;
+size_t g_top = 20;
+
+} // namespace
+
+void record_throw(const Exception* ex) {
+    auto& f = t_in_flight;
+    f.ex = ex;
+    f.key = diagnostics::SiteKey{};
+    f.key.type = ex ? reinterpret_cast<const Object*>(ex)->__type_info : nullptr;
+    // Starts in the runtime's throw path; the report skips to the throwing method
+    f.key.depth = profiler::capture_stack(f.key.frames, diagnostics::kSiteFrames);
+    f.elapsed_ns = 0;
+
+    sites().add(f.key, 1, 0, 0);
+    f.mark_ns = now_ns();
+}
+
+void record_unwind(const Exception* ex) {
+    auto& f = t_in_flight;
+    if (!f.ex || f.ex != ex) return;
+    int64_t now = now_ns();
+    auto hop = static_cast<uint64_t>(now > f.mark_ns ? now - f.mark_ns : 0);
+    f.elapsed_ns += hop;
+    f.mark_ns = now;
+    sites().add_existing(f.key, hop, f.elapsed_ns);    // false: reset() since the throw
+}
+
+void record_catch() {
+    t_in_flight.ex = nullptr;
+}
+
+void enable() {
+    g_enabled.store(true, std::memory_order_relaxed);
+}
+
+void disable() {
+    g_enabled.store(false, std::memory_order_relaxed);
+}
+
+void reset() {
+    sites().clear();
+}
+
+std::vector<Entry> by_type() {
+    diagnostics::SiteRows merged;
+    for (const auto& [key, totals] : sites().snapshot())
+        merged[diagnostics::site_type_name(key.type)].add(totals.count, totals.total_ns, totals.max_ns);
+    return sorted(merged);
+}
+
+std::vector<Entry> by_site() {
+    diagnostics::SiteRows merged;
+    for (const auto& [key, totals] : sites().snapshot())
+        merged[diagnostics::site_name(key)].add(totals.count, totals.total_ns, totals.max_ns);
+    return sorted(merged);
+}
+
+std::string report(size_t top) {
+    auto types = by_type();
+    uint64_t throws = 0, unwind_ns = 0;
+    for (const auto& e : types) {
+        throws += e.throws;
+        unwind_ns += e.unwind_ns;
+    }
+
+    std::string out;
+    char line[256];
+    std::snprintf(line, sizeof(line), "cil2cpp exceptions: %llu thrown, %.3f ms from throw to handler\n",
+        static_cast<unsigned long long>(throws), unwind_ns / 1e6);
+    out += line;
+    append_table(out, "by type", "type", types, top);
+    append_table(out, "by throw site", "site", by_site(), top);
+    return out;
+}
+
+void init() {
+    const char* target = std::getenv("CIL2CPP_EXCEPTION_PROFILE");
+    if (!target || !*target) return;
+
+    g_output = diagnostics::expand_target(target);
+    const char* top = std::getenv("CIL2CPP_EXCEPTION_PROFILE_TOP");
+    g_top = top ? static_cast<size_t>(std::max(0, std::atoi(top))) : 20;
+    enable();
+}
+
+void shutdown() {
+    if (g_output.empty()) return;
+    disable();
+    diagnostics::write_report(g_output, report(g_top), "CIL2CPP_EXCEPTION_PROFILE");
+    g_output.clear();
+}
+
+} // namespace exception_stats
+} // namespace cil2cpp
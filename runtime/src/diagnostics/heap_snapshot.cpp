@@ -0,0 +1,449 @@
+/**
+ * CIL2CPP Runtime - Heap Snapshot
+ *
+ * A full collection leaves the mark bits describing exactly the reachable blocks;
+ * GC_enumerate_reachable_objects_inner walks them with the allocation lock held, so no
+ * block can be allocated, freed or reused while the census (and, for the graph, the
+ * conservative scan for edges) reads it. Only plain data is gathered under the lock;
+ * names, sorting and the dominator tree are computed afterwards.
+ *
+ * Retained sizes use the iterative dominator algorithm of Cooper, Harvey and Kennedy
+ * over a virtual root whose children are the blocks standing in for GC roots. The real
+ * roots would only add edges from the virtual root, which can only move dominators up,
+ * so every subtree is at least as large as with them.
+ */
+
+#include <cil2cpp/heap_snapshot.h>
+#include <cil2cpp/array.h>
+#include <cil2cpp/bcl/System.Object.h>
+#include <cil2cpp/bcl/System.String.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/object.h>
+#include <cil2cpp/reflection.h>
+#include <cil2cpp/type_info.h>
+
+#include "report_target.h"
+
+#include <gc.h>
+#include <gc/gc_mark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#if defined(CIL2CPP_POSIX)
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+#endif
+
+namespace cil2cpp {
+namespace heap_snapshot {
+
+namespace {
+
+using TypeSet = std::unordered_set<const TypeInfo*>;
+
+struct Block {
+    uintptr_t address;
+    size_t bytes;
+    const TypeInfo* type;       // nullptr: no known TypeInfo header
+};
+
+// Collections a snapshot waits out before walking whatever the last one left
+constexpr int kWalkAttempts = 3;
+
+struct Walk {
+    const TypeSet* known;
+    bool scan_edges;
+    GC_word gc_no;              // the collection whose mark bits the walk reads
+    bool check_gc_no;           // false on the last attempt: walk whatever is marked
+    std::vector<Block> blocks;                          // by address after the walk
+    std::vector<std::pair<uint32_t, uint32_t>> edges;   // block indices
+};
+
+void add_type(TypeInfo* type, void* context) {
+    static_cast<TypeSet*>(context)->insert(type);
+}
+
+// Every TypeInfo an object header can point to: registered (generated) types, array
+// types created so far, the runtime's own types, and the bases and element types of those
+TypeSet known_types() {
+    TypeSet known;
+    type_for_each_registered(add_type, &known);
+    array_for_each_szarray_type_info(add_type, &known);
+
+    static TypeInfo* const runtime_types[] = {
+        &System::Object_TypeInfo, &System::String_TypeInfo,
+        &System_Object_TypeInfo, &System_String_TypeInfo, &System_Type_TypeInfo,
+        &Exception_TypeInfo, &NullReferenceException_TypeInfo, &IndexOutOfRangeException_TypeInfo,
+        &InvalidCastException_TypeInfo, &InvalidOperationException_TypeInfo,
+        &ObjectDisposedException_TypeInfo, &NotSupportedException_TypeInfo,
+        &PlatformNotSupportedException_TypeInfo, &NotImplementedException_TypeInfo,
+        &ArgumentException_TypeInfo, &ArgumentNullException_TypeInfo,
+        &ArgumentOutOfRangeException_TypeInfo, &ArithmeticException_TypeInfo,
+        &OverflowException_TypeInfo, &DivideByZeroException_TypeInfo, &FormatException_TypeInfo,
+        &RankException_TypeInfo, &ArrayTypeMismatchException_TypeInfo,
+        &TypeInitializationException_TypeInfo, &TimeoutException_TypeInfo,
+        &AggregateException_TypeInfo, &OperationCanceledException_TypeInfo,
+        &TaskCanceledException_TypeInfo, &KeyNotFoundException_TypeInfo, &IOException_TypeInfo,
+        &FileNotFoundException_TypeInfo, &DirectoryNotFoundException_TypeInfo,
+    };
+    for (auto* type : runtime_types) known.insert(type);
+
+    std::vector<const TypeInfo*> pending(known.begin(), known.end());
+    while (!pending.empty()) {
+        const TypeInfo* type = pending.back();
+        pending.pop_back();
+        for (const TypeInfo* related : {type->base_type, type->element_type_info})
+            if (related && known.insert(related).second) pending.push_back(related);
+    }
+    return known;
+}
+
+void GC_CALLBACK on_reachable(void* obj, size_t bytes, void* context) {
+    auto& walk = *static_cast<Walk*>(context);
+    const TypeInfo* type = nullptr;
+    if (bytes >= sizeof(Object)) {
+        const TypeInfo* header = static_cast<const Object*>(obj)->__type_info;
+        if (walk.known->count(header)) type = header;
+    }
+    walk.blocks.push_back({reinterpret_cast<uintptr_t>(obj), bytes, type});
+}
+
+// Every aligned word that holds the start address of another live block is an edge
+void find_edges(Walk& walk) {
+    const auto& blocks = walk.blocks;
+    std::vector<uint32_t> targets;
+    for (uint32_t from = 0; from < blocks.size(); from++) {
+        targets.clear();
+        auto* words = reinterpret_cast<const uintptr_t*>(blocks[from].address);
+        for (size_t i = 0; i < blocks[from].bytes / sizeof(uintptr_t); i++) {
+            uintptr_t value = words[i];
+            auto it = std::lower_bound(blocks.begin(), blocks.end(), value,
+                [](const Block& b, uintptr_t v) { return b.address < v; });
+            if (it == blocks.end() || it->address != value) continue;
+            auto to = static_cast<uint32_t>(it - blocks.begin());
+            if (to != from) targets.push_back(to);
+        }
+        std::sort(targets.begin(), targets.end());
+        targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+        for (uint32_t to : targets) walk.edges.emplace_back(from, to);
+    }
+}
+
+void* GC_CALLBACK walk_locked(void* context) {
+    auto& walk = *static_cast<Walk*>(context);
+    if (walk.check_gc_no && GC_get_gc_no() != walk.gc_no) return nullptr;
+    GC_enumerate_reachable_objects_inner(on_reachable, &walk);
+    std::sort(walk.blocks.begin(), walk.blocks.end(),
+        [](const Block& a, const Block& b) { return a.address < b.address; });
+    if (walk.scan_edges) find_edges(walk);
+    return context;
+}
+
+// collect() and the walk take the allocation lock separately, and an allocation on
+// another thread in between can run a collection (a new gc_no) or start an incremental
+// cycle that clears the mark bits. Collections are disabled around the walk so neither
+// can happen during it; with them disabled GC_collect_a_little does no work and only
+// reports whether a cycle is under way. Either case repeats the pair; after
+// kWalkAttempts a new gc_no is accepted (its marks are complete), a cycle never is.
+Walk take(bool scan_edges) {
+    auto known = known_types();
+    Walk walk{&known, scan_edges, 0, true, {}, {}};
+    for (int attempt = 1; ; attempt++) {
+        gc::collect();
+        walk.gc_no = GC_get_gc_no();
+        walk.check_gc_no = attempt < kWalkAttempts;
+        GC_disable();
+        bool walked = !GC_collect_a_little() && GC_call_with_alloc_lock(walk_locked, &walk);
+        GC_enable();
+        if (walked) break;
+    }
+    walk.known = nullptr;
+    return walk;
+}
+
+const char* type_name(const TypeInfo* type) {
+    if (!type) return "[other]";
+    if (type->full_name) return type->full_name;
+    return type->name ? type->name : "[unnamed]";
+}
+
+// Dominator-tree subtree sizes; node n's immediate dominator is idom[n], the virtual
+// root is index blocks.size()
+std::vector<uint64_t> retained_sizes(const Walk& walk) {
+    const auto n = static_cast<uint32_t>(walk.blocks.size());
+    const uint32_t root = n;
+
+    std::vector<uint32_t> succ_start(n + 2, 0), pred_start(n + 2, 0);
+    for (const auto& [from, to] : walk.edges) {
+        succ_start[from + 1]++;
+        pred_start[to + 1]++;
+    }
+    for (uint32_t i = 0; i <= n; i++) {
+        succ_start[i + 1] += succ_start[i];
+        pred_start[i + 1] += pred_start[i];
+    }
+    std::vector<uint32_t> succs(walk.edges.size()), preds(walk.edges.size());
+    {
+        auto succ_fill = succ_start, pred_fill = pred_start;
+        for (const auto& [from, to] : walk.edges) {
+            succs[succ_fill[from]++] = to;
+            preds[pred_fill[to]++] = from;
+        }
+    }
+
+    // Depth-first from the virtual root: first the blocks nothing points to, then one
+    // block of each cycle still unvisited
+    const uint32_t unvisited = UINT32_MAX;
+    std::vector<uint32_t> postorder(n + 1, unvisited);
+    std::vector<uint32_t> order;        // nodes by postorder number
+    order.reserve(n + 1);
+    std::vector<bool> root_child(n, false);
+    std::vector<std::pair<uint32_t, uint32_t>> stack;   // node, next successor
+    std::vector<bool> seen(n, false);
+    auto visit_from = [&](uint32_t start) {
+        seen[start] = true;
+        root_child[start] = true;
+        stack.emplace_back(start, succ_start[start]);
+        while (!stack.empty()) {
+            auto& [node, next] = stack.back();
+            if (next < succ_start[node + 1]) {
+                uint32_t s = succs[next++];
+                if (!seen[s]) {
+                    seen[s] = true;
+                    stack.emplace_back(s, succ_start[s]);
+                }
+                continue;
+            }
+            postorder[node] = static_cast<uint32_t>(order.size());
+            order.push_back(node);
+            stack.pop_back();
+        }
+    };
+    for (uint32_t i = 0; i < n; i++)
+        if (pred_start[i + 1] == pred_start[i]) visit_from(i);
+    for (uint32_t i = 0; i < n; i++)
+        if (!seen[i]) visit_from(i);
+    postorder[root] = static_cast<uint32_t>(order.size());
+
+    std::vector<uint32_t> idom(n + 1, unvisited);
+    idom[root] = root;
+    auto intersect = [&](uint32_t a, uint32_t b) {
+        while (a != b) {
+            while (postorder[a] < postorder[b]) a = idom[a];
+            while (postorder[b] < postorder[a]) b = idom[b];
+        }
+        return a;
+    };
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (size_t i = order.size(); i-- > 0;) {     // reverse postorder
+            uint32_t node = order[i];
+            uint32_t dom = root_child[node] ? root : unvisited;
+            for (uint32_t p = pred_start[node]; p < pred_start[node + 1]; p++) {
+                uint32_t pred = preds[p];
+                if (idom[pred] == unvisited) continue;
+                dom = dom == unvisited ? pred : intersect(pred, dom);
+            }
+            if (dom != unvisited && idom[node] != dom) {
+                idom[node] = dom;
+                changed = true;
+            }
+        }
+    }
+
+    // A dominator finishes after everything it dominates, so postorder sums subtrees
+    std::vector<uint64_t> retained(n + 1, 0);
+    for (uint32_t i = 0; i < n; i++) retained[i] = walk.blocks[i].bytes;
+    for (uint32_t node : order)
+        if (idom[node] != root) retained[idom[node]] += retained[node];
+    retained.pop_back();
+    return retained;
+}
+
+// ===== CIL2CPP_HEAPDUMP =====
+
+std::mutex g_dump_mutex;
+std::string g_output;           // "%p" / "%n" expanded per dump
+std::string g_graph;
+size_t g_top = 20;
+std::atomic<unsigned> g_dumps{0};
+
+#if defined(CIL2CPP_POSIX)
+// SIGUSR1 writes a byte to the pipe; the dump thread wakes up and takes the snapshot
+int g_pipe[2] = {-1, -1};
+std::atomic<bool> g_stopping{false};
+std::thread g_dump_thread;
+
+void on_dump_signal(int) {
+    int saved_errno = errno;
+    char byte = 1;
+    [[maybe_unused]] auto written = ::write(g_pipe[1], &byte, 1);
+    errno = saved_errno;
+}
+
+void dump_loop() {
+    gc::register_thread();
+    char byte;
+    while (true) {
+        ssize_t r = ::read(g_pipe[0], &byte, 1);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0 || g_stopping.load(std::memory_order_acquire)) break;
+        dump();
+    }
+    gc::unregister_thread();
+}
+#endif
+
+} // namespace
+
+Census census() {
+    auto walk = take(false);
+
+    Census result;
+    std::unordered_map<const TypeInfo*, TypeCount> per_type;
+    for (const auto& block : walk.blocks) {
+        if (!block.type) {
+            result.other_blocks++;
+            result.other_bytes += block.bytes;
+            continue;
+        }
+        auto& entry = per_type.try_emplace(block.type, TypeCount{block.type, 0, 0}).first->second;
+        entry.count++;
+        entry.bytes += block.bytes;
+        result.objects++;
+        result.bytes += block.bytes;
+    }
+    result.types.reserve(per_type.size());
+    for (const auto& [type, entry] : per_type) result.types.push_back(entry);
+    std::sort(result.types.begin(), result.types.end(), [](const TypeCount& a, const TypeCount& b) {
+        if (a.bytes != b.bytes) return a.bytes > b.bytes;
+        if (a.count != b.count) return a.count > b.count;
+        return std::strcmp(type_name(a.type), type_name(b.type)) < 0;
+    });
+    return result;
+}
+
+std::string format(const Census& census, size_t top) {
+    size_t shown = top == 0 ? census.types.size() : std::min(top, census.types.size());
+
+    std::string out;
+    char line[256];
+    std::snprintf(line, sizeof(line),
+        "cil2cpp heap census: %llu objects, %llu bytes in %zu types (+%llu other blocks, %llu bytes)\n",
+        static_cast<unsigned long long>(census.objects), static_cast<unsigned long long>(census.bytes),
+        census.types.size(), static_cast<unsigned long long>(census.other_blocks),
+        static_cast<unsigned long long>(census.other_bytes));
+    out += line;
+    std::snprintf(line, sizeof(line), "%12s %14s  %s\n", "count", "bytes", "type");
+    out += line;
+    for (size_t i = 0; i < shown; i++) {
+        const auto& e = census.types[i];
+        std::snprintf(line, sizeof(line), "%12llu %14llu  ",
+            static_cast<unsigned long long>(e.count), static_cast<unsigned long long>(e.bytes));
+        out += line;
+        out += type_name(e.type);
+        out += '\n';
+    }
+    return out;
+}
+
+bool write_graph(FILE* out) {
+    if (!out) return false;
+    auto walk = take(true);
+    auto retained = retained_sizes(walk);
+
+    std::fputs("# cil2cpp heap graph 1\n", out);
+    for (size_t i = 0; i < walk.blocks.size(); i++) {
+        std::fprintf(out, "node %zu %zu %llu %s\n", i + 1, walk.blocks[i].bytes,
+            static_cast<unsigned long long>(retained[i]), type_name(walk.blocks[i].type));
+    }
+    for (const auto& [from, to] : walk.edges)
+        std::fprintf(out, "edge %u %u\n", from + 1, to + 1);
+    return std::ferror(out) == 0;
+}
+
+bool dump() {
+    std::lock_guard<std::mutex> lock(g_dump_mutex);
+    if (g_output.empty()) return false;
+    unsigned number = g_dumps.fetch_add(1, std::memory_order_relaxed) + 1;
+    auto text = format(census(), g_top);
+
+    // Without "%n" every dump goes to the same file, so keep the earlier ones
+    bool append = g_output.find("%n") == std::string::npos;
+    bool ok = diagnostics::write_report(diagnostics::expand_target(g_output, number), text,
+        "CIL2CPP_HEAPDUMP", append);
+
+    if (!g_graph.empty()) {
+        auto path = diagnostics::expand_target(g_graph, number);
+        FILE* out = diagnostics::open_target(path, "w", "CIL2CPP_HEAPDUMP_GRAPH");
+        if (!out) {
+            ok = false;
+        } else {
+            bool written = write_graph(out);
+            if (!diagnostics::close_target(out) || !written) {
+                std::fprintf(stderr, "cil2cpp: CIL2CPP_HEAPDUMP_GRAPH: cannot write %s\n", path.c_str());
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+void init() {
+    const char* target = std::getenv("CIL2CPP_HEAPDUMP");
+    if (!target || !*target) return;
+
+    g_output = target;
+    const char* graph = std::getenv("CIL2CPP_HEAPDUMP_GRAPH");
+    g_graph = graph ? graph : "";
+    const char* top = std::getenv("CIL2CPP_HEAPDUMP_TOP");
+    g_top = top ? static_cast<size_t>(std::max(0, std::atoi(top))) : 20;
+
+#if defined(CIL2CPP_POSIX)
+    struct sigaction old{};
+    if (sigaction(SIGUSR1, nullptr, &old) != 0 || old.sa_handler != SIG_DFL) {
+        std::fprintf(stderr, "cil2cpp: CIL2CPP_HEAPDUMP: SIGUSR1 is already handled\n");
+        return;
+    }
+    if (pipe(g_pipe) != 0) {
+        std::fprintf(stderr, "cil2cpp: CIL2CPP_HEAPDUMP: cannot create the signal pipe\n");
+        return;
+    }
+    g_stopping.store(false, std::memory_order_relaxed);
+    g_dump_thread = std::thread(dump_loop);
+    signal(SIGUSR1, on_dump_signal);
+#else
+    std::fprintf(stderr, "cil2cpp: CIL2CPP_HEAPDUMP: no dump signal on this platform; "
+        "call cil2cpp::heap_snapshot::dump()\n");
+#endif
+}
+
+void shutdown() {
+#if defined(CIL2CPP_POSIX)
+    if (g_dump_thread.joinable()) {
+        signal(SIGUSR1, SIG_DFL);
+        g_stopping.store(true, std::memory_order_release);
+        char byte = 0;
+        [[maybe_unused]] auto written = ::write(g_pipe[1], &byte, 1);
+        g_dump_thread.join();
+        ::close(g_pipe[0]);
+        ::close(g_pipe[1]);
+        g_pipe[0] = g_pipe[1] = -1;
+    }
+#endif
+    std::lock_guard<std::mutex> lock(g_dump_mutex);
+    g_output.clear();
+    g_graph.clear();
+}
+
+} // namespace heap_snapshot
+} // namespace cil2cpp
@@ -0,0 +1,842 @@
+/**
+ * CIL2CPP Runtime - Sampling CPU Profiler
+ *
+ * Sampling (Linux): per-thread CLOCK_THREAD_CPUTIME timers deliver SIGPROF to their own
+ * thread. The handler only reads registers and the thread's own stack, then claims a
+ * slot in a fixed multi-producer ring with a CAS on `head`; a collector thread drains the
+ * ring every 100ms and folds stacks into counts keyed by their raw return addresses.
+ * Symbolisation and formatting happen only when a profile is written.
+ */
+
+#include <cil2cpp/profiler.h>
+
+#include "report_target.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <csignal>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <elf.h>
+#include <fcntl.h>
+#include <link.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <ucontext.h>
+#include <unistd.h>
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+
+#if defined(CIL2CPP_WINDOWS)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#define CIL2CPP_HAS_BACKTRACE 1
+#endif
+
+namespace cil2cpp {
+namespace profiler {
+
+namespace {
+
+constexpr int kMaxFrames = 64;
+constexpr int kDefaultHz = 99;
+
+// ===== Folded samples =====
+
+struct Samples {
+    std::mutex mutex;
+    // Raw frame addresses (leaf first) as bytes → sample count
+    std::unordered_map<std::string, uint64_t> stacks;
+    uint64_t total = 0;
+    int hz = kDefaultHz;
+    int64_t start_ns = 0;
+    int64_t duration_ns = 0;
+};
+
+Samples& samples() {
+    static auto* state = new Samples();
+    return *state;
+}
+
+std::atomic<uint64_t> g_dropped{0};
+
+// Caller holds samples().mutex
+void fold(const uintptr_t* frames, int depth) {
+    auto& s = samples();
+    s.stacks[std::string(reinterpret_cast<const char*>(frames), depth * sizeof(uintptr_t))]++;
+    s.total++;
+}
+
+int64_t wall_ns() {
+    timespec ts{};
+    std::timespec_get(&ts, TIME_UTC);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+// ===== Symbols =====
+
+struct ElfFunction {
+    uintptr_t start;
+    uintptr_t end;
+    const char* raw_name;   // points into the mapped executable
+};
+
+struct Symbols {
+    std::mutex mutex;
+    std::vector<MethodSymbol> methods;   // sorted by address
+    bool methods_sorted = true;
+    std::vector<ElfFunction> elf;        // sorted by start
+    bool elf_loaded = false;
+    std::unordered_map<const char*, std::string> demangled;
+    uintptr_t exe_lo = 0;                // mapped range of the executable
+    uintptr_t exe_hi = UINTPTR_MAX;
+};
+
+Symbols& symbols() {
+    static auto* state = new Symbols();
+    return *state;
+}
+
+std::string demangle(const char* raw) {
+#if defined(__GNUC__) || defined(__clang__)
+    int status = 0;
+    char* out = abi::__cxa_demangle(raw, nullptr, nullptr, &status);
+    if (status == 0 && out) {
+        std::string result(out);
+        std::free(out);
+        return result;
+    }
+#endif
+    return raw;
+}
+
+/// "ns::f(int, char*) const" → "ns::f": frames read better without the parameter list,
+/// and collapsed-stack parsers split on the last space.
+std::string strip_parameters(std::string name) {
+    if (name.size() > 6 && name.compare(name.size() - 6, 6, " const") == 0)
+        name.resize(name.size() - 6);
+    if (name.empty() || name.back() != ')') return name;
+    int depth = 0;
+    for (size_t i = name.size(); i-- > 0;) {
+        if (name[i] == ')') depth++;
+        else if (name[i] == '(' && --depth == 0) {
+            if (i > 0) name.resize(i);
+            break;
+        }
+    }
+    return name;
+}
+
+#ifdef __linux__
+
+struct ExeRange {
+    uintptr_t bias = 0;
+    uintptr_t lo = UINTPTR_MAX;
+    uintptr_t hi = 0;
+};
+
+int main_object_callback(dl_phdr_info* info, size_t, void* data) {
+    // The executable itself is always reported first
+    auto* range = static_cast<ExeRange*>(data);
+    range->bias = info->dlpi_addr;
+    for (int i = 0; i < info->dlpi_phnum; i++) {
+        const auto& ph = info->dlpi_phdr[i];
+        if (ph.p_type != PT_LOAD) continue;
+        range->lo = std::min<uintptr_t>(range->lo, info->dlpi_addr + ph.p_vaddr);
+        range->hi = std::max<uintptr_t>(range->hi, info->dlpi_addr + ph.p_vaddr + ph.p_memsz);
+    }
+    return 1;
+}
+
+// Function symbols of /proc/self/exe (.symtab, or .dynsym when stripped). The mapping
+// is kept for the life of the process so names can be demangled on demand.
+void load_elf_functions(Symbols& syms) {
+    ExeRange range;
+    dl_iterate_phdr(main_object_callback, &range);
+    if (range.lo < range.hi) {
+        syms.exe_lo = range.lo;
+        syms.exe_hi = range.hi;
+    }
+
+    int fd = open("/proc/self/exe", O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return;
+    struct stat st{};
+    void* map = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > static_cast<off_t>(sizeof(ElfW(Ehdr))))
+        map = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return;
+
+    auto size = static_cast<size_t>(st.st_size);
+    auto* base = static_cast<const unsigned char*>(map);
+    auto* eh = reinterpret_cast<const ElfW(Ehdr)*>(base);
+    if (std::memcmp(eh->e_ident, ELFMAG, SELFMAG) != 0 || eh->e_shoff == 0
+        || eh->e_shentsize != sizeof(ElfW(Shdr))
+        || eh->e_shoff + static_cast<size_t>(eh->e_shnum) * sizeof(ElfW(Shdr)) > size) {
+        munmap(map, size);
+        return;
+    }
+    auto* sections = reinterpret_cast<const ElfW(Shdr)*>(base + eh->e_shoff);
+
+    for (uint32_t wanted : {static_cast<uint32_t>(SHT_SYMTAB), static_cast<uint32_t>(SHT_DYNSYM)}) {
+        for (int i = 0; i < eh->e_shnum; i++) {
+            const auto& sec = sections[i];
+            if (sec.sh_type != wanted || sec.sh_link >= eh->e_shnum) continue;
+            const auto& strtab = sections[sec.sh_link];
+            if (sec.sh_offset + sec.sh_size > size || strtab.sh_offset + strtab.sh_size > size) continue;
+            auto* syms_begin = reinterpret_cast<const ElfW(Sym)*>(base + sec.sh_offset);
+            size_t count = sec.sh_size / sizeof(ElfW(Sym));
+            auto* names = reinterpret_cast<const char*>(base + strtab.sh_offset);
+            for (size_t k = 0; k < count; k++) {
+                const auto& sym = syms_begin[k];
+                if (ELF64_ST_TYPE(sym.st_info) != STT_FUNC || sym.st_size == 0
+                    || sym.st_shndx == SHN_UNDEF || sym.st_name >= strtab.sh_size)
+                    continue;
+                uintptr_t start = range.bias + sym.st_value;
+                syms.elf.push_back({start, start + sym.st_size, names + sym.st_name});
+            }
+        }
+        if (!syms.elf.empty()) break;
+    }
+    if (syms.elf.empty()) {
+        munmap(map, size);
+        return;
+    }
+    std::sort(syms.elf.begin(), syms.elf.end(),
+        [](const ElfFunction& a, const ElfFunction& b) { return a.start < b.start; });
+}
+
+#endif
+
+const MethodSymbol* method_at(Symbols& syms, uintptr_t address) {
+    auto it = std::lower_bound(syms.methods.begin(), syms.methods.end(), address,
+        [](const MethodSymbol& m, uintptr_t a) { return reinterpret_cast<uintptr_t>(m.address) < a; });
+    if (it != syms.methods.end() && reinterpret_cast<uintptr_t>(it->address) == address) return &*it;
+    return nullptr;
+}
+
+const MethodSymbol* method_before(Symbols& syms, uintptr_t pc) {
+    auto it = std::upper_bound(syms.methods.begin(), syms.methods.end(), pc,
+        [](uintptr_t a, const MethodSymbol& m) { return a < reinterpret_cast<uintptr_t>(m.address); });
+    return it == syms.methods.begin() ? nullptr : &*(it - 1);
+}
+
+std::string method_name(const MethodSymbol& m, FrameNames names) {
+    return names == FrameNames::Cpp || !m.name ? m.cpp_name : m.name;
+}
+
+// Caller holds syms.mutex
+std::string symbolize_locked(Symbols& syms, uintptr_t pc, FrameNames names) {
+    if (!syms.methods_sorted) {
+        std::sort(syms.methods.begin(), syms.methods.end(), [](const MethodSymbol& a, const MethodSymbol& b) {
+            return reinterpret_cast<uintptr_t>(a.address) < reinterpret_cast<uintptr_t>(b.address);
+        });
+        syms.methods_sorted = true;
+    }
+#ifdef __linux__
+    if (!syms.elf_loaded) {
+        syms.elf_loaded = true;
+        load_elf_functions(syms);
+    }
+    // Exact extents from the symbol table; compiled methods then map by entry address
+    auto it = std::upper_bound(syms.elf.begin(), syms.elf.end(), pc,
+        [](uintptr_t a, const ElfFunction& f) { return a < f.start; });
+    if (it != syms.elf.begin() && pc < (it - 1)->end) {
+        const auto& fn = *(it - 1);
+        if (auto* m = method_at(syms, fn.start)) return method_name(*m, names);
+        auto cached = syms.demangled.find(fn.raw_name);
+        if (cached != syms.demangled.end()) return cached->second;
+        return syms.demangled[fn.raw_name] = strip_parameters(demangle(fn.raw_name));
+    }
+    // Shared libraries (libc, libstdc++) through their dynamic symbols
+    if (pc < syms.exe_lo || pc >= syms.exe_hi) {
+        Dl_info info{};
+        if (!dladdr(reinterpret_cast<void*>(pc), &info)) return {};
+        if (info.dli_sname) return strip_parameters(demangle(info.dli_sname));
+        // Static function inside a library: name the library, like perf does
+        if (info.dli_fname && *info.dli_fname) {
+            const char* slash = std::strrchr(info.dli_fname, '/');
+            return std::string("[") + (slash ? slash + 1 : info.dli_fname) + "]";
+        }
+        return {};
+    }
+#endif
+    // Stripped executable: the nearest compiled method at or below the address
+    if (syms.elf.empty()) {
+        if (auto* m = method_before(syms, pc)) return method_name(*m, names);
+    }
+    return {};
+}
+
+// ===== Profile writers =====
+
+using NamedStacks = std::map<std::string, uint64_t>;
+
+std::string frame_name(Symbols& syms, std::unordered_map<uintptr_t, std::string>& cache,
+                       uintptr_t pc, FrameNames names) {
+    auto it = cache.find(pc);
+    if (it != cache.end()) return it->second;
+    auto name = symbolize_locked(syms, pc, names);
+    if (name.empty()) name = "[unknown]";
+    std::replace(name.begin(), name.end(), ';', ':');
+    return cache[pc] = name;
+}
+
+// Non-leaf frames are return addresses: look up the call instruction instead, which
+// is still inside the caller when the call was the function's last instruction.
+uintptr_t lookup_address(const uintptr_t* frames, int index) {
+    return index == 0 ? frames[0] : frames[index] - 1;
+}
+
+bool write_collapsed(std::FILE* f, const Samples& s, Symbols& syms, FrameNames names) {
+    std::unordered_map<uintptr_t, std::string> cache;
+    NamedStacks folded;
+    for (const auto& [key, count] : s.stacks) {
+        auto* frames = reinterpret_cast<const uintptr_t*>(key.data());
+        int depth = static_cast<int>(key.size() / sizeof(uintptr_t));
+        std::string line;
+        for (int i = depth; i-- > 0;) {
+            if (!line.empty()) line += ';';
+            line += frame_name(syms, cache, lookup_address(frames, i), names);
+        }
+        folded[line] += count;
+    }
+    for (const auto& [line, count] : folded)
+        std::fprintf(f, "%s %llu\n", line.c_str(), static_cast<unsigned long long>(count));
+    return true;
+}
+
+// Minimal protobuf encoder for the pprof Profile message (profile.proto)
+struct ProtoWriter {
+    std::string out;
+
+    void varint(uint64_t v) {
+        while (v >= 0x80) { out += static_cast<char>((v & 0x7F) | 0x80); v >>= 7; }
+        out += static_cast<char>(v);
+    }
+    void tag(int field, int wire) { varint(static_cast<uint64_t>(field) << 3 | wire); }
+    void int_field(int field, uint64_t v) { if (v) { tag(field, 0); varint(v); } }
+    void bytes_field(int field, const std::string& bytes) {
+        tag(field, 2);
+        varint(bytes.size());
+        out += bytes;
+    }
+    void packed_field(int field, const std::vector<uint64_t>& values) {
+        ProtoWriter inner;
+        for (auto v : values) inner.varint(v);
+        bytes_field(field, inner.out);
+    }
+};
+
+bool write_pprof(std::FILE* f, const Samples& s, Symbols& syms, FrameNames names) {
+    std::vector<std::string> strings{""};
+    std::unordered_map<std::string, uint64_t> string_ids{{"", 0}};
+    auto intern = [&](const std::string& str) {
+        auto [it, inserted] = string_ids.emplace(str, strings.size());
+        if (inserted) strings.push_back(str);
+        return it->second;
+    };
+
+    std::unordered_map<uintptr_t, std::string> cache;
+    std::unordered_map<std::string, uint64_t> function_ids;
+    std::unordered_map<uintptr_t, uint64_t> location_ids;
+    ProtoWriter profile, functions, locations;
+
+    auto type_pair = [&](const char* type, const char* unit) {
+        ProtoWriter vt;
+        vt.int_field(1, intern(type));
+        vt.int_field(2, intern(unit));
+        return vt.out;
+    };
+    profile.bytes_field(1, type_pair("samples", "count"));
+    profile.bytes_field(1, type_pair("cpu", "nanoseconds"));
+
+    uint64_t period = 1000000000ull / static_cast<uint64_t>(std::max(1, s.hz));
+    for (const auto& [key, count] : s.stacks) {
+        auto* frames = reinterpret_cast<const uintptr_t*>(key.data());
+        int depth = static_cast<int>(key.size() / sizeof(uintptr_t));
+        std::vector<uint64_t> ids;
+        for (int i = 0; i < depth; i++) {
+            uintptr_t pc = lookup_address(frames, i);
+            auto loc = location_ids.find(pc);
+            if (loc == location_ids.end()) {
+                auto name = frame_name(syms, cache, pc, names);
+                auto fn = function_ids.find(name);
+                if (fn == function_ids.end()) {
+                    fn = function_ids.emplace(name, function_ids.size() + 1).first;
+                    ProtoWriter w;
+                    w.int_field(1, fn->second);
+                    w.int_field(2, intern(name));
+                    w.int_field(3, intern(name));
+                    functions.bytes_field(5, w.out);
+                }
+                loc = location_ids.emplace(pc, location_ids.size() + 1).first;
+                ProtoWriter line, w;
+                line.int_field(1, fn->second);
+                w.int_field(1, loc->second);
+                w.int_field(3, pc);
+                w.bytes_field(4, line.out);
+                locations.bytes_field(4, w.out);
+            }
+            ids.push_back(loc->second);
+        }
+        ProtoWriter sample;
+        sample.packed_field(1, ids);
+        sample.packed_field(2, {count, count * period});
+        profile.bytes_field(2, sample.out);
+    }
+    profile.out += locations.out;
+    profile.out += functions.out;
+    for (const auto& str : strings) profile.bytes_field(6, str);
+    profile.int_field(9, static_cast<uint64_t>(s.start_ns));
+    profile.int_field(10, static_cast<uint64_t>(s.duration_ns));
+    profile.bytes_field(11, type_pair("cpu", "nanoseconds"));
+    profile.int_field(12, period);
+    return std::fwrite(profile.out.data(), 1, profile.out.size(), f) == profile.out.size();
+}
+
+bool is_pprof_path(const char* path) {
+    std::string p(path);
+    for (const char* ext : {".pb", ".pprof"}) {
+        size_t n = std::strlen(ext);
+        if (p.size() >= n && p.compare(p.size() - n, n, ext) == 0) return true;
+    }
+    return false;
+}
+
+// ===== Configuration (CIL2CPP_PROFILE*) =====
+
+std::string g_output;
+FrameNames g_output_names = FrameNames::DotNet;
+
+#ifdef __linux__
+
+// ===== Sampling =====
+
+struct alignas(64) Slot {
+    std::atomic<uint64_t> seq;   // claim index + 1 once the frames are published
+    int32_t depth;
+    uintptr_t frames[kMaxFrames];
+};
+
+constexpr uint64_t kRingSlots = 4096;
+
+Slot* g_ring = nullptr;                    // allocated by the first start(), never freed
+std::atomic<uint64_t> g_head{0};
+std::atomic<uint64_t> g_tail{0};
+std::atomic<bool> g_running{false};
+std::atomic<int> g_in_handler{0};
+std::atomic<bool> g_dump_requested{false};
+sem_t g_wake;
+std::thread g_collector;
+
+// Stack bounds of the current thread; trivially constructible so the signal handler's
+// access needs no TLS initialisation.
+struct ThreadStack {
+    uintptr_t lo;
+    uintptr_t hi;
+    bool attached;
+};
+thread_local ThreadStack t_stack;
+
+struct AttachedThread {
+    pid_t tid;
+    pthread_t handle;
+    timer_t timer;
+    bool armed;
+};
+
+struct Threads {
+    std::mutex mutex;
+    std::vector<AttachedThread> list;
+    int64_t interval_ns = 0;
+};
+
+Threads& threads() {
+    static auto* state = new Threads();
+    return *state;
+}
+
+void ring_push(const uintptr_t* frames, int depth) {
+    uint64_t h = g_head.load(std::memory_order_relaxed);
+    do {
+        if (h - g_tail.load(std::memory_order_acquire) >= kRingSlots) {
+            g_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    } while (!g_head.compare_exchange_weak(h, h + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+    Slot& slot = g_ring[h % kRingSlots];
+    slot.depth = depth;
+    std::memcpy(slot.frames, frames, depth * sizeof(uintptr_t));
+    slot.seq.store(h + 1, std::memory_order_release);
+}
+
+// Single consumer: callers hold samples().mutex
+void drain_ring() {
+    if (!g_ring) return;
+    uint64_t t = g_tail.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = g_ring[t % kRingSlots];
+        if (slot.seq.load(std::memory_order_acquire) != t + 1) break;
+        fold(slot.frames, slot.depth);
+        g_tail.store(++t, std::memory_order_release);
+    }
+}
+
+void on_sigprof(int, siginfo_t*, void* context) {
+    g_in_handler.fetch_add(1, std::memory_order_acquire);
+    if (!g_running.load(std::memory_order_relaxed)) {
+        g_in_handler.fetch_sub(1, std::memory_order_release);
+        return;
+    }
+    int saved_errno = errno;
+    auto* uc = static_cast<ucontext_t*>(context);
+    uintptr_t pc = 0, fp = 0;
+#if defined(__x86_64__)
+    pc = static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RIP]);
+    fp = static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RBP]);
+#elif defined(__aarch64__)
+    pc = static_cast<uintptr_t>(uc->uc_mcontext.pc);
+    fp = static_cast<uintptr_t>(uc->uc_mcontext.regs[29]);
+#else
+    (void)uc;
+#endif
+    if (pc) {
+        uintptr_t frames[kMaxFrames];
+        int depth = 0;
+        frames[depth++] = pc;
+        // Frame record on x86-64 and AArch64: [fp] = caller's fp, [fp + 8] = return address.
+        // Only follow records inside this thread's stack, strictly towards its base.
+        uintptr_t lo = t_stack.lo, hi = t_stack.hi;
+        while (depth < kMaxFrames && fp >= lo && fp + 2 * sizeof(uintptr_t) <= hi
+               && (fp & (sizeof(uintptr_t) - 1)) == 0) {
+            auto* record = reinterpret_cast<const uintptr_t*>(fp);
+            uintptr_t next = record[0], ret = record[1];
+            if (ret == 0) break;
+            frames[depth++] = ret;
+            if (next <= fp) break;
+            fp = next;
+        }
+        ring_push(frames, depth);
+    }
+    errno = saved_errno;
+    g_in_handler.fetch_sub(1, std::memory_order_release);
+}
+
+void on_dump_signal(int) {
+    g_dump_requested.store(true, std::memory_order_relaxed);
+    sem_post(&g_wake);
+}
+
+pid_t current_tid() {
+    return static_cast<pid_t>(syscall(SYS_gettid));
+}
+
+// Caller holds threads().mutex
+void arm(AttachedThread& t, int64_t interval_ns) {
+    clockid_t clock;
+    if (pthread_getcpuclockid(t.handle, &clock) != 0) return;
+    sigevent sev{};
+    sev.sigev_notify = SIGEV_THREAD_ID;
+    sev.sigev_signo = SIGPROF;
+    sev.sigev_notify_thread_id = t.tid;
+    if (timer_create(clock, &sev, &t.timer) != 0) return;
+    itimerspec spec{};
+    spec.it_interval.tv_sec = static_cast<time_t>(interval_ns / 1000000000);
+    spec.it_interval.tv_nsec = static_cast<long>(interval_ns % 1000000000);
+    spec.it_value = spec.it_interval;
+    if (timer_settime(t.timer, 0, &spec, nullptr) != 0) {
+        timer_delete(t.timer);
+        return;
+    }
+    t.armed = true;
+}
+
+void disarm(AttachedThread& t) {
+    if (!t.armed) return;
+    timer_delete(t.timer);
+    t.armed = false;
+}
+
+void collector_loop() {
+    while (g_running.load(std::memory_order_acquire)) {
+        timespec deadline{};
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += 100000000;
+        if (deadline.tv_nsec >= 1000000000) { deadline.tv_sec++; deadline.tv_nsec -= 1000000000; }
+        sem_timedwait(&g_wake, &deadline);
+        {
+            std::lock_guard<std::mutex> lock(samples().mutex);
+            drain_ring();
+        }
+        if (g_dump_requested.exchange(false) && !g_output.empty()) write(g_output.c_str(), Format::Auto, g_output_names);
+    }
+}
+
+bool install_handler(int sig, void (*handler)(int, siginfo_t*, void*)) {
+    struct sigaction sa{};
+    sa.sa_sigaction = handler;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    return sigaction(sig, &sa, nullptr) == 0;
+}
+
+#endif
+
+} // namespace
+
+void register_methods(const MethodSymbol* entries, size_t count) {
+    auto& syms = symbols();
+    std::lock_guard<std::mutex> lock(syms.mutex);
+    syms.methods.insert(syms.methods.end(), entries, entries + count);
+    syms.methods_sorted = false;
+}
+
+std::string symbolize(const void* pc, FrameNames names) {
+    auto& syms = symbols();
+    std::lock_guard<std::mutex> lock(syms.mutex);
+    return symbolize_locked(syms, reinterpret_cast<uintptr_t>(pc), names);
+}
+
+int capture_stack(const void** frames, int max_depth) {
+    if (max_depth <= 0) return 0;
+    max_depth = std::min(max_depth, kMaxFrames);
+#if defined(CIL2CPP_WINDOWS)
+    return CaptureStackBackTrace(1, static_cast<DWORD>(max_depth), const_cast<void**>(frames), nullptr);
+#elif defined(CIL2CPP_HAS_BACKTRACE)
+    // One extra frame: backtrace() also returns this function
+    void* raw[kMaxFrames + 1];
+    int depth = backtrace(raw, max_depth + 1) - 1;
+    for (int i = 0; i < depth; i++) frames[i] = raw[i + 1];
+    return depth > 0 ? depth : 0;
+#else
+    (void)frames;
+    return 0;
+#endif
+}
+
+std::string calling_method(const void* const* frames, int depth) {
+    for (int i = 0; i < depth; i++) {
+        // Return addresses: look up the call instruction, one byte back
+        auto name = symbolize(static_cast<const char*>(frames[i]) - 1);
+        if (name.empty() || name.rfind("cil2cpp::", 0) == 0 || name.rfind("std::", 0) == 0) continue;
+        return name;
+    }
+    return "[unknown]";
+}
+
+void record(const void* const* frames, int depth) {
+    if (depth <= 0) return;
+    depth = std::min(depth, kMaxFrames);
+    uintptr_t copy[kMaxFrames];
+    for (int i = 0; i < depth; i++) copy[i] = reinterpret_cast<uintptr_t>(frames[i]);
+    std::lock_guard<std::mutex> lock(samples().mutex);
+    fold(copy, depth);
+}
+
+uint64_t sample_count() {
+    auto& s = samples();
+    std::lock_guard<std::mutex> lock(s.mutex);
+#ifdef __linux__
+    drain_ring();
+#endif
+    return s.total;
+}
+
+uint64_t dropped_count() {
+    return g_dropped.load(std::memory_order_relaxed);
+}
+
+void reset() {
+    auto& s = samples();
+    std::lock_guard<std::mutex> lock(s.mutex);
+#ifdef __linux__
+    drain_ring();
+#endif
+    s.stacks.clear();
+    s.total = 0;
+    s.start_ns = wall_ns();
+    s.duration_ns = 0;
+    g_dropped.store(0, std::memory_order_relaxed);
+}
+
+bool write(const char* path, Format format, FrameNames names) {
+    auto& s = samples();
+    std::lock_guard<std::mutex> lock(s.mutex);
+#ifdef __linux__
+    drain_ring();
+    if (g_running.load(std::memory_order_relaxed)) s.duration_ns = wall_ns() - s.start_ns;
+#endif
+    std::FILE* f = std::fopen(path, "wb");
+    if (!f) return false;
+    if (format == Format::Auto) format = is_pprof_path(path) ? Format::Pprof : Format::Collapsed;
+    auto& syms = symbols();
+    std::lock_guard<std::mutex> symbols_lock(syms.mutex);
+    bool ok = format == Format::Pprof ? write_pprof(f, s, syms, names) : write_collapsed(f, s, syms, names);
+    return std::fclose(f) == 0 && ok;
+}
+
+#ifdef __linux__
+
+bool start(int hz) {
+    if (hz <= 0) hz = kDefaultHz;
+    if (g_running.load()) return false;
+    static bool installed = false;
+    if (!installed) {
+        g_ring = new Slot[kRingSlots]();
+        sem_init(&g_wake, 0, 0);
+        if (!install_handler(SIGPROF, on_sigprof)) return false;
+        installed = true;
+    }
+    reset();
+    {
+        std::lock_guard<std::mutex> lock(samples().mutex);
+        samples().hz = hz;
+    }
+    thread_attach();
+
+    g_running.store(true, std::memory_order_release);
+    g_collector = std::thread(collector_loop);
+    auto& ts = threads();
+    std::lock_guard<std::mutex> lock(ts.mutex);
+    ts.interval_ns = 1000000000 / hz;
+    for (auto& t : ts.list) arm(t, ts.interval_ns);
+    return true;
+}
+
+void stop() {
+    if (!g_running.load()) return;
+    {
+        auto& ts = threads();
+        std::lock_guard<std::mutex> lock(ts.mutex);
+        for (auto& t : ts.list) disarm(t);
+    }
+    g_running.store(false, std::memory_order_release);
+    // A SIGPROF already in flight may still be pushing; let it publish its slot
+    while (g_in_handler.load(std::memory_order_acquire) != 0) sched_yield();
+    sem_post(&g_wake);
+    if (g_collector.joinable()) g_collector.join();
+    auto& s = samples();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    drain_ring();
+    s.duration_ns = wall_ns() - s.start_ns;
+}
+
+bool is_running() {
+    return g_running.load(std::memory_order_acquire);
+}
+
+void thread_attach() {
+    if (t_stack.attached) return;
+    pthread_attr_t attr;
+    if (pthread_getattr_np(pthread_self(), &attr) == 0) {
+        void* addr = nullptr;
+        size_t size = 0;
+        if (pthread_attr_getstack(&attr, &addr, &size) == 0) {
+            t_stack.lo = reinterpret_cast<uintptr_t>(addr);
+            t_stack.hi = t_stack.lo + size;
+        }
+        pthread_attr_destroy(&attr);
+    }
+    t_stack.attached = true;
+
+    auto& ts = threads();
+    std::lock_guard<std::mutex> lock(ts.mutex);
+    AttachedThread t{current_tid(), pthread_self(), {}, false};
+    if (g_running.load(std::memory_order_acquire)) arm(t, ts.interval_ns);
+    ts.list.push_back(t);
+}
+
+void thread_detach() {
+    if (!t_stack.attached) return;
+    t_stack.attached = false;
+    auto& ts = threads();
+    std::lock_guard<std::mutex> lock(ts.mutex);
+    pid_t tid = current_tid();
+    for (size_t i = 0; i < ts.list.size(); i++) {
+        if (ts.list[i].tid != tid) continue;
+        disarm(ts.list[i]);
+        ts.list[i] = ts.list.back();
+        ts.list.pop_back();
+        break;
+    }
+}
+
+void init() {
+    thread_attach();
+    const char* path = std::getenv("CIL2CPP_PROFILE");
+    if (!path || !*path) return;
+
+    g_output = diagnostics::expand_target(path);
+    const char* names = std::getenv("CIL2CPP_PROFILE_NAMES");
+    g_output_names = names && std::strcmp(names, "cpp") == 0 ? FrameNames::Cpp : FrameNames::DotNet;
+    const char* hz = std::getenv("CIL2CPP_PROFILE_HZ");
+
+    if (!start(hz ? std::atoi(hz) : kDefaultHz)) {
+        std::fprintf(stderr, "cil2cpp: CIL2CPP_PROFILE: could not start the sampling profiler\n");
+        g_output.clear();
+        return;
+    }
+    struct sigaction old{};
+    if (sigaction(SIGUSR2, nullptr, &old) == 0 && old.sa_handler == SIG_DFL)
+        signal(SIGUSR2, on_dump_signal);
+}
+
+#else // !__linux__
+
+bool start(int) { return false; }
+void stop() {}
+bool is_running() { return false; }
+void thread_attach() {}
+void thread_detach() {}
+
+void init() {
+    const char* path = std::getenv("CIL2CPP_PROFILE");
+    if (path && *path)
+        std::fprintf(stderr, "cil2cpp: CIL2CPP_PROFILE: sampling is only supported on Linux\n");
+}
+
+#endif
+
+void shutdown() {
+    stop();
+    if (g_output.empty()) return;
+    if (write(g_output.c_str(), Format::Auto, g_output_names)) {
+        std::fprintf(stderr, "cil2cpp: profile written to %s (%llu samples, %llu dropped)\n",
+            g_output.c_str(), static_cast<unsigned long long>(sample_count()),
+            static_cast<unsigned long long>(dropped_count()));
+    } else {
+        std::fprintf(stderr, "cil2cpp: CIL2CPP_PROFILE: cannot write %s\n", g_output.c_str());
+    }
+    g_output.clear();
+}
+
+} // namespace profiler
+} // namespace cil2cpp
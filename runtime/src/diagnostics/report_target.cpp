@@ -0,0 +1,60 @@
+/**
+ * CIL2CPP Runtime - Diagnostics Report Targets
+ */
+
+#include "report_target.h"
+
+#if defined(CIL2CPP_WINDOWS)
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+namespace cil2cpp {
+namespace diagnostics {
+
+std::string expand_target(const std::string& pattern, unsigned number) {
+    std::string out;
+    for (size_t i = 0; i < pattern.size(); i++) {
+        char next = i + 1 < pattern.size() ? pattern[i + 1] : '\0';
+        if (pattern[i] == '%' && next == 'p') {
+            out += std::to_string(getpid());
+            i++;
+        } else if (pattern[i] == '%' && next == 'n' && number != 0) {
+            out += std::to_string(number);
+            i++;
+        } else {
+            out += pattern[i];
+        }
+    }
+    return out;
+}
+
+FILE* open_target(const std::string& target, const char* mode, const char* variable) {
+    if (target == "stderr") return stderr;
+    if (target == "stdout") return stdout;
+    FILE* file = std::fopen(target.c_str(), mode);
+    if (!file) std::fprintf(stderr, "cil2cpp: %s: cannot write %s\n", variable, target.c_str());
+    return file;
+}
+
+bool close_target(FILE* file) {
+    if (file == stderr || file == stdout) return std::fflush(file) == 0;
+    return std::fclose(file) == 0;
+}
+
+bool write_report(const std::string& target, const std::string& text, const char* variable,
+                  bool append) {
+    FILE* out = open_target(target, append ? "a" : "w", variable);
+    if (!out) return false;
+    bool ok = std::fwrite(text.data(), 1, text.size(), out) == text.size();
+    if (!close_target(out) || !ok) {
+        std::fprintf(stderr, "cil2cpp: %s: cannot write %s\n", variable, target.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace diagnostics
+} // namespace cil2cpp
@@ -0,0 +1,32 @@
+/**
+ * CIL2CPP Runtime - Diagnostics Report Targets
+ *
+ * Internal header. The profilers and dumps take their destination from an environment
+ * variable: "stderr", "stdout" or a path in which "%p" stands for the pid (and, for
+ * numbered dumps, "%n" for the dump number).
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+
+namespace cil2cpp {
+namespace diagnostics {
+
+/// `pattern` with "%p" replaced by the pid and, if `number` is not 0, "%n" by `number`.
+std::string expand_target(const std::string& pattern, unsigned number = 0);
+
+/// stderr / stdout for those names, else the file at `target` opened with `mode`. On
+/// failure prints "cil2cpp: <variable>: cannot write <target>" and returns nullptr.
+FILE* open_target(const std::string& target, const char* mode, const char* variable);
+
+/// Flush a standard stream or close a file from open_target; false on a write error.
+bool close_target(FILE* file);
+
+/// Write `text` to `target`: a file is replaced, or appended to if `append`.
+bool write_report(const std::string& target, const std::string& text, const char* variable,
+                  bool append = false);
+
+} // namespace diagnostics
+} // namespace cil2cpp
@@ -0,0 +1,40 @@
+/**
+ * CIL2CPP Runtime - Diagnostics Site Table
+ */
+
+#include "site_table.h"
+
+#include <cil2cpp/profiler.h>
+#include <cil2cpp/type_info.h>
+
+#include <cstring>
+#include <functional>
+
+namespace cil2cpp {
+namespace diagnostics {
+
+bool SiteKey::operator==(const SiteKey& other) const {
+    return type == other.type && depth == other.depth &&
+        std::memcmp(frames, other.frames, sizeof(frames[0]) * depth) == 0;
+}
+
+size_t SiteKeyHash::operator()(const SiteKey& key) const {
+    size_t h = std::hash<const void*>{}(key.type);
+    for (int i = 0; i < key.depth; i++)
+        h = h * 31 + std::hash<const void*>{}(key.frames[i]);
+    return h;
+}
+
+const char* site_type_name(const TypeInfo* type) {
+    return type && type->full_name ? type->full_name : "[unknown type]";
+}
+
+std::string site_name(const SiteKey& key) {
+    std::string name = site_type_name(key.type);
+    name += " @ ";
+    name += profiler::calling_method(key.frames, key.depth);
+    return name;
+}
+
+} // namespace diagnostics
+} // namespace cil2cpp
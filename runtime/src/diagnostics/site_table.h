@@ -0,0 +1,106 @@
+/**
+ * CIL2CPP Runtime - Diagnostics Site Table
+ *
+ * Internal header. Totals keyed by a type and the raw return addresses captured where
+ * an event happened (a contended monitor enter, a throw). Frames are symbolised only
+ * for the report, where keys that resolve to the same type and calling method merge.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cil2cpp {
+
+struct TypeInfo;
+
+namespace diagnostics {
+
+constexpr int kSiteFrames = 8;
+
+struct SiteKey {
+    const TypeInfo* type;
+    const void* frames[kSiteFrames];
+    int depth;
+
+    bool operator==(const SiteKey& other) const;
+};
+
+struct SiteKeyHash {
+    size_t operator()(const SiteKey& key) const;
+};
+
+struct SiteTotals {
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+
+    void add(uint64_t events, uint64_t ns, uint64_t max) {
+        count += events;
+        total_ns += ns;
+        max_ns = std::max(max_ns, max);
+    }
+};
+
+/// Report rows by name, before sorting.
+using SiteRows = std::map<std::string, SiteTotals>;
+
+class SiteTable {
+public:
+    /// Add `events` taking `ns` in total, the longest `max`.
+    void add(const SiteKey& key, uint64_t events, uint64_t ns, uint64_t max) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sites_[key].add(events, ns, max);
+    }
+
+    /// Add to a key that is already present; false if it is not (cleared since).
+    bool add_existing(const SiteKey& key, uint64_t ns, uint64_t max) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = sites_.find(key);
+        if (it == sites_.end()) return false;
+        it->second.add(0, ns, max);
+        return true;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sites_.clear();
+    }
+
+    std::vector<std::pair<SiteKey, SiteTotals>> snapshot() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return {sites_.begin(), sites_.end()};
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<SiteKey, SiteTotals, SiteKeyHash> sites_;
+};
+
+/// Full name of `type`, "[unknown type]" without one.
+const char* site_type_name(const TypeInfo* type);
+
+/// "<type> @ <first method outside the runtime>".
+std::string site_name(const SiteKey& key);
+
+/// `rows` as report entries ({name, count, total_ns, max_ns}), ordered by `before`.
+template <class Entry, class Before>
+std::vector<Entry> sorted_entries(const SiteRows& rows, Before before) {
+    std::vector<Entry> result;
+    result.reserve(rows.size());
+    for (const auto& [name, totals] : rows)
+        result.push_back({name, totals.count, totals.total_ns, totals.max_ns});
+    std::stable_sort(result.begin(), result.end(), before);
+    return result;
+}
+
+} // namespace diagnostics
+} // namespace cil2cpp
@@ -3,6 +3,8 @@
  */
 
 #include <cil2cpp/exception.h>
+#include <cil2cpp/delegate.h>
+#include <cil2cpp/exception_stats.h>
 #include <cil2cpp/gc.h>
 #include <cil2cpp/string.h>
 #include <cil2cpp/type_info.h>
@@ -62,7 +64,74 @@ extern TypeInfo OperationCanceledException_TypeInfo;
 extern TypeInfo TaskCanceledException_TypeInfo;
 extern TypeInfo KeyNotFoundException_TypeInfo;
 
+// Exception.GetExceptionCount / the exception-count runtime counter
+static std::atomic<uint64_t> g_exception_count{0};
+
+uint64_t exception_count() {
+    return g_exception_count.load(std::memory_order_relaxed);
+}
+
+// AppDomain.FirstChanceException: the combined handler delegate (a static, so the GC
+// sees it) and the FirstChanceExceptionEventArgs layout the compiler registered
+static std::mutex g_first_chance_mutex;
+static std::atomic<Object*> g_first_chance_handlers{nullptr};
+static TypeInfo* g_first_chance_args_type = nullptr;
+static size_t g_first_chance_args_size = 0;
+static size_t g_first_chance_exception_offset = 0;
+static thread_local bool t_in_first_chance = false;
+
+void exception_set_first_chance_args_typeinfo(TypeInfo* type, size_t size, size_t exception_offset) {
+    g_first_chance_args_type = type;
+    g_first_chance_args_size = size;
+    g_first_chance_exception_offset = exception_offset;
+}
+
+void exception_add_first_chance_handler(void* handler) {
+    std::lock_guard<std::mutex> lock(g_first_chance_mutex);
+    g_first_chance_handlers.store(
+        delegate_combine(g_first_chance_handlers.load(std::memory_order_relaxed), static_cast<Object*>(handler)),
+        std::memory_order_release);
+}
+
+void exception_remove_first_chance_handler(void* handler) {
+    std::lock_guard<std::mutex> lock(g_first_chance_mutex);
+    g_first_chance_handlers.store(
+        delegate_remove(g_first_chance_handlers.load(std::memory_order_relaxed), static_cast<Object*>(handler)),
+        std::memory_order_release);
+}
+
+// Invoke each EventHandler<FirstChanceExceptionEventArgs>(sender: null, e). An exception
+// escaping a handler is dropped, and throws inside handlers don't raise the event again.
+static void raise_first_chance(Exception* ex) {
+    auto* handlers = static_cast<Delegate*>(g_first_chance_handlers.load(std::memory_order_acquire));
+    if (!handlers || !g_first_chance_args_type || t_in_first_chance) return;
+    t_in_first_chance = true;
+
+    auto* args = static_cast<Object*>(gc::alloc(g_first_chance_args_size, g_first_chance_args_type));
+    *reinterpret_cast<Exception**>(reinterpret_cast<char*>(args) + g_first_chance_exception_offset) = ex;
+
+    Int32 count = delegate_get_invocation_count(handlers);
+    for (Int32 i = 0; i < count; i++) {
+        auto* del = delegate_get_invocation_item(handlers, i);
+        if (!del || !del->method_ptr) continue;
+        CIL2CPP_TRY
+            if (del->target) {
+                using InstanceFn = void(*)(Object*, Object*, Object*);
+                reinterpret_cast<InstanceFn>(del->method_ptr)(delegate_adjust_target(del->target), nullptr, args);
+            } else {
+                using StaticFn = void(*)(Object*, Object*);
+                reinterpret_cast<StaticFn>(del->method_ptr)(nullptr, args);
+            }
+        CIL2CPP_CATCH_ALL
+        CIL2CPP_END_TRY
+    }
+    t_in_first_chance = false;
+}
+
 [[noreturn]] void throw_exception(Exception* ex) {
+    g_exception_count.fetch_add(1, std::memory_order_relaxed);
+    if (exception_stats::is_enabled()) exception_stats::record_throw(ex);
+
     // Capture stack trace for user-thrown exceptions that don't have one yet.
     // Runtime throw_* functions already set this via create_exception(),
     // but user code (throw new Exception(...)) goes through newobj + .ctor
@@ -71,6 +140,11 @@ extern TypeInfo KeyNotFoundException_TypeInfo;
         ex->f__stackTraceString = capture_stack_trace();
     }
 
+    if (g_first_chance_handlers.load(std::memory_order_relaxed)) raise_first_chance(ex);
+    propagate_exception(ex);
+}
+
+[[noreturn]] void propagate_exception(Exception* ex) {
     // Skip contexts that are in catch (state=1) or finally (state=2) state.
     // This prevents re-entering the same handler when an exception is thrown
     // from within a catch or finally block — matching .NET semantics where
@@ -81,6 +155,7 @@ extern TypeInfo KeyNotFoundException_TypeInfo;
 #endif
         g_exception_context = g_exception_context->previous;
     }
+    if (exception_stats::is_enabled()) exception_stats::record_unwind(ex);
 
     if (g_exception_context) {
 #ifndef NDEBUG
@@ -122,6 +197,11 @@ extern TypeInfo KeyNotFoundException_TypeInfo;
     std::abort();
 }
 
+void exception_caught() {
+    // Unconditional: profiling may have been turned off since the throw
+    exception_stats::record_catch();
+}
+
 template<typename T = Exception>
 static T* create_exception(TypeInfo* type, const char* message) {
     static_assert(std::is_base_of_v<Exception, T>, "T must derive from Exception");
@@ -587,14 +667,17 @@ EXCEPTION_TYPEINFO(RankException,                   "System", "System.RankExcept
 EXCEPTION_TYPEINFO(ArrayTypeMismatchException,      "System", "System.ArrayTypeMismatchException",      Exception)
 EXCEPTION_TYPEINFO(TypeInitializationException,     "System", "System.TypeInitializationException",     Exception)
 EXCEPTION_TYPEINFO(TimeoutException,                "System", "System.TimeoutException",                Exception)
+EXCEPTION_TYPEINFO(ApplicationException,            "System", "System.ApplicationException",            Exception)
 EXCEPTION_TYPEINFO(AggregateException,              "System", "System.AggregateException",              Exception)
 EXCEPTION_TYPEINFO(OperationCanceledException,      "System", "System.OperationCanceledException",      Exception)
 EXCEPTION_TYPEINFO(TaskCanceledException,           "System.Threading.Tasks", "System.Threading.Tasks.TaskCanceledException", OperationCanceledException)
 EXCEPTION_TYPEINFO(KeyNotFoundException,            "System.Collections.Generic", "System.Collections.Generic.KeyNotFoundException", Exception)
+EXCEPTION_TYPEINFO(SemaphoreFullException,          "System.Threading", "System.Threading.SemaphoreFullException", Exception)
 EXCEPTION_TYPEINFO(IOException,                    "System.IO", "System.IO.IOException",                    Exception)
 EXCEPTION_TYPEINFO(FileNotFoundException,          "System.IO", "System.IO.FileNotFoundException",          IOException)
 EXCEPTION_TYPEINFO(DirectoryNotFoundException,     "System.IO", "System.IO.DirectoryNotFoundException",     IOException)
 EXCEPTION_TYPEINFO(MissingMethodException,         "System", "System.MissingMethodException",               Exception)
+EXCEPTION_TYPEINFO(TargetParameterCountException,  "System.Reflection", "System.Reflection.TargetParameterCountException", Exception)
 EXCEPTION_TYPEINFO(DllNotFoundException,           "System", "System.DllNotFoundException",                 Exception)
 
 #undef EXCEPTION_TYPEINFO
@@ -624,6 +707,25 @@ EXCEPTION_TYPEINFO(DllNotFoundException,           "System", "System.DllNotFound
     throw_exception(ex);
 }
 
+[[noreturn]] void throw_mutex_not_owned() {
+    // Mutex.ReleaseMutex / WaitHandle.SignalAndWait on a mutex the thread does not own
+    Exception* ex = create_exception(&ApplicationException_TypeInfo,
+                                      "Object synchronization method was called from an unsynchronized block of code.");
+    throw_exception(ex);
+}
+
+[[noreturn]] void throw_semaphore_full() {
+    Exception* ex = create_exception(&SemaphoreFullException_TypeInfo,
+                                      "Adding the specified count to the semaphore would cause it to exceed its maximum count.");
+    throw_exception(ex);
+}
+
+[[noreturn]] void throw_target_parameter_count() {
+    Exception* ex = create_exception(&TargetParameterCountException_TypeInfo,
+                                      "Parameter count mismatch.");
+    throw_exception(ex);
+}
+
 [[noreturn]] void throw_dll_not_found(String* libraryName) {
     char buf[512];
     if (libraryName) {
@@ -14,15 +14,37 @@
 #include <cil2cpp/exception.h>
 
 #include <gc.h>
+#include <atomic>
+#include <chrono>
 #include <cstdio>
 
 namespace cil2cpp {
 namespace gc {
 
+// Stop-the-world time for GCStats::total_pause_time_ms. Boehm reports events from the
+// collecting thread with the allocation lock held, so one collection at a time.
+static std::atomic<int64_t> s_pause_ns{0};
+static int64_t s_stop_start_ns = 0;
+
+static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void GC_CALLBACK on_collection_event(GC_EventType event) {
+    if (event == GC_EVENT_PRE_STOP_WORLD) {
+        s_stop_start_ns = now_ns();
+    } else if (event == GC_EVENT_POST_START_WORLD && s_stop_start_ns != 0) {
+        s_pause_ns.fetch_add(now_ns() - s_stop_start_ns, std::memory_order_relaxed);
+        s_stop_start_ns = 0;
+    }
+}
+
 void init(const GCConfig&) {
     GC_INIT();
     GC_enable_incremental();
     GC_allow_register_threads();
+    GC_set_on_collection_event(on_collection_event);
 }
 
 void shutdown() {
@@ -122,6 +144,35 @@ void unregister_thread() {
     GC_unregister_my_thread();
 }
 
+namespace {
+
+thread_local bool t_in_blocking = false;
+
+struct BlockingCall {
+    void (*fn)(void*);
+    void* data;
+};
+
+void* GC_CALLBACK run_blocking(void* client_data) {
+    auto* call = static_cast<BlockingCall*>(client_data);
+    call->fn(call->data);
+    return nullptr;
+}
+
+} // anonymous namespace
+
+void do_blocking(void (*fn)(void*), void* data) {
+    // The collector never waits for threads it does not know about
+    if (t_in_blocking || !GC_thread_is_registered()) {
+        fn(data);
+        return;
+    }
+    BlockingCall call{fn, data};
+    t_in_blocking = true;
+    GC_do_blocking(run_blocking, &call);
+    t_in_blocking = false;
+}
+
 void* alloc_uncollectable(size_t size) {
     return GC_MALLOC_UNCOLLECTABLE(size);
 }
@@ -139,12 +190,19 @@ void remove_root(void**) {
 }
 
 GCStats get_stats() {
+    size_t allocated = GC_get_total_bytes();
+    size_t heap = GC_get_heap_size();
+    size_t free_bytes = GC_get_free_bytes();
+    // BoehmGC doesn't count freed bytes; whatever was allocated and is no longer
+    // in use has been reclaimed (or is garbage awaiting the next sweep).
+    size_t in_use = heap > free_bytes ? heap - free_bytes : 0;
     return GCStats{
-        .total_allocated = GC_get_total_bytes(),
-        .total_freed = 0,  // BoehmGC doesn't track freed bytes directly
-        .current_heap_size = GC_get_heap_size(),
+        .total_allocated = allocated,
+        .total_freed = allocated > in_use ? allocated - in_use : 0,
+        .current_heap_size = heap,
         .collection_count = static_cast<size_t>(GC_get_gc_no()),
-        .total_pause_time_ms = 0.0
+        .total_pause_time_ms = static_cast<double>(s_pause_ns.load(std::memory_order_relaxed)) / 1e6,
+        .free_bytes = free_bytes
     };
 }
 
@@ -1,41 +1,103 @@
 /**
  * CIL2CPP Runtime - GCHandle Implementation
  *
- * Handle table backed by a vector + free list.
- * - Normal/Pinned: strong reference (kept in GC-visible table).
- * - Weak/WeakTrackResurrection: stored as raw pointers. Currently
- *   weak handles do NOT auto-clear when the object is collected.
- *   This is a known limitation — BoehmGC's GC_register_disappearing_link
- *   deadlocks when other threads are blocked in native calls (e.g. accept()).
- *   Proper fix: GC-safe transitions before blocking native calls.
+ * Segmented handle table. Handle index i lives in segment i >> kSegmentBits; segments are
+ * allocated on demand, published once through an atomic directory and never moved, so
+ * reading a handle's target is two atomic loads and no lock.
+ *
+ * - Normal/Pinned: the slot holds the object pointer. Segments are uncollectable GC memory,
+ *   which BoehmGC scans, so strong handles keep their targets alive.
+ * - Weak/WeakTrackResurrection: the slot holds GC_HIDE_POINTER(obj), invisible to the
+ *   marker, and is registered as a disappearing link (Weak) or long link
+ *   (WeakTrackResurrection): the collector zeroes it when the target dies — before
+ *   finalization for Weak, only once the object is reclaimed for WeakTrackResurrection.
+ *   Weak reads are lock-free: reveal the pointer, then confirm the slot still holds it
+ *   (see load_weak). Weak writes (re-registering the link) hold a striped mutex.
+ * - Dependent (DependentHandle, the ephemeron behind ConditionalWeakTable): the target is
+ *   a Weak slot and the dependent a second one, in a parallel array. Neither is seen by
+ *   the marker; instead a hook that runs whenever the mark stack drains pushes the
+ *   dependent of every handle whose target has been marked (mark_dependents). So the
+ *   dependent lives exactly as long as its target, and a dependent that references its
+ *   own target does not keep either alive. When the target dies both links are cleared in
+ *   the same collection.
+ *
+ * Allocation is lock-free on the fast path: each thread keeps a free list of released
+ * indices and only trades batches with the shared pool (under a mutex) when its list
+ * runs empty or overflows; fresh indices come from an atomic counter.
  */
 
 #include <cil2cpp/gchandle.h>
 #include <gc.h>
+#include <gc/gc_mark.h>
 
+#include <algorithm>
+#include <atomic>
 #include <mutex>
+#include <new>
 #include <vector>
 
 namespace cil2cpp {
 
 namespace {
 
-struct HandleEntry {
-    void* object = nullptr;
-    GCHandleType type = GCHandleType::Normal;
-    bool allocated = false;
+constexpr int32_t kSegmentBits = 10;
+constexpr int32_t kSegmentSize = 1 << kSegmentBits;  // handles per segment
+constexpr int32_t kMaxSegments = 1 << 14;            // 16M handles
+constexpr size_t kLocalFreeMax = 256;                // per-thread free list before spilling
+constexpr size_t kFreeBatch = 128;                   // indices moved per pool exchange
+
+struct Segment {
+    std::atomic<GC_word> slots[kSegmentSize];       // object pointer, or hidden pointer if weak
+    std::atomic<GC_word> dependents[kSegmentSize];  // Dependent handles only (hidden pointer)
+    std::atomic<uint8_t> types[kSegmentSize];       // 0 = free, else GCHandleType + 1
+};
+
+// Zero-initialized at load time: handles may be allocated during static initialization
+std::atomic<Segment*> g_segments[kMaxSegments];
+std::atomic<int32_t> g_next_index{0};     // first never-used index
+std::atomic<uint32_t> g_generation{0};    // bumped by gchandle_init(): drop thread free lists
+std::atomic<int32_t> g_dependent_count{0}; // live Dependent handles; 0 skips the mark hook
+GC_mark_stack_empty_proc g_chained_mark_stack_empty = nullptr;
+
+std::mutex g_pool_mutex;
+std::vector<int32_t> g_pool;              // released indices shared between threads
+std::atomic<size_t> g_pool_size{0};
+
+// Weak slot writers (link re-registration) serialize per stripe of handle indices
+constexpr int32_t kWeakStripes = 64;
+std::mutex g_weak_locks[kWeakStripes];
+
+struct ThreadFreeList {
+    uint32_t generation = 0;
+    std::vector<int32_t> indices;
+
+    ~ThreadFreeList() {
+        // Thread exit: hand the released indices to the other threads
+        if (indices.empty() || generation != g_generation.load(std::memory_order_acquire)) return;
+        std::lock_guard lock(g_pool_mutex);
+        g_pool.insert(g_pool.end(), indices.begin(), indices.end());
+        g_pool_size.store(g_pool.size(), std::memory_order_relaxed);
+    }
 };
 
-std::mutex g_handle_mutex;
-std::vector<HandleEntry> g_handle_table;
-std::vector<int32_t> g_free_list;
+thread_local ThreadFreeList t_free_list;
+
+ThreadFreeList& local_free_list() {
+    auto& list = t_free_list;
+    uint32_t generation = g_generation.load(std::memory_order_acquire);
+    if (list.generation != generation) {
+        list.indices.clear();
+        list.generation = generation;
+    }
+    return list;
+}
 
 // Handle encoding: (index + 1) << 1 — always even.
 // .NET's managed GCHandle uses the low bit as a "pinned" flag
 // (OR 1 for pinned, AND ~1 in GetHandleValue). Our internal handles
 // must be even so the low bit is available for that flag.
 intptr_t encode_handle(int32_t index) {
-    return static_cast<intptr_t>((index + 1) << 1);
+    return static_cast<intptr_t>((static_cast<intptr_t>(index) + 1) << 1);
 }
 
 int32_t decode_handle(intptr_t handle) {
@@ -43,94 +105,356 @@ int32_t decode_handle(intptr_t handle) {
 }
 
 bool is_weak_type(GCHandleType type) {
-    return type == GCHandleType::Weak || type == GCHandleType::WeakTrackResurrection;
+    return type == GCHandleType::Weak || type == GCHandleType::WeakTrackResurrection
+        || type == GCHandleType::Dependent;
 }
 
-} // anonymous namespace
+constexpr uint8_t kDependentTag = static_cast<uint8_t>(GCHandleType::Dependent) + 1;
 
-void gchandle_init() {
-    std::lock_guard lock(g_handle_mutex);
-    g_handle_table.clear();
-    g_free_list.clear();
-    // Pre-allocate some slots
-    g_handle_table.reserve(64);
+Segment* segment_for(int32_t index) {
+    if (index < 0 || index >= g_next_index.load(std::memory_order_acquire)) return nullptr;
+    return g_segments[index >> kSegmentBits].load(std::memory_order_acquire);
 }
 
-intptr_t gchandle_alloc(void* obj, GCHandleType type) {
-    std::lock_guard lock(g_handle_mutex);
+Segment* ensure_segment(int32_t segmentIndex) {
+    auto& entry = g_segments[segmentIndex];
+    Segment* segment = entry.load(std::memory_order_acquire);
+    if (segment) return segment;
+
+    // Several threads may race to create the same segment; the CAS loser frees its copy
+    auto* fresh = static_cast<Segment*>(GC_MALLOC_UNCOLLECTABLE(sizeof(Segment)));
+    if (!fresh) return nullptr;
+    for (int32_t i = 0; i < kSegmentSize; i++) {
+        new (&fresh->slots[i]) std::atomic<GC_word>(0);
+        new (&fresh->dependents[i]) std::atomic<GC_word>(0);
+        new (&fresh->types[i]) std::atomic<uint8_t>(0);
+    }
+    if (entry.compare_exchange_strong(segment, fresh, std::memory_order_acq_rel))
+        return fresh;
+    GC_FREE(fresh);
+    return segment;
+}
 
-    int32_t index;
-    if (!g_free_list.empty()) {
-        index = g_free_list.back();
-        g_free_list.pop_back();
-    } else {
-        index = static_cast<int32_t>(g_handle_table.size());
-        g_handle_table.push_back({});
+int32_t take_index() {
+    auto& local = local_free_list();
+    if (local.indices.empty() && g_pool_size.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard lock(g_pool_mutex);
+        size_t n = std::min(kFreeBatch, g_pool.size());
+        local.indices.assign(g_pool.end() - static_cast<ptrdiff_t>(n), g_pool.end());
+        g_pool.resize(g_pool.size() - n);
+        g_pool_size.store(g_pool.size(), std::memory_order_relaxed);
+    }
+    if (!local.indices.empty()) {
+        int32_t index = local.indices.back();
+        local.indices.pop_back();
+        return index;
     }
 
-    g_handle_table[index] = { obj, type, true };
+    int32_t index = g_next_index.load(std::memory_order_relaxed);
+    do {
+        if (index >= kMaxSegments * kSegmentSize) return -1;
+    } while (!g_next_index.compare_exchange_weak(index, index + 1, std::memory_order_acq_rel));
+    return ensure_segment(index >> kSegmentBits) ? index : -1;
+}
 
-    // NOTE: We intentionally do NOT call GC_register_disappearing_link here.
-    // That function acquires BoehmGC's internal allocation lock, which can
-    // deadlock if another GC-registered thread is blocked in a native call
-    // (e.g. accept(), recv()). BoehmGC tries to stop-the-world to synchronize,
-    // but can't properly handle threads suspended in kernel calls.
-    //
-    // This means weak handles won't auto-clear on collection. Since BoehmGC
-    // is conservative GC (may not collect objects with ambiguous roots anyway),
-    // this is acceptable. The proper fix is GC-safe transitions before blocking
-    // native calls (future work).
+void release_index(int32_t index) {
+    auto& local = local_free_list();
+    local.indices.push_back(index);
+    if (local.indices.size() < kLocalFreeMax) return;
+
+    // A thread that frees handles others allocated (e.g. the finalizer) spills in batches
+    std::lock_guard lock(g_pool_mutex);
+    g_pool.insert(g_pool.end(), local.indices.end() - static_cast<ptrdiff_t>(kFreeBatch),
+        local.indices.end());
+    local.indices.resize(local.indices.size() - kFreeBatch);
+    g_pool_size.store(g_pool.size(), std::memory_order_relaxed);
+}
 
-    return encode_handle(index);
+/// Target of a weak slot, without locking. While only the hidden value is in hand a
+/// collection may clear the link and reclaim the object, so after revealing it (onto our
+/// stack, where it keeps the object alive from then on) re-check that the slot still holds
+/// the same value; if it changed, the revealed pointer may be stale and we read again.
+void* load_weak(std::atomic<GC_word>& slot) {
+    for (;;) {
+        GC_word hidden = slot.load(std::memory_order_acquire);
+        if (hidden == 0) return nullptr; // collected or cleared
+        void* volatile target = GC_REVEAL_POINTER(hidden);
+        if (slot.load(std::memory_order_acquire) == hidden) return target;
+    }
 }
 
-void gchandle_free(intptr_t handle) {
-    std::lock_guard lock(g_handle_mutex);
+void unlink_weak(std::atomic<GC_word>& slot, GCHandleType type) {
+    auto** link = reinterpret_cast<void**>(&slot);
+    if (type == GCHandleType::WeakTrackResurrection)
+        GC_unregister_long_link(link);
+    else
+        GC_unregister_disappearing_link(link);
+}
 
-    auto index = decode_handle(handle);
-    if (index < 0 || index >= static_cast<int32_t>(g_handle_table.size()))
+void link_weak(std::atomic<GC_word>& slot, GCHandleType type, void* obj) {
+    if (!obj) {
+        slot.store(0, std::memory_order_release);
         return;
+    }
+    slot.store(GC_HIDE_POINTER(obj), std::memory_order_release);
+    // Objects outside the GC heap (static data) never die: nothing to link
+    if (GC_base(obj) != obj) return;
+    auto** link = reinterpret_cast<void**>(&slot);
+    if (type == GCHandleType::WeakTrackResurrection)
+        GC_register_long_link(link, obj);
+    else
+        GC_general_register_disappearing_link(link, obj);
+}
+
+/// Replace a weak slot's target. Caller holds the slot's stripe lock.
+void relink_weak(std::atomic<GC_word>& slot, GCHandleType type, void* obj) {
+    // Between unregistering and overwriting, only this local keeps the old target alive
+    void* volatile previous = load_weak(slot);
+    unlink_weak(slot, type);
+    link_weak(slot, type, obj);
+    GC_reachable_here(previous);
+}
+
+bool is_heap_object(void* obj) {
+    return GC_base(obj) == obj;
+}
 
-    auto& entry = g_handle_table[index];
-    if (entry.allocated) {
-        entry.allocated = false;
-        entry.object = nullptr;
-        g_free_list.push_back(index);
+/// Collector hook, called with the allocation lock held each time the mark stack drains
+/// (must not allocate). Pushes the dependent of every Dependent handle whose target is
+/// marked; marking resumes from them and the hook runs again, until a pass pushes nothing,
+/// so chains (a value that is another entry's key) resolve within the same collection.
+GC_ms_entry* GC_CALLBACK mark_dependents(GC_ms_entry* top, GC_ms_entry* limit) {
+    if (g_dependent_count.load(std::memory_order_acquire) > 0) {
+        int32_t used = g_next_index.load(std::memory_order_acquire);
+        for (int32_t base = 0; base < used; base += kSegmentSize) {
+            Segment* segment = g_segments[base >> kSegmentBits].load(std::memory_order_acquire);
+            if (!segment) continue;
+            for (int32_t i = 0; i < kSegmentSize; i++) {
+                if (segment->types[i].load(std::memory_order_relaxed) != kDependentTag) continue;
+                GC_word hiddenTarget = segment->slots[i].load(std::memory_order_relaxed);
+                GC_word hiddenDependent = segment->dependents[i].load(std::memory_order_relaxed);
+                if (hiddenTarget == 0 || hiddenDependent == 0) continue;
+                void* dependent = GC_REVEAL_POINTER(hiddenDependent);
+                if (!is_heap_object(dependent) || GC_is_marked(dependent)) continue;
+                void* target = GC_REVEAL_POINTER(hiddenTarget);
+                if (is_heap_object(target) && !GC_is_marked(target)) continue;
+                top = GC_mark_and_push(dependent, top, limit,
+                    reinterpret_cast<void**>(&segment->dependents[i]));
+            }
+        }
     }
+    return g_chained_mark_stack_empty ? g_chained_mark_stack_empty(top, limit) : top;
 }
 
-void* gchandle_get(intptr_t handle) {
-    std::lock_guard lock(g_handle_mutex);
+} // anonymous namespace
 
-    auto index = decode_handle(handle);
-    if (index < 0 || index >= static_cast<int32_t>(g_handle_table.size()))
-        return nullptr;
+void gchandle_init() {
+    // Reset for a fresh runtime: release every link, forget all indices. Segments stay
+    // allocated and are reused.
+    int32_t used = g_next_index.load(std::memory_order_acquire);
+    for (int32_t index = 0; index < used; index++) {
+        Segment* segment = g_segments[index >> kSegmentBits].load(std::memory_order_acquire);
+        if (!segment) continue;
+        int32_t i = index & (kSegmentSize - 1);
+        auto type = segment->types[i].exchange(0, std::memory_order_acq_rel);
+        if (type != 0 && is_weak_type(static_cast<GCHandleType>(type - 1)))
+            unlink_weak(segment->slots[i], static_cast<GCHandleType>(type - 1));
+        if (type == kDependentTag)
+            unlink_weak(segment->dependents[i], GCHandleType::Dependent);
+        segment->slots[i].store(0, std::memory_order_relaxed);
+        segment->dependents[i].store(0, std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard lock(g_pool_mutex);
+        g_pool.clear();
+        g_pool_size.store(0, std::memory_order_relaxed);
+    }
+    g_next_index.store(0, std::memory_order_release);
+    g_dependent_count.store(0, std::memory_order_release);
+    g_generation.fetch_add(1, std::memory_order_release);
+
+    static std::once_flag s_hook_once;
+    std::call_once(s_hook_once, [] {
+        g_chained_mark_stack_empty = GC_get_mark_stack_empty();
+        GC_set_mark_stack_empty(mark_dependents);
+    });
+}
 
-    auto& entry = g_handle_table[index];
-    return entry.allocated ? entry.object : nullptr;
+intptr_t gchandle_alloc(void* obj, GCHandleType type) {
+    int32_t index = take_index();
+    if (index < 0) return 0; // table exhausted (or out of memory for a new segment)
+
+    Segment* segment = g_segments[index >> kSegmentBits].load(std::memory_order_acquire);
+    int32_t i = index & (kSegmentSize - 1);
+    if (is_weak_type(type)) {
+        // NOTE: registering the link takes BoehmGC's allocation lock, which a collection
+        // holds until every registered thread has stopped. Threads parked in blocking
+        // native calls (accept(), recv(), waits) run in a GC-safe region (gc::blocking,
+        // around the P/Invoke wrappers and the runtime's own waits), so the collection
+        // does not wait on them and this cannot deadlock against them.
+        std::lock_guard lock(g_weak_locks[index % kWeakStripes]);
+        link_weak(segment->slots[i], type, obj);
+    } else {
+        segment->slots[i].store(reinterpret_cast<GC_word>(obj), std::memory_order_release);
+    }
+    segment->types[i].store(static_cast<uint8_t>(static_cast<int32_t>(type) + 1),
+        std::memory_order_release);
+    return encode_handle(index);
 }
 
-void gchandle_set(intptr_t handle, void* obj) {
-    std::lock_guard lock(g_handle_mutex);
+void gchandle_free(intptr_t handle) {
+    int32_t index = decode_handle(handle);
+    Segment* segment = segment_for(index);
+    if (!segment) return;
+
+    int32_t i = index & (kSegmentSize - 1);
+    uint8_t type = segment->types[i].exchange(0, std::memory_order_acq_rel);
+    if (type == 0) return; // double free
+    if (is_weak_type(static_cast<GCHandleType>(type - 1))) {
+        std::lock_guard lock(g_weak_locks[index % kWeakStripes]);
+        unlink_weak(segment->slots[i], static_cast<GCHandleType>(type - 1));
+        if (type == kDependentTag) {
+            unlink_weak(segment->dependents[i], GCHandleType::Dependent);
+            segment->dependents[i].store(0, std::memory_order_release);
+            g_dependent_count.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+    segment->slots[i].store(0, std::memory_order_release);
+    release_index(index);
+}
 
-    auto index = decode_handle(handle);
-    if (index < 0 || index >= static_cast<int32_t>(g_handle_table.size()))
-        return;
+void* gchandle_get(intptr_t handle) {
+    int32_t index = decode_handle(handle);
+    Segment* segment = segment_for(index);
+    if (!segment) return nullptr;
+
+    int32_t i = index & (kSegmentSize - 1);
+    uint8_t type = segment->types[i].load(std::memory_order_acquire);
+    if (type == 0) return nullptr;
+    if (is_weak_type(static_cast<GCHandleType>(type - 1)))
+        return load_weak(segment->slots[i]);
+    return reinterpret_cast<void*>(segment->slots[i].load(std::memory_order_acquire));
+}
 
-    auto& entry = g_handle_table[index];
-    if (entry.allocated) {
-        entry.object = obj;
+void gchandle_set(intptr_t handle, void* obj) {
+    int32_t index = decode_handle(handle);
+    Segment* segment = segment_for(index);
+    if (!segment) return;
+
+    int32_t i = index & (kSegmentSize - 1);
+    uint8_t type = segment->types[i].load(std::memory_order_acquire);
+    if (type == 0) return;
+    if (is_weak_type(static_cast<GCHandleType>(type - 1))) {
+        std::lock_guard lock(g_weak_locks[index % kWeakStripes]);
+        relink_weak(segment->slots[i], static_cast<GCHandleType>(type - 1), obj);
+    } else {
+        segment->slots[i].store(reinterpret_cast<GC_word>(obj), std::memory_order_release);
     }
 }
 
+void* gchandle_compare_exchange(intptr_t handle, void* obj, void* comparand) {
+    int32_t index = decode_handle(handle);
+    Segment* segment = segment_for(index);
+    if (!segment) return nullptr;
+
+    int32_t i = index & (kSegmentSize - 1);
+    uint8_t type = segment->types[i].load(std::memory_order_acquire);
+    if (type == 0) return nullptr;
+    if (is_weak_type(static_cast<GCHandleType>(type - 1))) {
+        std::lock_guard lock(g_weak_locks[index % kWeakStripes]);
+        void* current = load_weak(segment->slots[i]);
+        if (current == comparand)
+            relink_weak(segment->slots[i], static_cast<GCHandleType>(type - 1), obj);
+        return current;
+    }
+    GC_word expected = reinterpret_cast<GC_word>(comparand);
+    segment->slots[i].compare_exchange_strong(expected, reinterpret_cast<GC_word>(obj),
+        std::memory_order_acq_rel);
+    return reinterpret_cast<void*>(expected);
+}
+
 bool gchandle_is_allocated(intptr_t handle) {
-    std::lock_guard lock(g_handle_mutex);
+    int32_t index = decode_handle(handle);
+    Segment* segment = segment_for(index);
+    return segment && segment->types[index & (kSegmentSize - 1)].load(std::memory_order_acquire) != 0;
+}
+
+// ===== Dependent handles =====
+
+namespace {
 
-    auto index = decode_handle(handle);
-    if (index < 0 || index >= static_cast<int32_t>(g_handle_table.size()))
-        return false;
+/// Segment and slot of an allocated Dependent handle, or nullptr.
+Segment* dependent_segment(intptr_t handle, int32_t& i) {
+    int32_t index = decode_handle(handle);
+    Segment* segment = segment_for(index);
+    if (!segment) return nullptr;
+    i = index & (kSegmentSize - 1);
+    if (segment->types[i].load(std::memory_order_acquire) != kDependentTag)
+        return nullptr;
+    return segment;
+}
+
+} // anonymous namespace
+
+intptr_t dependent_handle_alloc(void* target, void* dependent) {
+    int32_t index = take_index();
+    if (index < 0) return 0;
+
+    Segment* segment = g_segments[index >> kSegmentBits].load(std::memory_order_acquire);
+    int32_t i = index & (kSegmentSize - 1);
+    {
+        std::lock_guard lock(g_weak_locks[index % kWeakStripes]);
+        link_weak(segment->slots[i], GCHandleType::Dependent, target);
+        link_weak(segment->dependents[i], GCHandleType::Dependent, target ? dependent : nullptr);
+    }
+    g_dependent_count.fetch_add(1, std::memory_order_relaxed);
+    segment->types[i].store(kDependentTag, std::memory_order_release);
+    // Until the tag is visible the hook skips the slot: only our frame holds both objects
+    GC_reachable_here(target);
+    GC_reachable_here(dependent);
+    return encode_handle(index);
+}
+
+void* dependent_handle_get_target(intptr_t handle) {
+    int32_t i;
+    Segment* segment = dependent_segment(handle, i);
+    return segment ? load_weak(segment->slots[i]) : nullptr;
+}
 
-    return g_handle_table[index].allocated;
+void* dependent_handle_get_dependent(intptr_t handle) {
+    int32_t i;
+    Segment* segment = dependent_segment(handle, i);
+    return segment ? load_weak(segment->dependents[i]) : nullptr;
+}
+
+void* dependent_handle_get_target_and_dependent(intptr_t handle, void** dependent) {
+    *dependent = nullptr;
+    int32_t i;
+    Segment* segment = dependent_segment(handle, i);
+    if (!segment) return nullptr;
+    // Holding the target keeps the hook marking the dependent
+    void* target = load_weak(segment->slots[i]);
+    if (target)
+        *dependent = load_weak(segment->dependents[i]);
+    return target;
+}
+
+void dependent_handle_set_dependent(intptr_t handle, void* dependent) {
+    int32_t i;
+    Segment* segment = dependent_segment(handle, i);
+    if (!segment) return;
+    std::lock_guard lock(g_weak_locks[decode_handle(handle) % kWeakStripes]);
+    relink_weak(segment->dependents[i], GCHandleType::Dependent, dependent);
+}
+
+void dependent_handle_set_target_to_null(intptr_t handle) {
+    int32_t i;
+    Segment* segment = dependent_segment(handle, i);
+    if (!segment) return;
+    std::lock_guard lock(g_weak_locks[decode_handle(handle) % kWeakStripes]);
+    relink_weak(segment->slots[i], GCHandleType::Dependent, nullptr);
+    // With no target the dependent is unreachable through this handle: release it now
+    relink_weak(segment->dependents[i], GCHandleType::Dependent, nullptr);
 }
 
 namespace icall {
@@ -151,5 +475,33 @@ void* GCHandle_InternalGet(intptr_t handle) {
     return gchandle_get(handle);
 }
 
+intptr_t DependentHandle_InternalInitialize(void* target, void* dependent) {
+    return dependent_handle_alloc(target, dependent);
+}
+
+void* DependentHandle_InternalGetTarget(intptr_t handle) {
+    return dependent_handle_get_target(handle);
+}
+
+void* DependentHandle_InternalGetDependent(intptr_t handle) {
+    return dependent_handle_get_dependent(handle);
+}
+
+void* DependentHandle_InternalGetTargetAndDependent(intptr_t handle, Object** dependent) {
+    return dependent_handle_get_target_and_dependent(handle, reinterpret_cast<void**>(dependent));
+}
+
+void DependentHandle_InternalSetDependent(intptr_t handle, void* dependent) {
+    dependent_handle_set_dependent(handle, dependent);
+}
+
+void DependentHandle_InternalSetTargetToNull(intptr_t handle) {
+    dependent_handle_set_target_to_null(handle);
+}
+
+void DependentHandle_InternalFree(intptr_t handle) {
+    gchandle_free(handle);
+}
+
 } // namespace icall
 } // namespace cil2cpp
@@ -6,31 +6,52 @@
  */
 
 #include <cil2cpp/globalization.h>
+#include <cil2cpp/bcl/System.String.h>
+#include <cil2cpp/contention.h>
+#include <cil2cpp/delegate.h>
 #include <cil2cpp/exception.h>
+#include <cil2cpp/object.h>
+#include <cil2cpp/reflection.h>
 #include <cil2cpp/unicode.h>
 
-#include <unicode/ucol.h>     // Collation: ucol_open, ucol_strcoll, ucol_setStrength
-#include <unicode/usearch.h>  // String search: usearch_open, usearch_first, usearch_last
+#include <unicode/ucol.h>     // Collation: ucol_open, ucol_clone, ucol_strcoll, ucol_setStrength
+#include <unicode/usearch.h>  // String search: usearch_openFromCollator, usearch_first
 #include <unicode/uloc.h>     // Locale: uloc_getDefault
-#include <unicode/uchar.h>    // Character: u_toupper
 #include <unicode/ustring.h>  // String: u_strToUpper, u_strToLower
+#include <unicode/uset.h>     // Tailored sets: uset_getItem
 #include <unicode/utypes.h>   // UErrorCode
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace cil2cpp {
 namespace globalization {
 
 // ===== Collator Cache =====
-// Per-locale collator cache. Each culture sort name maps to a cached UCollator*.
-// Thread-safe via mutex.
+// Base collators: one UCollator* per ICU locale, opened on first use and never reconfigured
+// afterwards (they double as CompareInfo sort handles). g_collator_mutex guards only the
+// locale → collator map, i.e. sort handle creation.
+//
+// Comparisons and searches run on thread_collator() clones: each thread keeps its own copy
+// of every (base, CompareOptions) pair it has used, so the hot path never locks and never
+// races on ucol_setStrength. init()/shutdown() bump g_collator_generation, which makes every
+// thread drop its clones on next use (a reopened base may reuse a closed one's address).
 
 static UCollator* g_invariant_collator = nullptr;
+static UCollator* g_default_collator = nullptr; // uloc_getDefault(), for culture-sensitive IndexOf
 static std::unordered_map<std::string, UCollator*> g_collator_cache;
-static std::mutex g_collator_mutex;
+static contention::Mutex g_collator_mutex{"globalization.collator"};
+static std::atomic<uint32_t> g_collator_generation{0};
+
+// Default locale maps ASCII letters with plain a-z ↔ A-Z (false for tr/az dotted/dotless i)
+static bool g_default_ascii_casing = false;
+
+static void build_ascii_collation(const UCollator* root);
 
 void init() {
     UErrorCode err = U_ZERO_ERROR;
@@ -38,22 +59,59 @@ void init() {
     if (U_FAILURE(err)) {
         g_invariant_collator = nullptr;
     }
+    err = U_ZERO_ERROR;
+    g_default_collator = ucol_open(uloc_getDefault(), &err);
+    if (U_FAILURE(err)) {
+        g_default_collator = nullptr;
+    }
+    build_ascii_collation(g_invariant_collator);
+
+    char language[ULOC_LANG_CAPACITY] = {};
+    err = U_ZERO_ERROR;
+    uloc_getLanguage(uloc_getDefault(), language, ULOC_LANG_CAPACITY, &err);
+    g_default_ascii_casing = U_SUCCESS(err)
+        && std::strcmp(language, "tr") != 0 && std::strcmp(language, "az") != 0;
+
+    g_collator_generation.fetch_add(1, std::memory_order_release);
 }
 
 void shutdown() {
-    std::lock_guard<std::mutex> lock(g_collator_mutex);
+    std::lock_guard<contention::Mutex> lock(g_collator_mutex);
+    g_collator_generation.fetch_add(1, std::memory_order_release);
     for (auto& [locale, collator] : g_collator_cache) {
-        if (collator && collator != g_invariant_collator) {
+        if (collator) {
             ucol_close(collator);
         }
     }
     g_collator_cache.clear();
+    if (g_default_collator) {
+        ucol_close(g_default_collator);
+        g_default_collator = nullptr;
+    }
     if (g_invariant_collator) {
         ucol_close(g_invariant_collator);
         g_invariant_collator = nullptr;
     }
 }
 
+UCollator* base_collator(const char* locale) {
+    if (!locale || !*locale) return g_invariant_collator;
+
+    std::lock_guard<contention::Mutex> lock(g_collator_mutex);
+    auto it = g_collator_cache.find(locale);
+    if (it != g_collator_cache.end()) {
+        return it->second;
+    }
+
+    UErrorCode err = U_ZERO_ERROR;
+    UCollator* collator = ucol_open(locale, &err);
+    if (U_FAILURE(err)) {
+        collator = nullptr; // cache the failure too — ucol_open is not cheap
+    }
+    g_collator_cache[locale] = collator;
+    return collator;
+}
+
 // ===== CompareOptions → ICU Strength Mapping =====
 // CompareOptions: None=0, IgnoreCase=1, IgnoreNonSpace=2, IgnoreSymbols=4,
 //   IgnoreKanaType=8, IgnoreWidth=16, OrdinalIgnoreCase=0x10000000, Ordinal=0x40000000
@@ -63,6 +121,8 @@ enum CompareOptions : int32_t {
     CO_IgnoreCase = 1,
     CO_IgnoreNonSpace = 2,
     CO_IgnoreSymbols = 4,
+    CO_IgnoreKanaType = 8,
+    CO_IgnoreWidth = 16,
     CO_OrdinalIgnoreCase = 0x10000000,
     CO_Ordinal = 0x40000000,
 };
@@ -76,49 +136,300 @@ enum StringComparison : int32_t {
     SC_OrdinalIgnoreCase = 5,
 };
 
-// ===== Internal Helpers =====
+// ===== ASCII Collation Tables =====
+// Root (invariant) collation weights for the 128 ASCII characters, read back from ICU at
+// init() so the fast path orders exactly like ucol_strcoll. ASCII in the root collation has
+// one collation element per character, no contractions, and a common secondary weight, so
+// comparing two ASCII strings reduces to: primary weights (skipping ignorables), then — at
+// tertiary strength — the tertiary weights of the aligned characters (lowercase < uppercase).
+
+namespace {
+
+// Plain aggregate: zero-initialized at load time, so runtime_init() may run during
+// static initialization without the table being reset afterwards.
+struct AsciiCollation {
+    bool valid;
+    uint8_t primary[128];  // 0 = completely ignorable, else ascending primary rank
+    uint8_t shifted[128];  // primary with variable characters (spaces, punctuation) zeroed,
+                           // for IgnoreSymbols (alternate=shifted)
+    uint8_t tertiary[128]; // rank among the ASCII characters sharing one primary weight
+};
 
-/// Ordinal compare: raw memcmp-style comparison of UTF-16 code units.
-static Int32 ordinal_compare(const Char* s1, Int32 len1, const Char* s2, Int32 len2) {
-    Int32 minLen = len1 < len2 ? len1 : len2;
-    for (Int32 i = 0; i < minLen; i++) {
-        if (s1[i] != s2[i])
-            return static_cast<Int32>(s1[i]) - static_cast<Int32>(s2[i]);
+AsciiCollation g_ascii_collation;
+
+/// Sort key of s (at most 2 UTF-16 units) under `collator`, or "" if it doesn't fit.
+std::string short_sort_key(const UCollator* collator, const UChar* s, int32_t len) {
+    uint8_t buf[64];
+    int32_t n = ucol_getSortKey(collator, s, len, buf, static_cast<int32_t>(sizeof(buf)));
+    if (n <= 0 || n > static_cast<int32_t>(sizeof(buf))) return {};
+    return std::string(reinterpret_cast<const char*>(buf), static_cast<size_t>(n));
+}
+
+UCollator* clone_with(const UCollator* base, UCollationStrength strength, UColAttributeValue alternate) {
+    UErrorCode err = U_ZERO_ERROR;
+    UCollator* clone = ucol_clone(base, &err);
+    if (U_FAILURE(err)) return nullptr;
+    ucol_setStrength(clone, strength);
+    ucol_setAttribute(clone, UCOL_ALTERNATE_HANDLING, alternate, &err);
+    return clone;
+}
+
+} // namespace
+
+static void build_ascii_collation(const UCollator* root) {
+    auto& table = g_ascii_collation;
+    table = {};
+    if (!root) return;
+
+    UCollator* primary = clone_with(root, UCOL_PRIMARY, UCOL_NON_IGNORABLE);
+    UCollator* secondary = clone_with(root, UCOL_SECONDARY, UCOL_NON_IGNORABLE);
+    UCollator* tertiary = clone_with(root, UCOL_TERTIARY, UCOL_NON_IGNORABLE);
+    UCollator* shifted = clone_with(root, UCOL_PRIMARY, UCOL_SHIFTED);
+    bool ok = primary && secondary && tertiary && shifted;
+
+    std::string keyP[128], keyS[128], keyT[128];
+    bool variable[128];
+    std::string emptyP, emptyShifted;
+    int order[128];
+    if (ok) {
+        emptyP = short_sort_key(primary, nullptr, 0);
+        emptyShifted = short_sort_key(shifted, nullptr, 0);
+        for (int c = 0; c < 128; c++) {
+            UChar ch = static_cast<UChar>(c);
+            keyP[c] = short_sort_key(primary, &ch, 1);
+            keyS[c] = short_sort_key(secondary, &ch, 1);
+            keyT[c] = short_sort_key(tertiary, &ch, 1);
+            variable[c] = short_sort_key(shifted, &ch, 1) == emptyShifted;
+            ok = ok && !keyP[c].empty() && !keyS[c].empty() && !keyT[c].empty();
+            order[c] = c;
+        }
+    }
+    if (ok) {
+        std::sort(order, order + 128, [&](int a, int b) {
+            int cmp = keyP[a].compare(keyP[b]);
+            return cmp != 0 ? cmp < 0 : keyT[a] < keyT[b];
+        });
+        uint8_t primaryRank = 0, tertiaryRank = 0;
+        for (int i = 0; i < 128 && ok; i++) {
+            int c = order[i];
+            if (keyP[c] == emptyP) {
+                table.primary[c] = table.shifted[c] = table.tertiary[c] = 0;
+                continue;
+            }
+            int prev = i > 0 ? order[i - 1] : -1;
+            if (prev < 0 || keyP[prev] != keyP[c]) {
+                primaryRank++;
+                tertiaryRank = 1;
+            } else {
+                // Same primary: the model only holds if secondary weights agree
+                ok = keyS[prev] == keyS[c];
+                if (keyT[prev] != keyT[c]) tertiaryRank++;
+            }
+            table.primary[c] = primaryRank;
+            table.shifted[c] = variable[c] ? 0 : primaryRank;
+            table.tertiary[c] = tertiaryRank;
+        }
+    }
+    table.valid = ok;
+
+    for (UCollator* c : { primary, secondary, tertiary, shifted }) {
+        if (c) ucol_close(c);
     }
-    return len1 - len2;
 }
 
-/// Ordinal compare ignore case: per-char u_toupper comparison.
-static Int32 ordinal_compare_ic(const Char* s1, Int32 len1, const Char* s2, Int32 len2) {
+/// True if `base` orders ASCII exactly like the root collation: no tailoring of any ASCII
+/// character or contraction (da "aa", cs "ch", tr "i"), root attributes, no reordering.
+static bool has_root_ascii_collation(const UCollator* base) {
+    if (!g_ascii_collation.valid || !g_invariant_collator) return false;
+    if (base == g_invariant_collator) return true;
+
+    UErrorCode err = U_ZERO_ERROR;
+    static const UColAttribute attributes[] = {
+        UCOL_ALTERNATE_HANDLING, UCOL_CASE_FIRST, UCOL_CASE_LEVEL, UCOL_NUMERIC_COLLATION,
+    };
+    for (UColAttribute attribute : attributes) {
+        if (ucol_getAttribute(base, attribute, &err) !=
+            ucol_getAttribute(g_invariant_collator, attribute, &err))
+            return false;
+    }
+    if (ucol_getMaxVariable(base) != ucol_getMaxVariable(g_invariant_collator)) return false;
+    if (ucol_getReorderCodes(base, nullptr, 0, &err) != 0 || U_FAILURE(err)) return false;
+
+    USet* tailored = ucol_getTailoredSet(base, &err);
+    if (U_FAILURE(err) || !tailored) return false;
+    bool touchesAscii = false;
+    int32_t items = uset_getItemCount(tailored);
+    for (int32_t i = 0; i < items && !touchesAscii; i++) {
+        UChar32 start = 0, end = 0;
+        UChar str[32];
+        UErrorCode itemErr = U_ZERO_ERROR;
+        int32_t len = uset_getItem(tailored, i, &start, &end, str, 32, &itemErr);
+        if (len == 0) {
+            touchesAscii = start < 0x80; // code point range
+        } else if (U_FAILURE(itemErr)) {
+            touchesAscii = true; // contraction too long to inspect: be conservative
+        } else {
+            for (int32_t k = 0; k < len && !touchesAscii; k++) touchesAscii = str[k] < 0x80;
+        }
+    }
+    uset_close(tailored);
+    return !touchesAscii;
+}
+
+/// Compare two ASCII strings with the root weights. Same result as ucol_strcoll on a
+/// root-compatible collator configured by configure_collator(options).
+static Int32 ascii_collate(const Char* s1, Int32 len1, const Char* s2, Int32 len2, Int32 options) {
+    // An identical prefix contributes identical weights at every level: skip it
+    Int32 prefix = 0;
     Int32 minLen = len1 < len2 ? len1 : len2;
-    for (Int32 i = 0; i < minLen; i++) {
-        UChar32 c1 = u_toupper(static_cast<UChar32>(s1[i]));
-        UChar32 c2 = u_toupper(static_cast<UChar32>(s2[i]));
-        if (c1 != c2)
-            return static_cast<Int32>(c1) - static_cast<Int32>(c2);
+    while (prefix < minLen && s1[prefix] == s2[prefix]) prefix++;
+    if (prefix == len1 && prefix == len2) return 0;
+
+    const auto& table = g_ascii_collation;
+    const uint8_t* weight = (options & CO_IgnoreSymbols) ? table.shifted : table.primary;
+    const bool tertiary = (options & (CO_IgnoreCase | CO_IgnoreNonSpace)) == 0;
+
+    Int32 tertiaryResult = 0; // first tertiary difference, used only if primaries tie
+    Int32 i = prefix, j = prefix;
+    for (;;) {
+        uint8_t w1 = 0, w2 = 0;
+        while (i < len1 && (w1 = weight[s1[i]]) == 0) i++;
+        while (j < len2 && (w2 = weight[s2[j]]) == 0) j++;
+        if (i == len1 || j == len2) {
+            if (i < len1) return 1;
+            if (j < len2) return -1;
+            return tertiaryResult;
+        }
+        if (w1 != w2) return w1 < w2 ? -1 : 1;
+        if (tertiary && tertiaryResult == 0) {
+            uint8_t t1 = table.tertiary[s1[i]], t2 = table.tertiary[s2[j]];
+            if (t1 != t2) tertiaryResult = t1 < t2 ? -1 : 1;
+        }
+        i++;
+        j++;
     }
-    return len1 - len2;
 }
 
-/// Culture-sensitive compare using ICU collator.
-static Int32 icu_compare(const Char* s1, Int32 len1, const Char* s2, Int32 len2, Int32 options) {
-    std::lock_guard<std::mutex> lock(g_collator_mutex);
-    if (!g_invariant_collator) {
-        // Fallback to ordinal if ICU not initialized
-        return ordinal_compare(s1, len1, s2, len2);
+/// Search ASCII `value` in ASCII `source` with the root weights. Only valid when neither
+/// contains control characters (ignorables and CR LF change usearch's match boundaries)
+/// and IgnoreSymbols is off; the caller checks. Matches have the length of `value`.
+static Int32 ascii_search(const Char* source, Int32 sourceLen,
+    const Char* value, Int32 valueLen, Int32 options, bool last)
+{
+    const auto& table = g_ascii_collation;
+    const bool tertiary = (options & (CO_IgnoreCase | CO_IgnoreNonSpace)) == 0;
+    auto key = [&](Char c) -> uint16_t {
+        return static_cast<uint16_t>(table.primary[c] << 8 | (tertiary ? table.tertiary[c] : 0));
+    };
+    auto matches_at = [&](Int32 pos) {
+        for (Int32 k = 0; k < valueLen; k++) {
+            if (key(source[pos + k]) != key(value[k])) return false;
+        }
+        return true;
+    };
+    if (last) {
+        for (Int32 pos = sourceLen - valueLen; pos >= 0; pos--)
+            if (matches_at(pos)) return pos;
+    } else {
+        for (Int32 pos = 0; pos + valueLen <= sourceLen; pos++)
+            if (matches_at(pos)) return pos;
     }
+    return -1;
+}
+
+static bool has_ascii_control(const Char* chars, Int32 length) {
+    for (Int32 i = 0; i < length; i++) {
+        if (chars[i] < 0x20 || chars[i] == 0x7F) return true;
+    }
+    return false;
+}
+
+// ===== Per-Thread Collators =====
+
+namespace {
 
-    // Set collator strength based on options
+struct ThreadCollators {
+    struct Entry {
+        const UCollator* base;
+        Int32 options;
+        UCollator* clone;
+        bool ascii; // base orders ASCII like root: ASCII-only input may skip ICU
+    };
+
+    uint32_t generation = 0;
+    std::vector<Entry> entries; // a thread rarely uses more than a handful of combinations
+
+    void clear() {
+        for (auto& e : entries) ucol_close(e.clone);
+        entries.clear();
+    }
+    ~ThreadCollators() { clear(); }
+};
+
+thread_local ThreadCollators t_collators;
+
+} // namespace
+
+/// Options that change collator attributes; the ordinal flags never reach a collator.
+static constexpr Int32 kCollatorOptionMask =
+    CO_IgnoreCase | CO_IgnoreNonSpace | CO_IgnoreSymbols | CO_IgnoreKanaType | CO_IgnoreWidth;
+
+/// Configure a freshly cloned collator for CompareOptions.
+static void configure_collator(UCollator* collator, Int32 options) {
     UCollationStrength strength = UCOL_TERTIARY; // default: case-sensitive
     if (options & CO_IgnoreCase)
         strength = UCOL_SECONDARY; // ignore case
     if (options & CO_IgnoreNonSpace)
         strength = UCOL_PRIMARY; // ignore accents too
+    ucol_setStrength(collator, strength);
+
+    if (options & CO_IgnoreSymbols) {
+        // Punctuation, symbols and whitespace become ignorable at the chosen strength
+        UErrorCode err = U_ZERO_ERROR;
+        ucol_setAttribute(collator, UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, &err);
+    }
+}
+
+static ThreadCollators::Entry* thread_entry(const UCollator* base, Int32 options) {
+    if (!base) return nullptr;
+    options &= kCollatorOptionMask;
+
+    auto& cache = t_collators;
+    uint32_t generation = g_collator_generation.load(std::memory_order_acquire);
+    if (cache.generation != generation) {
+        cache.clear();
+        cache.generation = generation;
+    }
+    for (auto& e : cache.entries) {
+        if (e.base == base && e.options == options) return &e;
+    }
+
+    // ucol_clone shares the immutable tailoring data with the base; only the settings
+    // are copied, so a clone is cheap and stays valid after the base is closed.
+    UErrorCode err = U_ZERO_ERROR;
+    UCollator* clone = ucol_clone(base, &err);
+    if (U_FAILURE(err) || !clone) return nullptr;
+    configure_collator(clone, options);
+    cache.entries.push_back({ base, options, clone, has_root_ascii_collation(base) });
+    return &cache.entries.back();
+}
+
+UCollator* thread_collator(const UCollator* base, Int32 options) {
+    auto* entry = thread_entry(base, options);
+    return entry ? entry->clone : nullptr;
+}
+
+Int32 collator_compare(const UCollator* base,
+    const Char* s1, Int32 len1, const Char* s2, Int32 len2, Int32 options)
+{
+    auto* entry = thread_entry(base, options);
+    if (!entry) return 0; // no collator (ICU unavailable)
 
-    ucol_setStrength(g_invariant_collator, strength);
+    if (entry->ascii && unicode::is_ascii(s1, len1) && unicode::is_ascii(s2, len2))
+        return ascii_collate(s1, len1, s2, len2, options);
 
     UCollationResult result = ucol_strcoll(
-        g_invariant_collator,
+        entry->clone,
         reinterpret_cast<const UChar*>(s1), static_cast<int32_t>(len1),
         reinterpret_cast<const UChar*>(s2), static_cast<int32_t>(len2)
     );
@@ -130,6 +441,198 @@ static Int32 icu_compare(const Char* s1, Int32 len1, const Char* s2, Int32 len2,
     }
 }
 
+Int32 collator_index_of(const UCollator* base, const Char* source, Int32 sourceLen,
+    const Char* value, Int32 valueLen, Int32 options, bool last, Int32* matchLength)
+{
+    if (matchLength) *matchLength = 0;
+    auto* entry = thread_entry(base, options);
+    if (!entry) return -1;
+
+    if (entry->ascii && !(options & CO_IgnoreSymbols)
+        && unicode::is_ascii(value, valueLen) && unicode::is_ascii(source, sourceLen)
+        && !has_ascii_control(value, valueLen) && !has_ascii_control(source, sourceLen))
+    {
+        Int32 pos = ascii_search(source, sourceLen, value, valueLen, options, last);
+        if (pos >= 0 && matchLength) *matchLength = valueLen;
+        return pos;
+    }
+
+    UErrorCode err = U_ZERO_ERROR;
+    UStringSearch* search = usearch_openFromCollator(
+        reinterpret_cast<const UChar*>(value), static_cast<int32_t>(valueLen),
+        reinterpret_cast<const UChar*>(source), static_cast<int32_t>(sourceLen),
+        entry->clone, nullptr, &err
+    );
+    if (U_FAILURE(err) || !search) return -1;
+
+    int32_t pos = last ? usearch_last(search, &err) : usearch_first(search, &err);
+    int32_t matched = 0;
+    if (pos != USEARCH_DONE && !U_FAILURE(err)) {
+        matched = usearch_getMatchedLength(search);
+    }
+    usearch_close(search);
+
+    if (pos == USEARCH_DONE || U_FAILURE(err)) return -1;
+    if (matchLength) *matchLength = matched;
+    return pos;
+}
+
+// ===== Sort Keys =====
+
+Int32 collator_sort_key(const UCollator* base, const Char* s, Int32 length, Int32 options,
+    uint8_t* key, Int32 keyLength)
+{
+    UCollator* collator = thread_collator(base, options);
+    if (!collator) return 0;
+    return ucol_getSortKey(collator, reinterpret_cast<const UChar*>(s),
+        static_cast<int32_t>(length), key, static_cast<int32_t>(keyLength));
+}
+
+bool sort_strings_by_key(String** items, Int32 count, const UCollator* base, Int32 options) {
+    if (count < kSortKeyThreshold) return false;
+    UCollator* collator = thread_collator(base, options);
+    if (!collator) return false;
+
+    // All keys live in one arena; an entry remembers where its key starts. Keys end in the
+    // only zero byte they contain, so comparing them is memcmp over the shorter length.
+    struct Keyed {
+        size_t offset;
+        uint32_t length; // including the terminator; 0 = null string
+        Int32 index;
+    };
+    std::vector<Keyed> keyed(static_cast<size_t>(count));
+    std::vector<uint8_t> arena;
+    arena.reserve(static_cast<size_t>(count) * 32);
+    for (Int32 i = 0; i < count; i++) {
+        auto& k = keyed[static_cast<size_t>(i)];
+        k.index = i;
+        k.offset = arena.size();
+        k.length = 0;
+        String* s = items[i];
+        if (!s) continue;
+        auto* chars = reinterpret_cast<const UChar*>(&s->f__firstChar);
+        constexpr int32_t kKeyGuess = 64; // typical identifier keys are 20-40 bytes
+        arena.resize(k.offset + kKeyGuess);
+        int32_t needed = ucol_getSortKey(collator, chars, s->f__stringLength,
+            arena.data() + k.offset, kKeyGuess);
+        if (needed > kKeyGuess) {
+            arena.resize(k.offset + static_cast<size_t>(needed));
+            ucol_getSortKey(collator, chars, s->f__stringLength, arena.data() + k.offset, needed);
+        }
+        arena.resize(k.offset + static_cast<size_t>(needed));
+        k.length = static_cast<uint32_t>(needed);
+    }
+
+    const uint8_t* keys = arena.data();
+    std::sort(keyed.begin(), keyed.end(), [keys](const Keyed& a, const Keyed& b) {
+        if (a.length == 0 || b.length == 0) {
+            if (a.length != b.length) return a.length == 0; // null sorts first
+        } else {
+            int c = std::memcmp(keys + a.offset, keys + b.offset, std::min(a.length, b.length));
+            if (c != 0) return c < 0;
+        }
+        return a.index < b.index; // equal keys keep input order
+    });
+
+    // Apply the permutation in place, one cycle at a time: the displaced element is held in
+    // a local, so every string stays reachable from the array or the (GC-scanned) stack.
+    std::vector<bool> placed(static_cast<size_t>(count));
+    for (Int32 start = 0; start < count; start++) {
+        if (placed[static_cast<size_t>(start)]) continue;
+        String* first = items[start];
+        Int32 dst = start;
+        for (;;) {
+            placed[static_cast<size_t>(dst)] = true;
+            Int32 src = keyed[static_cast<size_t>(dst)].index;
+            if (src == start) break;
+            items[dst] = items[src];
+            dst = src;
+        }
+        items[dst] = first;
+    }
+    return true;
+}
+
+namespace {
+
+struct CultureComparerLayout {
+    TypeInfo* type;
+    size_t compare_info_offset;
+    size_t options_offset;
+    size_t sort_handle_offset;
+};
+
+// Plain aggregate: constant-initialized, so registration may happen before static init ends
+CultureComparerLayout g_culture_comparer;
+
+} // namespace
+
+void set_culture_comparer_layout(TypeInfo* comparer, size_t compareInfoOffset,
+    size_t optionsOffset, size_t sortHandleOffset)
+{
+    g_culture_comparer = { comparer, compareInfoOffset, optionsOffset, sortHandleOffset };
+}
+
+bool sort_strings_by_key(String** items, Int32 count, Object* comparison) {
+    if (count < kSortKeyThreshold || !comparison || !g_culture_comparer.type) return false;
+    auto* del = static_cast<Delegate*>(comparison);
+    Object* comparer = del->target;
+    if (del->invocation_count != 0 || !comparer
+        || comparer->__type_info != g_culture_comparer.type) return false;
+
+    auto* fields = reinterpret_cast<const uint8_t*>(comparer);
+    Object* compareInfo;
+    Int32 options;
+    std::memcpy(&compareInfo, fields + g_culture_comparer.compare_info_offset, sizeof(compareInfo));
+    std::memcpy(&options, fields + g_culture_comparer.options_offset, sizeof(options));
+    if (!compareInfo) return false;
+    intptr_t sortHandle;
+    std::memcpy(&sortHandle, reinterpret_cast<const uint8_t*>(compareInfo)
+        + g_culture_comparer.sort_handle_offset, sizeof(sortHandle));
+    // No handle: invariant globalization mode, where CompareInfo compares ordinally
+    if (!sortHandle) return false;
+    // Shared (__Canon) sort bodies reach here too; Compare(object, object) may be bound
+    // to a Comparison<T> of any reference type
+    for (Int32 i = 0; i < count; i++) {
+        TypeInfo* type = items[i] ? items[i]->__type_info : nullptr;
+        if (type && type != &System::String_TypeInfo && type != &System_String_TypeInfo) return false;
+    }
+    return sort_strings_by_key(items, count, reinterpret_cast<const UCollator*>(sortHandle), options);
+}
+
+// ===== Internal Helpers =====
+
+/// Ordinal compare: raw memcmp-style comparison of UTF-16 code units.
+static Int32 ordinal_compare(const Char* s1, Int32 len1, const Char* s2, Int32 len2) {
+    Int32 minLen = len1 < len2 ? len1 : len2;
+    for (Int32 i = 0; i < minLen; i++) {
+        if (s1[i] != s2[i])
+            return static_cast<Int32>(s1[i]) - static_cast<Int32>(s2[i]);
+    }
+    return len1 - len2;
+}
+
+/// Ordinal compare ignore case: per-char simple uppercase (ASCII without ICU).
+static Int32 ordinal_compare_ic(const Char* s1, Int32 len1, const Char* s2, Int32 len2) {
+    Int32 minLen = len1 < len2 ? len1 : len2;
+    for (Int32 i = 0; i < minLen; i++) {
+        Char c1 = unicode::to_upper(s1[i]);
+        Char c2 = unicode::to_upper(s2[i]);
+        if (c1 != c2)
+            return static_cast<Int32>(c1) - static_cast<Int32>(c2);
+    }
+    return len1 - len2;
+}
+
+/// Culture-sensitive compare on the invariant collator.
+static Int32 icu_compare(const Char* s1, Int32 len1, const Char* s2, Int32 len2, Int32 options) {
+    if (!g_invariant_collator) {
+        // Fallback to ordinal if ICU not initialized
+        return ordinal_compare(s1, len1, s2, len2);
+    }
+    return collator_compare(g_invariant_collator, s1, len1, s2, len2, options);
+}
+
 /// Compare two strings with CompareOptions.
 static Int32 compare_with_options(const Char* s1, Int32 len1, const Char* s2, Int32 len2, Int32 options) {
     if (options & CO_Ordinal)
@@ -180,8 +683,8 @@ static Int32 index_of_with_options(const Char* source, Int32 sourceLen,
                 Char c1 = source[i + j];
                 Char c2 = value[j];
                 if (ignoreCase) {
-                    c1 = static_cast<Char>(u_toupper(static_cast<UChar32>(c1)));
-                    c2 = static_cast<Char>(u_toupper(static_cast<UChar32>(c2)));
+                    c1 = unicode::to_upper(c1);
+                    c2 = unicode::to_upper(c2);
                 }
                 if (c1 != c2) { match = false; break; }
             }
@@ -190,34 +693,17 @@ static Int32 index_of_with_options(const Char* source, Int32 sourceLen,
         return -1;
     }
 
-    // Culture-sensitive: use ICU string search
-    std::lock_guard<std::mutex> lock(g_collator_mutex);
-    if (!g_invariant_collator) {
+    // Culture-sensitive: search with the default locale's collator
+    const UCollator* collator = g_default_collator ? g_default_collator : g_invariant_collator;
+    if (!collator) {
         // Fallback to ordinal
         return index_of_with_options(source, sourceLen, value, valueLen,
             startIndex, count, CO_Ordinal);
     }
 
-    UErrorCode err = U_ZERO_ERROR;
-    UStringSearch* search = usearch_open(
-        reinterpret_cast<const UChar*>(value), static_cast<int32_t>(valueLen),
-        reinterpret_cast<const UChar*>(source + startIndex), static_cast<int32_t>(count),
-        uloc_getDefault(), nullptr, &err
-    );
-
-    if (U_FAILURE(err) || !search) return -1;
-
-    // Set strength for options
-    UCollator* searchCollator = usearch_getCollator(search);
-    if (options & CO_IgnoreCase)
-        ucol_setStrength(searchCollator, UCOL_SECONDARY);
-
-    usearch_reset(search);
-    int32_t pos = usearch_first(search, &err);
-    usearch_close(search);
-
-    if (pos == USEARCH_DONE || U_FAILURE(err)) return -1;
-    return startIndex + pos;
+    Int32 pos = collator_index_of(collator, source + startIndex, count,
+        value, valueLen, options, false, nullptr);
+    return pos < 0 ? -1 : startIndex + pos;
 }
 
 // ===== CompareInfo ICalls =====
@@ -325,23 +811,9 @@ intptr_t compareinfo_get_sort_handle(String* sortName) {
             locale[static_cast<size_t>(i)] = '_';
     }
 
-    std::lock_guard<std::mutex> lock(g_collator_mutex);
-    auto it = g_collator_cache.find(locale);
-    if (it != g_collator_cache.end()) {
-        return reinterpret_cast<intptr_t>(it->second);
-    }
-
-    // Create new collator for this locale
-    UErrorCode err = U_ZERO_ERROR;
-    UCollator* collator = ucol_open(locale.c_str(), &err);
-    if (U_FAILURE(err) || !collator) {
-        // Fallback to invariant on failure
-        g_collator_cache[locale] = g_invariant_collator;
-        return reinterpret_cast<intptr_t>(g_invariant_collator);
-    }
-
-    g_collator_cache[locale] = collator;
-    return reinterpret_cast<intptr_t>(collator);
+    // Unknown locale → invariant
+    UCollator* collator = base_collator(locale.c_str());
+    return reinterpret_cast<intptr_t>(collator ? collator : g_invariant_collator);
 }
 
 // ===== String ICalls =====
@@ -449,9 +921,8 @@ void string_check_comparison(Int32 comparisonType) {
 Boolean ordinal_equals_ignore_case(Char* charA, Char* charB, Int32 length) {
     if (!charA || !charB) return false;
     for (Int32 i = 0; i < length; i++) {
-        UChar32 c1 = u_toupper(static_cast<UChar32>(charA[i]));
-        UChar32 c2 = u_toupper(static_cast<UChar32>(charB[i]));
-        if (c1 != c2) return false;
+        if (charA[i] == charB[i]) continue;
+        if (unicode::to_upper(charA[i]) != unicode::to_upper(charB[i])) return false;
     }
     return true;
 }
@@ -463,9 +934,7 @@ Int32 ordinal_compare_ignore_case(Char* strA, Int32 lengthA, Char* strB, Int32 l
 // ===== OrdinalCasing ICalls =====
 
 Char ordinal_casing_to_upper(Char c) {
-    UChar32 result = u_toupper(static_cast<UChar32>(c));
-    if (result > 0xFFFF) return c;
-    return static_cast<Char>(result);
+    return unicode::to_upper(c);
 }
 
 void* ordinal_casing_init_table() {
@@ -481,6 +950,16 @@ void* ordinal_casing_init_page(Int32 /*pageNumber*/) {
 void textinfo_change_case_core(void* /*__this*/,
     Char* src, Int32 srcLen, Char* dstBuffer, Int32 dstBufferCapacity, Boolean bToUpper)
 {
+    // ASCII maps 1:1 in every locale except Turkic i/I, so no ICU call is needed
+    if (g_default_ascii_casing && srcLen <= dstBufferCapacity && unicode::is_ascii(src, srcLen)) {
+        if (bToUpper) {
+            for (Int32 i = 0; i < srcLen; i++) dstBuffer[i] = unicode::ascii_to_upper(src[i]);
+        } else {
+            for (Int32 i = 0; i < srcLen; i++) dstBuffer[i] = unicode::ascii_to_lower(src[i]);
+        }
+        return;
+    }
+
     UErrorCode err = U_ZERO_ERROR;
     if (bToUpper) {
         u_strToUpper(
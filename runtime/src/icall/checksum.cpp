@@ -0,0 +1,465 @@
+/**
+ * CIL2CPP Runtime - CRC32 / CRC32C / Adler-32 with CPU dispatch
+ *
+ * Portable code is slicing-by-8 (CRC) and a 16-byte unrolled Adler-32. On x86-64 the
+ * CRC-32 path folds 64-byte blocks with carry-less multiplication (Intel, "Fast CRC
+ * Computation for Generic Polynomials Using PCLMULQDQ"; constants as in Chromium's zlib),
+ * CRC-32C uses the SSE4.2 crc32 instruction and Adler-32 uses SSSE3 pmaddubsw.
+ * On arm64 both CRCs use the ARMv8 crc32/crc32c instructions.
+ *
+ * All kernels work on the raw (non-inverted) CRC register; the public functions apply
+ * zlib's pre/post inversion.
+ */
+
+#include <cil2cpp/checksum.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <array>
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CIL2CPP_CHECKSUM_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CIL2CPP_CHECKSUM_ARM64 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <windows.h>
+#else
+#include <arm_acle.h>
+#endif
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
+// GCC/Clang compile the SIMD kernels for their ISA extension without raising the
+// baseline of the whole file; MSVC always accepts the intrinsics.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define CIL2CPP_TARGET(isa)
+#else
+#define CIL2CPP_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace cil2cpp {
+namespace checksum {
+
+namespace {
+
+// ===== Portable =====
+
+using CrcTables = std::array<std::array<uint32_t, 256>, 8>;
+
+constexpr CrcTables make_crc_tables(uint32_t poly) {
+    CrcTables t{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) c = (c & 1) ? (c >> 1) ^ poly : c >> 1;
+        t[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int k = 1; k < 8; k++) t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFF];
+    }
+    return t;
+}
+
+constexpr CrcTables kCrc32Tables = make_crc_tables(0xEDB88320u);
+constexpr CrcTables kCrc32cTables = make_crc_tables(0x82F63B78u);
+
+inline uint32_t load_le32(const uint8_t* p) {
+    return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+}
+
+inline uint64_t load_le64(const uint8_t* p) {
+    return uint64_t(load_le32(p)) | uint64_t(load_le32(p + 4)) << 32;
+}
+
+uint32_t crc_slice8(const CrcTables& t, uint32_t crc, const uint8_t* p, size_t n) {
+    while (n >= 8) {
+        uint32_t lo = load_le32(p) ^ crc;
+        uint32_t hi = load_le32(p + 4);
+        crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24]
+            ^ t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+        p += 8;
+        n -= 8;
+    }
+    while (n--) crc = t[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+uint32_t crc32_portable(uint32_t crc, const uint8_t* p, size_t n) {
+    return crc_slice8(kCrc32Tables, crc, p, n);
+}
+
+uint32_t crc32c_portable(uint32_t crc, const uint8_t* p, size_t n) {
+    return crc_slice8(kCrc32cTables, crc, p, n);
+}
+
+constexpr uint32_t kAdlerBase = 65521;
+constexpr size_t kAdlerNMax = 5552;   // largest n with 255n(n+1)/2 + (n+1)(BASE-1) < 2^32
+
+uint32_t adler32_portable(uint32_t adler, const uint8_t* p, size_t n) {
+    uint32_t s1 = adler & 0xFFFF;
+    uint32_t s2 = adler >> 16;
+    while (n > 0) {
+        size_t chunk = n < kAdlerNMax ? n : kAdlerNMax;
+        n -= chunk;
+        while (chunk >= 16) {
+            for (int i = 0; i < 16; i++) { s1 += p[i]; s2 += s1; }
+            p += 16;
+            chunk -= 16;
+        }
+        while (chunk--) { s1 += *p++; s2 += s1; }
+        s1 %= kAdlerBase;
+        s2 %= kAdlerBase;
+    }
+    return s1 | (s2 << 16);
+}
+
+// ===== x86-64 =====
+
+#if defined(CIL2CPP_CHECKSUM_X86)
+
+alignas(16) constexpr uint64_t kFold4[2] = {0x0154442BD4, 0x01C6E41596};   // x^(4*128+32), x^(4*128-32)
+alignas(16) constexpr uint64_t kFold1[2] = {0x01751997D0, 0x00CCAA009E};   // x^(128+32), x^(128-32)
+alignas(16) constexpr uint64_t kFold64[2] = {0x0163CD6124, 0x0000000000};  // x^64 mod P
+alignas(16) constexpr uint64_t kBarrett[2] = {0x01DB710641, 0x01F7011641}; // P', mu
+
+// acc * x^128 mod P, xor next
+CIL2CPP_TARGET("pclmul")
+inline __m128i fold128(__m128i acc, __m128i next, __m128i k) {
+    __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(hi, next), lo);
+}
+
+// Folds len bytes (len >= 64, multiple of 16) into the CRC register.
+CIL2CPP_TARGET("pclmul,sse4.1")
+uint32_t crc32_fold_pclmul(uint32_t crc, const uint8_t* p, size_t len) {
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x00));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x10));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x20));
+    __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(kFold4));
+    p += 64;
+    len -= 64;
+
+    // Four independent 128-bit lanes, each folded 512 bits forward per iteration
+    while (len >= 64) {
+        __m128i x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+        __m128i x6 = _mm_clmulepi64_si128(x2, k, 0x00);
+        __m128i x7 = _mm_clmulepi64_si128(x3, k, 0x00);
+        __m128i x8 = _mm_clmulepi64_si128(x4, k, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x30)));
+        p += 64;
+        len -= 64;
+    }
+
+    // Fold the four lanes into one
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(kFold1));
+    x1 = fold128(x1, x2, k);
+    x1 = fold128(x1, x3, k);
+    x1 = fold128(x1, x4, k);
+
+    while (len >= 16) {
+        x1 = fold128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), k);
+        p += 16;
+        len -= 16;
+    }
+
+    // 128 → 64 bits
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    k = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(kFold64));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x00), x2);
+
+    // Barrett reduction 64 → 32 bits
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(kBarrett));
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), k, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+uint32_t crc32_x86(uint32_t crc, const uint8_t* p, size_t n) {
+    if (n >= 64) {
+        size_t blocks = n & ~size_t(15);
+        crc = crc32_fold_pclmul(crc, p, blocks);
+        p += blocks;
+        n -= blocks;
+    }
+    return crc32_portable(crc, p, n);
+}
+
+CIL2CPP_TARGET("sse4.2")
+uint32_t crc32c_x86(uint32_t crc, const uint8_t* p, size_t n) {
+    uint64_t c = crc;
+    while (n >= 8) {
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+        c = _mm_crc32_u64(c, v);
+        p += 8;
+        n -= 8;
+    }
+    uint32_t c32 = static_cast<uint32_t>(c);
+    while (n--) c32 = _mm_crc32_u8(c32, *p++);
+    return c32;
+}
+
+// 32 bytes per step: s1 by psadbw, s2 by pmaddubsw against descending weights 32..1
+CIL2CPP_TARGET("ssse3")
+uint32_t adler32_x86(uint32_t adler, const uint8_t* p, size_t n) {
+    constexpr size_t kBlock = 32;
+    uint32_t s1 = adler & 0xFFFF;
+    uint32_t s2 = adler >> 16;
+    size_t blocks = n / kBlock;
+    n -= blocks * kBlock;
+
+    const __m128i tap1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+    const __m128i tap2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+
+    while (blocks) {
+        size_t count = kAdlerNMax / kBlock;
+        if (count > blocks) count = blocks;
+        blocks -= count;
+
+        // v_ps accumulates s1 before each block; every block adds 32 * s1 to s2
+        __m128i v_ps = _mm_set_epi32(0, 0, 0, static_cast<int>(s1 * count));
+        __m128i v_s2 = _mm_set_epi32(0, 0, 0, static_cast<int>(s2));
+        __m128i v_s1 = zero;
+        do {
+            const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const __m128i b2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16));
+            v_ps = _mm_add_epi32(v_ps, v_s1);
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(b1, zero));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_maddubs_epi16(b1, tap1), ones));
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(b2, zero));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_maddubs_epi16(b2, tap2), ones));
+            p += kBlock;
+        } while (--count);
+        v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(2, 3, 0, 1)));
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(1, 0, 3, 2)));
+        s1 += static_cast<uint32_t>(_mm_cvtsi128_si32(v_s1));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(2, 3, 0, 1)));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(1, 0, 3, 2)));
+        s2 = static_cast<uint32_t>(_mm_cvtsi128_si32(v_s2));
+        s1 %= kAdlerBase;
+        s2 %= kAdlerBase;
+    }
+    return adler32_portable(s1 | (s2 << 16), p, n);
+}
+
+CIL2CPP_TARGET("sse4.2") uint32_t crc32c_step_u8(uint32_t c, uint8_t v) { return _mm_crc32_u8(c, v); }
+CIL2CPP_TARGET("sse4.2") uint32_t crc32c_step_u16(uint32_t c, uint16_t v) { return _mm_crc32_u16(c, v); }
+CIL2CPP_TARGET("sse4.2") uint32_t crc32c_step_u32(uint32_t c, uint32_t v) { return _mm_crc32_u32(c, v); }
+CIL2CPP_TARGET("sse4.2") uint32_t crc32c_step_u64(uint32_t c, uint64_t v) {
+    return static_cast<uint32_t>(_mm_crc32_u64(c, v));
+}
+
+struct CpuFeatures { bool pclmul, sse41, sse42, ssse3; };
+
+CpuFeatures detect_cpu() {
+    int regs[4] = {};
+#if defined(_MSC_VER)
+    __cpuid(regs, 1);
+#else
+    unsigned a, b, c, d;
+    if (!__get_cpuid(1, &a, &b, &c, &d)) return {};
+    regs[2] = static_cast<int>(c);
+#endif
+    unsigned ecx = static_cast<unsigned>(regs[2]);
+    return {(ecx >> 1 & 1) != 0, (ecx >> 19 & 1) != 0, (ecx >> 20 & 1) != 0, (ecx >> 9 & 1) != 0};
+}
+
+#endif // CIL2CPP_CHECKSUM_X86
+
+// ===== arm64 =====
+
+#if defined(CIL2CPP_CHECKSUM_ARM64)
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define CIL2CPP_TARGET_CRC
+#else
+#define CIL2CPP_TARGET_CRC CIL2CPP_TARGET("arch=armv8-a+crc")
+#endif
+
+CIL2CPP_TARGET_CRC
+uint32_t crc32_arm64(uint32_t crc, const uint8_t* p, size_t n) {
+    while (n >= 8) {
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+        crc = __crc32d(crc, v);
+        p += 8;
+        n -= 8;
+    }
+    while (n--) crc = __crc32b(crc, *p++);
+    return crc;
+}
+
+CIL2CPP_TARGET_CRC
+uint32_t crc32c_arm64(uint32_t crc, const uint8_t* p, size_t n) {
+    while (n >= 8) {
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+        crc = __crc32cd(crc, v);
+        p += 8;
+        n -= 8;
+    }
+    while (n--) crc = __crc32cb(crc, *p++);
+    return crc;
+}
+
+CIL2CPP_TARGET_CRC uint32_t crc32c_step_u8(uint32_t c, uint8_t v) { return __crc32cb(c, v); }
+CIL2CPP_TARGET_CRC uint32_t crc32c_step_u16(uint32_t c, uint16_t v) { return __crc32ch(c, v); }
+CIL2CPP_TARGET_CRC uint32_t crc32c_step_u32(uint32_t c, uint32_t v) { return __crc32cw(c, v); }
+CIL2CPP_TARGET_CRC uint32_t crc32c_step_u64(uint32_t c, uint64_t v) { return __crc32cd(c, v); }
+
+bool detect_arm_crc() {
+#if defined(__APPLE__)
+    return true;   // every Apple arm64 core implements ARMv8.1+
+#elif defined(_WIN32)
+    return IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != 0;
+#elif defined(__linux__) && defined(HWCAP_CRC32)
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#else
+    return false;
+#endif
+}
+
+#endif // CIL2CPP_CHECKSUM_ARM64
+
+// ===== Dispatch =====
+
+using BufferFn = uint32_t (*)(uint32_t, const uint8_t*, size_t);
+
+struct Kernels {
+    BufferFn crc32;
+    BufferFn crc32c;
+    BufferFn adler32;
+    uint32_t (*crc32c_u8)(uint32_t, uint8_t);
+    uint32_t (*crc32c_u16)(uint32_t, uint16_t);
+    uint32_t (*crc32c_u32)(uint32_t, uint32_t);
+    uint32_t (*crc32c_u64)(uint32_t, uint64_t);
+    const char* name;
+};
+
+uint32_t crc32c_portable_u8(uint32_t c, uint8_t v) { return crc32c_portable(c, &v, 1); }
+uint32_t crc32c_portable_u16(uint32_t c, uint16_t v) {
+    uint8_t b[2] = {uint8_t(v), uint8_t(v >> 8)};
+    return crc32c_portable(c, b, 2);
+}
+uint32_t crc32c_portable_u32(uint32_t c, uint32_t v) {
+    uint8_t b[4] = {uint8_t(v), uint8_t(v >> 8), uint8_t(v >> 16), uint8_t(v >> 24)};
+    return crc32c_portable(c, b, 4);
+}
+uint32_t crc32c_portable_u64(uint32_t c, uint64_t v) {
+    return crc32c_portable_u32(crc32c_portable_u32(c, uint32_t(v)), uint32_t(v >> 32));
+}
+
+constexpr Kernels kPortable = {
+    crc32_portable, crc32c_portable, adler32_portable,
+    crc32c_portable_u8, crc32c_portable_u16, crc32c_portable_u32, crc32c_portable_u64,
+    "portable",
+};
+
+Kernels select_hardware() {
+    Kernels k = kPortable;
+#if defined(CIL2CPP_CHECKSUM_X86)
+    CpuFeatures cpu = detect_cpu();
+    if (cpu.pclmul && cpu.sse41) k.crc32 = crc32_x86;
+    if (cpu.ssse3) k.adler32 = adler32_x86;
+    if (cpu.sse42) {
+        k.crc32c = crc32c_x86;
+        k.crc32c_u8 = crc32c_step_u8;
+        k.crc32c_u16 = crc32c_step_u16;
+        k.crc32c_u32 = crc32c_step_u32;
+        k.crc32c_u64 = crc32c_step_u64;
+    }
+    if (cpu.pclmul && cpu.sse41 && cpu.sse42 && cpu.ssse3) k.name = "x86-64 pclmul/sse4.2/ssse3";
+    else if (k.crc32 != kPortable.crc32 || k.crc32c != kPortable.crc32c || k.adler32 != kPortable.adler32)
+        k.name = "x86-64 partial";
+#elif defined(CIL2CPP_CHECKSUM_ARM64)
+    if (detect_arm_crc()) {
+        k.crc32 = crc32_arm64;
+        k.crc32c = crc32c_arm64;
+        k.crc32c_u8 = crc32c_step_u8;
+        k.crc32c_u16 = crc32c_step_u16;
+        k.crc32c_u32 = crc32c_step_u32;
+        k.crc32c_u64 = crc32c_step_u64;
+        k.name = "arm64 crc32";
+    }
+#endif
+    return k;
+}
+
+const Kernels& hardware_kernels() {
+    static const Kernels k = select_hardware();
+    return k;
+}
+
+std::atomic<const Kernels*> g_kernels{nullptr};
+
+inline const Kernels& kernels() {
+    const Kernels* k = g_kernels.load(std::memory_order_acquire);
+    if (k) return *k;
+    const Kernels* selected = &hardware_kernels();
+    g_kernels.compare_exchange_strong(k, selected, std::memory_order_acq_rel);
+    return *g_kernels.load(std::memory_order_acquire);
+}
+
+} // namespace
+
+uint32_t crc32(uint32_t crc, const void* data, size_t length) {
+    if (!data || length == 0) return crc;
+    return ~kernels().crc32(~crc, static_cast<const uint8_t*>(data), length);
+}
+
+uint32_t crc32c(uint32_t crc, const void* data, size_t length) {
+    if (!data || length == 0) return crc;
+    return ~kernels().crc32c(~crc, static_cast<const uint8_t*>(data), length);
+}
+
+uint32_t adler32(uint32_t adler, const void* data, size_t length) {
+    if (!data || length == 0) return adler;
+    return kernels().adler32(adler, static_cast<const uint8_t*>(data), length);
+}
+
+const char* implementation() {
+    return kernels().name;
+}
+
+bool use_hardware(bool enabled) {
+    const Kernels* k = enabled ? &hardware_kernels() : &kPortable;
+    g_kernels.store(k, std::memory_order_release);
+    return k != &kPortable && k->name != kPortable.name;
+}
+
+} // namespace checksum
+
+uint32_t bit_crc32c_u8(uint32_t crc, uint8_t data) { return checksum::kernels().crc32c_u8(crc, data); }
+uint32_t bit_crc32c_u16(uint32_t crc, uint16_t data) { return checksum::kernels().crc32c_u16(crc, data); }
+uint32_t bit_crc32c_u32(uint32_t crc, uint32_t data) { return checksum::kernels().crc32c_u32(crc, data); }
+uint32_t bit_crc32c_u64(uint32_t crc, uint64_t data) { return checksum::kernels().crc32c_u64(crc, data); }
+
+} // namespace cil2cpp
@@ -18,6 +18,7 @@
 #include <cil2cpp/boxing.h>
 #include <cil2cpp/gchandle.h>
 #include <cil2cpp/threadpool.h>
+#include <cil2cpp/counters.h>
 #include <cil2cpp/iocp.h>
 #include <cil2cpp/delegate.h>
 
@@ -103,6 +104,10 @@ Int32 Environment_get_ProcessorCount() {
     return count > 0 ? static_cast<Int32>(count) : 1;
 }
 
+Int64 Environment_get_WorkingSet() {
+    return counters::working_set();
+}
+
 Int32 Environment_get_CurrentManagedThreadId() {
     // Return a hash of the native thread ID as a managed thread ID
     return static_cast<Int32>(std::hash<std::thread::id>{}(std::this_thread::get_id()) & kPositiveHashMask);
@@ -371,6 +376,10 @@ void Monitor_PulseAll(Object* obj) {
     monitor::pulse_all(obj);
 }
 
+Int64 Monitor_get_LockContentionCount() {
+    return monitor::get_contention_count();
+}
+
 // ===== System.Threading.Interlocked =====
 
 Int32 Interlocked_Increment_i32(Int32* location) { return interlocked::increment_i32(location); }
@@ -842,6 +851,20 @@ bool ThreadPool_BindHandlePortableCore(void* osHandle) {
     return iocp::bind_handle(handle);
 }
 
+// Counters read by the BCL getters (and RuntimeEventSource / RuntimeMetrics) come from the
+// C++ pool — the BCL's own PortableThreadPool bookkeeping never runs here.
+Int32 ThreadPool_get_ThreadCount() {
+    return threadpool::get_thread_count();
+}
+
+Int64 ThreadPool_get_PendingWorkItemCount() {
+    return threadpool::get_queue_length();
+}
+
+Int64 ThreadPool_get_CompletedWorkItemCount() {
+    return threadpool::get_completions();
+}
+
 // ===== System.Type (reflection introspection) =====
 
 static Type* get_type_from_this(void* __this) {
@@ -1084,13 +1107,11 @@ Boolean MethodBase_get_IsConstructor(void* __this) {
     return std::strcmp(ni->name, ".ctor") == 0 || std::strcmp(ni->name, ".cctor") == 0;
 }
 
-// CreateDelegate from MethodInfo — simplified AOT implementation.
-// Creates a delegate that calls the method via its stored function pointer.
-Object* MethodInfo_CreateDelegate(void* __this, void* /*delegateType*/) {
-    // In AOT, we can't create arbitrary delegates from MethodInfo at runtime
-    // (would require JIT-like thunk generation). Return nullptr for now.
-    // Libraries that need this (e.g., Newtonsoft.Json) typically have fallback paths.
-    return nullptr;
+// CreateDelegate from MethodInfo: binds the compiled method pointer directly
+// (static or open-instance; see methodinfo_create_delegate).
+Object* MethodInfo_CreateDelegate(void* __this, void* delegateType) {
+    return methodinfo_create_delegate(reinterpret_cast<ManagedMethodInfo*>(__this),
+        reinterpret_cast<Type*>(delegateType), nullptr);
 }
 
 Boolean MethodBase_get_IsAssembly(void* __this) {
@@ -1291,13 +1312,8 @@ void* Delegate_get_Method(void* /*__this*/) {
 // ===== System.Runtime.InteropServices.GCHandle =====
 
 intptr_t GCHandle_InternalCompareExchange(intptr_t handle, cil2cpp::Object* value, cil2cpp::Object* comparand) {
-    // Atomic compare-and-swap on the GCHandle table entry.
-    // Read current value, compare with comparand, if equal replace with value.
-    void* current = gchandle_get(handle);
-    if (current == static_cast<void*>(comparand)) {
-        gchandle_set(handle, static_cast<void*>(value));
-    }
-    return reinterpret_cast<intptr_t>(current);
+    // Atomic compare-and-swap on the GCHandle table entry; returns the previous target
+    return reinterpret_cast<intptr_t>(gchandle_compare_exchange(handle, value, comparand));
 }
 
 // ===== System.Diagnostics =====
@@ -1,5 +1,5 @@
 /**
- * CIL2CPP Runtime — Compression Interop (zlib)
+ * CIL2CPP Runtime — Compression Interop (zlib, Brotli)
  *
  * Implements the CompressionNative_* entry points that .NET BCL's
  * System.IO.Compression calls via P/Invoke. The managed side uses a
@@ -8,35 +8,188 @@
  *
  * Follows .NET runtime's pal_zlib.c architecture:
  * https://github.com/dotnet/runtime/blob/main/src/native/libs/System.IO.Compression.Native/pal_zlib.c
+ *
+ * Unlike pal_zlib.c, ending a stream does not free its zlib state: the state is reset and
+ * parked in a small per-thread pool for the next stream with the same window/memory
+ * parameters.
+ *
+ * There are no one-shot zlib entry points (compress2/uncompress): the BCL has no managed
+ * one-shot zlib API, and System.IO.Compression only P/Invokes the streaming ones above.
+ * Brotli's one-shot path (BrotliEncoder.TryCompress / BrotliDecoder.TryDecompress) is
+ * libbrotli's own, below.
+ *
+ * Brotli needs no wrappers: System.IO.Compression.Native exports libbrotli's own C API
+ * (BrotliEncoderCreateInstance, BrotliEncoderCompressStream, BrotliDecoderDecompressStream,
+ * the one-shot BrotliEncoderCompress/BrotliDecoderDecompress, ...), so the BCL's
+ * Interop.Brotli P/Invokes link straight against the bundled brotlienc/brotlidec.
+ * The generated forward declarations use the IL signature types; the checks below pin
+ * the ABI those declarations assume.
  */
 
+#include "compression_interop.h"
+
+#include <cil2cpp/checksum.h>
 #include <zlib.h>
+#include <brotli/decode.h>
+#include <brotli/encode.h>
+#include <cstddef>
 #include <cstdlib>
 #include <cstdint>
 #include <cstring>
 
-// PAL_ZStream: managed-side wrapper passed to CompressionNative_* functions.
-// Maps to System.IO.Compression.ZLibNative.ZStream in .NET BCL IL.
-// Layout must match the generated C++ struct:
-//   intptr_t f_nextIn, f_nextOut, f_msg, f_internalState;
-//   uint32_t f_availIn, f_availOut;
-struct PAL_ZStream {
-    uint8_t*  nextIn;
-    uint8_t*  nextOut;
-    char*     msg;
-    void*     internalState;   // opaque — points to our allocated z_stream
-    uint32_t  availIn;
-    uint32_t  availOut;
+namespace {
+
+// Native state behind PAL_ZStream::internalState. z_stream comes first so the pointer
+// doubles as a z_stream*; the remaining fields are what the pool matches on.
+struct ZState {
+    z_stream zs;
+    bool     deflater;
+    int32_t  windowBits;
+    int32_t  memLevel;         // deflate only
+    int32_t  level;            // deflate only: current deflateParams
+    int32_t  strategy;
+    bool     midStream;        // deflate only: deflate() called, Z_STREAM_END not reached yet
+};
+
+static_assert(offsetof(ZState, zs) == 0, "internalState must also be a valid z_stream*");
+
+// Returns the deflateEnd/inflateEnd result.
+int32_t destroy_state(ZState* state) {
+    int32_t ret = state->deflater ? deflateEnd(&state->zs) : inflateEnd(&state->zs);
+    std::free(state);
+    return ret;
+}
+
+// Per-thread pool of reset states. A deflate state is ~256 KB of zlib allocations
+// (window, hash chains, pending buffer), so short-lived GZipStream/DeflateStream
+// instances otherwise allocate and free it every time. Deflaters are keyed on
+// (windowBits, memLevel), which size those buffers; level and strategy are re-applied
+// with deflateParams. Inflaters are keyed on windowBits only (inflateReset2 can switch
+// it). A full pool evicts the least recently parked entry.
+constexpr int kPoolCapacity = 4;
+
+struct ZStatePool {
+    ZState* deflaters[kPoolCapacity] = {};
+    int deflaterCount = 0;
+    ZState* inflaters[kPoolCapacity] = {};
+    int inflaterCount = 0;
+
+    ~ZStatePool() {
+        for (int i = 0; i < deflaterCount; i++) destroy_state(deflaters[i]);
+        for (int i = 0; i < inflaterCount; i++) destroy_state(inflaters[i]);
+    }
+};
+
+// The pool is reached through a trivially destructible pointer: a stream ended after this
+// thread's thread_locals were torn down frees its state instead of parking it.
+thread_local ZStatePool* t_pool = nullptr;
+thread_local bool t_pool_retired = false;
+
+struct ZStatePoolOwner {
+    ZStatePool pool;
+    ZStatePoolOwner() { t_pool = &pool; }
+    ~ZStatePoolOwner() { t_pool = nullptr; t_pool_retired = true; }
 };
 
-// Allocate and zero-initialize the internal z_stream.
-static int32_t Init(PAL_ZStream* stream) {
-    z_stream* zs = static_cast<z_stream*>(std::calloc(1, sizeof(z_stream)));
-    if (!zs) return Z_MEM_ERROR;
-    stream->internalState = zs;
+ZStatePool* current_pool() {
+    if (t_pool) return t_pool;
+    if (t_pool_retired) return nullptr;
+    thread_local ZStatePoolOwner owner;
+    return t_pool;
+}
+
+ZState* take(ZState** entries, int& count, int index) {
+    ZState* state = entries[index];
+    for (int i = index + 1; i < count; i++) entries[i - 1] = entries[i];
+    entries[--count] = nullptr;
+    return state;
+}
+
+void park(ZState** entries, int& count, ZState* state) {
+    if (count == kPoolCapacity) destroy_state(take(entries, count, 0));
+    entries[count++] = state;
+}
+
+// Returns a deflate state ready for input, or nullptr with *ret set to the zlib error.
+ZState* acquire_deflater(int32_t level, int32_t method, int32_t windowBits,
+                         int32_t memLevel, int32_t strategy, int32_t* ret) {
+    ZStatePool* pool = current_pool();
+    for (int i = pool ? pool->deflaterCount - 1 : -1; i >= 0; i--) {
+        ZState* state = pool->deflaters[i];
+        if (state->windowBits != windowBits || state->memLevel != memLevel) continue;
+        take(pool->deflaters, pool->deflaterCount, i);
+        // Right after deflateReset there is no pending input, so deflateParams just
+        // switches the configuration
+        if (state->level != level || state->strategy != strategy) {
+            if (deflateParams(&state->zs, level, strategy) != Z_OK) {
+                park(pool->deflaters, pool->deflaterCount, state);   // invalid level/strategy:
+                break;                                               // deflateInit2 reports it
+            }
+            state->level = level;
+            state->strategy = strategy;
+        }
+        *ret = Z_OK;
+        return state;
+    }
+
+    ZState* state = static_cast<ZState*>(std::calloc(1, sizeof(ZState)));
+    if (!state) { *ret = Z_MEM_ERROR; return nullptr; }
+    *ret = deflateInit2(&state->zs, level, method, windowBits, memLevel, strategy);
+    if (*ret != Z_OK) { std::free(state); return nullptr; }
+    state->deflater = true;
+    state->windowBits = windowBits;
+    state->memLevel = memLevel;
+    state->level = level;
+    state->strategy = strategy;
+    return state;
+}
+
+ZState* acquire_inflater(int32_t windowBits, int32_t* ret) {
+    ZStatePool* pool = current_pool();
+    if (pool && pool->inflaterCount > 0) {
+        int index = pool->inflaterCount - 1;
+        for (int i = index; i >= 0; i--) {
+            if (pool->inflaters[i]->windowBits == windowBits) { index = i; break; }
+        }
+        ZState* state = pool->inflaters[index];
+        // A matching windowBits keeps the already-allocated window
+        if (state->windowBits == windowBits || inflateReset2(&state->zs, windowBits) == Z_OK) {
+            take(pool->inflaters, pool->inflaterCount, index);
+            state->windowBits = windowBits;
+            *ret = Z_OK;
+            return state;
+        }
+    }
+
+    ZState* state = static_cast<ZState*>(std::calloc(1, sizeof(ZState)));
+    if (!state) { *ret = Z_MEM_ERROR; return nullptr; }
+    *ret = inflateInit2(&state->zs, windowBits);
+    if (*ret != Z_OK) { std::free(state); return nullptr; }
+    state->deflater = false;
+    state->windowBits = windowBits;
+    return state;
+}
+
+// Resets the state and parks it in this thread's pool, or frees it if it cannot be reused.
+// Returns what deflateEnd/inflateEnd reports for the stream. A deflater abandoned before
+// Z_STREAM_END is really ended, since deflateEnd's answer for it is Z_DATA_ERROR; any
+// other state would get Z_OK, which a successful reset confirms (both run zlib's state check).
+int32_t release(ZState* state) {
+    ZStatePool* pool = current_pool();
+    if (!pool || state->midStream) return destroy_state(state);
+    int32_t ret = state->deflater ? deflateReset(&state->zs) : inflateReset(&state->zs);
+    if (ret != Z_OK) return destroy_state(state);
+    state->zs.next_in = nullptr;
+    state->zs.avail_in = 0;
+    state->zs.next_out = nullptr;
+    state->zs.avail_out = 0;
+    if (state->deflater) park(pool->deflaters, pool->deflaterCount, state);
+    else park(pool->inflaters, pool->inflaterCount, state);
     return Z_OK;
 }
 
+} // namespace
+
 // Get the internal z_stream, syncing input from PAL_ZStream.
 static z_stream* GetCurrentZStream(PAL_ZStream* stream) {
     z_stream* zs = static_cast<z_stream*>(stream->internalState);
@@ -57,6 +210,18 @@ static void TransferState(PAL_ZStream* stream, z_stream* zs) {
     stream->msg      = zs->msg;
 }
 
+// Interop.BOOL (int32), nuint (size_t) and the BCL enums passed by value
+static_assert(sizeof(BROTLI_BOOL) == sizeof(int32_t), "Interop.BOOL is a 32-bit int");
+static_assert(sizeof(size_t) == sizeof(uintptr_t), "nuint maps to size_t");
+static_assert(BROTLI_OPERATION_PROCESS == 0 && BROTLI_OPERATION_FLUSH == 1
+    && BROTLI_OPERATION_FINISH == 2 && BROTLI_OPERATION_EMIT_METADATA == 3,
+    "System.IO.Compression.BrotliEncoderOperation values");
+static_assert(BROTLI_PARAM_MODE == 0 && BROTLI_PARAM_QUALITY == 1 && BROTLI_PARAM_LGWIN == 2,
+    "System.IO.Compression.BrotliEncoderParameter values");
+static_assert(BROTLI_DECODER_RESULT_ERROR == 0 && BROTLI_DECODER_RESULT_SUCCESS == 1
+    && BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT == 2 && BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT == 3,
+    "System.IO.Compression.BrotliDecoderResult values");
+
 extern "C" {
 
 int32_t CompressionNative_DeflateInit2_(
@@ -67,13 +232,14 @@ int32_t CompressionNative_DeflateInit2_(
     int32_t memLevel,
     int32_t strategy)
 {
-    int32_t ret = Init(stream);
-    if (ret != Z_OK) return ret;
+    int32_t ret;
+    ZState* state = acquire_deflater(level, method, windowBits, memLevel, strategy, &ret);
+    if (!state) return ret;
+    stream->internalState = state;
 
     z_stream* zs = GetCurrentZStream(stream);
-    ret = deflateInit2(zs, level, method, windowBits, memLevel, strategy);
     TransferState(stream, zs);
-    return ret;
+    return Z_OK;
 }
 
 int32_t CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush) {
@@ -81,28 +247,28 @@ int32_t CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush) {
     if (!zs) return Z_STREAM_ERROR;
 
     int32_t ret = deflate(zs, flush);
+    static_cast<ZState*>(stream->internalState)->midStream = ret != Z_STREAM_END;
     TransferState(stream, zs);
     return ret;
 }
 
 int32_t CompressionNative_DeflateEnd(PAL_ZStream* stream) {
-    z_stream* zs = GetCurrentZStream(stream);
-    if (!zs) return Z_STREAM_ERROR;
+    auto* state = static_cast<ZState*>(stream->internalState);
+    if (!state) return Z_STREAM_ERROR;
 
-    int32_t ret = deflateEnd(zs);
-    std::free(zs);
     stream->internalState = nullptr;
-    return ret;
+    return release(state);
 }
 
 int32_t CompressionNative_InflateInit2_(PAL_ZStream* stream, int32_t windowBits) {
-    int32_t ret = Init(stream);
-    if (ret != Z_OK) return ret;
+    int32_t ret;
+    ZState* state = acquire_inflater(windowBits, &ret);
+    if (!state) return ret;
+    stream->internalState = state;
 
     z_stream* zs = GetCurrentZStream(stream);
-    ret = inflateInit2(zs, windowBits);
     TransferState(stream, zs);
-    return ret;
+    return Z_OK;
 }
 
 int32_t CompressionNative_Inflate(PAL_ZStream* stream, int32_t flush) {
@@ -115,18 +281,18 @@ int32_t CompressionNative_Inflate(PAL_ZStream* stream, int32_t flush) {
 }
 
 int32_t CompressionNative_InflateEnd(PAL_ZStream* stream) {
-    z_stream* zs = GetCurrentZStream(stream);
-    if (!zs) return Z_STREAM_ERROR;
+    auto* state = static_cast<ZState*>(stream->internalState);
+    if (!state) return Z_STREAM_ERROR;
 
-    int32_t ret = inflateEnd(zs);
-    std::free(zs);
     stream->internalState = nullptr;
-    return ret;
+    return release(state);
 }
 
 uint32_t CompressionNative_Crc32(uint32_t crc, uint8_t* buf, int32_t len) {
-    if (!buf || len <= 0) return static_cast<uint32_t>(crc32(crc, Z_NULL, 0));
-    return static_cast<uint32_t>(crc32(crc, buf, static_cast<uInt>(len)));
+    // zlib returns the initial value 0 for a null buffer; CRC kernels are CPU-dispatched
+    if (!buf) return 0;
+    if (len <= 0) return crc;
+    return cil2cpp::checksum::crc32(crc, buf, static_cast<size_t>(len));
 }
 
 } // extern "C"
@@ -0,0 +1,45 @@
+/**
+ * CIL2CPP Runtime — Compression Interop (internal)
+ *
+ * Declarations for the CompressionNative_* entry points implemented in
+ * compression_interop.cpp. Generated code never includes this header: it forward-declares
+ * the P/Invoke entry points itself from the IL signatures, and those declarations use the
+ * generated ZStream struct instead of PAL_ZStream.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// PAL_ZStream: managed-side wrapper passed to CompressionNative_* functions.
+// Maps to System.IO.Compression.ZLibNative.ZStream in .NET BCL IL.
+// Layout must match the generated C++ struct:
+//   intptr_t f_nextIn, f_nextOut, f_msg, f_internalState;
+//   uint32_t f_availIn, f_availOut;
+struct PAL_ZStream {
+    uint8_t*  nextIn;
+    uint8_t*  nextOut;
+    char*     msg;
+    void*     internalState;   // opaque — points to our allocated z_stream
+    uint32_t  availIn;
+    uint32_t  availOut;
+};
+
+extern "C" {
+
+// ===== Streaming (pal_zlib.c) =====
+// DeflateEnd/InflateEnd park the native state in a per-thread pool (deflateReset /
+// inflateReset) instead of freeing it; the next Init2_ with the same windowBits/memLevel
+// on that thread reuses it. A deflater ended mid-stream is freed with deflateEnd instead,
+// so its Z_DATA_ERROR reaches the caller; every End returns what zlib's End would.
+
+int32_t CompressionNative_DeflateInit2_(PAL_ZStream* stream, int32_t level, int32_t method,
+                                        int32_t windowBits, int32_t memLevel, int32_t strategy);
+int32_t CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush);
+int32_t CompressionNative_DeflateEnd(PAL_ZStream* stream);
+int32_t CompressionNative_InflateInit2_(PAL_ZStream* stream, int32_t windowBits);
+int32_t CompressionNative_Inflate(PAL_ZStream* stream, int32_t flush);
+int32_t CompressionNative_InflateEnd(PAL_ZStream* stream);
+uint32_t CompressionNative_Crc32(uint32_t crc, uint8_t* buf, int32_t len);
+
+} // extern "C"
@@ -10,10 +10,11 @@
  */
 
 #include <cil2cpp/globalization_interop.h>
+#include <cil2cpp/globalization.h>
+#include <cil2cpp/unicode.h>
 #include <cil2cpp/array.h>
 
 #include <unicode/ucol.h>
-#include <unicode/usearch.h>
 #include <unicode/uloc.h>
 #include <unicode/uchar.h>
 #include <unicode/ustring.h>
@@ -25,9 +26,7 @@
 #include <unicode/ucurr.h>
 
 #include <cstring>
-#include <mutex>
 #include <string>
-#include <unordered_map>
 
 namespace cil2cpp {
 
@@ -68,33 +67,10 @@ enum InteropCompareOptions : int32_t {
     ICO_Ordinal          = 0x40000000,
 };
 
-/// Apply CompareOptions to a UCollator's strength setting.
-static void apply_compare_options(UCollator* collator, int32_t options) {
-    UCollationStrength strength = UCOL_TERTIARY; // default: case-sensitive
-    if (options & ICO_IgnoreCase)     strength = UCOL_SECONDARY;
-    if (options & ICO_IgnoreNonSpace) strength = UCOL_PRIMARY;
-    ucol_setStrength(collator, strength);
-}
-
-// ===== Sort Handle Cache =====
-// Sort handles are UCollator* pointers passed as intptr_t.
-// Cached by locale name — CloseSortHandle is a no-op.
-
-static std::unordered_map<std::string, UCollator*> g_sort_handle_cache;
-static std::mutex g_sort_handle_mutex;
-
-static UCollator* get_or_create_collator(const std::string& locale) {
-    std::lock_guard<std::mutex> lock(g_sort_handle_mutex);
-    auto it = g_sort_handle_cache.find(locale);
-    if (it != g_sort_handle_cache.end()) return it->second;
-
-    UErrorCode err = U_ZERO_ERROR;
-    UCollator* collator = ucol_open(locale.empty() ? "" : locale.c_str(), &err);
-    if (U_FAILURE(err) || !collator) return nullptr;
-
-    g_sort_handle_cache[locale] = collator;
-    return collator;
-}
+// ===== Sort Handles =====
+// Sort handles are the shared base collators from globalization::base_collator(), passed as
+// intptr_t and never reconfigured — CloseSortHandle is a no-op. Comparisons and searches
+// use globalization::thread_collator(), a per-thread clone configured for the options.
 
 // ===== LocaleNumberData enum (matches .NET's LocaleNumberData) =====
 
@@ -199,7 +175,7 @@ int32_t interop_globalization_get_sort_handle(String* sortName, intptr_t* sortHa
     if (!sortHandle) return 1; // error: null output pointer
 
     std::string locale = locale_to_icu(sortName);
-    UCollator* collator = get_or_create_collator(locale);
+    UCollator* collator = globalization::base_collator(locale.c_str());
     if (!collator) {
         *sortHandle = 0;
         return 1; // error: could not create collator
@@ -236,8 +212,8 @@ int32_t interop_globalization_compare_string(
     if (options & ICO_OrdinalIgnoreCase) {
         int32_t minLen = string1Length < string2Length ? string1Length : string2Length;
         for (int32_t i = 0; i < minLen; i++) {
-            UChar32 c1 = u_toupper(static_cast<UChar32>(string1[i]));
-            UChar32 c2 = u_toupper(static_cast<UChar32>(string2[i]));
+            Char c1 = unicode::to_upper(string1[i]);
+            Char c2 = unicode::to_upper(string2[i]);
             if (c1 != c2) return c1 < c2 ? -1 : 1;
         }
         if (string1Length < string2Length) return -1;
@@ -245,22 +221,9 @@ int32_t interop_globalization_compare_string(
         return 0;
     }
 
-    // Culture-sensitive: use ICU collator
-    auto* collator = reinterpret_cast<UCollator*>(sortHandle);
-    if (!collator) return 0;
-
-    apply_compare_options(collator, options);
-
-    UCollationResult result = ucol_strcoll(
-        collator,
-        reinterpret_cast<const UChar*>(string1), string1Length,
-        reinterpret_cast<const UChar*>(string2), string2Length);
-
-    switch (result) {
-        case UCOL_LESS:    return -1;
-        case UCOL_GREATER: return 1;
-        default:           return 0;
-    }
+    // Culture-sensitive: ASCII weight tables or this thread's clone of the handle's collator
+    return globalization::collator_compare(reinterpret_cast<UCollator*>(sortHandle),
+        string1, string1Length, string2, string2Length, options);
 }
 
 // =====================================================================
@@ -293,8 +256,7 @@ int32_t interop_globalization_index_of(
         for (int32_t i = 0; i <= sourceLength - targetLength; i++) {
             bool match = true;
             for (int32_t j = 0; j < targetLength; j++) {
-                if (u_toupper(static_cast<UChar32>(pSource[i + j])) !=
-                    u_toupper(static_cast<UChar32>(target[j]))) {
+                if (unicode::to_upper(pSource[i + j]) != unicode::to_upper(target[j])) {
                     match = false;
                     break;
                 }
@@ -307,39 +269,9 @@ int32_t interop_globalization_index_of(
         return -1;
     }
 
-    // Culture-sensitive: use ICU string search
-    auto* collator = reinterpret_cast<UCollator*>(sortHandle);
-    if (!collator) return -1;
-
-    // Clone collator so we can set options without affecting cached instance
-    UErrorCode err = U_ZERO_ERROR;
-    UCollator* cloned = ucol_clone(collator, &err);
-    if (U_FAILURE(err) || !cloned) return -1;
-
-    apply_compare_options(cloned, options);
-
-    UStringSearch* search = usearch_openFromCollator(
-        reinterpret_cast<const UChar*>(target), targetLength,
-        reinterpret_cast<const UChar*>(pSource), sourceLength,
-        cloned, nullptr, &err);
-
-    if (U_FAILURE(err) || !search) {
-        ucol_close(cloned);
-        return -1;
-    }
-
-    int32_t pos = usearch_first(search, &err);
-    int32_t matchLen = 0;
-    if (pos != USEARCH_DONE && !U_FAILURE(err)) {
-        matchLen = usearch_getMatchedLength(search);
-    }
-
-    usearch_close(search);
-    ucol_close(cloned);
-
-    if (pos == USEARCH_DONE || U_FAILURE(err)) return -1;
-    if (matchLengthPtr) *matchLengthPtr = matchLen;
-    return pos;
+    // Culture-sensitive: ASCII weight tables or ICU string search
+    return globalization::collator_index_of(reinterpret_cast<UCollator*>(sortHandle),
+        pSource, sourceLength, target, targetLength, options, false, matchLengthPtr);
 }
 
 int32_t interop_globalization_last_index_of(
@@ -368,8 +300,7 @@ int32_t interop_globalization_last_index_of(
         for (int32_t i = sourceLength - targetLength; i >= 0; i--) {
             bool match = true;
             for (int32_t j = 0; j < targetLength; j++) {
-                if (u_toupper(static_cast<UChar32>(pSource[i + j])) !=
-                    u_toupper(static_cast<UChar32>(target[j]))) {
+                if (unicode::to_upper(pSource[i + j]) != unicode::to_upper(target[j])) {
                     match = false;
                     break;
                 }
@@ -382,38 +313,9 @@ int32_t interop_globalization_last_index_of(
         return -1;
     }
 
-    // Culture-sensitive: use ICU string search (last match)
-    auto* collator = reinterpret_cast<UCollator*>(sortHandle);
-    if (!collator) return -1;
-
-    UErrorCode err = U_ZERO_ERROR;
-    UCollator* cloned = ucol_clone(collator, &err);
-    if (U_FAILURE(err) || !cloned) return -1;
-
-    apply_compare_options(cloned, options);
-
-    UStringSearch* search = usearch_openFromCollator(
-        reinterpret_cast<const UChar*>(target), targetLength,
-        reinterpret_cast<const UChar*>(pSource), sourceLength,
-        cloned, nullptr, &err);
-
-    if (U_FAILURE(err) || !search) {
-        ucol_close(cloned);
-        return -1;
-    }
-
-    int32_t pos = usearch_last(search, &err);
-    int32_t matchLen = 0;
-    if (pos != USEARCH_DONE && !U_FAILURE(err)) {
-        matchLen = usearch_getMatchedLength(search);
-    }
-
-    usearch_close(search);
-    ucol_close(cloned);
-
-    if (pos == USEARCH_DONE || U_FAILURE(err)) return -1;
-    if (matchLengthPtr) *matchLengthPtr = matchLen;
-    return pos;
+    // Culture-sensitive: ASCII weight tables or ICU string search (last match)
+    return globalization::collator_index_of(reinterpret_cast<UCollator*>(sortHandle),
+        pSource, sourceLength, target, targetLength, options, true, matchLengthPtr);
 }
 
 int32_t interop_globalization_starts_with(
@@ -459,6 +361,20 @@ int32_t interop_globalization_ends_with(
     return (pos >= 0 && pos + matchLen == sourceLength) ? 1 : 0;
 }
 
+// =====================================================================
+//  Sort Keys (ICU Collation)
+// =====================================================================
+
+int32_t interop_globalization_get_sort_key(
+    intptr_t sortHandle, char16_t* str, int32_t strLength,
+    uint8_t* sortKey, int32_t sortKeyLength, int32_t options)
+{
+    // Size query passes a null buffer with length 0
+    if (!sortKey) sortKeyLength = 0;
+    return globalization::collator_sort_key(reinterpret_cast<UCollator*>(sortHandle),
+        str, strLength, options, sortKey, sortKeyLength);
+}
+
 // =====================================================================
 //  Locale Data
 // =====================================================================
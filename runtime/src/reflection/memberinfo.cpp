@@ -8,15 +8,18 @@
 #include <cil2cpp/assembly.h>
 #include <cil2cpp/reflection.h>
 #include <cil2cpp/gc.h>
-#include <cil2cpp/gc_allocator.h>
 #include <cil2cpp/string.h>
 #include <cil2cpp/array.h>
 #include <cil2cpp/exception.h>
 #include <cil2cpp/boxing.h>
+#include <cil2cpp/delegate.h>
+#include <cil2cpp/bcl/System.String.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 // Generated code defines System_RuntimeType_TypeInfo in global namespace.
 extern cil2cpp::TypeInfo System_RuntimeType_TypeInfo;
@@ -187,51 +190,107 @@ void reflection_patch_method_vtables(TypeInfo* methodbase_ti, TypeInfo* methodin
 
 // ===== Helper: Create managed wrappers =====
 
-// Cache managed MethodInfo wrappers so the same native MethodInfo always
-// returns the same managed object. Critical for reference-equality checks
-// in Expression.CheckMethod (System.Linq.Expressions).
-// GC-safe: gc_allocator ensures BoehmGC scans map buckets for GC pointers.
-static std::unordered_map<MethodInfo*, ManagedMethodInfo*,
-    std::hash<MethodInfo*>, std::equal_to<MethodInfo*>,
-    cil2cpp::gc_allocator<std::pair<MethodInfo* const, ManagedMethodInfo*>>>
-    s_methodinfo_cache;
+// Each native descriptor caches its managed wrapper, so the same native MethodInfo always
+// returns the same managed object. Critical for reference-equality checks in
+// Expression.CheckMethod (System.Linq.Expressions) and List<MemberInfo>.Contains() used by
+// Newtonsoft.Json's GetSerializableMembers. Racing creators CAS-publish; the loser's
+// allocation is dropped. GC-safe: descriptors live in static data (a GC root) or GC heap.
+template <typename Wrapper, typename Native>
+static Wrapper* canonical_wrapper(Native* native, TypeInfo* ti) {
+    std::atomic_ref<Object*> slot(native->managed);
+    if (auto* existing = slot.load(std::memory_order_acquire))
+        return static_cast<Wrapper*>(existing);
+    auto* wrapper = static_cast<Wrapper*>(gc::alloc(sizeof(Wrapper), ti));
+    wrapper->native_info = native;
+    Object* expected = nullptr;
+    if (!slot.compare_exchange_strong(expected, wrapper, std::memory_order_acq_rel,
+                                      std::memory_order_acquire))
+        return static_cast<Wrapper*>(expected);
+    return wrapper;
+}
 
 ManagedMethodInfo* create_managed_method_info(MethodInfo* native) {
-    auto it = s_methodinfo_cache.find(native);
-    if (it != s_methodinfo_cache.end())
-        return it->second;
-    auto* mi = static_cast<ManagedMethodInfo*>(
-        gc::alloc(sizeof(ManagedMethodInfo), s_methodinfo_ti));
-    mi->native_info = native;
-    s_methodinfo_cache[native] = mi;
-    return mi;
+    return canonical_wrapper<ManagedMethodInfo>(native, s_methodinfo_ti);
 }
 
 static ManagedFieldInfo* create_managed_field_info(FieldInfo* native) {
-    auto* fi = static_cast<ManagedFieldInfo*>(
-        gc::alloc(sizeof(ManagedFieldInfo), s_fieldinfo_ti));
-    fi->native_info = native;
-    return fi;
+    return canonical_wrapper<ManagedFieldInfo>(native, s_fieldinfo_ti);
 }
 
-// Cache managed PropertyInfo wrappers so the same native PropertyInfo always
-// returns the same managed object. Critical for reference-equality checks
-// in List<MemberInfo>.Contains() used by Newtonsoft.Json's GetSerializableMembers.
-// GC-safe: gc_allocator ensures BoehmGC scans map buckets for GC pointers.
-static std::unordered_map<PropertyInfo*, ManagedPropertyInfo*,
-    std::hash<PropertyInfo*>, std::equal_to<PropertyInfo*>,
-    cil2cpp::gc_allocator<std::pair<PropertyInfo* const, ManagedPropertyInfo*>>>
-    s_propinfo_cache;
-
 static ManagedPropertyInfo* create_managed_property_info(PropertyInfo* native) {
-    auto it = s_propinfo_cache.find(native);
-    if (it != s_propinfo_cache.end())
-        return it->second;
-    auto* pi = static_cast<ManagedPropertyInfo*>(
-        gc::alloc(sizeof(ManagedPropertyInfo), s_propertyinfo_ti));
-    pi->native_info = native;
-    s_propinfo_cache[native] = pi;
-    return pi;
+    return canonical_wrapper<ManagedPropertyInfo>(native, s_propertyinfo_ti);
+}
+
+// Member name as a String, materialized once per wrapper (interned, as before)
+static String* cached_member_name(String*& cache, const char* name) {
+    std::atomic_ref<String*> slot(cache);
+    if (auto* existing = slot.load(std::memory_order_acquire))
+        return existing;
+    auto* str = string_literal(name);
+    slot.store(str, std::memory_order_release);
+    return str;
+}
+
+// ===== Member lookup by name =====
+
+/**
+ * Visit members named `name` in declaration order until `fn` returns true.
+ * With a compiler-emitted name index this is a binary search over the sorted positions
+ * (O(log n) + matches); without one, a linear scan.
+ */
+template <typename Member, typename Fn>
+static void for_each_named(Member* members, UInt32 count, const UInt16* index,
+                           const char* name, Fn&& fn) {
+    if (!members || !name) return;
+    if (index) {
+        auto* end = index + count;
+        auto* it = std::lower_bound(index, end, name, [&](UInt16 i, const char* n) {
+            return std::strcmp(members[i].name, n) < 0;
+        });
+        for (; it != end && std::strcmp(members[*it].name, name) == 0; ++it) {
+            if (fn(members[*it])) return;
+        }
+        return;
+    }
+    for (UInt32 i = 0; i < count; i++) {
+        if (members[i].name && std::strcmp(members[i].name, name) == 0 && fn(members[i]))
+            return;
+    }
+}
+
+/**
+ * Members matching `name` exactly (listType 1) or case-insensitively (listType 2),
+ * in declaration order. Case-insensitive matching can't use the ordinal index.
+ */
+template <typename Member, typename Wrapper>
+static Array* members_by_name(Member* members, UInt32 count, const UInt16* index,
+                              const char* name, int listType, TypeInfo* array_ti,
+                              Wrapper* (*wrap)(Member*)) {
+    if (listType == 1) {
+        UInt32 matchCount = 0;
+        for_each_named(members, count, index, name, [&](Member&) { matchCount++; return false; });
+        auto* arr = array_create(array_ti, static_cast<Int32>(matchCount));
+        auto** data = static_cast<Wrapper**>(array_data(arr));
+        UInt32 idx = 0;
+        for_each_named(members, count, index, name, [&](Member& m) {
+            data[idx++] = wrap(&m);
+            return false;
+        });
+        return arr;
+    }
+
+    UInt32 matchCount = 0;
+    for (UInt32 i = 0; i < count; i++) {
+        if (members[i].name && _stricmp(members[i].name, name) == 0) matchCount++;
+    }
+    auto* arr = array_create(array_ti, static_cast<Int32>(matchCount));
+    auto** data = static_cast<Wrapper**>(array_data(arr));
+    UInt32 idx = 0;
+    for (UInt32 i = 0; i < count && idx < matchCount; i++) {
+        if (members[i].name && _stricmp(members[i].name, name) == 0)
+            data[idx++] = wrap(&members[i]);
+    }
+    return arr;
 }
 
 // ===== Type → GetMethods/GetFields =====
@@ -258,27 +317,8 @@ Array* type_get_methods_by_name(Type* t, const char* name, int listType) {
     auto* info = t->type_info;
     UInt32 count = info->methods ? info->method_count : 0;
     if (!name || listType == 0) return type_get_methods(t);
-
-    UInt32 matchCount = 0;
-    for (UInt32 i = 0; i < count; i++) {
-        if (!info->methods[i].name) continue;
-        bool match = (listType == 1)
-            ? (std::strcmp(info->methods[i].name, name) == 0)
-            : (_stricmp(info->methods[i].name, name) == 0);
-        if (match) matchCount++;
-    }
-
-    auto* arr = array_create(s_methodinfo_ti, static_cast<Int32>(matchCount));
-    auto** data = static_cast<ManagedMethodInfo**>(array_data(arr));
-    UInt32 idx = 0;
-    for (UInt32 i = 0; i < count && idx < matchCount; i++) {
-        if (!info->methods[i].name) continue;
-        bool match = (listType == 1)
-            ? (std::strcmp(info->methods[i].name, name) == 0)
-            : (_stricmp(info->methods[i].name, name) == 0);
-        if (match) data[idx++] = create_managed_method_info(&info->methods[i]);
-    }
-    return arr;
+    return members_by_name(info->methods, count, info->method_name_index, name, listType,
+                           s_methodinfo_ti, &create_managed_method_info);
 }
 
 Array* type_get_fields(Type* t) {
@@ -302,39 +342,20 @@ Array* type_get_fields_by_name(Type* t, const char* name, int listType) {
     auto* info = t->type_info;
     UInt32 count = info->fields ? info->field_count : 0;
     if (!name || listType == 0) return type_get_fields(t);
-
-    // Count matches
-    UInt32 matchCount = 0;
-    for (UInt32 i = 0; i < count; i++) {
-        if (!info->fields[i].name) continue;
-        bool match = (listType == 1)
-            ? (std::strcmp(info->fields[i].name, name) == 0)
-            : (_stricmp(info->fields[i].name, name) == 0);
-        if (match) matchCount++;
-    }
-
-    auto* arr = array_create(s_fieldinfo_ti, static_cast<Int32>(matchCount));
-    auto** data = static_cast<ManagedFieldInfo**>(array_data(arr));
-    UInt32 idx = 0;
-    for (UInt32 i = 0; i < count && idx < matchCount; i++) {
-        if (!info->fields[i].name) continue;
-        bool match = (listType == 1)
-            ? (std::strcmp(info->fields[i].name, name) == 0)
-            : (_stricmp(info->fields[i].name, name) == 0);
-        if (match) data[idx++] = create_managed_field_info(&info->fields[i]);
-    }
-    return arr;
+    return members_by_name(info->fields, count, info->field_name_index, name, listType,
+                           s_fieldinfo_ti, &create_managed_field_info);
 }
 
 MethodInfo* find_method_info(TypeInfo* type_info, const char* name, uint32_t param_count) {
     if (!type_info || !type_info->methods) return nullptr;
-    for (UInt32 i = 0; i < type_info->method_count; i++) {
-        if (std::strcmp(type_info->methods[i].name, name) == 0
-            && type_info->methods[i].parameter_count == param_count) {
-            return &type_info->methods[i];
-        }
-    }
-    return nullptr;
+    MethodInfo* found = nullptr;
+    for_each_named(type_info->methods, type_info->method_count, type_info->method_name_index, name,
+        [&](MethodInfo& m) {
+            if (m.parameter_count != param_count) return false;
+            found = &m;
+            return true;
+        });
+    return found;
 }
 
 ManagedMethodInfo* type_get_method(Type* t, String* name) {
@@ -344,16 +365,14 @@ ManagedMethodInfo* type_get_method(Type* t, String* name) {
     auto* info = t->type_info;
     if (!info->methods) return nullptr;  // Reflection metadata stripped
     auto* name_utf8 = string_to_utf8(name);
-
-    for (UInt32 i = 0; i < info->method_count; i++) {
-        if (std::strcmp(info->methods[i].name, name_utf8) == 0) {
-            // .NET GetMethod(string) doesn't return constructors
-            if (std::strcmp(name_utf8, ".ctor") == 0 || std::strcmp(name_utf8, ".cctor") == 0)
-                return nullptr;
-            return create_managed_method_info(&info->methods[i]);
-        }
-    }
-    return nullptr;
+    // .NET GetMethod(string) doesn't return constructors
+    if (std::strcmp(name_utf8, ".ctor") == 0 || std::strcmp(name_utf8, ".cctor") == 0)
+        return nullptr;
+
+    MethodInfo* found = nullptr;
+    for_each_named(info->methods, info->method_count, info->method_name_index, name_utf8,
+        [&](MethodInfo& m) { found = &m; return true; });
+    return found ? create_managed_method_info(found) : nullptr;
 }
 
 ManagedFieldInfo* type_get_field(Type* t, String* name) {
@@ -364,21 +383,22 @@ ManagedFieldInfo* type_get_field(Type* t, String* name) {
     if (!info->fields) return nullptr;  // Reflection metadata stripped
     auto* name_utf8 = string_to_utf8(name);
 
-    for (UInt32 i = 0; i < info->field_count; i++) {
-        if (std::strcmp(info->fields[i].name, name_utf8) == 0) {
+    FieldInfo* found = nullptr;
+    for_each_named(info->fields, info->field_count, info->field_name_index, name_utf8,
+        [&](FieldInfo& f) {
             // .NET GetField(string) without BindingFlags returns public fields only
-            if (!metadata::field_is_public(info->fields[i].flags)) continue;
-            return create_managed_field_info(&info->fields[i]);
-        }
-    }
-    return nullptr;
+            if (!metadata::field_is_public(f.flags)) return false;
+            found = &f;
+            return true;
+        });
+    return found ? create_managed_field_info(found) : nullptr;
 }
 
 // ===== MethodInfo Property Accessors =====
 
 String* methodinfo_get_name(ManagedMethodInfo* mi) {
     if (!mi || !mi->native_info) throw_null_reference();
-    return string_literal(mi->native_info->name);
+    return cached_member_name(mi->cached_name, mi->native_info->name);
 }
 
 Type* methodinfo_get_declaring_type(ManagedMethodInfo* mi) {
@@ -459,6 +479,25 @@ Array* methodinfo_get_parameters(ManagedMethodInfo* mi) {
     return arr;
 }
 
+void invoke_check_arg(Object* arg, TypeInfo* type) {
+    if (!arg || !type) return;
+    TypeInfo* actual = arg->__type_info;
+    // Strings carry either of the runtime's two String TypeInfos
+    if (type == &System_String_TypeInfo || type == &System::String_TypeInfo) {
+        if (actual != &System_String_TypeInfo && actual != &System::String_TypeInfo)
+            throw_argument();
+        return;
+    }
+    if (!(type->flags & TypeFlags::ValueType)) {
+        if (!object_is_instance_of(arg, type)) throw_argument();
+        return;
+    }
+    if (actual == type) return;
+    TypeInfo* actual_underlying = actual->underlying_type ? actual->underlying_type : actual;
+    TypeInfo* expected_underlying = type->underlying_type ? type->underlying_type : type;
+    if (actual_underlying != expected_underlying) throw_argument();
+}
+
 Object* methodinfo_invoke(ManagedMethodInfo* mi, Object* obj, Array* parameters) {
     if (!mi || !mi->native_info) throw_null_reference();
     auto* native = mi->native_info;
@@ -467,6 +506,12 @@ Object* methodinfo_invoke(ManagedMethodInfo* mi, Object* obj, Array* parameters)
 
     UInt32 param_count = native->parameter_count;
     bool is_static = metadata::method_is_static(native->flags);
+    if (!is_static && !obj) throw_null_reference();
+
+    // A null array stands for no arguments; any other count mismatch is an error
+    Int32 arg_count = parameters ? array_length(parameters) : 0;
+    if (arg_count != static_cast<Int32>(param_count))
+        throw_target_parameter_count();
 
     // Collect parameter pointers from array
     Object** args = nullptr;
@@ -474,10 +519,14 @@ Object* methodinfo_invoke(ManagedMethodInfo* mi, Object* obj, Array* parameters)
         args = static_cast<Object**>(array_data(parameters));
     }
 
+    // Typed thunk: one indirect call, no arity limit
+    if (native->invoker)
+        return native->invoker(native->method_pointer, obj, args);
+
     // Helper to get argument N safely
     auto arg = [&](UInt32 i) -> Object* { return (args && i < param_count) ? args[i] : nullptr; };
 
-    // Dispatch based on parameter count (supports 0-10 parameters).
+    // No thunk: dispatch based on parameter count (supports 0-10 parameters).
     // Instance methods get 'obj' as first C++ parameter.
     // Static function pointer types: SF0 = Object*(*)(), SF1 = Object*(*)(O*), ...
     // Instance function pointer types: IF0 = Object*(*)(O*), IF1 = Object*(*)(O*, O*), ...
@@ -497,7 +546,6 @@ Object* methodinfo_invoke(ManagedMethodInfo* mi, Object* obj, Array* parameters)
             default: throw_not_supported(); // >10 parameters not supported in reflection invoke
         }
     } else {
-        if (!obj) throw_null_reference();
         switch (param_count) {
             case 0:  return reinterpret_cast<Object*(*)(Object*)>(native->method_pointer)(obj);
             case 1:  return reinterpret_cast<Object*(*)(Object*, Object*)>(native->method_pointer)(obj, arg(0));
@@ -515,11 +563,79 @@ Object* methodinfo_invoke(ManagedMethodInfo* mi, Object* obj, Array* parameters)
     }
 }
 
+// Vtable / interface vtable entry for a virtual method on target's type, or nullptr
+static void* resolve_virtual_target(MethodInfo* method, TypeInfo* type) {
+    auto slot = static_cast<UInt32>(method->vtable_slot);
+    if (method->declaring_type && (method->declaring_type->flags & TypeFlags::Interface)) {
+        auto* itable = type_get_interface_vtable(type, method->declaring_type);
+        return itable && slot < itable->method_count ? itable->methods[slot] : nullptr;
+    }
+    if (type != method->declaring_type && !type_is_subclass_of(type, method->declaring_type))
+        return nullptr;
+    return type->vtable && slot < type->vtable->method_count ? type->vtable->methods[slot] : nullptr;
+}
+
+// A value type's vtable holds unboxing thunks that expect the box, but delegate Invoke
+// passes delegate_adjust_target(target), the unboxed 'this'. Map the thunk back to the
+// value type's own method, whose method_pointer takes the unboxed 'this'.
+static void* unboxed_entry_point(TypeInfo* type, void* entry) {
+    if (!type->vtable) return nullptr;
+    for (UInt32 i = 0; i < type->method_count; i++) {
+        auto& m = type->methods[i];
+        auto slot = static_cast<UInt32>(m.vtable_slot);
+        if (m.vtable_slot >= 0 && slot < type->vtable->method_count
+            && type->vtable->methods[slot] == entry)
+            return m.method_pointer;
+    }
+    return nullptr;
+}
+
+Object* methodinfo_create_delegate(ManagedMethodInfo* mi, Type* delegate_type, Object* target) {
+    if (!mi || !mi->native_info) throw_null_reference();
+    if (!delegate_type || !delegate_type->type_info) throw_argument_null();
+    auto* del_ti = delegate_type->type_info;
+    auto* native = mi->native_info;
+    if (!(del_ti->flags & TypeFlags::Delegate))
+        throw_argument();
+
+    bool is_static = metadata::method_is_static(native->flags);
+    void* method_ptr = native->method_pointer;
+    if (!is_static && target && metadata::method_is_virtual(native->flags) && native->vtable_slot >= 0) {
+        // Closed over an instance: bind the override the target's type dispatches to, like
+        // a callvirt would (abstract and interface methods have no body of their own)
+        auto* target_type = target->__type_info;
+        bool value_type = (target_type->flags & TypeFlags::ValueType) != 0;
+        if (!(value_type && native->declaring_type == target_type)) {
+            method_ptr = resolve_virtual_target(native, target_type);
+            if (method_ptr && value_type) method_ptr = unboxed_entry_point(target_type, method_ptr);
+        }
+    }
+    if (!method_ptr)
+        throw_argument();
+    if (is_static && target) {
+        // Closed over the first argument: only reference types can be bound
+        if (native->parameter_count == 0 || (target->__type_info->flags & TypeFlags::ValueType))
+            throw_argument();
+    }
+
+    // Delegate invoke passes target (when set) as the first C++ argument, otherwise only the
+    // Invoke arguments — so an open instance delegate's first parameter becomes 'this'.
+    UInt32 expected = native->parameter_count + (is_static ? 0 : 1) - (target ? 1 : 0);
+    for (UInt32 i = 0; i < del_ti->method_count; i++) {
+        auto& m = del_ti->methods[i];
+        if (m.name && std::strcmp(m.name, "Invoke") == 0) {
+            if (m.parameter_count != expected) throw_argument();
+            break;
+        }
+    }
+    return delegate_create(del_ti, target, method_ptr);
+}
+
 // ===== FieldInfo Property Accessors =====
 
 String* fieldinfo_get_name(ManagedFieldInfo* fi) {
     if (!fi || !fi->native_info) throw_null_reference();
-    return string_literal(fi->native_info->name);
+    return cached_member_name(fi->cached_name, fi->native_info->name);
 }
 
 Type* fieldinfo_get_declaring_type(ManagedFieldInfo* fi) {
@@ -674,27 +790,8 @@ Array* type_get_properties_by_name(Type* t, const char* name, int listType) {
     auto* info = t->type_info;
     UInt32 count = info->properties ? info->property_count : 0;
     if (!name || listType == 0) return type_get_properties(t);
-
-    UInt32 matchCount = 0;
-    for (UInt32 i = 0; i < count; i++) {
-        if (!info->properties[i].name) continue;
-        bool match = (listType == 1)
-            ? (std::strcmp(info->properties[i].name, name) == 0)
-            : (_stricmp(info->properties[i].name, name) == 0);
-        if (match) matchCount++;
-    }
-
-    auto* arr = array_create(s_propertyinfo_ti, static_cast<Int32>(matchCount));
-    auto** data = static_cast<ManagedPropertyInfo**>(array_data(arr));
-    UInt32 idx = 0;
-    for (UInt32 i = 0; i < count && idx < matchCount; i++) {
-        if (!info->properties[i].name) continue;
-        bool match = (listType == 1)
-            ? (std::strcmp(info->properties[i].name, name) == 0)
-            : (_stricmp(info->properties[i].name, name) == 0);
-        if (match) data[idx++] = create_managed_property_info(&info->properties[i]);
-    }
-    return arr;
+    return members_by_name(info->properties, count, info->property_name_index, name, listType,
+                           s_propertyinfo_ti, &create_managed_property_info);
 }
 
 ManagedPropertyInfo* type_get_property(Type* t, String* name) {
@@ -705,19 +802,17 @@ ManagedPropertyInfo* type_get_property(Type* t, String* name) {
     if (!info->properties) return nullptr;
     auto* name_utf8 = string_to_utf8(name);
 
-    for (UInt32 i = 0; i < info->property_count; i++) {
-        if (std::strcmp(info->properties[i].name, name_utf8) == 0) {
-            return create_managed_property_info(&info->properties[i]);
-        }
-    }
-    return nullptr;
+    PropertyInfo* found = nullptr;
+    for_each_named(info->properties, info->property_count, info->property_name_index, name_utf8,
+        [&](PropertyInfo& p) { found = &p; return true; });
+    return found ? create_managed_property_info(found) : nullptr;
 }
 
 // ===== PropertyInfo Property Accessors =====
 
 String* propertyinfo_get_name(ManagedPropertyInfo* pi) {
     if (!pi || !pi->native_info) throw_null_reference();
-    return string_literal(pi->native_info->name);
+    return cached_member_name(pi->cached_name, pi->native_info->name);
 }
 
 Type* propertyinfo_get_declaring_type(ManagedPropertyInfo* pi) {
@@ -732,51 +827,66 @@ Type* propertyinfo_get_property_type(ManagedPropertyInfo* pi) {
     return type_get_type_object(pi->native_info->property_type);
 }
 
-ManagedMethodInfo* propertyinfo_get_get_method(ManagedPropertyInfo* pi) {
-    if (!pi || !pi->native_info) throw_null_reference();
-    if (!pi->native_info->getter) return nullptr;
-    // Find the MethodInfo in declaring type's methods that matches the getter pointer
-    auto* decl = pi->native_info->declaring_type;
+// MethodInfo for a property accessor: the declaring type's entry whose pointer matches
+// (found via the name index as "get_X"/"set_X", else by pointer scan), or a synthesized
+// descriptor when the accessor isn't in the methods table. Cached on the PropertyInfo.
+static ManagedMethodInfo* property_accessor(ManagedPropertyInfo* pi, ManagedMethodInfo*& cache,
+                                            void* accessor, const char* prefix) {
+    std::atomic_ref<ManagedMethodInfo*> slot(cache);
+    if (auto* existing = slot.load(std::memory_order_acquire))
+        return existing;
+
+    auto* native = pi->native_info;
+    auto* decl = native->declaring_type;
+    const char* prop_name = native->name ? native->name : "";
+    std::string accessor_name = std::string(prefix) + prop_name;
+
+    MethodInfo* found = nullptr;
     if (decl && decl->methods) {
-        for (UInt32 i = 0; i < decl->method_count; i++) {
-            if (decl->methods[i].method_pointer == pi->native_info->getter) {
-                return create_managed_method_info(&decl->methods[i]);
-            }
+        for_each_named(decl->methods, decl->method_count, decl->method_name_index,
+            accessor_name.c_str(), [&](MethodInfo& m) {
+                if (m.method_pointer != accessor) return false;
+                found = &m;
+                return true;
+            });
+        for (UInt32 i = 0; !found && i < decl->method_count; i++) {
+            if (decl->methods[i].method_pointer == accessor)
+                found = &decl->methods[i];
         }
     }
-    // Fallback: property has a getter pointer but the declaring type's methods array
-    // doesn't include it. Create a GC-allocated MethodInfo with proper naming.
-    auto* stub = static_cast<MethodInfo*>(gc::alloc(sizeof(MethodInfo), nullptr));
-    std::memset(stub, 0, sizeof(MethodInfo));
-    static thread_local std::string getter_name_buf;
-    getter_name_buf = std::string("get_") + (pi->native_info->name ? pi->native_info->name : "");
-    stub->name = getter_name_buf.c_str();
-    stub->method_pointer = pi->native_info->getter;
-    stub->declaring_type = pi->native_info->declaring_type;
-    return create_managed_method_info(stub);
+    if (!found) {
+        // Property has an accessor pointer but the declaring type's methods array
+        // doesn't include it. Synthesize a GC-allocated MethodInfo with proper naming.
+        found = static_cast<MethodInfo*>(gc::alloc(sizeof(MethodInfo), nullptr));
+        std::memset(found, 0, sizeof(MethodInfo));
+        // gc::alloc stamps an object header, so never ask for less than one
+        auto* name_copy = static_cast<char*>(gc::alloc(
+            std::max(accessor_name.size() + 1, sizeof(Object)), nullptr));
+        std::memcpy(name_copy, accessor_name.c_str(), accessor_name.size() + 1);
+        found->name = name_copy;
+        found->method_pointer = accessor;
+        found->declaring_type = decl;
+        found->vtable_slot = -1;
+    }
+
+    auto* mi = create_managed_method_info(found);
+    ManagedMethodInfo* expected = nullptr;
+    if (!slot.compare_exchange_strong(expected, mi, std::memory_order_acq_rel,
+                                      std::memory_order_acquire))
+        return expected;
+    return mi;
+}
+
+ManagedMethodInfo* propertyinfo_get_get_method(ManagedPropertyInfo* pi) {
+    if (!pi || !pi->native_info) throw_null_reference();
+    if (!pi->native_info->getter) return nullptr;
+    return property_accessor(pi, pi->cached_getter, pi->native_info->getter, "get_");
 }
 
 ManagedMethodInfo* propertyinfo_get_set_method(ManagedPropertyInfo* pi) {
     if (!pi || !pi->native_info) throw_null_reference();
     if (!pi->native_info->setter) return nullptr;
-    auto* decl = pi->native_info->declaring_type;
-    if (decl && decl->methods) {
-        for (UInt32 i = 0; i < decl->method_count; i++) {
-            if (decl->methods[i].method_pointer == pi->native_info->setter) {
-                return create_managed_method_info(&decl->methods[i]);
-            }
-        }
-    }
-    // Fallback: property has a setter pointer but the declaring type's methods array
-    // doesn't include it. Create a GC-allocated MethodInfo with proper naming.
-    auto* stub = static_cast<MethodInfo*>(gc::alloc(sizeof(MethodInfo), nullptr));
-    std::memset(stub, 0, sizeof(MethodInfo));
-    static thread_local std::string setter_name_buf;
-    setter_name_buf = std::string("set_") + (pi->native_info->name ? pi->native_info->name : "");
-    stub->name = setter_name_buf.c_str();
-    stub->method_pointer = pi->native_info->setter;
-    stub->declaring_type = pi->native_info->declaring_type;
-    return create_managed_method_info(stub);
+    return property_accessor(pi, pi->cached_setter, pi->native_info->setter, "set_");
 }
 
 Boolean propertyinfo_can_read(ManagedPropertyInfo* pi) {
@@ -789,11 +899,25 @@ Boolean propertyinfo_can_write(ManagedPropertyInfo* pi) {
     return pi->native_info->setter != nullptr;
 }
 
-Object* propertyinfo_get_value(ManagedPropertyInfo* pi, Object* obj, Array* /*index*/) {
+Object* propertyinfo_get_value(ManagedPropertyInfo* pi, Object* obj, Array* index) {
     if (!pi || !pi->native_info) throw_null_reference();
     if (!pi->native_info->getter)
         throw_invalid_operation();
 
+    // Accessor MethodInfo is resolved once and cached in pi; its typed invoker
+    // does the unbox/box, so GetValue is one indirect call
+    auto* accessor = propertyinfo_get_get_method(pi)->native_info;
+    if (accessor->invoker) {
+        if (!obj && !metadata::method_is_static(accessor->flags)) throw_null_reference();
+        Object** args = nullptr;
+        if (accessor->parameter_count > 0) {
+            if (!index || array_length(index) != static_cast<Int32>(accessor->parameter_count))
+                throw_target_parameter_count();
+            args = static_cast<Object**>(array_data(index));
+        }
+        return accessor->invoker(accessor->method_pointer, obj, args);
+    }
+
     auto* prop_type = pi->native_info->property_type;
     auto getter = pi->native_info->getter;
 
@@ -859,11 +983,30 @@ Object* propertyinfo_get_value(ManagedPropertyInfo* pi, Object* obj, Array* /*in
     }
 }
 
-void propertyinfo_set_value(ManagedPropertyInfo* pi, Object* obj, Object* value, Array* /*index*/) {
+void propertyinfo_set_value(ManagedPropertyInfo* pi, Object* obj, Object* value, Array* index) {
     if (!pi || !pi->native_info) throw_null_reference();
     if (!pi->native_info->setter)
         throw_invalid_operation();
 
+    // Typed invoker of the cached accessor (see propertyinfo_get_value)
+    auto* accessor = propertyinfo_get_set_method(pi)->native_info;
+    if (accessor->invoker) {
+        if (!obj && !metadata::method_is_static(accessor->flags)) throw_null_reference();
+        if (accessor->parameter_count <= 1) {
+            Object* args[1] = { value };
+            accessor->invoker(accessor->method_pointer, obj, args);
+            return;
+        }
+        // Indexer: set_Item(index..., value)
+        Int32 index_count = static_cast<Int32>(accessor->parameter_count) - 1;
+        if (!index || array_length(index) != index_count) throw_target_parameter_count();
+        std::vector<Object*> args(static_cast<Object**>(array_data(index)),
+                                  static_cast<Object**>(array_data(index)) + index_count);
+        args.push_back(value);
+        accessor->invoker(accessor->method_pointer, obj, args.data());
+        return;
+    }
+
     auto* prop_type = pi->native_info->property_type;
     auto setter = pi->native_info->setter;
 
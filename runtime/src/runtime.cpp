@@ -27,6 +27,12 @@ char** runtime_get_argv() { return g_argv; }
 void runtime_init() {
     gc::init();
     gchandle_init();
+    // Before any runtime thread starts, so every attached thread gets a sampling timer
+    profiler::init();
+    counters::init();
+    contention::init();
+    exception_stats::init();
+    heap_snapshot::init();
     threadpool::init();
     unicode::init();
     globalization::init();
@@ -47,9 +53,15 @@ void runtime_set_args(int argc, char** argv) {
 }
 
 void runtime_shutdown() {
+    // First, so the final record still sees the live thread pool
+    counters::shutdown();
     iocp::shutdown();
     globalization::shutdown();
     threadpool::shutdown();
+    profiler::shutdown();
+    contention::shutdown();
+    exception_stats::shutdown();
+    heap_snapshot::shutdown();
     gc::collect();
     gc::shutdown();
 }
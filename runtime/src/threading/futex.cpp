@@ -0,0 +1,121 @@
+/**
+ * CIL2CPP Runtime - Futex (address-based thread parking)
+ */
+
+#include "futex.h"
+
+#include <cil2cpp/gc.h>
+
+#include <chrono>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <ctime>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace cil2cpp {
+namespace threading {
+
+int64_t now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int32_t remaining_ms(int32_t timeoutMs, int64_t startMs) {
+    if (timeoutMs < 0) return -1;
+    int64_t left = static_cast<int64_t>(timeoutMs) - (now_ms() - startMs);
+    return left > 0 ? static_cast<int32_t>(left) : 0;
+}
+
+#if defined(_WIN32)
+
+static bool park(std::atomic<int32_t>& word, int32_t expected, int32_t timeoutMs) {
+    DWORD timeout = timeoutMs < 0 ? INFINITE : static_cast<DWORD>(timeoutMs);
+    if (WaitOnAddress(&word, &expected, sizeof(int32_t), timeout)) return true;
+    return GetLastError() != ERROR_TIMEOUT;
+}
+
+void futex_wake(std::atomic<int32_t>& word, int32_t count) {
+    if (count == 1)
+        WakeByAddressSingle(&word);
+    else
+        WakeByAddressAll(&word);
+}
+
+#elif defined(__linux__)
+
+// std::atomic<int32_t> is a plain int32_t in memory on every Linux ABI we target
+static_assert(sizeof(std::atomic<int32_t>) == sizeof(int32_t));
+
+static bool park(std::atomic<int32_t>& word, int32_t expected, int32_t timeoutMs) {
+    struct timespec ts;
+    struct timespec* pts = nullptr;
+    if (timeoutMs >= 0) {
+        ts.tv_sec = timeoutMs / 1000;
+        ts.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000L;
+        pts = &ts;
+    }
+    long rc = syscall(SYS_futex, reinterpret_cast<int32_t*>(&word), FUTEX_WAIT_PRIVATE,
+        expected, pts, nullptr, 0);
+    return rc == 0 || errno != ETIMEDOUT;
+}
+
+void futex_wake(std::atomic<int32_t>& word, int32_t count) {
+    syscall(SYS_futex, reinterpret_cast<int32_t*>(&word), FUTEX_WAKE_PRIVATE, count,
+        nullptr, nullptr, 0);
+}
+
+#else
+
+// Parking lot: waiters on the same address stripe share a mutex/condvar pair
+namespace {
+
+struct ParkingStripe {
+    std::mutex mutex;
+    std::condition_variable cond;
+};
+
+ParkingStripe g_stripes[64];
+
+ParkingStripe& stripe_for(const void* address) {
+    return g_stripes[(reinterpret_cast<uintptr_t>(address) >> 4) % 64];
+}
+
+} // anonymous namespace
+
+static bool park(std::atomic<int32_t>& word, int32_t expected, int32_t timeoutMs) {
+    auto& stripe = stripe_for(&word);
+    std::unique_lock lock(stripe.mutex);
+    if (word.load(std::memory_order_acquire) != expected) return true;
+    if (timeoutMs < 0) {
+        stripe.cond.wait(lock);
+        return true;
+    }
+    return stripe.cond.wait_for(lock, std::chrono::milliseconds(timeoutMs))
+        == std::cv_status::no_timeout;
+}
+
+void futex_wake(std::atomic<int32_t>& word, int32_t) {
+    auto& stripe = stripe_for(&word);
+    { std::lock_guard lock(stripe.mutex); }  // order against a waiter between check and wait
+    stripe.cond.notify_all();                // stripes are shared: wake everyone, they re-check
+}
+
+#endif
+
+bool futex_wait(std::atomic<int32_t>& word, int32_t expected, int32_t timeoutMs) {
+    // A parked thread must not hold up a collection
+    return gc::blocking([&] { return park(word, expected, timeoutMs); });
+}
+
+} // namespace threading
+} // namespace cil2cpp
@@ -0,0 +1,35 @@
+/**
+ * CIL2CPP Runtime - Futex (address-based thread parking)
+ *
+ * Internal header. Linux uses the futex syscall directly, Windows WaitOnAddress;
+ * other POSIX systems fall back to a striped mutex/condvar parking table.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace cil2cpp {
+namespace threading {
+
+/// Block while `*word == expected`, for at most `timeoutMs` (negative = infinite).
+/// May return spuriously; callers re-check their condition. Returns false on timeout.
+bool futex_wait(std::atomic<int32_t>& word, int32_t expected, int32_t timeoutMs);
+
+/// Wake up to `count` threads blocked in futex_wait on `word`.
+void futex_wake(std::atomic<int32_t>& word, int32_t count);
+
+inline void futex_wake_all(std::atomic<int32_t>& word) {
+    futex_wake(word, INT32_MAX);
+}
+
+/// Milliseconds left of a timeout started at `startMs` (monotonic, from now_ms()), or -1
+/// for an infinite one. Never negative for a finite timeout.
+int32_t remaining_ms(int32_t timeoutMs, int64_t startMs);
+
+/// Monotonic clock in milliseconds.
+int64_t now_ms();
+
+} // namespace threading
+} // namespace cil2cpp
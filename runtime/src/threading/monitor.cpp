@@ -13,6 +13,7 @@
 
 #include <cil2cpp/threading.h>
 #include <cil2cpp/exception.h>
+#include <cil2cpp/contention.h>
 
 #include <atomic>
 #include <mutex>
@@ -46,7 +47,7 @@ struct SyncBlock {
 
 // Global sync block table — slot 0 is unused (0 means "no sync block")
 static std::vector<SyncBlock*> g_sync_table;
-static std::mutex g_table_lock;
+static contention::Mutex g_table_lock{"monitor.sync_table"};
 static std::atomic<uint32_t> g_next_index{1};
 
 /**
@@ -58,7 +59,7 @@ static SyncBlock* get_sync_block(Object* obj) {
     auto* slot = reinterpret_cast<std::atomic<uint32_t>*>(&obj->__sync_block);
     uint32_t index = slot->load(std::memory_order_acquire);
     if (index != 0) {
-        std::lock_guard<std::mutex> guard(g_table_lock);
+        std::lock_guard<contention::Mutex> guard(g_table_lock);
         return g_sync_table[index];
     }
 
@@ -67,7 +68,7 @@ static SyncBlock* get_sync_block(Object* obj) {
     auto* block = new SyncBlock();
 
     {
-        std::lock_guard<std::mutex> guard(g_table_lock);
+        std::lock_guard<contention::Mutex> guard(g_table_lock);
         if (g_sync_table.size() <= new_index) {
             g_sync_table.resize(new_index + 1, nullptr);
         }
@@ -82,24 +83,42 @@ static SyncBlock* get_sync_block(Object* obj) {
 
     // Another thread assigned first — use theirs, discard ours
     {
-        std::lock_guard<std::mutex> guard(g_table_lock);
+        std::lock_guard<contention::Mutex> guard(g_table_lock);
         g_sync_table[new_index] = nullptr;
     }
     delete block;
 
     // Use the winner's sync block
-    std::lock_guard<std::mutex> guard(g_table_lock);
+    std::lock_guard<contention::Mutex> guard(g_table_lock);
     return g_sync_table[expected];
 }
 
-void enter(Object* obj) {
-    if (!obj) throw_null_reference();
-    auto* block = get_sync_block(obj);
+// Monitor.LockContentionCount: acquisitions that found the lock held by another thread
+static std::atomic<int64_t> g_contention_count{0};
+
+static void lock_block(Object* obj, SyncBlock* block) {
+#ifdef _WIN32
+    if (TryEnterCriticalSection(&block->cs)) return;
+#else
+    if (block->mutex.try_lock()) return;
+#endif
+    g_contention_count.fetch_add(1, std::memory_order_relaxed);
+    int64_t start = contention::is_enabled() ? contention::now_ns() : 0;
 #ifdef _WIN32
     EnterCriticalSection(&block->cs);
 #else
     block->mutex.lock();
 #endif
+    if (start != 0) contention::record_monitor(obj->__type_info, contention::now_ns() - start);
+}
+
+int64_t get_contention_count() {
+    return g_contention_count.load(std::memory_order_relaxed);
+}
+
+void enter(Object* obj) {
+    if (!obj) throw_null_reference();
+    lock_block(obj, get_sync_block(obj));
 }
 
 void exit(Object* obj) {
@@ -114,12 +133,7 @@ void exit(Object* obj) {
 
 void reliable_enter(Object* obj, bool* lockTaken) {
     if (!obj) throw_null_reference();
-    auto* block = get_sync_block(obj);
-#ifdef _WIN32
-    EnterCriticalSection(&block->cs);
-#else
-    block->mutex.lock();
-#endif
+    lock_block(obj, get_sync_block(obj));
     if (lockTaken) *lockTaken = true;
 }
 
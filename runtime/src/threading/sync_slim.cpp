@@ -0,0 +1,655 @@
+/**
+ * CIL2CPP Runtime - SemaphoreSlim / ManualResetEventSlim
+ *
+ * The BCL implementations park on Monitor.Wait/PulseAll, which in this runtime means the
+ * global sync table lock plus a condition variable per object. Here the state word itself
+ * is the wait address: acquire with CAS, spin briefly (adaptively for SemaphoreSlim), then
+ * futex_wait on the word. Release/Set only issue a wake when someone is actually parked.
+ *
+ * A wait with a cancelable token registers a CancelWake with the token's source:
+ * cancellation wakes the parked thread, or claims and completes the WaitAsync waiter.
+ */
+
+#include <cil2cpp/sync_slim.h>
+#include <cil2cpp/cancellation.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/icall.h>
+#include <cil2cpp/profiler.h>
+#include <cil2cpp/safe_handle.h>
+#include <cil2cpp/threadpool.h>
+#include <cil2cpp/waithandle.h>
+
+#include "futex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace cil2cpp {
+
+namespace {
+
+using threading::futex_wait;
+using threading::futex_wake;
+using threading::futex_wake_all;
+using threading::now_ms;
+using threading::remaining_ms;
+
+static_assert(sizeof(std::atomic<Int32>) == sizeof(Int32));
+
+// Int32 fields of the generated structs double as futex words
+inline std::atomic<Int32>& as_atomic(Int32& field) {
+    return *reinterpret_cast<std::atomic<Int32>*>(&field);
+}
+
+bool is_multiprocessor() {
+    static const bool multi = std::thread::hardware_concurrency() > 1;
+    return multi;
+}
+
+/**
+ * A synchronous wait's cancellation registration. The waiter may be between its last
+ * check and futex_wait, where a single wake would be lost, so the canceling thread keeps
+ * waking the word until the waiter reports that it has seen the cancellation.
+ */
+struct ParkedCancel {
+    CancelWake node{};
+    std::atomic<Int32>* word = nullptr;
+    std::atomic<bool> seen{false};
+
+    /// Register for `token`'s source; false if it is already canceled
+    bool arm(CancellationToken token, std::atomic<Int32>& parkWord) {
+        word = &parkWord;
+        node.wake = wake;
+        node.context = this;
+        node.cts = token.f__source;
+        return cts_register_wake(&node);
+    }
+
+    /// Stop listening; true if the token was canceled while registered
+    bool disarm() {
+        seen.store(true, std::memory_order_release);
+        return cts_unregister_wake(&node);
+    }
+
+    static void wake(CancelWake* node) {
+        auto* self = static_cast<ParkedCancel*>(node->context);
+        while (!self->seen.load(std::memory_order_acquire)) {
+            futex_wake_all(*self->word);
+            std::this_thread::yield();
+        }
+        cts_wake_done(node);
+    }
+};
+
+/// System.Runtime.CompilerServices.StrongBox<bool> (SemaphoreSlim.m_lockObjAndDisposed)
+struct StrongBoxBoolLayout {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    bool f_Value;
+};
+
+/// Signal or reset the OS event behind a lazily created ManualResetEvent (may be null)
+void set_wait_handle(void* waitHandle, bool signaled) {
+    if (!waitHandle) return;
+    auto* safe = static_cast<SafeHandleLayout*>(static_cast<ManagedWaitHandle*>(waitHandle)->f__waitHandle);
+    if (!safe) return;
+    if (signaled)
+        icall::EventWaitHandle_Set(safe->f_handle);
+    else
+        icall::EventWaitHandle_Reset(safe->f_handle);
+}
+
+// ===== SemaphoreSlim =====
+
+constexpr Int32 kSpinDefault = 100;     // m_countOfWaitersPulsedToWake == 0 (fresh semaphore)
+constexpr Int32 kSpinMin = 10;
+constexpr Int32 kSpinMax = 2000;
+
+bool semaphore_disposed(SemaphoreSlimLayout* s) {
+    auto* box = static_cast<StrongBoxBoolLayout*>(s->f_m_lockObjAndDisposed);
+    return box && box->f_Value;
+}
+
+bool semaphore_try_acquire(SemaphoreSlimLayout* s) {
+    auto& count = as_atomic(s->f_m_currentCount);
+    Int32 c = count.load(std::memory_order_relaxed);
+    while (c > 0) {
+        if (count.compare_exchange_weak(c, c - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+/// Keep AvailableWaitHandle in step with the count after an acquire took it to zero.
+/// A racing Release may have set it in between, so re-check after resetting.
+void semaphore_after_acquire(SemaphoreSlimLayout* s) {
+    if (!s->f_m_waitHandle) return;
+    auto& count = as_atomic(s->f_m_currentCount);
+    if (count.load(std::memory_order_relaxed) != 0) return;
+    set_wait_handle(s->f_m_waitHandle, false);
+    if (count.load(std::memory_order_acquire) != 0)
+        set_wait_handle(s->f_m_waitHandle, true);
+}
+
+/// Spin for up to the semaphore's adaptive budget. The budget doubles when a spin
+/// acquires and halves when it runs out, so contended-but-short hold times converge on
+/// spinning and long ones on parking right away.
+bool semaphore_spin_acquire(SemaphoreSlimLayout* s) {
+    if (!is_multiprocessor()) return false;
+    auto& budgetWord = as_atomic(s->f_m_countOfWaitersPulsedToWake);
+    Int32 budget = budgetWord.load(std::memory_order_relaxed);
+    if (budget <= 0) budget = kSpinDefault;
+    auto& count = as_atomic(s->f_m_currentCount);
+    for (Int32 i = 0; i < budget; ++i) {
+        icall::Thread_SpinWait(1);
+        if (count.load(std::memory_order_relaxed) > 0 && semaphore_try_acquire(s)) {
+            budgetWord.store(std::min(budget * 2, kSpinMax), std::memory_order_relaxed);
+            return true;
+        }
+    }
+    budgetWord.store(std::max(budget / 2, kSpinMin), std::memory_order_relaxed);
+    return false;
+}
+
+// ----- WaitAsync queue -----
+
+/**
+ * A queued WaitAsync call. Allocated uncollectable (it is referenced from the worker
+ * queue, the timer heap and the cancellation side table, none of which the GC scans) and
+ * freed when its last reference is dropped: the claimer's completion, and the timer heap
+ * when it was on it. The cancellation registration holds no reference: the completion
+ * unregisters it first, waiting out a wake that is still running.
+ *
+ * `state` moves off kQueued exactly once, always under the owner's queue stripe lock,
+ * together with unlinking the node.
+ */
+struct AsyncWaiter {
+    Task* task;
+    SemaphoreSlimLayout* owner;
+    AsyncWaiter* next;
+    AsyncWaiter* prev;
+    CancelWake cancel;                  // registered when cancel.cts is set
+    int64_t deadline;                   // now_ms() deadline, -1 = none
+    size_t timer_index;                 // position in the timer heap, kNotInHeap once off it
+    std::atomic<Int32> state;
+    std::atomic<Int32> refs;
+};
+
+enum : Int32 { kQueued = 0, kGranted = 1, kTimedOut = 2, kCanceled = 3 };
+
+constexpr size_t kNotInHeap = SIZE_MAX;
+
+std::mutex g_queue_locks[64];
+
+std::mutex& queue_lock(SemaphoreSlimLayout* s) {
+    return g_queue_locks[(reinterpret_cast<uintptr_t>(s) >> 4) % 64];
+}
+
+// The head is written under the queue lock but peeked without it (Release fast path)
+AsyncWaiter* head_of(SemaphoreSlimLayout* s) {
+    return static_cast<AsyncWaiter*>(std::atomic_ref<void*>(s->f_m_asyncHead).load(std::memory_order_relaxed));
+}
+
+void set_head(SemaphoreSlimLayout* s, AsyncWaiter* w) {
+    std::atomic_ref<void*>(s->f_m_asyncHead).store(w, std::memory_order_relaxed);
+}
+
+void enqueue(SemaphoreSlimLayout* s, AsyncWaiter* w) {
+    auto* tail = static_cast<AsyncWaiter*>(s->f_m_asyncTail);
+    w->prev = tail;
+    w->next = nullptr;
+    if (tail) tail->next = w; else set_head(s, w);
+    s->f_m_asyncTail = w;
+}
+
+void unlink(SemaphoreSlimLayout* s, AsyncWaiter* w) {
+    if (w->prev) w->prev->next = w->next; else set_head(s, w->next);
+    if (w->next) w->next->prev = w->prev; else s->f_m_asyncTail = w->prev;
+    w->next = w->prev = nullptr;
+}
+
+void release_waiter_ref(AsyncWaiter* w) {
+    if (w->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        w->~AsyncWaiter();
+        gc::free_uncollectable(w);
+    }
+}
+
+void timer_remove(AsyncWaiter* w);
+
+void run_completion(void* raw) {
+    auto* w = static_cast<AsyncWaiter*>(raw);
+    if (w->cancel.cts) cts_unregister_wake(&w->cancel);
+    if (w->deadline >= 0) timer_remove(w);
+    switch (w->state.load(std::memory_order_acquire)) {
+        case kGranted:  task_complete_bool(w->task, true); break;
+        case kTimedOut: task_complete_bool(w->task, false); break;
+        default:        tcs_set_canceled(w->task); break;
+    }
+    release_waiter_ref(w);
+}
+
+/// Complete a claimed waiter's task. Continuations may run user code, so they never
+/// run on the releasing thread while the pool is available (RunContinuationsAsynchronously).
+void complete_waiter(AsyncWaiter* w) {
+    if (threadpool::is_initialized())
+        threadpool::queue_work(run_completion, w);
+    else
+        run_completion(w);
+}
+
+/// Hand available counts to queued async waiters. Counts that parked synchronous
+/// waiters are about to consume (m_waitCount) are left for them, as in the BCL.
+void drain_async_waiters(SemaphoreSlimLayout* s) {
+    if (!head_of(s)) return;    // racy peek; enqueue re-checks the count under the lock
+    auto& count = as_atomic(s->f_m_currentCount);
+    auto& waitCount = as_atomic(s->f_m_waitCount);
+    AsyncWaiter* granted = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(queue_lock(s));
+        while (auto* w = head_of(s)) {
+            Int32 c = count.load(std::memory_order_relaxed);
+            if (c <= waitCount.load(std::memory_order_relaxed)) break;
+            if (!count.compare_exchange_weak(c, c - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                continue;
+            unlink(s, w);
+            w->state.store(kGranted, std::memory_order_release);
+            w->next = granted;
+            granted = w;
+        }
+    }
+    if (granted) semaphore_after_acquire(s);
+    while (granted) {
+        auto* next = granted->next;
+        complete_waiter(granted);
+        granted = next;
+    }
+}
+
+/// Claim a timed-out or canceled waiter if Release has not granted it first
+bool expire_waiter(AsyncWaiter* w, Int32 outcome) {
+    std::lock_guard<std::mutex> lock(queue_lock(w->owner));
+    if (w->state.load(std::memory_order_relaxed) != kQueued) return false;
+    unlink(w->owner, w);
+    w->state.store(outcome, std::memory_order_release);
+    return true;
+}
+
+/// CancelWake for a queued waiter: claim it as canceled unless something else did first
+void cancel_waiter(CancelWake* node) {
+    auto* w = static_cast<AsyncWaiter*>(node->context);
+    bool claimed = expire_waiter(w, kCanceled);
+    cts_wake_done(node);    // from here the completion may free `w`
+    if (claimed) complete_waiter(w);
+}
+
+// ----- Timeout timer -----
+
+// One detached thread serves every WaitAsync with a timeout. The waiters sit in a binary
+// min-heap on their deadline; a completion takes its waiter out, so the heap only holds
+// waiters that are still queued, and the thread sleeps until the earliest deadline.
+struct TimerState {
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::vector<AsyncWaiter*> heap;
+    bool started = false;
+};
+
+// Never destroyed: the detached thread is still waiting on the condvar at exit
+TimerState& timer_state() {
+    static auto* state = new TimerState();
+    return *state;
+}
+
+void heap_place(std::vector<AsyncWaiter*>& heap, size_t i, AsyncWaiter* w) {
+    heap[i] = w;
+    w->timer_index = i;
+}
+
+void heap_sift_up(std::vector<AsyncWaiter*>& heap, size_t i) {
+    AsyncWaiter* w = heap[i];
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (heap[parent]->deadline <= w->deadline) break;
+        heap_place(heap, i, heap[parent]);
+        i = parent;
+    }
+    heap_place(heap, i, w);
+}
+
+void heap_sift_down(std::vector<AsyncWaiter*>& heap, size_t i) {
+    AsyncWaiter* w = heap[i];
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= heap.size()) break;
+        if (child + 1 < heap.size() && heap[child + 1]->deadline < heap[child]->deadline) child++;
+        if (w->deadline <= heap[child]->deadline) break;
+        heap_place(heap, i, heap[child]);
+        i = child;
+    }
+    heap_place(heap, i, w);
+}
+
+/// Take the waiter at `i` out of the heap (timer mutex held)
+void heap_erase(std::vector<AsyncWaiter*>& heap, size_t i) {
+    heap[i]->timer_index = kNotInHeap;
+    AsyncWaiter* last = heap.back();
+    heap.pop_back();
+    if (i == heap.size()) return;
+    heap_place(heap, i, last);
+    heap_sift_down(heap, i);
+    heap_sift_up(heap, last->timer_index);
+}
+
+void timer_thread_func() {
+    gc::register_thread();
+    profiler::thread_attach();
+    auto& timer = timer_state();
+    std::unique_lock<std::mutex> lock(timer.mutex);
+    std::vector<AsyncWaiter*> due;
+    for (;;) {
+        int64_t now = now_ms();
+        while (!timer.heap.empty() && timer.heap.front()->deadline <= now) {
+            due.push_back(timer.heap.front());
+            heap_erase(timer.heap, 0);
+        }
+
+        if (!due.empty()) {
+            lock.unlock();
+            for (auto* w : due) {
+                if (expire_waiter(w, kTimedOut))
+                    complete_waiter(w);         // drops the queue's reference
+                release_waiter_ref(w);          // the heap's reference
+            }
+            due.clear();
+            lock.lock();
+            continue;   // re-check: deadlines may have passed while completing
+        }
+
+        if (timer.heap.empty())
+            timer.cond.wait(lock);
+        else
+            timer.cond.wait_for(lock, std::chrono::milliseconds(timer.heap.front()->deadline - now));
+    }
+}
+
+void timer_add(AsyncWaiter* w) {
+    auto& timer = timer_state();
+    std::lock_guard<std::mutex> lock(timer.mutex);
+    timer.heap.push_back(w);
+    heap_sift_up(timer.heap, timer.heap.size() - 1);
+    if (!timer.started) {
+        timer.started = true;
+        std::thread(timer_thread_func).detach();
+    }
+    // Only a new earliest deadline moves the thread's wake-up
+    if (w->timer_index == 0) timer.cond.notify_one();
+}
+
+/// Take a completed waiter off the heap, dropping the heap's reference, if the timer
+/// thread has not already popped it
+void timer_remove(AsyncWaiter* w) {
+    auto& timer = timer_state();
+    {
+        std::lock_guard<std::mutex> lock(timer.mutex);
+        if (w->timer_index == kNotInHeap) return;
+        heap_erase(timer.heap, w->timer_index);
+    }
+    release_waiter_ref(w);
+}
+
+// ===== ManualResetEventSlim =====
+
+constexpr UInt32 kSignaledBit = 0x80000000u;
+constexpr UInt32 kDisposedBit = 0x40000000u;
+constexpr UInt32 kSpinCountMask = 0x3FF80000u;
+constexpr int kSpinCountShift = 19;
+constexpr UInt32 kWaitersMask = 0x0007FFFFu;
+
+std::atomic<Int32>& state_word(ManualResetEventSlimLayout* e) {
+    return as_atomic(e->f_m_combinedState);
+}
+
+bool event_is_set(ManualResetEventSlimLayout* e) {
+    return static_cast<UInt32>(state_word(e).load(std::memory_order_acquire)) & kSignaledBit;
+}
+
+void event_set(ManualResetEventSlimLayout* e) {
+    auto prev = static_cast<UInt32>(state_word(e).fetch_or(
+        static_cast<Int32>(kSignaledBit), std::memory_order_acq_rel));
+    if (prev & kSignaledBit) return;
+    if (prev & kWaitersMask) futex_wake_all(state_word(e));
+    set_wait_handle(e->f_m_eventObj, true);
+}
+
+} // anonymous namespace
+
+namespace icall {
+
+// ===== SemaphoreSlim =====
+
+bool SemaphoreSlim_Wait(void* self, Int32 millisecondsTimeout, CancellationToken cancellationToken) {
+    auto* s = static_cast<SemaphoreSlimLayout*>(self);
+    if (semaphore_disposed(s)) throw_object_disposed();
+    if (millisecondsTimeout < -1) throw_argument_out_of_range();
+    if (ct_is_cancellation_requested(cancellationToken)) throw_operation_canceled();
+
+    if (semaphore_try_acquire(s) || (millisecondsTimeout != 0 && semaphore_spin_acquire(s))) {
+        semaphore_after_acquire(s);
+        return true;
+    }
+    if (millisecondsTimeout == 0) return false;
+
+    auto& count = as_atomic(s->f_m_currentCount);
+    auto& waitCount = as_atomic(s->f_m_waitCount);
+    ParkedCancel cancel;
+    bool cancelable = ct_can_be_canceled(cancellationToken);
+    if (cancelable && !cancel.arm(cancellationToken, count)) throw_operation_canceled();
+    bool acquired = false;
+    bool canceled = false;
+    int64_t start = now_ms();
+    waitCount.fetch_add(1, std::memory_order_relaxed);
+    // Pairs with the fence in Release (store-then-load on both sides): either Release sees
+    // this waiter and wakes it, or the acquire attempt below sees the released count
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (;;) {
+        if (semaphore_try_acquire(s)) { acquired = true; break; }
+        if (cancelable && cts_wake_fired(&cancel.node)) { canceled = true; break; }
+        Int32 remaining = remaining_ms(millisecondsTimeout, start);
+        if (remaining == 0) break;
+        futex_wait(count, 0, remaining);
+    }
+    if (cancelable) canceled = cancel.disarm() && !acquired;
+    waitCount.fetch_sub(1, std::memory_order_relaxed);
+    // Same pairing: a Release that still counted this waiter left a count we see below
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (acquired) {
+        semaphore_after_acquire(s);
+        return true;
+    }
+    // A count Release meant for this waiter is still there: pass it on
+    if (count.load(std::memory_order_relaxed) > 0) {
+        if (waitCount.load(std::memory_order_relaxed) > 0) futex_wake(count, 1);
+        drain_async_waiters(s);
+    }
+    if (canceled) throw_operation_canceled();
+    return false;
+}
+
+Task* SemaphoreSlim_WaitAsync(void* self, Int32 millisecondsTimeout, CancellationToken cancellationToken) {
+    auto* s = static_cast<SemaphoreSlimLayout*>(self);
+    if (semaphore_disposed(s)) throw_object_disposed();
+    if (millisecondsTimeout < -1) throw_argument_out_of_range();
+    if (ct_is_cancellation_requested(cancellationToken)) {
+        auto* t = task_create_bool_pending();
+        tcs_set_canceled(t);
+        return t;
+    }
+    if (semaphore_try_acquire(s)) {
+        semaphore_after_acquire(s);
+        return task_create_bool_completed(true);
+    }
+    if (millisecondsTimeout == 0) return task_create_bool_completed(false);
+
+    auto* task = task_create_bool_pending();
+    bool timed = millisecondsTimeout > 0;
+    auto* w = new (gc::alloc_uncollectable(sizeof(AsyncWaiter))) AsyncWaiter{};
+    w->task = task;
+    w->owner = s;
+    w->cancel.wake = cancel_waiter;
+    w->cancel.context = w;
+    w->cancel.cts = ct_can_be_canceled(cancellationToken) ? cancellationToken.f__source : nullptr;
+    w->deadline = timed ? now_ms() + millisecondsTimeout : -1;
+    w->timer_index = kNotInHeap;
+    w->refs.store(timed ? 2 : 1, std::memory_order_relaxed);
+
+    bool acquired = false;
+    bool canceled = false;
+    {
+        std::lock_guard<std::mutex> lock(queue_lock(s));
+        // Re-check under the lock: a Release between the fast path and here drained an
+        // empty queue, so the count it added must be taken now
+        acquired = semaphore_try_acquire(s);
+        // Registered before the node is visible: a wake that runs now waits on this lock
+        if (!acquired && w->cancel.cts) canceled = !cts_register_wake(&w->cancel);
+        if (!acquired && !canceled) {
+            enqueue(s, w);
+            if (timed) timer_add(w);
+        }
+    }
+    if (acquired || canceled) {
+        w->~AsyncWaiter();
+        gc::free_uncollectable(w);
+        if (canceled) {
+            tcs_set_canceled(task);
+            return task;
+        }
+        semaphore_after_acquire(s);
+        task_complete_bool(task, true);
+        return task;
+    }
+    return task;
+}
+
+Int32 SemaphoreSlim_Release(void* self, Int32 releaseCount) {
+    auto* s = static_cast<SemaphoreSlimLayout*>(self);
+    if (semaphore_disposed(s)) throw_object_disposed();
+    if (releaseCount < 1) throw_argument_out_of_range();
+
+    auto& count = as_atomic(s->f_m_currentCount);
+    Int32 prev = count.load(std::memory_order_relaxed);
+    for (;;) {
+        if (s->f_m_maxCount - prev < releaseCount) throw_semaphore_full();
+        if (count.compare_exchange_weak(prev, prev + releaseCount,
+                std::memory_order_release, std::memory_order_relaxed))
+            break;
+    }
+
+    // Pairs with the fences around the waiter's waitCount updates in Wait
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Int32 parked = as_atomic(s->f_m_waitCount).load(std::memory_order_relaxed);
+    if (parked > 0) futex_wake(count, std::min(parked, releaseCount));
+    drain_async_waiters(s);
+    if (prev == 0) set_wait_handle(s->f_m_waitHandle, true);
+    return prev;
+}
+
+void SemaphoreSlim_Dispose(void* self, bool disposing) {
+    if (!disposing) return;
+    auto* s = static_cast<SemaphoreSlimLayout*>(self);
+    if (auto* wh = static_cast<ManagedWaitHandle*>(s->f_m_waitHandle)) {
+        if (wh->f__waitHandle) SafeHandle_Dispose(wh->f__waitHandle, true);
+        s->f_m_waitHandle = nullptr;
+    }
+    static_cast<StrongBoxBoolLayout*>(s->f_m_lockObjAndDisposed)->f_Value = true;
+
+    // The BCL drops its queued TaskNodes here and leaves their tasks pending; these nodes
+    // are not collectable, so cancel them instead
+    AsyncWaiter* canceled = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(queue_lock(s));
+        while (auto* w = head_of(s)) {
+            unlink(s, w);
+            w->state.store(kCanceled, std::memory_order_release);
+            w->next = canceled;
+            canceled = w;
+        }
+    }
+    while (canceled) {
+        auto* next = canceled->next;
+        complete_waiter(canceled);
+        canceled = next;
+    }
+}
+
+// ===== ManualResetEventSlim =====
+
+void ManualResetEventSlim_Set(void* self) {
+    event_set(static_cast<ManualResetEventSlimLayout*>(self));
+}
+
+void ManualResetEventSlim_Set_Cancellation(void* self, bool) {
+    event_set(static_cast<ManualResetEventSlimLayout*>(self));
+}
+
+void ManualResetEventSlim_Reset(void* self) {
+    auto* e = static_cast<ManualResetEventSlimLayout*>(self);
+    auto& word = state_word(e);
+    if (static_cast<UInt32>(word.load(std::memory_order_relaxed)) & kDisposedBit) throw_object_disposed();
+    set_wait_handle(e->f_m_eventObj, false);
+    word.fetch_and(static_cast<Int32>(~kSignaledBit), std::memory_order_release);
+}
+
+bool ManualResetEventSlim_Wait(void* self, Int32 millisecondsTimeout, CancellationToken cancellationToken) {
+    auto* e = static_cast<ManualResetEventSlimLayout*>(self);
+    auto& word = state_word(e);
+    if (static_cast<UInt32>(word.load(std::memory_order_relaxed)) & kDisposedBit) throw_object_disposed();
+    if (millisecondsTimeout < -1) throw_argument_out_of_range();
+    if (ct_is_cancellation_requested(cancellationToken)) throw_operation_canceled();
+
+    if (event_is_set(e)) return true;
+    if (millisecondsTimeout == 0) return false;
+
+    // SpinCount property (bits 19-29; the BCL constructor stores 1 on uniprocessors)
+    Int32 spins = static_cast<Int32>(
+        (static_cast<UInt32>(word.load(std::memory_order_relaxed)) & kSpinCountMask) >> kSpinCountShift);
+    if (is_multiprocessor()) {
+        for (Int32 i = 0; i < spins; ++i) {
+            icall::Thread_SpinWait(1 << std::min(i, 6));
+            if (event_is_set(e)) return true;
+        }
+    }
+
+    ParkedCancel cancel;
+    bool cancelable = ct_can_be_canceled(cancellationToken);
+    if (cancelable && !cancel.arm(cancellationToken, word)) throw_operation_canceled();
+    bool canceled = false;
+    bool signaled = false;
+    int64_t start = now_ms();
+    for (;;) {
+        // Register as a waiter in the low bits, unless the event got set meanwhile
+        Int32 observed = word.load(std::memory_order_acquire);
+        if (static_cast<UInt32>(observed) & kSignaledBit) { signaled = true; break; }
+        if (cancelable && cts_wake_fired(&cancel.node)) break;
+        Int32 remaining = remaining_ms(millisecondsTimeout, start);
+        if (remaining == 0) break;
+        if (!word.compare_exchange_weak(observed, observed + 1, std::memory_order_acq_rel,
+                std::memory_order_relaxed))
+            continue;
+        futex_wait(word, observed + 1, remaining);
+        word.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (cancelable) canceled = cancel.disarm() && !signaled;
+    if (canceled) throw_operation_canceled();
+    return signaled;
+}
+
+} // namespace icall
+} // namespace cil2cpp
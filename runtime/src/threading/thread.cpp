@@ -7,6 +7,7 @@
 
 #include <cil2cpp/threading.h>
 #include <cil2cpp/gc.h>
+#include <cil2cpp/profiler.h>
 #include <cil2cpp/exception.h>
 #include <cil2cpp/type_info.h>
 
@@ -34,6 +35,7 @@ static std::atomic<Int32> g_next_managed_id{2}; // Start at 2; ID=1 reserved for
 // Thread entry point — runs on the new thread
 static void thread_entry(ManagedThread* t) {
     gc::register_thread();
+    profiler::thread_attach();
     thread_set_current(t);
 
     t->state.store(1, std::memory_order_release); // running
@@ -62,6 +64,7 @@ static void thread_entry(ManagedThread* t) {
     t->state.store(2, std::memory_order_release); // stopped
     thread_set_current(nullptr);
 
+    profiler::thread_detach();
     gc::unregister_thread();
 }
 
@@ -96,7 +99,7 @@ void join(ManagedThread* t) {
     if (!t) throw_null_reference();
     auto* native = static_cast<std::thread*>(t->native_handle);
     if (native && native->joinable()) {
-        native->join();
+        gc::blocking([native] { native->join(); });
         delete native;
         t->native_handle = nullptr;
     }
@@ -125,7 +128,7 @@ bool join_timeout(ManagedThread* t, Int32 timeout_ms) {
             }
             return true;
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+        gc::blocking([sleep_ms] { std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms)); });
         if (sleep_ms < 50) sleep_ms *= 2;
     }
     return false;
@@ -133,16 +136,20 @@ bool join_timeout(ManagedThread* t, Int32 timeout_ms) {
 
 void sleep(Int32 milliseconds) {
     if (milliseconds > 0) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+        gc::blocking([milliseconds] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+        });
     } else if (milliseconds == 0) {
         std::this_thread::yield();
     } else {
         // .NET: Sleep(-1) = Timeout.Infinite = wait forever.
         // Other negative values are ArgumentOutOfRange in full .NET,
         // but we treat all negatives as infinite for simplicity.
-        while (true) {
-            std::this_thread::sleep_for(std::chrono::hours(24));
-        }
+        gc::blocking([] {
+            while (true) {
+                std::this_thread::sleep_for(std::chrono::hours(24));
+            }
+        });
     }
 }
 
@@ -3,7 +3,10 @@
  *
  * Phase II.5: Platform-specific implementations for wait handle operations.
  * Windows: Win32 CreateEvent/WaitForSingleObject/SetEvent/ResetEvent/CreateMutex/CreateSemaphore
- * POSIX: pthread mutex + condvar emulation
+ * POSIX: futex-backed events/mutexes/semaphores with native WaitAny/WaitAll
+ *
+ * On Unix the BCL reaches these through Interop.Kernel32 QCalls (CreateEventExW, SetEvent,
+ * ...), which CoreCLR serves from its PAL; the same entry points are defined here, below.
  */
 
 #include <cil2cpp/waithandle.h>
@@ -14,10 +17,14 @@
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #else
-#include <pthread.h>
-#include <cstdlib>
-#include <ctime>
-#include <cerrno>
+#include "futex.h"
+#include <cil2cpp/contention.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <sched.h>
+#include <vector>
 #endif
 
 namespace cil2cpp {
@@ -67,7 +74,7 @@ intptr_t Mutex_CreateMutexCoreWin32(bool initiallyOwned) {
 
 void Mutex_ReleaseMutex(intptr_t handle) {
     if (!ReleaseMutex(reinterpret_cast<HANDLE>(handle))) {
-        throw_invalid_operation();
+        throw_mutex_not_owned();
     }
 }
 
@@ -80,6 +87,7 @@ intptr_t Semaphore_CreateSemaphoreCoreWin32(Int32 initialCount, Int32 maximumCou
 Int32 Semaphore_ReleaseSemaphore(intptr_t handle, Int32 releaseCount) {
     LONG previousCount = 0;
     if (!::ReleaseSemaphore(reinterpret_cast<HANDLE>(handle), releaseCount, &previousCount)) {
+        if (GetLastError() == ERROR_TOO_MANY_POSTS) throw_semaphore_full();
         throw_invalid_operation();
     }
     return static_cast<Int32>(previousCount);
@@ -91,260 +99,577 @@ void WaitHandle_CloseHandle(intptr_t handle) {
     }
 }
 
-#else
+Int32 WaitHandle_WaitMultipleIgnoringSyncContext(intptr_t* waitHandles, Int32 numHandles,
+    bool waitAll, Int32 millisecondsTimeout) {
+    DWORD timeout = (millisecondsTimeout < 0) ? INFINITE : static_cast<DWORD>(millisecondsTimeout);
+    DWORD result = WaitForMultipleObjectsEx(static_cast<DWORD>(numHandles),
+        reinterpret_cast<const HANDLE*>(waitHandles), waitAll ? TRUE : FALSE, timeout, FALSE);
+    if (result == WAIT_FAILED) throw_invalid_operation();
+    return static_cast<Int32>(result); // WAIT_OBJECT_0+i, WAIT_ABANDONED_0+i, WAIT_TIMEOUT
+}
+
+Int32 WaitHandle_SignalAndWaitNative(intptr_t waitHandleToSignal, intptr_t waitHandleToWaitOn,
+    Int32 millisecondsTimeout) {
+    DWORD timeout = (millisecondsTimeout < 0) ? INFINITE : static_cast<DWORD>(millisecondsTimeout);
+    DWORD result = SignalObjectAndWait(reinterpret_cast<HANDLE>(waitHandleToSignal),
+        reinterpret_cast<HANDLE>(waitHandleToWaitOn), timeout, FALSE);
+    if (result == WAIT_FAILED) {
+        DWORD error = GetLastError();
+        if (error == ERROR_TOO_MANY_POSTS) return ERROR_TOO_MANY_POSTS;
+        if (error == ERROR_NOT_OWNER) throw_mutex_not_owned();
+        throw_invalid_operation();
+    }
+    return static_cast<Int32>(result);
+}
 
-// ===== POSIX: pthread-based wait handle emulation =====
+#else
 
-// Type tag to distinguish event/mutex/semaphore at WaitOneCore dispatch time
+// ===== POSIX: futex-backed wait objects with a shared waiter list =====
+//
+// Each object (event, mutex, semaphore) keeps its state and an intrusive list of wait
+// blocks under a short per-object spinlock. A blocked thread parks on the futex word of
+// its thread-local Waiter, however many objects it waits on:
+//  - WaitAny/WaitOne: the signaling side claims the waiter by CAS'ing its word from
+//    kWaiting to (index + 1), acquires the object on the waiter's behalf (clears an
+//    auto-reset event, takes a semaphore unit, takes mutex ownership) under the object's
+//    lock, and wakes it. Claims are exclusive, so a waiter acquires exactly one object;
+//    a timing-out waiter races the same CAS and loses if it was already claimed.
+//  - WaitAll: signals only bump the waiter's word and wake it; the waiter then locks all
+//    objects in address order and acquires them together if every one is signaled.
+// No path polls: a thread sleeps until an object it waits on changes state.
+
+// Type tag to distinguish event/mutex/semaphore at wait time
 enum class PosixHandleType : int { Event = 0, Mutex = 1, Semaphore = 2 };
 
-// Common header for all POSIX handle types
-struct PosixHandleBase {
-    PosixHandleType type;
+constexpr Int32 kWaitTimeout = 258;         // WAIT_TIMEOUT
+constexpr Int32 kErrorTooManyPosts = 298;   // ERROR_TOO_MANY_POSTS
+constexpr int32_t kMaxWaitHandles = 64;     // MAXIMUM_WAIT_OBJECTS
+
+constexpr int32_t kWaiting = 0;
+constexpr int32_t kTimedOut = -1;
+
+// Mutex owners are identified by a per-thread serial, never reused (unlike a TLS address
+// or a native thread id), so a thread that exits holding a mutex can't hand it to a new one
+using ThreadSerial = uint64_t;
+constexpr ThreadSerial kNoOwner = 0;
+std::atomic<ThreadSerial> g_next_thread_serial{1};
+
+struct Waiter {
+    std::atomic<int32_t> word{kWaiting};  // WaitAny: claim; WaitAll: change counter
+    bool wait_all = false;
+    ThreadSerial thread = g_next_thread_serial.fetch_add(1, std::memory_order_relaxed);
 };
 
-// --- Event (AutoReset / ManualReset) ---
-struct PosixEvent : PosixHandleBase {
-    pthread_mutex_t mutex;
-    pthread_cond_t cond;
-    bool signaled;
-    bool manual_reset;
+// One thread-local Waiter per thread
+thread_local Waiter t_waiter;
+
+struct WaitBlock {
+    Waiter* waiter;
+    int32_t index;
+    bool linked;
+    WaitBlock* prev;
+    WaitBlock* next;
 };
 
-static PosixEvent* posix_event_create(bool initialState, bool manualReset) {
-    auto* ev = static_cast<PosixEvent*>(std::malloc(sizeof(PosixEvent)));
-    ev->type = PosixHandleType::Event;
-    pthread_mutex_init(&ev->mutex, nullptr);
-    pthread_cond_init(&ev->cond, nullptr);
-    ev->signaled = initialState;
-    ev->manual_reset = manualReset;
-    return ev;
-}
-
-// Helper: compute absolute deadline from relative timeout_ms
-static struct timespec posix_deadline(int timeout_ms) {
-    struct timespec ts;
-    clock_gettime(CLOCK_REALTIME, &ts);
-    ts.tv_sec += timeout_ms / 1000;
-    ts.tv_nsec += (timeout_ms % 1000) * 1000000L;
-    if (ts.tv_nsec >= 1000000000L) {
-        ts.tv_sec++;
-        ts.tv_nsec -= 1000000000L;
+struct SpinLock {
+    std::atomic<bool> held{false};
+
+    void lock() {
+        while (held.exchange(true, std::memory_order_acquire)) {
+            while (held.load(std::memory_order_relaxed)) sched_yield();
+        }
     }
-    return ts;
+    void unlock() { held.store(false, std::memory_order_release); }
+};
+
+struct WaitObject {
+    PosixHandleType type;
+    SpinLock lock;
+    WaitBlock* head = nullptr;
+    WaitBlock* tail = nullptr;
+    // Event
+    bool signaled = false;
+    bool manual_reset = false;
+    // Semaphore
+    int32_t count = 0;
+    int32_t max_count = 0;
+    // Mutex (recursive)
+    ThreadSerial owner = kNoOwner;
+    int32_t recursion = 0;
+    // The handle managed code holds (see wait_object_create)
+    intptr_t handle = 0;
+};
+
+static void link_block(WaitObject* obj, WaitBlock* b) {
+    b->linked = true;
+    b->next = nullptr;
+    b->prev = obj->tail;
+    if (obj->tail) obj->tail->next = b; else obj->head = b;
+    obj->tail = b;
 }
 
-static int posix_event_wait(PosixEvent* ev, int timeout_ms) {
-    pthread_mutex_lock(&ev->mutex);
-    if (timeout_ms < 0) {
-        while (!ev->signaled)
-            pthread_cond_wait(&ev->cond, &ev->mutex);
-    } else {
-        auto ts = posix_deadline(timeout_ms);
-        while (!ev->signaled) {
-            if (pthread_cond_timedwait(&ev->cond, &ev->mutex, &ts) == ETIMEDOUT) {
-                pthread_mutex_unlock(&ev->mutex);
-                return 258; // WAIT_TIMEOUT
-            }
-        }
+static void unlink_block(WaitObject* obj, WaitBlock* b) {
+    if (!b->linked) return;
+    if (b->prev) b->prev->next = b->next; else obj->head = b->next;
+    if (b->next) b->next->prev = b->prev; else obj->tail = b->prev;
+    b->linked = false;
+}
+
+// Can `self` acquire `obj` right now? (caller holds obj->lock; kNoOwner = any thread)
+static bool can_acquire(const WaitObject* obj, ThreadSerial self) {
+    switch (obj->type) {
+        case PosixHandleType::Event: return obj->signaled;
+        case PosixHandleType::Semaphore: return obj->count > 0;
+        case PosixHandleType::Mutex: return obj->owner == kNoOwner || obj->owner == self;
     }
-    if (!ev->manual_reset)
-        ev->signaled = false;
-    pthread_mutex_unlock(&ev->mutex);
-    return 0;
+    return false;
 }
 
-static void posix_event_set(PosixEvent* ev) {
-    pthread_mutex_lock(&ev->mutex);
-    ev->signaled = true;
-    if (ev->manual_reset)
-        pthread_cond_broadcast(&ev->cond);
-    else
-        pthread_cond_signal(&ev->cond);
-    pthread_mutex_unlock(&ev->mutex);
+// Acquire `obj` for `self` (caller holds obj->lock and checked can_acquire)
+static void acquire(WaitObject* obj, ThreadSerial self) {
+    switch (obj->type) {
+        case PosixHandleType::Event:
+            if (!obj->manual_reset) obj->signaled = false;
+            break;
+        case PosixHandleType::Semaphore:
+            obj->count--;
+            break;
+        case PosixHandleType::Mutex:
+            obj->owner = self;
+            obj->recursion++;
+            break;
+    }
 }
 
-static void posix_event_reset(PosixEvent* ev) {
-    pthread_mutex_lock(&ev->mutex);
-    ev->signaled = false;
-    pthread_mutex_unlock(&ev->mutex);
+// Hand `obj` to its queued waiters while it stays signaled (caller holds obj->lock)
+static void satisfy_waiters(WaitObject* obj) {
+    WaitBlock* b = obj->head;
+    while (b && can_acquire(obj, kNoOwner)) {
+        WaitBlock* next = b->next;
+        Waiter* w = b->waiter;
+        if (w->wait_all) {
+            // Let the WaitAll waiter re-check its whole set
+            w->word.fetch_add(1, std::memory_order_acq_rel);
+            threading::futex_wake_all(w->word);
+        } else {
+            int32_t expected = kWaiting;
+            if (w->word.compare_exchange_strong(expected, b->index + 1,
+                    std::memory_order_acq_rel)) {
+                acquire(obj, w->thread);
+                unlink_block(obj, b);
+                threading::futex_wake_all(w->word);
+            }
+        }
+        b = next;
+    }
 }
 
-static void posix_event_destroy(PosixEvent* ev) {
-    if (!ev) return;
-    pthread_cond_destroy(&ev->cond);
-    pthread_mutex_destroy(&ev->mutex);
-    std::free(ev);
+static int32_t wait_any(WaitObject** objs, int32_t n, int32_t timeout_ms) {
+    Waiter* self = &t_waiter;
+
+    // Fast path: something is already signaled
+    for (int32_t i = 0; i < n; i++) {
+        std::lock_guard lock(objs[i]->lock);
+        if (can_acquire(objs[i], self->thread)) {
+            acquire(objs[i], self->thread);
+            return i;
+        }
+    }
+    if (timeout_ms == 0) return kWaitTimeout;
+
+    self->wait_all = false;
+    self->word.store(kWaiting, std::memory_order_release);
+    WaitBlock blocks[kMaxWaitHandles];
+    int32_t queued = 0;
+    for (; queued < n; queued++) {
+        WaitObject* obj = objs[queued];
+        std::lock_guard lock(obj->lock);
+        blocks[queued] = {self, queued, false, nullptr, nullptr};
+        // Re-check under the lock: a signal may have arrived since the fast path
+        if (can_acquire(obj, self->thread)) {
+            int32_t expected = kWaiting;
+            if (self->word.compare_exchange_strong(expected, queued + 1,
+                    std::memory_order_acq_rel))
+                acquire(obj, self->thread);
+            queued++;
+            break;
+        }
+        link_block(obj, &blocks[queued]);
+    }
+
+    int64_t start = threading::now_ms();
+    int32_t word;
+    while ((word = self->word.load(std::memory_order_acquire)) == kWaiting) {
+        int32_t left = threading::remaining_ms(timeout_ms, start);
+        if (left == 0) {
+            int32_t expected = kWaiting;
+            if (self->word.compare_exchange_strong(expected, kTimedOut,
+                    std::memory_order_acq_rel)) {
+                word = kTimedOut;
+                break;
+            }
+            continue; // claimed just now
+        }
+        threading::futex_wait(self->word, kWaiting, left);
+    }
+
+    for (int32_t i = 0; i < queued; i++) {
+        std::lock_guard lock(objs[i]->lock);
+        unlink_block(objs[i], &blocks[i]);
+    }
+    return word == kTimedOut ? kWaitTimeout : word - 1;
 }
 
-// --- Mutex (recursive, owned by a single thread) ---
-struct PosixMutex : PosixHandleBase {
-    pthread_mutex_t mutex;  // PTHREAD_MUTEX_RECURSIVE
-};
+static int32_t wait_all(WaitObject** objs, int32_t n, int32_t timeout_ms) {
+    Waiter* self = &t_waiter;
+
+    // Lock in address order so concurrent WaitAll calls cannot deadlock
+    WaitObject* sorted[kMaxWaitHandles];
+    std::copy(objs, objs + n, sorted);
+    std::sort(sorted, sorted + n);
+    int32_t unique = static_cast<int32_t>(std::unique(sorted, sorted + n) - sorted);
 
-static PosixMutex* posix_mutex_create(bool initiallyOwned) {
-    auto* m = static_cast<PosixMutex*>(std::malloc(sizeof(PosixMutex)));
-    m->type = PosixHandleType::Mutex;
+    auto lock_all = [&] { for (int32_t i = 0; i < unique; i++) sorted[i]->lock.lock(); };
+    auto unlock_all = [&] { for (int32_t i = unique; i-- > 0;) sorted[i]->lock.unlock(); };
 
-    pthread_mutexattr_t attr;
-    pthread_mutexattr_init(&attr);
-    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
-    pthread_mutex_init(&m->mutex, &attr);
-    pthread_mutexattr_destroy(&attr);
+    self->wait_all = true;
+    self->word.store(0, std::memory_order_release);
+    WaitBlock blocks[kMaxWaitHandles];
+    bool queued = false;
+    int64_t start = threading::now_ms();
 
-    if (initiallyOwned)
-        pthread_mutex_lock(&m->mutex);
-    return m;
+    for (;;) {
+        lock_all();
+        bool all = true;
+        for (int32_t i = 0; i < unique && all; i++) all = can_acquire(sorted[i], self->thread);
+        if (all) {
+            for (int32_t i = 0; i < unique; i++) acquire(sorted[i], self->thread);
+        }
+        int32_t left = threading::remaining_ms(timeout_ms, start);
+        if (all || left == 0) {
+            if (queued)
+                for (int32_t i = 0; i < unique; i++) unlink_block(sorted[i], &blocks[i]);
+            unlock_all();
+            return all ? 0 : kWaitTimeout;
+        }
+        if (!queued) {
+            for (int32_t i = 0; i < unique; i++) {
+                blocks[i] = {self, i, false, nullptr, nullptr};
+                link_block(sorted[i], &blocks[i]);
+            }
+            queued = true;
+        }
+        int32_t seen = self->word.load(std::memory_order_acquire);
+        unlock_all();
+        threading::futex_wait(self->word, seen, left);
+    }
 }
 
-static int posix_mutex_wait(PosixMutex* m, int timeout_ms) {
-    if (timeout_ms < 0) {
-        pthread_mutex_lock(&m->mutex);
-        return 0;
+// Handles come from managed code (and CloseHandle is shared with other handle kinds), so
+// they are never dereferenced blindly: a handle is a slot index tagged with the slot's
+// generation, and closing bumps the generation, so a closed, reused or foreign handle is
+// rejected rather than read after free. Lookups are lock-free; only create and close take
+// the free-list lock. Closing while another thread still uses the handle is prevented on
+// the managed side, where SafeWaitHandle holds DangerousAddRef/Release around every call.
+constexpr int kHandleIndexBits = sizeof(intptr_t) >= 8 ? 32 : 24;
+constexpr uintptr_t kHandleIndexMask = (uintptr_t{1} << kHandleIndexBits) - 1;
+constexpr uintptr_t kHandleGenerationMask = ~uintptr_t{0} >> kHandleIndexBits;
+constexpr uint32_t kHandleSegmentSize = 1024;
+constexpr uint32_t kHandleSegments = 1024;
+
+struct HandleSlot {
+    std::atomic<uintptr_t> generation{0};
+    std::atomic<WaitObject*> object{nullptr};
+};
+
+static std::atomic<HandleSlot*> g_handle_segments[kHandleSegments];
+static std::vector<uint32_t> g_free_slots;
+static uint32_t g_next_slot = 0;
+static contention::Mutex g_slots_lock{"waithandle.slots"};
+
+static HandleSlot* handle_slot(uint32_t index) {
+    HandleSlot* segment = g_handle_segments[index / kHandleSegmentSize].load(std::memory_order_acquire);
+    return segment ? &segment[index % kHandleSegmentSize] : nullptr;
+}
+
+static WaitObject* wait_object_create(PosixHandleType type) {
+    auto* obj = new (std::nothrow) WaitObject();
+    if (!obj) return nullptr;
+    obj->type = type;
+    std::lock_guard<contention::Mutex> guard(g_slots_lock);
+    uint32_t index;
+    if (!g_free_slots.empty()) {
+        index = g_free_slots.back();
+        g_free_slots.pop_back();
+    } else {
+        if (g_next_slot == kHandleSegments * kHandleSegmentSize) {
+            delete obj;
+            return nullptr;
+        }
+        index = g_next_slot++;
+        auto& segment = g_handle_segments[index / kHandleSegmentSize];
+        if (!segment.load(std::memory_order_relaxed))
+            segment.store(new HandleSlot[kHandleSegmentSize], std::memory_order_release);
     }
-    // Timed lock via polling (pthread_mutex_timedlock not portable to all platforms)
-    auto ts = posix_deadline(timeout_ms);
-    while (true) {
-        if (pthread_mutex_trylock(&m->mutex) == 0)
-            return 0;
-        struct timespec now;
-        clock_gettime(CLOCK_REALTIME, &now);
-        if (now.tv_sec > ts.tv_sec || (now.tv_sec == ts.tv_sec && now.tv_nsec >= ts.tv_nsec))
-            return 258; // WAIT_TIMEOUT
-        // Brief yield before retrying
-        struct timespec sleep_ts = {0, 1000000}; // 1ms
-        nanosleep(&sleep_ts, nullptr);
+    HandleSlot* slot = handle_slot(index);
+    uintptr_t generation = slot->generation.load(std::memory_order_relaxed);
+    obj->handle = static_cast<intptr_t>((generation << kHandleIndexBits) | (index + 1));
+    slot->object.store(obj, std::memory_order_release);
+    return obj;
+}
+
+static WaitObject* wait_object_from_handle(intptr_t handle) {
+    auto bits = static_cast<uintptr_t>(handle);
+    uintptr_t index = bits & kHandleIndexMask;
+    if (index == 0 || index > kHandleSegments * kHandleSegmentSize) return nullptr;
+    HandleSlot* slot = handle_slot(static_cast<uint32_t>(index - 1));
+    if (!slot) return nullptr;
+    // Object first: a close bumps the generation before the slot can hold a new object
+    WaitObject* obj = slot->object.load(std::memory_order_acquire);
+    if (!obj || slot->generation.load(std::memory_order_acquire) != bits >> kHandleIndexBits)
+        return nullptr;
+    return obj;
+}
+
+// Retire the slot behind `handle` and free its object; false if it is not a live wait object
+static bool wait_object_close(intptr_t handle) {
+    WaitObject* obj;
+    {
+        std::lock_guard<contention::Mutex> guard(g_slots_lock);
+        obj = wait_object_from_handle(handle);
+        if (!obj) return false;
+        auto index = static_cast<uint32_t>((static_cast<uintptr_t>(handle) & kHandleIndexMask) - 1);
+        HandleSlot* slot = handle_slot(index);
+        uintptr_t next = (slot->generation.load(std::memory_order_relaxed) + 1) & kHandleGenerationMask;
+        slot->generation.store(next, std::memory_order_release);
+        slot->object.store(nullptr, std::memory_order_release);
+        g_free_slots.push_back(index);
     }
+    delete obj;
+    return true;
 }
 
-static void posix_mutex_release(PosixMutex* m) {
-    pthread_mutex_unlock(&m->mutex);
+// The wait object behind `handle`, or throw if it is not a live one
+static WaitObject* checked_wait_object(intptr_t handle) {
+    auto* obj = wait_object_from_handle(handle);
+    if (!obj) throw_invalid_operation();
+    return obj;
 }
 
-static void posix_mutex_destroy(PosixMutex* m) {
-    if (!m) return;
-    pthread_mutex_destroy(&m->mutex);
-    std::free(m);
+static void mutex_take_initial_ownership(WaitObject* m) {
+    m->owner = t_waiter.thread;
+    m->recursion = 1;
 }
 
-// --- Semaphore (counting, with maximum) ---
-struct PosixSemaphore : PosixHandleBase {
-    pthread_mutex_t mutex;
-    pthread_cond_t cond;
-    int count;
-    int max_count;
-};
+static void event_set(WaitObject* ev) {
+    std::lock_guard lock(ev->lock);
+    ev->signaled = true;
+    satisfy_waiters(ev);
+}
 
-static PosixSemaphore* posix_semaphore_create(int initialCount, int maximumCount) {
-    auto* s = static_cast<PosixSemaphore*>(std::malloc(sizeof(PosixSemaphore)));
-    s->type = PosixHandleType::Semaphore;
-    pthread_mutex_init(&s->mutex, nullptr);
-    pthread_cond_init(&s->cond, nullptr);
-    s->count = initialCount;
-    s->max_count = maximumCount;
-    return s;
+static void event_reset(WaitObject* ev) {
+    std::lock_guard lock(ev->lock);
+    ev->signaled = false;
 }
 
-static int posix_semaphore_wait(PosixSemaphore* s, int timeout_ms) {
-    pthread_mutex_lock(&s->mutex);
-    if (timeout_ms < 0) {
-        while (s->count <= 0)
-            pthread_cond_wait(&s->cond, &s->mutex);
-    } else {
-        auto ts = posix_deadline(timeout_ms);
-        while (s->count <= 0) {
-            if (pthread_cond_timedwait(&s->cond, &s->mutex, &ts) == ETIMEDOUT) {
-                pthread_mutex_unlock(&s->mutex);
-                return 258; // WAIT_TIMEOUT
-            }
-        }
+// Returns false if the calling thread does not own the mutex
+static bool mutex_release(WaitObject* m) {
+    std::lock_guard lock(m->lock);
+    if (m->owner != t_waiter.thread) return false;
+    if (--m->recursion == 0) {
+        m->owner = kNoOwner;
+        satisfy_waiters(m);
     }
-    s->count--;
-    pthread_mutex_unlock(&s->mutex);
-    return 0;
+    return true;
 }
 
-static int posix_semaphore_release(PosixSemaphore* s, int releaseCount) {
-    pthread_mutex_lock(&s->mutex);
-    int prev = s->count;
+// Returns false (count unchanged) if the release would exceed the maximum
+static bool semaphore_release(WaitObject* s, int32_t releaseCount, int32_t* previous) {
+    std::lock_guard lock(s->lock);
+    if (releaseCount <= 0 || releaseCount > s->max_count - s->count) return false;
+    if (previous) *previous = s->count;
     s->count += releaseCount;
-    if (s->count > s->max_count) {
-        s->count = prev; // rollback
-        pthread_mutex_unlock(&s->mutex);
-        throw_invalid_operation(); // SemaphoreFullException equivalent
-    }
-    pthread_cond_broadcast(&s->cond);
-    pthread_mutex_unlock(&s->mutex);
-    return prev;
+    satisfy_waiters(s);
+    return true;
 }
 
-static void posix_semaphore_destroy(PosixSemaphore* s) {
-    if (!s) return;
-    pthread_cond_destroy(&s->cond);
-    pthread_mutex_destroy(&s->mutex);
-    std::free(s);
+// --- WaitHandle dispatch ---
+
+Int32 WaitHandle_WaitOneCore(intptr_t waitHandle, Int32 millisecondsTimeout) {
+    WaitObject* obj = checked_wait_object(waitHandle);
+    return wait_any(&obj, 1, millisecondsTimeout);
 }
 
-// --- WaitHandle dispatch (routes to event/mutex/semaphore by type tag) ---
+Int32 WaitHandle_WaitMultipleIgnoringSyncContext(intptr_t* waitHandles, Int32 numHandles,
+    bool waitAll, Int32 millisecondsTimeout) {
+    if (numHandles <= 0 || numHandles > kMaxWaitHandles) throw_invalid_operation();
+    WaitObject* objs[kMaxWaitHandles];
+    for (Int32 i = 0; i < numHandles; i++) objs[i] = checked_wait_object(waitHandles[i]);
+    return waitAll ? wait_all(objs, numHandles, millisecondsTimeout)
+                   : wait_any(objs, numHandles, millisecondsTimeout);
+}
 
-Int32 WaitHandle_WaitOneCore(intptr_t waitHandle, Int32 millisecondsTimeout) {
-    auto* base = reinterpret_cast<PosixHandleBase*>(waitHandle);
-    switch (base->type) {
+Int32 WaitHandle_SignalAndWaitNative(intptr_t waitHandleToSignal, intptr_t waitHandleToWaitOn,
+    Int32 millisecondsTimeout) {
+    WaitObject* toSignal = checked_wait_object(waitHandleToSignal);
+    checked_wait_object(waitHandleToWaitOn);
+    switch (toSignal->type) {
         case PosixHandleType::Event:
-            return posix_event_wait(static_cast<PosixEvent*>(base), millisecondsTimeout);
+            event_set(toSignal);
+            break;
         case PosixHandleType::Mutex:
-            return posix_mutex_wait(static_cast<PosixMutex*>(base), millisecondsTimeout);
+            if (!mutex_release(toSignal)) throw_mutex_not_owned();
+            break;
         case PosixHandleType::Semaphore:
-            return posix_semaphore_wait(static_cast<PosixSemaphore*>(base), millisecondsTimeout);
+            if (!semaphore_release(toSignal, 1, nullptr)) return kErrorTooManyPosts;
+            break;
     }
-    throw_invalid_operation();
+    return WaitHandle_WaitOneCore(waitHandleToWaitOn, millisecondsTimeout);
 }
 
 intptr_t EventWaitHandle_CreateEventCoreWin32(bool initialState, Int32 eventResetMode) {
-    bool manualReset = (eventResetMode == 1);
-    return reinterpret_cast<intptr_t>(posix_event_create(initialState, manualReset));
+    auto* ev = wait_object_create(PosixHandleType::Event);
+    if (!ev) throw_invalid_operation();
+    ev->signaled = initialState;
+    ev->manual_reset = (eventResetMode == 1); // 0=AutoReset, 1=ManualReset
+    return ev->handle;
 }
 
 bool EventWaitHandle_Set(intptr_t handle) {
-    posix_event_set(reinterpret_cast<PosixEvent*>(handle));
+    auto* ev = wait_object_from_handle(handle);
+    if (!ev || ev->type != PosixHandleType::Event) return false;
+    event_set(ev);
     return true;
 }
 
 bool EventWaitHandle_Reset(intptr_t handle) {
-    posix_event_reset(reinterpret_cast<PosixEvent*>(handle));
+    auto* ev = wait_object_from_handle(handle);
+    if (!ev || ev->type != PosixHandleType::Event) return false;
+    event_reset(ev);
     return true;
 }
 
 intptr_t Mutex_CreateMutexCoreWin32(bool initiallyOwned) {
-    return reinterpret_cast<intptr_t>(posix_mutex_create(initiallyOwned));
+    auto* m = wait_object_create(PosixHandleType::Mutex);
+    if (!m) throw_invalid_operation();
+    if (initiallyOwned) mutex_take_initial_ownership(m);
+    return m->handle;
 }
 
 void Mutex_ReleaseMutex(intptr_t handle) {
-    posix_mutex_release(reinterpret_cast<PosixMutex*>(handle));
+    WaitObject* m = checked_wait_object(handle);
+    if (m->type != PosixHandleType::Mutex) throw_invalid_operation();
+    if (!mutex_release(m)) throw_mutex_not_owned();
 }
 
 intptr_t Semaphore_CreateSemaphoreCoreWin32(Int32 initialCount, Int32 maximumCount) {
-    return reinterpret_cast<intptr_t>(posix_semaphore_create(initialCount, maximumCount));
+    auto* s = wait_object_create(PosixHandleType::Semaphore);
+    if (!s) throw_invalid_operation();
+    s->count = initialCount;
+    s->max_count = maximumCount;
+    return s->handle;
 }
 
 Int32 Semaphore_ReleaseSemaphore(intptr_t handle, Int32 releaseCount) {
-    return posix_semaphore_release(reinterpret_cast<PosixSemaphore*>(handle), releaseCount);
+    WaitObject* s = checked_wait_object(handle);
+    if (s->type != PosixHandleType::Semaphore) throw_invalid_operation();
+    int32_t previous = 0;
+    if (!semaphore_release(s, releaseCount, &previous)) throw_semaphore_full();
+    return previous;
 }
 
 void WaitHandle_CloseHandle(intptr_t handle) {
-    auto* base = reinterpret_cast<PosixHandleBase*>(handle);
-    if (!base) return;
-    switch (base->type) {
-        case PosixHandleType::Event:
-            posix_event_destroy(static_cast<PosixEvent*>(base)); break;
-        case PosixHandleType::Mutex:
-            posix_mutex_destroy(static_cast<PosixMutex*>(base)); break;
-        case PosixHandleType::Semaphore:
-            posix_semaphore_destroy(static_cast<PosixSemaphore*>(base)); break;
-    }
+    wait_object_close(handle);
 }
 
 #endif
 
 } // namespace icall
 } // namespace cil2cpp
+
+#ifndef _WIN32
+
+// ===== Interop.Kernel32 QCall entry points (Unix CoreLib) =====
+//
+// Called through compiler-generated P/Invoke wrappers. Names are rejected by the managed
+// side on Unix before reaching here; security attributes and access masks are ignored.
+// Win32 BOOL results: nonzero = success.
+
+namespace {
+
+using cil2cpp::icall::PosixHandleType;
+using cil2cpp::icall::WaitObject;
+
+constexpr uint32_t CREATE_EVENT_MANUAL_RESET = 0x1;
+constexpr uint32_t CREATE_EVENT_INITIAL_SET = 0x2;
+constexpr uint32_t CREATE_MUTEX_INITIAL_OWNER = 0x1;
+
+WaitObject* as_wait_object(intptr_t handle, PosixHandleType type) {
+    auto* obj = cil2cpp::icall::wait_object_from_handle(handle);
+    return (obj && obj->type == type) ? obj : nullptr;
+}
+
+} // anonymous namespace
+
+extern "C" {
+
+intptr_t CreateEventExW(intptr_t /*lpEventAttributes*/, uint16_t* /*lpName*/,
+    uint32_t dwFlags, uint32_t /*dwDesiredAccess*/) {
+    auto* ev = cil2cpp::icall::wait_object_create(PosixHandleType::Event);
+    if (!ev) return 0;
+    ev->manual_reset = (dwFlags & CREATE_EVENT_MANUAL_RESET) != 0;
+    ev->signaled = (dwFlags & CREATE_EVENT_INITIAL_SET) != 0;
+    return ev->handle;
+}
+
+int32_t SetEvent(intptr_t hEvent) {
+    auto* ev = as_wait_object(hEvent, PosixHandleType::Event);
+    if (!ev) return 0;
+    cil2cpp::icall::event_set(ev);
+    return 1;
+}
+
+int32_t ResetEvent(intptr_t hEvent) {
+    auto* ev = as_wait_object(hEvent, PosixHandleType::Event);
+    if (!ev) return 0;
+    cil2cpp::icall::event_reset(ev);
+    return 1;
+}
+
+intptr_t CreateMutexExW(intptr_t /*lpMutexAttributes*/, uint16_t* /*lpName*/,
+    uint32_t dwFlags, uint32_t /*dwDesiredAccess*/) {
+    bool owned = (dwFlags & CREATE_MUTEX_INITIAL_OWNER) != 0;
+    auto* m = cil2cpp::icall::wait_object_create(PosixHandleType::Mutex);
+    if (!m) return 0;
+    if (owned) cil2cpp::icall::mutex_take_initial_ownership(m);
+    return m->handle;
+}
+
+int32_t ReleaseMutex(intptr_t hMutex) {
+    auto* m = as_wait_object(hMutex, PosixHandleType::Mutex);
+    return (m && cil2cpp::icall::mutex_release(m)) ? 1 : 0;
+}
+
+intptr_t CreateSemaphoreExW(intptr_t /*lpSemaphoreAttributes*/, int32_t lInitialCount,
+    int32_t lMaximumCount, uint16_t* /*lpName*/, uint32_t /*dwFlags*/,
+    uint32_t /*dwDesiredAccess*/) {
+    if (lMaximumCount <= 0 || lInitialCount < 0 || lInitialCount > lMaximumCount) return 0;
+    auto* s = cil2cpp::icall::wait_object_create(PosixHandleType::Semaphore);
+    if (!s) return 0;
+    s->count = lInitialCount;
+    s->max_count = lMaximumCount;
+    return s->handle;
+}
+
+int32_t ReleaseSemaphore(intptr_t hSemaphore, int32_t lReleaseCount, int32_t* lpPreviousCount) {
+    auto* s = as_wait_object(hSemaphore, PosixHandleType::Semaphore);
+    return (s && cil2cpp::icall::semaphore_release(s, lReleaseCount, lpPreviousCount)) ? 1 : 0;
+}
+
+int32_t CloseHandle(intptr_t hObject) {
+    return cil2cpp::icall::wait_object_close(hObject) ? 1 : 0;
+}
+
+} // extern "C"
+
+#endif
@@ -198,6 +198,81 @@ InterfaceVTable* type_get_interface_vtable_checked(TypeInfo* type, TypeInfo* int
     return result;
 }
 
+// ===== Generic virtual method dispatch (inline cache slow path) =====
+
+namespace {
+
+// Sites with at most this many receiver types are scanned linearly on a miss;
+// larger (megamorphic) sites get an open-addressing hash table keyed by TypeInfo*.
+constexpr Int32 kGvmLinearMax = 8;
+
+struct GvmHashTable {
+    struct Entry {
+        TypeInfo* type;
+        Int32 index;
+    };
+    uint32_t mask;
+    Entry entries[1];   // mask + 1 entries
+};
+
+inline uint32_t gvm_hash(TypeInfo* type) {
+    // TypeInfos are static objects: drop alignment bits, then Fibonacci-mix
+    auto bits = reinterpret_cast<uintptr_t>(type) >> 4;
+    return static_cast<uint32_t>((bits * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+GvmHashTable* gvm_build_table(GvmCallSite* site) {
+    uint32_t capacity = 16;
+    while (capacity < static_cast<uint32_t>(site->count) * 2) capacity <<= 1;
+
+    auto bytes = sizeof(GvmHashTable) + (capacity - 1) * sizeof(GvmHashTable::Entry);
+    auto* table = static_cast<GvmHashTable*>(::operator new(bytes));
+    table->mask = capacity - 1;
+    for (uint32_t i = 0; i < capacity; i++)
+        table->entries[i] = { nullptr, -1 };
+
+    for (Int32 i = 0; i < site->count; i++) {
+        auto* type = site->types[i];
+        uint32_t slot = gvm_hash(type) & table->mask;
+        while (table->entries[slot].type && table->entries[slot].type != type)
+            slot = (slot + 1) & table->mask;
+        // First listed override wins (same order as the compiler's target list)
+        if (!table->entries[slot].type)
+            table->entries[slot] = { type, i };
+    }
+
+    // Publish; if another thread won the race, use its table
+    void* expected = nullptr;
+    if (!site->table.compare_exchange_strong(expected, table,
+            std::memory_order_acq_rel, std::memory_order_acquire)) {
+        ::operator delete(table);
+        return static_cast<GvmHashTable*>(expected);
+    }
+    return table;
+}
+
+} // namespace
+
+Int32 gvm_resolve(GvmCallSite* site, TypeInfo* type) {
+    Int32 index = -1;
+    if (site->count <= kGvmLinearMax) {
+        for (Int32 i = 0; i < site->count; i++) {
+            if (site->types[i] == type) { index = i; break; }
+        }
+    } else {
+        auto* table = static_cast<GvmHashTable*>(site->table.load(std::memory_order_acquire));
+        if (!table) table = gvm_build_table(site);
+        uint32_t slot = gvm_hash(type) & table->mask;
+        while (table->entries[slot].type) {
+            if (table->entries[slot].type == type) { index = table->entries[slot].index; break; }
+            slot = (slot + 1) & table->mask;
+        }
+    }
+    if (index >= 0)
+        site->last.store(&site->types[index], std::memory_order_relaxed);
+    return index;
+}
+
 InterfaceVTable* obj_get_interface_vtable(Object* obj, TypeInfo* interface_type) {
     if (!obj) throw_null_reference();
 
@@ -266,6 +341,11 @@ void type_register(TypeInfo* type) {
     }
 }
 
+void type_for_each_registered(void (*visit)(TypeInfo* type, void* context), void* context) {
+    std::lock_guard<std::mutex> lock(g_type_registry_mutex);
+    for (auto& [name, type] : g_type_registry) visit(type, context);
+}
+
 // Object method implementations
 Object* object_alloc(TypeInfo* type) {
     if (!type) {
@@ -13,8 +13,17 @@
 #include <unicode/uversion.h> // u_getVersion
 #include <unicode/uloc.h>     // uloc_getDefault
 
+#include <cstdint>
 #include <cstring>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CIL2CPP_ASCII_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define CIL2CPP_ASCII_NEON 1
+#endif
+
 namespace cil2cpp {
 namespace unicode {
 
@@ -81,6 +90,7 @@ bool is_low_surrogate(Char c) {
 // ===== Case Conversion =====
 
 Char to_upper(Char c) {
+    if (c < 0x80) return ascii_to_upper(c);
     UChar32 result = u_toupper(static_cast<UChar32>(c));
     // If result is outside BMP, return original (single Char can't represent supplementary)
     if (result > 0xFFFF) return c;
@@ -88,6 +98,7 @@ Char to_upper(Char c) {
 }
 
 Char to_lower(Char c) {
+    if (c < 0x80) return ascii_to_lower(c);
     UChar32 result = u_tolower(static_cast<UChar32>(c));
     if (result > 0xFFFF) return c;
     return static_cast<Char>(result);
@@ -112,6 +123,40 @@ Char to_lower_locale(Char c) {
     return static_cast<Char>(dest[0]);
 }
 
+// ===== ASCII Detection =====
+
+bool is_ascii(const Char* chars, Int32 length) {
+    Int32 i = 0;
+    // OR everything together and test the high bits once per block: the common case
+    // (all ASCII) never branches on data.
+#if defined(CIL2CPP_ASCII_SSE2)
+    const __m128i mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i + 8));
+        __m128i high = _mm_and_si128(_mm_or_si128(a, b), mask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF) return false;
+    }
+#elif defined(CIL2CPP_ASCII_NEON)
+    const uint16x8_t mask = vdupq_n_u16(0xFF80);
+    for (; i + 16 <= length; i += 16) {
+        uint16x8_t a = vld1q_u16(reinterpret_cast<const uint16_t*>(chars + i));
+        uint16x8_t b = vld1q_u16(reinterpret_cast<const uint16_t*>(chars + i + 8));
+        if (vmaxvq_u16(vandq_u16(vorrq_u16(a, b), mask)) != 0) return false;
+    }
+#endif
+    for (; i + 4 <= length; i += 4) {
+        uint64_t word;
+        std::memcpy(&word, chars + i, sizeof(word));
+        if (word & 0xFF80FF80FF80FF80ULL) return false;
+    }
+    for (; i < length; i++) {
+        if (chars[i] >= 0x80) return false;
+    }
+    return true;
+}
+
 // ===== UTF-8 ↔ UTF-16 Conversion =====
 
 Int32 utf8_to_utf16(const char* utf8, Char* out, Int32 outCapacity) {
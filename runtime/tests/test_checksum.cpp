@@ -0,0 +1,123 @@
+/**
+ * CIL2CPP Runtime Tests - CRC32 / CRC32C / Adler-32 (CPU-dispatched and portable paths)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+#include <interop/compression_interop.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace cil2cpp;
+
+namespace {
+
+std::vector<uint8_t> random_bytes(size_t size, uint32_t seed = 12345) {
+    std::vector<uint8_t> v(size);
+    for (auto& b : v) {
+        seed = seed * 1664525 + 1013904223;
+        b = static_cast<uint8_t>(seed >> 24);
+    }
+    return v;
+}
+
+// Bitwise reference for CRC-32C (zlib has no Castagnoli variant)
+uint32_t crc32c_reference(uint32_t crc, const uint8_t* p, size_t n) {
+    crc = ~crc;
+    while (n--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) crc = (crc & 1) ? (crc >> 1) ^ 0x82F63B78u : crc >> 1;
+    }
+    return ~crc;
+}
+
+// Runs every test body once with the CPU-specific kernels and once with the portable ones.
+class ChecksumTest : public ::testing::TestWithParam<bool> {
+protected:
+    void SetUp() override { checksum::use_hardware(GetParam()); }
+    void TearDown() override { checksum::use_hardware(true); }
+};
+
+} // namespace
+
+TEST_P(ChecksumTest, KnownVectors) {
+    const char* s = "123456789";
+    EXPECT_EQ(checksum::crc32(0, s, 9), 0xCBF43926u);
+    EXPECT_EQ(checksum::crc32c(0, s, 9), 0xE3069283u);
+    EXPECT_EQ(checksum::adler32(1, s, 9), 0x091E01DEu);
+}
+
+TEST_P(ChecksumTest, EmptyInput_ReturnsSeed) {
+    EXPECT_EQ(checksum::crc32(0x1234u, nullptr, 0), 0x1234u);
+    EXPECT_EQ(checksum::crc32c(0, "", 0), 0u);
+    EXPECT_EQ(checksum::adler32(1, "", 0), 1u);
+}
+
+TEST_P(ChecksumTest, MatchesZlib_AllLengthsAndAlignments) {
+    auto data = random_bytes(4096 + 64);
+    for (size_t offset = 0; offset < 16; offset += 3) {
+        for (size_t len : {1, 7, 15, 16, 31, 63, 64, 65, 127, 128, 200, 1000, 4096}) {
+            const uint8_t* p = data.data() + offset;
+            EXPECT_EQ(checksum::crc32(0, p, len), static_cast<uint32_t>(::crc32(0, p, static_cast<uInt>(len))))
+                << "offset " << offset << " len " << len;
+            EXPECT_EQ(checksum::adler32(1, p, len), static_cast<uint32_t>(::adler32(1, p, static_cast<uInt>(len))))
+                << "offset " << offset << " len " << len;
+            EXPECT_EQ(checksum::crc32c(0, p, len), crc32c_reference(0, p, len))
+                << "offset " << offset << " len " << len;
+        }
+    }
+}
+
+TEST_P(ChecksumTest, Adler32_LargeInputReducesModulo) {
+    // All-0xFF input is the worst case for the deferred modulo
+    std::vector<uint8_t> data(100000, 0xFF);
+    EXPECT_EQ(checksum::adler32(1, data.data(), data.size()),
+              static_cast<uint32_t>(::adler32(1, data.data(), static_cast<uInt>(data.size()))));
+}
+
+TEST_P(ChecksumTest, Chaining_OverSplitBuffers) {
+    auto data = random_bytes(10000);
+    uint32_t crc = 0, crcc = 0, adler = 1;
+    for (size_t pos = 0, step = 1; pos < data.size(); pos += step, step = step * 3 % 701 + 1) {
+        size_t n = std::min(step, data.size() - pos);
+        crc = checksum::crc32(crc, data.data() + pos, n);
+        crcc = checksum::crc32c(crcc, data.data() + pos, n);
+        adler = checksum::adler32(adler, data.data() + pos, n);
+    }
+    EXPECT_EQ(crc, checksum::crc32(0, data.data(), data.size()));
+    EXPECT_EQ(crcc, checksum::crc32c(0, data.data(), data.size()));
+    EXPECT_EQ(adler, checksum::adler32(1, data.data(), data.size()));
+}
+
+TEST_P(ChecksumTest, BitCrc32C_MatchesBufferCrc) {
+    // BitOperations.Crc32C steps carry no inversion and consume the value little-endian
+    uint64_t v = 0x0123456789ABCDEFull;
+    uint8_t bytes[8];
+    std::memcpy(bytes, &v, 8);
+    uint32_t seed = 0xFFFFFFFFu;
+    EXPECT_EQ(~bit_crc32c_u64(seed, v), crc32c_reference(0, bytes, 8));
+    EXPECT_EQ(~bit_crc32c_u32(seed, static_cast<uint32_t>(v)), crc32c_reference(0, bytes, 4));
+    EXPECT_EQ(~bit_crc32c_u16(seed, static_cast<uint16_t>(v)), crc32c_reference(0, bytes, 2));
+    EXPECT_EQ(~bit_crc32c_u8(seed, static_cast<uint8_t>(v)), crc32c_reference(0, bytes, 1));
+}
+
+TEST_P(ChecksumTest, CompressionNativeCrc32_MatchesZlib) {
+    auto data = random_bytes(777);
+    EXPECT_EQ(CompressionNative_Crc32(0, data.data(), static_cast<int32_t>(data.size())),
+              static_cast<uint32_t>(::crc32(0, data.data(), static_cast<uInt>(data.size()))));
+    EXPECT_EQ(CompressionNative_Crc32(0x5555u, nullptr, 0), 0u);
+}
+
+INSTANTIATE_TEST_SUITE_P(Dispatch, ChecksumTest, ::testing::Values(true, false),
+    [](const ::testing::TestParamInfo<bool>& info) { return info.param ? "Hardware" : "Portable"; });
+
+TEST(ChecksumDispatchTest, Implementation_ReportsSelection) {
+    bool hardware = checksum::use_hardware(true);
+    EXPECT_EQ(hardware, std::strcmp(checksum::implementation(), "portable") != 0);
+    EXPECT_FALSE(checksum::use_hardware(false));
+    EXPECT_STREQ(checksum::implementation(), "portable");
+    checksum::use_hardware(true);
+}
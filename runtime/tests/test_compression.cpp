@@ -0,0 +1,185 @@
+/**
+ * CIL2CPP Runtime Tests - zlib interop (pooled stream states)
+ */
+
+#include <gtest/gtest.h>
+#include <interop/compression_interop.h>
+#include <zlib.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int32_t kRaw = -15;
+constexpr int32_t kZLib = 15;
+constexpr int32_t kGZip = 31;
+
+std::vector<uint8_t> sample(size_t size) {
+    std::string text;
+    uint32_t seed = 7;
+    while (text.size() < size) {
+        seed = seed * 1103515245 + 12345;
+        text += "token" + std::to_string((seed >> 16) % 97) + ' ';
+    }
+    return std::vector<uint8_t>(text.begin(), text.begin() + size);
+}
+
+// Drives CompressionNative_Deflate the way DeflateStream does: Z_NO_FLUSH, then Z_FINISH.
+std::vector<uint8_t> deflate_stream(PAL_ZStream& s, std::vector<uint8_t>& input) {
+    // compressBound covers the 6-byte zlib wrapper; gzip's is 18 bytes
+    std::vector<uint8_t> out(compressBound(static_cast<uLong>(input.size())) + 12);
+    s.nextIn = input.data();
+    s.availIn = static_cast<uint32_t>(input.size());
+    s.nextOut = out.data();
+    s.availOut = static_cast<uint32_t>(out.size());
+    EXPECT_EQ(CompressionNative_Deflate(&s, Z_NO_FLUSH), Z_OK);
+    EXPECT_EQ(CompressionNative_Deflate(&s, Z_FINISH), Z_STREAM_END);
+    out.resize(out.size() - s.availOut);
+    return out;
+}
+
+std::vector<uint8_t> inflate_stream(PAL_ZStream& s, std::vector<uint8_t>& input, size_t expected) {
+    std::vector<uint8_t> out(expected);
+    s.nextIn = input.data();
+    s.availIn = static_cast<uint32_t>(input.size());
+    s.nextOut = out.data();
+    s.availOut = static_cast<uint32_t>(out.size());
+    EXPECT_EQ(CompressionNative_Inflate(&s, Z_NO_FLUSH), Z_STREAM_END);
+    out.resize(out.size() - s.availOut);
+    return out;
+}
+
+std::vector<uint8_t> compress_fresh(std::vector<uint8_t>& input, int32_t level, int32_t windowBits,
+                                    int32_t memLevel = 8) {
+    z_stream zs{};
+    EXPECT_EQ(deflateInit2(&zs, level, Z_DEFLATED, windowBits, memLevel, Z_DEFAULT_STRATEGY), Z_OK);
+    std::vector<uint8_t> out(deflateBound(&zs, static_cast<uLong>(input.size())));
+    zs.next_in = input.data();
+    zs.avail_in = static_cast<uInt>(input.size());
+    zs.next_out = out.data();
+    zs.avail_out = static_cast<uInt>(out.size());
+    EXPECT_EQ(deflate(&zs, Z_FINISH), Z_STREAM_END);
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+    return out;
+}
+
+} // namespace
+
+TEST(CompressionTest, Stream_RoundTrip) {
+    auto input = sample(100000);
+    PAL_ZStream d{};
+    ASSERT_EQ(CompressionNative_DeflateInit2_(&d, 6, Z_DEFLATED, kGZip, 8, Z_DEFAULT_STRATEGY), Z_OK);
+    auto compressed = deflate_stream(d, input);
+    EXPECT_EQ(CompressionNative_DeflateEnd(&d), Z_OK);
+    EXPECT_EQ(d.internalState, nullptr);
+    EXPECT_LT(compressed.size(), input.size());
+
+    PAL_ZStream i{};
+    ASSERT_EQ(CompressionNative_InflateInit2_(&i, kGZip), Z_OK);
+    EXPECT_EQ(inflate_stream(i, compressed, input.size()), input);
+    EXPECT_EQ(CompressionNative_InflateEnd(&i), Z_OK);
+}
+
+TEST(CompressionTest, Deflater_ReusedForSameWindowAndMemLevel) {
+    PAL_ZStream a{};
+    ASSERT_EQ(CompressionNative_DeflateInit2_(&a, 6, Z_DEFLATED, kRaw, 8, Z_DEFAULT_STRATEGY), Z_OK);
+    void* state = a.internalState;
+    CompressionNative_DeflateEnd(&a);
+
+    PAL_ZStream b{};
+    ASSERT_EQ(CompressionNative_DeflateInit2_(&b, 6, Z_DEFLATED, kRaw, 8, Z_DEFAULT_STRATEGY), Z_OK);
+    EXPECT_EQ(b.internalState, state);
+    CompressionNative_DeflateEnd(&b);
+
+    // Different memLevel sizes the buffers differently: never handed the pooled state
+    PAL_ZStream c{};
+    ASSERT_EQ(CompressionNative_DeflateInit2_(&c, 6, Z_DEFLATED, kRaw, 9, Z_DEFAULT_STRATEGY), Z_OK);
+    EXPECT_NE(c.internalState, state);
+    CompressionNative_DeflateEnd(&c);
+}
+
+TEST(CompressionTest, Deflater_ReusedAcrossLevels_MatchesFreshOutput) {
+    auto input = sample(50000);
+    PAL_ZStream warm{};
+    ASSERT_EQ(CompressionNative_DeflateInit2_(&warm, 9, Z_DEFLATED, kZLib, 8, Z_DEFAULT_STRATEGY), Z_OK);
+    void* state = warm.internalState;
+    deflate_stream(warm, input);
+    CompressionNative_DeflateEnd(&warm);
+
+    for (int32_t level : {1, 6, -1, 9}) {
+        PAL_ZStream s{};
+        ASSERT_EQ(CompressionNative_DeflateInit2_(&s, level, Z_DEFLATED, kZLib, 8, Z_DEFAULT_STRATEGY), Z_OK);
+        EXPECT_EQ(s.internalState, state);
+        EXPECT_EQ(deflate_stream(s, input), compress_fresh(input, level, kZLib)) << "level " << level;
+        CompressionNative_DeflateEnd(&s);
+    }
+}
+
+TEST(CompressionTest, Deflater_AbandonedMidStream_ReportsDataError) {
+    auto input = sample(200000);
+    PAL_ZStream s{};
+    ASSERT_EQ(CompressionNative_DeflateInit2_(&s, 6, Z_DEFLATED, kRaw, 8, Z_DEFAULT_STRATEGY), Z_OK);
+    std::vector<uint8_t> scratch(1024);
+    s.nextIn = input.data();
+    s.availIn = static_cast<uint32_t>(input.size());
+    s.nextOut = scratch.data();
+    s.availOut = static_cast<uint32_t>(scratch.size());
+    CompressionNative_Deflate(&s, Z_NO_FLUSH);   // disposed without Z_FINISH
+    EXPECT_EQ(CompressionNative_DeflateEnd(&s), Z_DATA_ERROR);   // as deflateEnd reports it
+    EXPECT_EQ(s.internalState, nullptr);
+
+    PAL_ZStream t{};
+    ASSERT_EQ(CompressionNative_DeflateInit2_(&t, 6, Z_DEFLATED, kRaw, 8, Z_DEFAULT_STRATEGY), Z_OK);
+    EXPECT_EQ(deflate_stream(t, input), compress_fresh(input, 6, kRaw));
+    CompressionNative_DeflateEnd(&t);
+}
+
+TEST(CompressionTest, Inflater_ReusedAcrossWindowBits) {
+    auto input = sample(30000);
+    auto gz = compress_fresh(input, 6, kGZip);
+    auto raw = compress_fresh(input, 6, kRaw);
+
+    PAL_ZStream a{};
+    ASSERT_EQ(CompressionNative_InflateInit2_(&a, kGZip), Z_OK);
+    void* state = a.internalState;
+    EXPECT_EQ(inflate_stream(a, gz, input.size()), input);
+    CompressionNative_InflateEnd(&a);
+
+    PAL_ZStream b{};
+    ASSERT_EQ(CompressionNative_InflateInit2_(&b, kRaw), Z_OK);
+    EXPECT_EQ(b.internalState, state);
+    EXPECT_EQ(inflate_stream(b, raw, input.size()), input);
+    CompressionNative_InflateEnd(&b);
+}
+
+TEST(CompressionTest, Pool_IsPerThread) {
+    PAL_ZStream mine{};
+    ASSERT_EQ(CompressionNative_DeflateInit2_(&mine, 6, Z_DEFLATED, 12, 4, Z_DEFAULT_STRATEGY), Z_OK);
+    void* parked = mine.internalState;
+    CompressionNative_DeflateEnd(&mine);   // parked in this thread's pool, still allocated
+
+    std::thread([&] {
+        auto input = sample(5000);
+        PAL_ZStream s{};
+        ASSERT_EQ(CompressionNative_DeflateInit2_(&s, 6, Z_DEFLATED, 12, 4, Z_DEFAULT_STRATEGY), Z_OK);
+        EXPECT_NE(s.internalState, parked);
+        EXPECT_EQ(deflate_stream(s, input), compress_fresh(input, 6, 12, 4));
+        CompressionNative_DeflateEnd(&s);
+    }).join();   // thread exit frees that thread's pool
+
+    ASSERT_EQ(CompressionNative_DeflateInit2_(&mine, 6, Z_DEFLATED, 12, 4, Z_DEFAULT_STRATEGY), Z_OK);
+    EXPECT_EQ(mine.internalState, parked);
+    CompressionNative_DeflateEnd(&mine);
+}
+
+TEST(CompressionTest, Init_InvalidParameters_ReportsZlibError) {
+    PAL_ZStream s{};
+    EXPECT_EQ(CompressionNative_DeflateInit2_(&s, 42, Z_DEFLATED, kRaw, 8, Z_DEFAULT_STRATEGY), Z_STREAM_ERROR);
+    EXPECT_EQ(s.internalState, nullptr);
+    EXPECT_EQ(CompressionNative_InflateInit2_(&s, 3), Z_STREAM_ERROR);
+    EXPECT_EQ(s.internalState, nullptr);
+    EXPECT_EQ(CompressionNative_DeflateEnd(&s), Z_STREAM_ERROR);
+}
@@ -0,0 +1,148 @@
+/**
+ * CIL2CPP Runtime Tests - Lock contention profiler (named runtime locks, monitors, report)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace cil2cpp;
+
+namespace {
+
+#ifdef _MSC_VER
+#define TEST_NOINLINE __declspec(noinline)
+#else
+#define TEST_NOINLINE __attribute__((noinline))
+#endif
+
+TypeInfo ContendedType = {
+    .name = "ContendedObj",
+    .namespace_name = "Tests",
+    .full_name = "Tests.ContendedObj",
+    .base_type = nullptr,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(Object),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .properties = nullptr, .property_count = 0,
+    .finalizer = nullptr,
+};
+
+contention::Mutex g_test_mutex{"test.mutex"};
+
+const contention::Entry* find(const std::vector<contention::Entry>& entries, const std::string& prefix) {
+    for (const auto& e : entries)
+        if (e.site.rfind(prefix, 0) == 0) return &e;
+    return nullptr;
+}
+
+class ContentionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        gc::init();
+        contention::reset();
+        contention::enable();
+    }
+    void TearDown() override {
+        contention::disable();
+        contention::reset();
+    }
+};
+
+} // namespace
+
+// Stand-in for a generated method holding a `lock` statement
+TEST_NOINLINE void ContentionTest_LockSite(Object* obj) {
+    monitor::enter(obj);
+    monitor::exit(obj);
+}
+
+TEST_F(ContentionTest, Mutex_RecordsWaitUnderStaticName) {
+    std::atomic<bool> started{false};
+    g_test_mutex.lock();
+    std::thread t([&] {
+        started.store(true);
+        std::lock_guard<contention::Mutex> guard(g_test_mutex);
+    });
+    while (!started.load()) std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    g_test_mutex.unlock();
+    t.join();
+
+    auto* e = find(contention::entries(), "runtime test.mutex");
+    ASSERT_NE(e, nullptr);
+    EXPECT_EQ(e->contentions, 1u);
+    EXPECT_GT(e->wait_ns, 0u);
+    EXPECT_EQ(e->max_wait_ns, e->wait_ns);
+}
+
+TEST_F(ContentionTest, Monitor_RecordsTypeAndCallingMethod) {
+    auto* obj = object_alloc(&ContendedType);
+    ASSERT_NE(obj, nullptr);
+
+    auto before = monitor::get_contention_count();
+    monitor::enter(obj);
+    std::thread t([&] {
+        gc::register_thread();
+        ContentionTest_LockSite(obj);
+        gc::unregister_thread();
+    });
+    while (monitor::get_contention_count() == before) std::this_thread::yield();
+    monitor::exit(obj);
+    t.join();
+
+    auto entries = contention::entries();
+    auto* e = find(entries, "monitor Tests.ContendedObj @ ");
+    ASSERT_NE(e, nullptr);
+    EXPECT_EQ(e->contentions, 1u);
+#ifdef __linux__
+    EXPECT_NE(e->site.find("ContentionTest_LockSite"), std::string::npos) << e->site;
+#endif
+}
+
+TEST_F(ContentionTest, Disabled_RecordsNothing) {
+    contention::disable();
+    std::atomic<bool> started{false};
+    g_test_mutex.lock();
+    std::thread t([&] {
+        started.store(true);
+        std::lock_guard<contention::Mutex> guard(g_test_mutex);
+    });
+    while (!started.load()) std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    g_test_mutex.unlock();
+    t.join();
+
+    EXPECT_TRUE(contention::entries().empty());
+}
+
+TEST_F(ContentionTest, Report_ListsTopSitesByWait) {
+    static contention::Site slow("test.slow");   // sites stay registered for the process lifetime
+    static contention::Site fast("test.fast");
+    contention::record(slow, 3000000);
+    contention::record(slow, 1000000);
+    contention::record(fast, 500000);
+
+    auto entries = contention::entries();
+    ASSERT_GE(entries.size(), 2u);
+    EXPECT_EQ(entries[0].site, "runtime test.slow");
+    EXPECT_EQ(entries[0].contentions, 2u);
+    EXPECT_EQ(entries[0].wait_ns, 4000000u);
+    EXPECT_EQ(entries[0].max_wait_ns, 3000000u);
+
+    auto text = contention::report(1);
+    EXPECT_EQ(text.rfind("cil2cpp lock contention: top 1 of ", 0), 0u);
+    EXPECT_NE(text.find("       4.000      3.000  runtime test.slow\n"), std::string::npos) << text;
+    EXPECT_EQ(text.find("test.fast"), std::string::npos);
+}
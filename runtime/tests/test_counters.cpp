@@ -0,0 +1,210 @@
+/**
+ * CIL2CPP Runtime Tests - Runtime counters (System.Runtime set, text / JSON dump, Meter)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace cil2cpp;
+
+namespace {
+
+const counters::Value* find(const std::vector<counters::Value>& values, const char* name) {
+    for (const auto& v : values)
+        if (std::string(v.name) == name) return &v;
+    return nullptr;
+}
+
+std::string read_all(FILE* f) {
+    std::string text;
+    std::rewind(f);
+    char buf[4096];
+    size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) text.append(buf, n);
+    return text;
+}
+
+std::string utf8(String* s) {
+    char* chars = string_to_utf8(s);
+    std::string text = chars ? chars : "";
+    std::free(chars);
+    return text;
+}
+
+TypeInfo FuncInt64TypeInfo = {
+    .name = "Func`1<Int64>", .namespace_name = "System", .full_name = "System.Func`1<System.Int64>",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(Delegate), .element_size = 0, .flags = TypeFlags::None,
+};
+
+TypeInfo FuncDoubleTypeInfo = {
+    .name = "Func`1<Double>", .namespace_name = "System", .full_name = "System.Func`1<System.Double>",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(Delegate), .element_size = 0, .flags = TypeFlags::None,
+};
+
+// What the generated Meter factories were asked to create
+struct PublishedInstrument {
+    const char* kind;
+    Object* meter;
+    std::string name;
+    std::string unit;
+    Delegate* observe;
+};
+
+std::vector<std::string> g_meter_names;
+std::vector<PublishedInstrument> g_instruments;
+Object g_meter{};
+
+template <const char* Kind>
+void record_instrument(Object* meter, String* name, Delegate* observe, String* unit, String*) {
+    g_instruments.push_back({ Kind, meter, utf8(name), utf8(unit), observe });
+}
+
+constexpr char kCounterInt64[] = "ObservableCounter<long>";
+constexpr char kUpDownCounterInt64[] = "ObservableUpDownCounter<long>";
+constexpr char kCounterDouble[] = "ObservableCounter<double>";
+
+const PublishedInstrument* find_instrument(const char* name) {
+    for (const auto& i : g_instruments)
+        if (i.name == name) return &i;
+    return nullptr;
+}
+
+} // namespace
+
+TEST(CountersTest, Read_ReportsLiveRuntimeState) {
+    auto s = counters::read();
+    EXPECT_GT(s.timestamp_ns, 0);
+    EXPECT_GE(s.cpu_time_ns, 0);
+    EXPECT_EQ(s.exception_count, static_cast<int64_t>(exception_count()));
+    EXPECT_EQ(s.lock_contention_count, monitor::get_contention_count());
+    EXPECT_EQ(s.threadpool_completed_items, threadpool::get_completions());
+#ifdef __linux__
+    EXPECT_GT(s.working_set_bytes, 0);
+#endif
+}
+
+TEST(CountersTest, Compute_RatesOverInterval) {
+    counters::Sample a;
+    a.timestamp_ns = 1000000000;
+    counters::Sample b = a;
+    b.timestamp_ns = a.timestamp_ns + 2000000000;   // 2 s later
+    b.allocated_bytes = 4000;
+    b.exception_count = 6;
+    b.gc_count = 2;
+    b.gc_pause_ns = 20000000;                       // 1% of the interval
+    b.gc_committed_bytes = 8000000;
+    b.gc_fragmented_bytes = 2000000;
+    b.gc_heap_size_bytes = 6000000;
+    b.threadpool_queue_length = 3;
+
+    auto values = counters::compute(a, b);
+    EXPECT_DOUBLE_EQ(find(values, "alloc-rate")->value, 2000.0);
+    EXPECT_DOUBLE_EQ(find(values, "exception-count")->value, 3.0);
+    EXPECT_DOUBLE_EQ(find(values, "gen-0-gc-count")->value, 1.0);
+    EXPECT_DOUBLE_EQ(find(values, "gen-2-gc-count")->value, 1.0);
+    EXPECT_DOUBLE_EQ(find(values, "time-in-gc")->value, 1.0);
+    EXPECT_DOUBLE_EQ(find(values, "gc-fragmentation")->value, 25.0);
+    EXPECT_DOUBLE_EQ(find(values, "gc-heap-size")->value, 6.0);
+    EXPECT_DOUBLE_EQ(find(values, "threadpool-queue-length")->value, 3.0);
+    EXPECT_STREQ(find(values, "gc-heap-size")->display_name, "GC Heap Size (MB)");
+}
+
+TEST(CountersTest, Format_TextAndJson) {
+    std::vector<counters::Value> values = {
+        { "gc-heap-size", "GC Heap Size (MB)", 12.5 },
+        { "exception-count", "Exception Count (Count / 1 sec)", 3 },
+    };
+
+    auto json = counters::format(values, counters::Format::Json);
+    EXPECT_EQ(json.rfind("{\"timestamp\":\"", 0), 0u);
+    EXPECT_NE(json.find("\"provider\":\"System.Runtime\""), std::string::npos);
+    EXPECT_NE(json.find("\"counters\":{\"gc-heap-size\":12.500,\"exception-count\":3}}\n"), std::string::npos);
+
+    auto text = counters::format(values, counters::Format::Text);
+    EXPECT_EQ(text.rfind("[System.Runtime] ", 0), 0u);
+    EXPECT_NE(text.find("    GC Heap Size (MB)"), std::string::npos);
+    EXPECT_NE(text.find(" 12.500\n"), std::string::npos);
+    EXPECT_NE(text.find(" 3\n"), std::string::npos);
+}
+
+TEST(CountersTest, Start_DumpsPeriodicallyAndOnStop) {
+    FILE* out = std::tmpfile();
+    ASSERT_NE(out, nullptr);
+    ASSERT_TRUE(counters::start(out, 20, counters::Format::Json));
+    EXPECT_TRUE(counters::is_running());
+    EXPECT_FALSE(counters::start(out, 20, counters::Format::Json));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    counters::stop();
+    EXPECT_FALSE(counters::is_running());
+
+    auto text = read_all(out);
+    std::fclose(out);
+    size_t records = 0;
+    for (size_t pos = 0; (pos = text.find("\"provider\":\"System.Runtime\"", pos)) != std::string::npos; pos++)
+        records++;
+    EXPECT_GE(records, 2u);
+    EXPECT_NE(text.find("\"threadpool-completed-items-count\":"), std::string::npos);
+}
+
+TEST(CountersTest, PublishMeter_CreatesSystemRuntimeInstrumentsOnce) {
+    runtime_init();
+    EXPECT_FALSE(counters::publish_meter());   // nothing registered yet
+
+    counters::MeterFactories factories{};
+    factories.create_meter = [](String* name) {
+        g_meter_names.push_back(utf8(name));
+        return &g_meter;
+    };
+    factories.func_int64 = &FuncInt64TypeInfo;
+    factories.func_double = &FuncDoubleTypeInfo;
+    factories.counter_int64 = record_instrument<kCounterInt64>;
+    factories.up_down_counter_int64 = record_instrument<kUpDownCounterInt64>;
+    factories.counter_double = record_instrument<kCounterDouble>;
+    counters::set_meter_factories(factories);
+
+    ASSERT_TRUE(counters::publish_meter());
+    ASSERT_EQ(g_meter_names.size(), 1u);
+    EXPECT_EQ(g_meter_names[0], "System.Runtime");
+    ASSERT_FALSE(g_instruments.empty());
+    for (const auto& i : g_instruments)
+        EXPECT_EQ(i.meter, &g_meter);
+
+    // The callbacks are static delegates over live readings, as a listener invokes them
+    auto* exceptions = find_instrument("dotnet.exceptions");
+    ASSERT_NE(exceptions, nullptr);
+    EXPECT_STREQ(exceptions->kind, kCounterInt64);
+    EXPECT_EQ(exceptions->unit, "{exception}");
+    EXPECT_EQ(exceptions->observe->__type_info, &FuncInt64TypeInfo);
+    EXPECT_EQ(exceptions->observe->target, nullptr);
+    auto observe_int64 = reinterpret_cast<int64_t (*)()>(exceptions->observe->method_ptr);
+    EXPECT_EQ(observe_int64(), static_cast<int64_t>(exception_count()));
+
+    auto* queue = find_instrument("dotnet.thread_pool.queue.length");
+    ASSERT_NE(queue, nullptr);
+    EXPECT_STREQ(queue->kind, kUpDownCounterInt64);
+
+    auto* cpu = find_instrument("dotnet.process.cpu.time");
+    ASSERT_NE(cpu, nullptr);
+    EXPECT_STREQ(cpu->kind, kCounterDouble);
+    EXPECT_EQ(cpu->unit, "s");
+    EXPECT_EQ(cpu->observe->__type_info, &FuncDoubleTypeInfo);
+    auto observe_double = reinterpret_cast<double (*)()>(cpu->observe->method_ptr);
+    EXPECT_GT(observe_double(), 0.0);
+
+    // A second publish is a no-op: the meter already exists
+    size_t published = g_instruments.size();
+    EXPECT_TRUE(counters::publish_meter());
+    EXPECT_EQ(g_meter_names.size(), 1u);
+    EXPECT_EQ(g_instruments.size(), published);
+    runtime_shutdown();
+}
@@ -385,6 +385,143 @@ TEST_F(ExceptionTest, Rethrow_PreservesException) {
     EXPECT_EQ(inner_ex, outer_ex);  // Same exception object
 }
 
+// ===== exception_count =====
+
+TEST_F(ExceptionTest, ExceptionCount_CountsThrowsNotPropagation) {
+    auto before = exception_count();
+
+    // One throw unwinding through a finally: counted once
+    CIL2CPP_TRY
+        CIL2CPP_TRY
+            throw_null_reference();
+        CIL2CPP_FINALLY
+        CIL2CPP_END_TRY
+    CIL2CPP_CATCH_ALL
+    CIL2CPP_END_TRY
+    EXPECT_EQ(exception_count(), before + 1);
+
+    // A rethrow is a new throw, as in CoreCLR
+    CIL2CPP_TRY
+        CIL2CPP_TRY
+            throw_null_reference();
+        CIL2CPP_CATCH_ALL
+            CIL2CPP_RETHROW;
+        CIL2CPP_END_TRY
+    CIL2CPP_CATCH_ALL
+    CIL2CPP_END_TRY
+    EXPECT_EQ(exception_count(), before + 3);
+    EXPECT_EQ(exception_get_count(), static_cast<UInt32>(before + 3));
+
+    // A rejecting filter lets the same throw continue: not counted again
+    CIL2CPP_TRY
+        CIL2CPP_TRY
+            throw_null_reference();
+        CIL2CPP_FILTER_BEGIN
+            int32_t __filter_result = 0;
+            if (__filter_result) { CIL2CPP_MARK_CAUGHT; } else { CIL2CPP_FILTER_REJECT; }
+        CIL2CPP_END_TRY
+    CIL2CPP_CATCH_ALL
+    CIL2CPP_END_TRY
+    EXPECT_EQ(exception_count(), before + 4);
+}
+
+// ===== AppDomain.FirstChanceException =====
+
+namespace {
+
+// Generated layout of System.Runtime.ExceptionServices.FirstChanceExceptionEventArgs
+struct FirstChanceArgs : Object {
+    Exception* f_Exception;
+};
+
+TypeInfo FirstChanceArgsType = {
+    .name = "FirstChanceExceptionEventArgs",
+    .namespace_name = "System.Runtime.ExceptionServices",
+    .full_name = "System.Runtime.ExceptionServices.FirstChanceExceptionEventArgs",
+    .base_type = nullptr,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(FirstChanceArgs),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+   .properties = nullptr, .property_count = 0,
+        .default_ctor = nullptr,
+    .finalizer = nullptr,
+    .interface_vtables = nullptr,
+    .interface_vtable_count = 0,
+};
+
+TypeInfo FirstChanceHandlerType = {
+    .name = "EventHandler`1",
+    .namespace_name = "System",
+    .full_name = "System.EventHandler`1",
+    .base_type = nullptr,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(Delegate),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+   .properties = nullptr, .property_count = 0,
+        .default_ctor = nullptr,
+    .finalizer = nullptr,
+    .interface_vtables = nullptr,
+    .interface_vtable_count = 0,
+};
+
+int g_first_chance_calls = 0;
+Exception* g_first_chance_seen = nullptr;
+
+void first_chance_handler(Object* sender, Object* e) {
+    EXPECT_EQ(sender, nullptr);
+    g_first_chance_calls++;
+    g_first_chance_seen = static_cast<FirstChanceArgs*>(e)->f_Exception;
+    // Throws inside a handler don't raise the event again, and don't escape
+    throw_invalid_operation();
+}
+
+} // namespace
+
+TEST_F(ExceptionTest, FirstChanceException_RaisedBeforeCatch) {
+    exception_set_first_chance_args_typeinfo(&FirstChanceArgsType, sizeof(FirstChanceArgs),
+        offsetof(FirstChanceArgs, f_Exception));
+    auto* handler = delegate_create(&FirstChanceHandlerType, nullptr, (void*)first_chance_handler);
+    exception_add_first_chance_handler(handler);
+    g_first_chance_calls = 0;
+    g_first_chance_seen = nullptr;
+
+    Exception* caught = nullptr;
+    CIL2CPP_TRY
+        CIL2CPP_TRY
+            throw_null_reference();
+        CIL2CPP_FINALLY
+            EXPECT_EQ(g_first_chance_calls, 1);
+        CIL2CPP_END_TRY
+    CIL2CPP_CATCH_ALL
+        caught = get_current_exception();
+    CIL2CPP_END_TRY
+    ASSERT_NE(caught, nullptr);
+    EXPECT_EQ(caught->__type_info, &NullReferenceException_TypeInfo);
+    EXPECT_EQ(g_first_chance_calls, 1);
+    EXPECT_EQ(g_first_chance_seen, caught);
+
+    exception_remove_first_chance_handler(handler);
+    CIL2CPP_TRY
+        throw_null_reference();
+    CIL2CPP_CATCH_ALL
+    CIL2CPP_END_TRY
+    EXPECT_EQ(g_first_chance_calls, 1);
+}
+
 // ===== throw_exception with custom exception =====
 
 TEST_F(ExceptionTest, ThrowException_CustomException) {
@@ -925,27 +1062,27 @@ TEST_F(ExceptionTest, CheckedConvUn_Int64ToInt64_LargeOverflow) {
 // ===== Exception Filter Macros =====
 
 TEST_F(ExceptionTest, FilterBegin_Accept) {
-    // Filter accepts: __filter_result = 1 → __exc_caught = true
+    // Filter accepts: __filter_result = 1 → CIL2CPP_MARK_CAUGHT
     bool handler_ran = false;
     CIL2CPP_TRY
         throw_null_reference();
     CIL2CPP_FILTER_BEGIN
         int32_t __filter_result = 1; // accept
-        if (__filter_result) { __exc_caught = true; } else { CIL2CPP_RETHROW; }
+        if (__filter_result) { CIL2CPP_MARK_CAUGHT; } else { CIL2CPP_FILTER_REJECT; }
         handler_ran = true;
     CIL2CPP_END_TRY
     EXPECT_TRUE(handler_ran);
 }
 
 TEST_F(ExceptionTest, FilterBegin_Reject) {
-    // Filter rejects: __filter_result = 0 → rethrow, caught by outer
+    // Filter rejects: __filter_result = 0 → keeps unwinding, caught by outer
     bool outer_caught = false;
     CIL2CPP_TRY
         CIL2CPP_TRY
             throw_null_reference();
         CIL2CPP_FILTER_BEGIN
             int32_t __filter_result = 0; // reject
-            if (__filter_result) { __exc_caught = true; } else { CIL2CPP_RETHROW; }
+            if (__filter_result) { CIL2CPP_MARK_CAUGHT; } else { CIL2CPP_FILTER_REJECT; }
         CIL2CPP_END_TRY
     CIL2CPP_CATCH_ALL
         outer_caught = true;
@@ -962,7 +1099,7 @@ TEST_F(ExceptionTest, FilterBegin_ExceptionAccessible) {
         // In generated code, __exc_ctx.current_exception is the caught exception
         is_null_ref = (__exc_ctx.current_exception != nullptr);
         int32_t __filter_result = 1;
-        if (__filter_result) { __exc_caught = true; } else { CIL2CPP_RETHROW; }
+        if (__filter_result) { CIL2CPP_MARK_CAUGHT; } else { CIL2CPP_FILTER_REJECT; }
     CIL2CPP_END_TRY
     EXPECT_TRUE(is_null_ref);
 }
@@ -0,0 +1,145 @@
+/**
+ * CIL2CPP Runtime Tests - Exception throw profiler (per-type / per-site counts, unwind time, report)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace cil2cpp;
+
+namespace {
+
+#ifdef _MSC_VER
+#define TEST_NOINLINE __declspec(noinline)
+#else
+#define TEST_NOINLINE __attribute__((noinline))
+#endif
+
+const exception_stats::Entry* find(const std::vector<exception_stats::Entry>& entries, const std::string& prefix) {
+    for (const auto& e : entries)
+        if (e.name.rfind(prefix, 0) == 0) return &e;
+    return nullptr;
+}
+
+class ExceptionStatsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        runtime_init();
+        exception_stats::reset();
+        exception_stats::enable();
+    }
+    void TearDown() override {
+        exception_stats::disable();
+        exception_stats::reset();
+        runtime_shutdown();
+    }
+};
+
+} // namespace
+
+// Stand-in for a generated method that throws
+TEST_NOINLINE void ExceptionStatsTest_ThrowSite() {
+    throw_invalid_operation();
+}
+
+TEST_F(ExceptionStatsTest, CountsThrowsByTypeAndSite) {
+    for (int i = 0; i < 3; i++) {
+        CIL2CPP_TRY
+            ExceptionStatsTest_ThrowSite();
+        CIL2CPP_CATCH_ALL
+        CIL2CPP_END_TRY
+    }
+    CIL2CPP_TRY
+        throw_null_reference();
+    CIL2CPP_CATCH_ALL
+    CIL2CPP_END_TRY
+
+    auto types = exception_stats::by_type();
+    ASSERT_EQ(types.size(), 2u);
+    EXPECT_EQ(types[0].name, "System.InvalidOperationException");
+    EXPECT_EQ(types[0].throws, 3u);
+    EXPECT_GT(types[0].unwind_ns, 0u);
+    EXPECT_GE(types[0].unwind_ns, types[0].max_unwind_ns);
+    EXPECT_EQ(types[1].name, "System.NullReferenceException");
+    EXPECT_EQ(types[1].throws, 1u);
+
+    auto sites = exception_stats::by_site();
+    auto* site = find(sites, "System.InvalidOperationException @ ");
+    ASSERT_NE(site, nullptr);
+    EXPECT_EQ(site->throws, 3u);
+#ifdef __linux__
+    EXPECT_NE(site->name.find("ExceptionStatsTest_ThrowSite"), std::string::npos) << site->name;
+#endif
+}
+
+TEST_F(ExceptionStatsTest, UnwindTimeRunsUntilTheCatchingHandler) {
+    // The finally on the way out runs before the exception reaches its catch
+    CIL2CPP_TRY
+        CIL2CPP_TRY
+            throw_invalid_operation();
+        CIL2CPP_FINALLY
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        CIL2CPP_END_TRY
+    CIL2CPP_CATCH_ALL
+    CIL2CPP_END_TRY
+
+    auto types = exception_stats::by_type();
+    ASSERT_EQ(types.size(), 1u);
+    EXPECT_EQ(types[0].throws, 1u);
+    EXPECT_GE(types[0].unwind_ns, 20000000u);
+    EXPECT_EQ(types[0].max_unwind_ns, types[0].unwind_ns);
+}
+
+TEST_F(ExceptionStatsTest, CatchEndsTheMeasurement) {
+    Exception* caught = nullptr;
+    CIL2CPP_TRY
+        throw_invalid_operation();
+    CIL2CPP_CATCH_ALL
+        caught = __exc_ctx.current_exception;
+    CIL2CPP_END_TRY
+    ASSERT_NE(caught, nullptr);
+    auto before = exception_stats::by_type();
+    ASSERT_EQ(before.size(), 1u);
+
+    // Unwinding it again without a new throw is no longer charged to the first throw
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    CIL2CPP_TRY
+        propagate_exception(caught);
+    CIL2CPP_CATCH_ALL
+    CIL2CPP_END_TRY
+
+    auto after = exception_stats::by_type();
+    ASSERT_EQ(after.size(), 1u);
+    EXPECT_EQ(after[0].throws, 1u);
+    EXPECT_EQ(after[0].unwind_ns, before[0].unwind_ns);
+}
+
+TEST_F(ExceptionStatsTest, Disabled_RecordsNothing) {
+    exception_stats::disable();
+    CIL2CPP_TRY
+        throw_invalid_operation();
+    CIL2CPP_CATCH_ALL
+    CIL2CPP_END_TRY
+
+    EXPECT_TRUE(exception_stats::by_type().empty());
+}
+
+TEST_F(ExceptionStatsTest, Report_ListsTypesAndSites) {
+    for (int i = 0; i < 2; i++) {
+        CIL2CPP_TRY
+            throw_invalid_operation();
+        CIL2CPP_CATCH_ALL
+        CIL2CPP_END_TRY
+    }
+
+    auto text = exception_stats::report(1);
+    EXPECT_EQ(text.rfind("cil2cpp exceptions: 2 thrown, ", 0), 0u) << text;
+    EXPECT_NE(text.find("\nby type: top 1 of 1 by throws\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("  System.InvalidOperationException\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("\nby throw site: top 1 of 1 by throws\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("  System.InvalidOperationException @ "), std::string::npos) << text;
+}
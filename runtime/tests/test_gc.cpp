@@ -10,6 +10,10 @@
 
 #include <gc.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 using namespace cil2cpp;
 
 // Test type info
@@ -246,3 +250,30 @@ TEST_F(GCTest, SetIncremental_DoesNotCrash) {
     }
     gc::collect_a_little();
 }
+
+// ===== GC-safe regions =====
+
+TEST_F(GCTest, Blocking_ReturnsResultAndNests) {
+    int inner = 0;
+    int result = gc::blocking([&] {
+        // Nested regions just run the callable
+        gc::blocking([&] { inner = 7; });
+        return inner * 6;
+    });
+    EXPECT_EQ(result, 42);
+}
+
+TEST_F(GCTest, Blocking_OtherThreadCollectsWhileParked) {
+    std::atomic<bool> release{false};
+    std::thread parked([&] {
+        gc::register_thread();
+        gc::blocking([&] {
+            while (!release.load()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        });
+        gc::unregister_thread();
+    });
+    // The collection does not wait for the parked thread
+    gc::collect();
+    release.store(true);
+    parked.join();
+}
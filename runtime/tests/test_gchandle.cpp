@@ -0,0 +1,320 @@
+/**
+ * CIL2CPP Runtime Tests - GCHandle table (strong, weak, concurrent use)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/gchandle.h>
+#include <cil2cpp/object.h>
+#include <cil2cpp/type_info.h>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace cil2cpp;
+
+static TypeInfo CachedValueType = {
+    .name = "CachedValue",
+    .namespace_name = "Tests",
+    .full_name = "Tests.CachedValue",
+    .instance_size = sizeof(Object) + sizeof(int64_t),
+};
+
+class GCHandleTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        gc::init();
+        gchandle_init();
+    }
+
+    void TearDown() override {
+        gchandle_init(); // release links registered by the test
+        gc::shutdown();
+    }
+
+    static Object* new_object() {
+        return static_cast<Object*>(gc::alloc(CachedValueType.instance_size, &CachedValueType));
+    }
+};
+
+TEST_F(GCHandleTest, Normal_AllocGetFree) {
+    Object* obj = new_object();
+    intptr_t h = gchandle_alloc(obj, GCHandleType::Normal);
+    ASSERT_NE(h, 0);
+    EXPECT_EQ(h & 1, 0); // low bit is reserved for the managed pinned flag
+    EXPECT_TRUE(gchandle_is_allocated(h));
+    EXPECT_EQ(gchandle_get(h), obj);
+
+    Object* other = new_object();
+    gchandle_set(h, other);
+    EXPECT_EQ(gchandle_get(h), other);
+
+    gchandle_free(h);
+    EXPECT_FALSE(gchandle_is_allocated(h));
+    EXPECT_EQ(gchandle_get(h), nullptr);
+    gchandle_free(h); // double free is ignored
+}
+
+TEST_F(GCHandleTest, InvalidHandles) {
+    EXPECT_EQ(gchandle_get(0), nullptr);
+    EXPECT_FALSE(gchandle_is_allocated(0));
+    EXPECT_FALSE(gchandle_is_allocated(1 << 30));
+    gchandle_free(1 << 30);
+    gchandle_set(-2, nullptr);
+}
+
+TEST_F(GCHandleTest, FreedHandleIsReused) {
+    intptr_t h = gchandle_alloc(new_object(), GCHandleType::Normal);
+    gchandle_free(h);
+    intptr_t again = gchandle_alloc(nullptr, GCHandleType::Pinned);
+    EXPECT_EQ(again, h);
+    EXPECT_EQ(gchandle_get(again), nullptr);
+    gchandle_free(again);
+}
+
+TEST_F(GCHandleTest, ManySegments) {
+    std::vector<intptr_t> handles;
+    std::vector<Object*> objects;
+    for (int i = 0; i < 5000; i++) {
+        objects.push_back(new_object());
+        handles.push_back(gchandle_alloc(objects.back(), GCHandleType::Normal));
+    }
+    for (int i = 0; i < 5000; i++) EXPECT_EQ(gchandle_get(handles[i]), objects[i]);
+    for (auto h : handles) gchandle_free(h);
+}
+
+TEST_F(GCHandleTest, CompareExchange_Strong) {
+    Object* a = new_object();
+    Object* b = new_object();
+    intptr_t h = gchandle_alloc(nullptr, GCHandleType::Normal);
+    EXPECT_EQ(gchandle_compare_exchange(h, a, nullptr), nullptr);
+    EXPECT_EQ(gchandle_get(h), a);
+    EXPECT_EQ(gchandle_compare_exchange(h, b, nullptr), a); // comparand mismatch
+    EXPECT_EQ(gchandle_get(h), a);
+    gchandle_free(h);
+}
+
+TEST_F(GCHandleTest, Weak_GetSetCompareExchange) {
+    Object* a = new_object();
+    Object* b = new_object();
+    for (auto type : { GCHandleType::Weak, GCHandleType::WeakTrackResurrection }) {
+        intptr_t h = gchandle_alloc(a, type);
+        EXPECT_EQ(gchandle_get(h), a);
+        gchandle_set(h, nullptr);
+        EXPECT_EQ(gchandle_get(h), nullptr);
+        EXPECT_EQ(gchandle_compare_exchange(h, b, nullptr), nullptr);
+        EXPECT_EQ(gchandle_get(h), b);
+        EXPECT_EQ(gchandle_compare_exchange(h, a, a), b);
+        EXPECT_EQ(gchandle_get(h), b);
+        gchandle_free(h);
+    }
+}
+
+TEST_F(GCHandleTest, ConcurrentAllocFree) {
+    constexpr int kThreads = 8;
+    constexpr int kPerThread = 2000;
+    std::vector<std::vector<intptr_t>> kept(kThreads);
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&, t] {
+            gc::register_thread();
+            for (int i = 0; i < kPerThread; i++) {
+                auto* marker = reinterpret_cast<void*>(static_cast<uintptr_t>((t << 20 | i) << 4));
+                intptr_t h = gchandle_alloc(marker, GCHandleType::Normal);
+                if (gchandle_get(h) != marker) mismatches++;
+                // Free every other handle right away so indices recycle through the free lists
+                if (i % 2) gchandle_free(h); else kept[t].push_back(h);
+            }
+            gc::unregister_thread();
+        });
+    }
+    for (auto& th : threads) th.join();
+    EXPECT_EQ(mismatches.load(), 0);
+
+    std::set<intptr_t> unique;
+    for (int t = 0; t < kThreads; t++) {
+        for (size_t i = 0; i < kept[t].size(); i++) {
+            unique.insert(kept[t][i]);
+            auto* marker = reinterpret_cast<void*>(static_cast<uintptr_t>((t << 20 | (2 * i)) << 4));
+            EXPECT_EQ(gchandle_get(kept[t][i]), marker);
+        }
+    }
+    EXPECT_EQ(unique.size(), static_cast<size_t>(kThreads * kPerThread / 2));
+}
+
+// ===== Weak targets are cleared by the collector =====
+
+namespace {
+
+/// A WeakReference<T>-style cache: entries are weak handles, dead ones are pruned.
+struct WeakCache {
+    std::vector<intptr_t> entries;
+
+    size_t prune() {
+        size_t live = 0;
+        for (auto& h : entries) {
+            if (gchandle_get(h)) {
+                entries[live++] = h;
+            } else {
+                gchandle_free(h);
+            }
+        }
+        entries.resize(live);
+        return live;
+    }
+};
+
+[[gnu::noinline]] void fill_cache(WeakCache& cache, int count, GCHandleType type) {
+    for (int i = 0; i < count; i++) {
+        auto* obj = static_cast<Object*>(gc::alloc(CachedValueType.instance_size, &CachedValueType));
+        cache.entries.push_back(gchandle_alloc(obj, type));
+    }
+}
+
+} // namespace
+
+TEST_F(GCHandleTest, WeakCache_ShrinksAfterCollect) {
+    for (auto type : { GCHandleType::Weak, GCHandleType::WeakTrackResurrection }) {
+        WeakCache cache;
+        fill_cache(cache, 1000, type);
+        ASSERT_EQ(cache.prune(), 1000u);
+
+        gc::collect();
+        gc::collect();
+
+        // Conservative stack scanning may pin a few, never most of them
+        EXPECT_LT(cache.prune(), 100u);
+        for (auto h : cache.entries) gchandle_free(h);
+    }
+}
+
+TEST_F(GCHandleTest, WeakTarget_KeptAliveByStrongHandle) {
+    Object* obj = new_object();
+    intptr_t strong = gchandle_alloc(obj, GCHandleType::Normal);
+    intptr_t weak = gchandle_alloc(obj, GCHandleType::Weak);
+    obj = nullptr;
+
+    gc::collect();
+    EXPECT_NE(gchandle_get(weak), nullptr);
+    EXPECT_EQ(gchandle_get(weak), gchandle_get(strong));
+
+    gchandle_free(strong);
+    gchandle_free(weak);
+}
+
+// ===== Dependent handles (ConditionalWeakTable ephemerons) =====
+
+TEST_F(GCHandleTest, Dependent_TargetAndDependent) {
+    Object* key = new_object();
+    Object* value = new_object();
+    intptr_t h = dependent_handle_alloc(key, value);
+    ASSERT_NE(h, 0);
+    EXPECT_TRUE(gchandle_is_allocated(h));
+    EXPECT_EQ(dependent_handle_get_target(h), key);
+    EXPECT_EQ(dependent_handle_get_dependent(h), value);
+
+    void* dependent = nullptr;
+    EXPECT_EQ(dependent_handle_get_target_and_dependent(h, &dependent), key);
+    EXPECT_EQ(dependent, value);
+
+    Object* other = new_object();
+    dependent_handle_set_dependent(h, other);
+    EXPECT_EQ(dependent_handle_get_dependent(h), other);
+
+    dependent_handle_set_target_to_null(h);
+    EXPECT_EQ(dependent_handle_get_target_and_dependent(h, &dependent), nullptr);
+    EXPECT_EQ(dependent, nullptr);
+    EXPECT_EQ(dependent_handle_get_dependent(h), nullptr);
+
+    gchandle_free(h);
+    EXPECT_FALSE(gchandle_is_allocated(h));
+    EXPECT_EQ(dependent_handle_get_target(h), nullptr);
+}
+
+TEST_F(GCHandleTest, Dependent_NotAccessibleAsOtherHandleKind) {
+    intptr_t normal = gchandle_alloc(new_object(), GCHandleType::Normal);
+    EXPECT_EQ(dependent_handle_get_target(normal), nullptr);
+    dependent_handle_set_dependent(normal, nullptr); // ignored
+    EXPECT_NE(gchandle_get(normal), nullptr);
+    gchandle_free(normal);
+}
+
+namespace {
+
+[[gnu::noinline]] intptr_t make_entry(intptr_t* valueObserver, bool valueReferencesKey = false) {
+    auto* key = static_cast<Object*>(gc::alloc(CachedValueType.instance_size, &CachedValueType));
+    // One extra word, scanned conservatively like every field: a value -> key reference
+    auto* value = static_cast<Object*>(gc::alloc(sizeof(Object) + sizeof(void*), &CachedValueType));
+    if (valueReferencesKey)
+        *reinterpret_cast<Object**>(value + 1) = key;
+    *valueObserver = gchandle_alloc(value, GCHandleType::Weak);
+    return dependent_handle_alloc(key, value);
+}
+
+[[gnu::noinline]] std::pair<int, int> count_live(std::vector<intptr_t>& entries,
+                                                 std::vector<intptr_t>& observers) {
+    int liveKeys = 0, liveValues = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (dependent_handle_get_target(entries[i])) liveKeys++;
+        if (gchandle_get(observers[i])) liveValues++;
+        gchandle_free(entries[i]);
+        gchandle_free(observers[i]);
+    }
+    return {liveKeys, liveValues};
+}
+
+} // namespace
+
+TEST_F(GCHandleTest, Dependent_ValueLivesWhileKeyIsReachable) {
+    intptr_t observer;
+    intptr_t h = make_entry(&observer);
+    intptr_t keyRoot = gchandle_alloc(dependent_handle_get_target(h), GCHandleType::Normal);
+
+    gc::collect();
+    gc::collect();
+    EXPECT_NE(dependent_handle_get_target(h), nullptr);
+    EXPECT_NE(gchandle_get(observer), nullptr); // only the dependent handle holds the value
+
+    gchandle_free(keyRoot);
+    gchandle_free(observer);
+    gchandle_free(h);
+}
+
+TEST_F(GCHandleTest, Dependent_KeyAndValueCollected) {
+    constexpr int kEntries = 200;
+    std::vector<intptr_t> entries, observers;
+    for (int i = 0; i < kEntries; i++) {
+        intptr_t observer;
+        entries.push_back(make_entry(&observer));
+        observers.push_back(observer);
+    }
+
+    // Key and value go in the same collection
+    gc::collect();
+
+    auto [liveKeys, liveValues] = count_live(entries, observers);
+    // Conservative stack scanning may retain a few
+    EXPECT_LT(liveKeys, kEntries / 10);
+    EXPECT_LT(liveValues, kEntries / 10);
+}
+
+TEST_F(GCHandleTest, Dependent_ValueReferencingKeyDoesNotKeepItAlive) {
+    constexpr int kEntries = 200;
+    std::vector<intptr_t> entries, observers;
+    for (int i = 0; i < kEntries; i++) {
+        intptr_t observer;
+        entries.push_back(make_entry(&observer, /*valueReferencesKey=*/true));
+        observers.push_back(observer);
+    }
+
+    // The value is only marked through a marked key, so the cycle is not a root
+    gc::collect();
+
+    auto [liveKeys, liveValues] = count_live(entries, observers);
+    EXPECT_LT(liveKeys, kEntries / 10);
+    EXPECT_LT(liveValues, kEntries / 10);
+}
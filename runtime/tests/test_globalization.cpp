@@ -7,7 +7,12 @@
 
 #include <gtest/gtest.h>
 #include <cil2cpp/cil2cpp.h>
+#include <algorithm>
 #include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace cil2cpp;
 
@@ -406,6 +411,313 @@ TEST_F(GlobalizationTest, CompareInfo_GetSortHandle) {
     EXPECT_NE(handle, 0);
 }
 
+TEST_F(GlobalizationTest, CompareInfo_GetSortHandle_CachedPerLocale) {
+    intptr_t a = globalization::compareinfo_get_sort_handle(S("de-DE"));
+    intptr_t b = globalization::compareinfo_get_sort_handle(S("de-DE"));
+    EXPECT_NE(a, 0);
+    EXPECT_EQ(a, b);
+}
+
+// ===== Per-thread collators =====
+
+TEST_F(GlobalizationTest, ThreadCollator_ClonePerOptions) {
+    auto* base = globalization::base_collator("");
+    ASSERT_NE(base, nullptr);
+    auto* exact = globalization::thread_collator(base, 0);
+    auto* ignoreCase = globalization::thread_collator(base, 1);
+    EXPECT_NE(exact, base);       // never the shared collator
+    EXPECT_NE(exact, ignoreCase);
+    EXPECT_EQ(globalization::thread_collator(base, 0), exact);
+    // Ordinal flags don't affect the collator
+    EXPECT_EQ(globalization::thread_collator(base, 0x10000000 | 1), ignoreCase);
+}
+
+TEST_F(GlobalizationTest, ThreadCollator_DistinctAcrossThreads) {
+    auto* base = globalization::base_collator("");
+    auto* mine = globalization::thread_collator(base, 0);
+    UCollator* theirs = nullptr;
+    std::thread([&] { theirs = globalization::thread_collator(base, 0); }).join();
+    EXPECT_NE(theirs, nullptr);
+    EXPECT_NE(theirs, mine);
+}
+
+TEST_F(GlobalizationTest, SortHandle_OptionsDoNotLeakBetweenCalls) {
+    intptr_t handle = 0;
+    ASSERT_EQ(interop_globalization_get_sort_handle(S("en-US"), &handle), 0);
+    char16_t lower[] = u"abc";
+    char16_t upper[] = u"ABC";
+    EXPECT_EQ(interop_globalization_compare_string(handle, lower, 3, upper, 3, 1), 0);
+    EXPECT_NE(interop_globalization_compare_string(handle, lower, 3, upper, 3, 0), 0);
+    EXPECT_EQ(interop_globalization_compare_string(handle, lower, 3, upper, 3, 1), 0);
+}
+
+TEST_F(GlobalizationTest, CompareInfo_Compare_IgnoreSymbols) {
+    auto* a = S("co-op");
+    auto* b = S("coop");
+    EXPECT_NE(globalization::compareinfo_compare_string_string(nullptr, a, b, 0), 0);
+    EXPECT_EQ(globalization::compareinfo_compare_string_string(nullptr, a, b, 4), 0);
+}
+
+TEST_F(GlobalizationTest, CompareInfo_Compare_ConcurrentMixedOptions) {
+    // Threads alternate IgnoreCase and None on the same collator base; with a shared,
+    // reconfigured collator one thread's strength would leak into another's compare.
+    auto* a = S("hello world");
+    auto* b = S("Hello World");
+    Int32 exact = globalization::compareinfo_compare_string_string(nullptr, a, b, 0);
+    Int32 ignoreCase = globalization::compareinfo_compare_string_string(nullptr, a, b, 1);
+    ASSERT_NE(exact, ignoreCase);
+
+    std::vector<std::thread> threads;
+    std::vector<int> mismatches(8, 0);
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 2000; i++) {
+                Int32 options = (i + t) & 1;
+                Int32 r = globalization::compareinfo_compare_string_string(nullptr, a, b, options);
+                if (r != (options ? ignoreCase : exact)) mismatches[t]++;
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    for (int t = 0; t < 8; t++) EXPECT_EQ(mismatches[t], 0) << "thread " << t;
+}
+
+// ===== ASCII fast paths =====
+
+TEST_F(GlobalizationTest, AsciiCollation_MatchesIcu) {
+    // Appending SOFT HYPHEN (completely ignorable) to both strings forces the ICU path
+    // without changing the expected result, so each pair is compared both ways.
+    auto* root = globalization::base_collator("");
+    const char16_t shy = 0x00AD;
+    ASSERT_EQ(globalization::collator_compare(root, u"a\u00AD", 2, u"a", 1, 0), 0);
+
+    static const char alphabet[] = "aAbBzZ09 -_.,'!$+<=~\t\x01";
+    std::mt19937 rng(7);
+    auto random_string = [&] {
+        std::u16string s;
+        int len = static_cast<int>(rng() % 8);
+        for (int i = 0; i < len; i++) s += static_cast<char16_t>(alphabet[rng() % (sizeof(alphabet) - 1)]);
+        return s;
+    };
+
+    int checked = 0;
+    for (int n = 0; n < 3000; n++) {
+        std::u16string a = random_string();
+        std::u16string b = (n & 1) ? random_string() : a;
+        if (!(n & 1) && !b.empty()) {
+            // Near-miss: flip case or replace one character, so ties reach the tertiary level
+            size_t pos = rng() % b.size();
+            b[pos] = (rng() & 1) ? unicode::to_upper(b[pos]) == b[pos] ? unicode::to_lower(b[pos])
+                : unicode::to_upper(b[pos]) : static_cast<char16_t>(alphabet[rng() % (sizeof(alphabet) - 1)]);
+        }
+        std::u16string a2 = a + shy, b2 = b + shy;
+        for (Int32 options : { 0, 1, 2, 4, 5 }) {
+            Int32 fast = globalization::collator_compare(root, a.data(), static_cast<Int32>(a.size()),
+                b.data(), static_cast<Int32>(b.size()), options);
+            Int32 icu = globalization::collator_compare(root, a2.data(), static_cast<Int32>(a2.size()),
+                b2.data(), static_cast<Int32>(b2.size()), options);
+            ASSERT_EQ(fast, icu) << "options " << options << " pair #" << n;
+            checked++;
+        }
+    }
+    EXPECT_EQ(checked, 15000);
+}
+
+TEST_F(GlobalizationTest, AsciiCollation_OrderingAndStrength) {
+    auto cmp = [](const char* a, const char* b, Int32 options) {
+        return globalization::compareinfo_compare_string_string(nullptr,
+            string_create_utf8(a), string_create_utf8(b), options);
+    };
+    EXPECT_LT(cmp("a", "A", 0), 0);        // lowercase first at tertiary strength
+    EXPECT_EQ(cmp("a", "A", 1), 0);
+    EXPECT_LT(cmp("apple", "Banana", 0), 0); // alphabetic, not code point order
+    EXPECT_LT(cmp("9", "a", 0), 0);        // digits before letters
+    EXPECT_LT(cmp("_x", "1", 0), 0);       // punctuation before digits
+    EXPECT_LT(cmp("ab", "abc", 0), 0);
+    EXPECT_EQ(cmp("co-op", "COOP", 4 | 1), 0);
+}
+
+TEST_F(GlobalizationTest, AsciiCollation_TailoredCulturesUseIcu) {
+    // Danish sorts "aa" as å (after z); Turkish uppercase of i is İ, so i ≠ I ignoring case
+    auto* root = globalization::base_collator("");
+    auto* da = globalization::base_collator("da");
+    auto* tr = globalization::base_collator("tr");
+    ASSERT_NE(da, nullptr);
+    ASSERT_NE(tr, nullptr);
+    EXPECT_LT(globalization::collator_compare(root, u"aa", 2, u"z", 1, 0), 0);
+    EXPECT_GT(globalization::collator_compare(da, u"aa", 2, u"z", 1, 0), 0);
+    EXPECT_EQ(globalization::collator_compare(root, u"i", 1, u"I", 1, 1), 0);
+    EXPECT_NE(globalization::collator_compare(tr, u"i", 1, u"I", 1, 1), 0);
+    // An untailored culture shares the root's ASCII order
+    auto* en = globalization::base_collator("en_US");
+    EXPECT_LT(globalization::collator_compare(en, u"a", 1, u"A", 1, 0), 0);
+}
+
+TEST_F(GlobalizationTest, AsciiSearch_FirstAndLast) {
+    auto* root = globalization::base_collator("");
+    Int32 len = 0;
+    EXPECT_EQ(globalization::collator_index_of(root, u"Hello World world", 17, u"WORLD", 5, 1, false, &len), 6);
+    EXPECT_EQ(len, 5);
+    EXPECT_EQ(globalization::collator_index_of(root, u"Hello World world", 17, u"WORLD", 5, 1, true, &len), 12);
+    EXPECT_EQ(globalization::collator_index_of(root, u"Hello World world", 17, u"WORLD", 5, 0, false, &len), -1);
+    EXPECT_EQ(len, 0);
+    EXPECT_EQ(globalization::collator_index_of(root, u"Hello World", 11, u"World", 5, 0, false, &len), 6);
+    // Control characters take the ICU path (CR LF is one grapheme for usearch)
+    EXPECT_EQ(globalization::collator_index_of(root, u"a\r\nb", 4, u"\nB", 2, 1, false, &len), -1);
+}
+
+TEST_F(GlobalizationTest, TextInfo_ChangeCase_AsciiMatchesIcu) {
+    Char src[] = u"Mixed_Case 123 zZ";
+    Char ascii[17], icu[18];
+    globalization::textinfo_change_case_core(nullptr, src, 17, ascii, 17, true);
+    // A trailing non-ASCII character forces the ICU path
+    Char src2[] = u"Mixed_Case 123 zZ\u00e9";
+    globalization::textinfo_change_case_core(nullptr, src2, 18, icu, 18, true);
+    EXPECT_EQ(std::u16string(ascii, 17), std::u16string(icu, 17));
+}
+
+// ===== Sort keys =====
+
+namespace {
+
+std::vector<std::u16string> sort_words(size_t count, unsigned seed) {
+    // Mixed case, accents, punctuation and duplicates, so every strength level decides
+    static const char16_t* syllables[] = { u"al", u"Al", u"be", u"Bé", u"co", u"-",
+        u"dé", u"De", u" ", u"ïn", u"zz", u"Z" };
+    std::mt19937 rng(seed);
+    std::vector<std::u16string> words;
+    for (size_t i = 0; i < count; i++) {
+        std::u16string w;
+        int parts = static_cast<int>(rng() % 4);
+        for (int p = 0; p < parts; p++) w += syllables[rng() % 12];
+        words.push_back(w);
+    }
+    return words;
+}
+
+std::string sort_key(const UCollator* collator, const std::u16string& s, Int32 options) {
+    Int32 length = globalization::collator_sort_key(collator, s.data(),
+        static_cast<Int32>(s.size()), options, nullptr, 0);
+    std::string key(static_cast<size_t>(length), '\0');
+    EXPECT_EQ(globalization::collator_sort_key(collator, s.data(), static_cast<Int32>(s.size()),
+        options, reinterpret_cast<uint8_t*>(key.data()), length), length);
+    return key;
+}
+
+} // namespace
+
+TEST_F(GlobalizationTest, SortKey_OrderMatchesCompare) {
+    for (const char* locale : { "", "en_US", "da", "tr" }) {
+        auto* collator = globalization::base_collator(locale);
+        ASSERT_NE(collator, nullptr) << locale;
+        auto words = sort_words(300, 11);
+        for (Int32 options : { 0, 1, 2, 4, 5 }) {
+            for (size_t i = 0; i + 1 < words.size(); i++) {
+                const auto& a = words[i];
+                const auto& b = words[i + 1];
+                int byKey = sort_key(collator, a, options).compare(sort_key(collator, b, options));
+                Int32 direct = globalization::collator_compare(collator, a.data(),
+                    static_cast<Int32>(a.size()), b.data(), static_cast<Int32>(b.size()), options);
+                ASSERT_EQ((byKey > 0) - (byKey < 0), direct)
+                    << "locale '" << locale << "' options " << options << " pair #" << i;
+            }
+        }
+    }
+}
+
+TEST_F(GlobalizationTest, SortKey_InteropSizeQueryThenFill) {
+    intptr_t handle = 0;
+    ASSERT_EQ(interop_globalization_get_sort_handle(S("en-US"), &handle), 0);
+    char16_t text[] = u"Hello";
+    int32_t length = interop_globalization_get_sort_key(handle, text, 5, nullptr, 0, 0);
+    ASSERT_GT(length, 1);
+    std::vector<uint8_t> key(static_cast<size_t>(length));
+    EXPECT_EQ(interop_globalization_get_sort_key(handle, text, 5, key.data(), length, 0), length);
+    EXPECT_EQ(key.back(), 0);
+    // IgnoreCase keys of "Hello" and "hello" are identical
+    char16_t lower[] = u"hello";
+    std::vector<uint8_t> upperKey(static_cast<size_t>(length) * 2), lowerKey(upperKey.size());
+    int32_t n1 = interop_globalization_get_sort_key(handle, text, 5, upperKey.data(),
+        static_cast<int32_t>(upperKey.size()), 1);
+    int32_t n2 = interop_globalization_get_sort_key(handle, lower, 5, lowerKey.data(),
+        static_cast<int32_t>(lowerKey.size()), 1);
+    ASSERT_EQ(n1, n2);
+    EXPECT_EQ(std::memcmp(upperKey.data(), lowerKey.data(), static_cast<size_t>(n1)), 0);
+}
+
+TEST_F(GlobalizationTest, SortStringsByKey_MatchesComparisonSort) {
+    for (const char* locale : { "", "da" }) {
+        auto* collator = globalization::base_collator(locale);
+        for (Int32 options : { 0, 1, 4 }) {
+            std::vector<String*> items;
+            for (auto& w : sort_words(500, 23)) items.push_back(string_create_utf16(w.data(),
+                static_cast<Int32>(w.size())));
+            items[17] = nullptr;
+            items[300] = nullptr;
+            // Reference: the comparison sort with CultureAwareComparer semantics, stable so
+            // that equal elements keep input order like the key sort does
+            std::vector<String*> expected = items;
+            std::stable_sort(expected.begin(), expected.end(), [&](String* a, String* b) {
+                if (!a || !b) return !a && b;
+                return globalization::collator_compare(collator, &a->f__firstChar, a->length,
+                    &b->f__firstChar, b->length, options) < 0;
+            });
+            ASSERT_TRUE(globalization::sort_strings_by_key(items.data(),
+                static_cast<Int32>(items.size()), collator, options));
+            EXPECT_EQ(items, expected) << "locale '" << locale << "' options " << options;
+        }
+    }
+}
+
+TEST_F(GlobalizationTest, SortStringsByKey_SmallInputsLeftToCaller) {
+    auto* collator = globalization::base_collator("");
+    std::vector<String*> items = { S("b"), S("a") };
+    EXPECT_FALSE(globalization::sort_strings_by_key(items.data(), 2, collator, 0));
+    EXPECT_STREQ(string_to_utf8(items[0]), "b");
+}
+
+TEST_F(GlobalizationTest, SortStringsByKey_CultureComparerDelegate) {
+    // Stand-ins for the generated CultureAwareComparer / CompareInfo structs
+    struct FakeCompareInfo : Object { Int32 culture; intptr_t sortHandle; };
+    struct FakeComparer : Object { FakeCompareInfo* compareInfo; Int32 options; };
+    TypeInfo comparerType = { .name = "CultureAwareComparer", .namespace_name = "System",
+        .full_name = "System.CultureAwareComparer", .instance_size = sizeof(FakeComparer) };
+    globalization::set_culture_comparer_layout(&comparerType, offsetof(FakeComparer, compareInfo),
+        offsetof(FakeComparer, options), offsetof(FakeCompareInfo, sortHandle));
+
+    FakeCompareInfo compareInfo = {};
+    compareInfo.sortHandle = reinterpret_cast<intptr_t>(globalization::base_collator(""));
+    FakeComparer comparer = {};
+    comparer.__type_info = &comparerType;
+    comparer.compareInfo = &compareInfo;
+    comparer.options = 1; // IgnoreCase
+    Delegate comparison = {};
+    comparison.target = &comparer;
+
+    // a1, a3 ... a199 and B0, B2 ... B198, interleaved in reverse; IgnoreCase puts all a's first
+    constexpr Int32 n = 200;
+    static_assert(n >= globalization::kSortKeyThreshold);
+    std::vector<String*> items;
+    for (Int32 i = 0; i < n; i++) items.push_back(S(((i % 2 ? "B" : "a") + std::to_string(n - 1 - i)).c_str()));
+    EXPECT_TRUE(globalization::sort_strings_by_key(items.data(), n, &comparison));
+    EXPECT_STREQ(string_to_utf8(items[0]), "a1");
+    EXPECT_STREQ(string_to_utf8(items[n / 2 - 1]), "a99");
+    EXPECT_STREQ(string_to_utf8(items[n / 2]), "B0");
+    EXPECT_STREQ(string_to_utf8(items[n - 1]), "B98");
+
+    // Anything but a single-cast culture comparer over strings is left to the comparison sort
+    comparison.invocation_count = 2;
+    EXPECT_FALSE(globalization::sort_strings_by_key(items.data(), n, &comparison));
+    comparison.invocation_count = 0;
+    comparer.__type_info = &System_String_TypeInfo;
+    EXPECT_FALSE(globalization::sort_strings_by_key(items.data(), n, &comparison));
+    comparer.__type_info = &comparerType;
+    items[5] = reinterpret_cast<String*>(&comparer);
+    EXPECT_FALSE(globalization::sort_strings_by_key(items.data(), n, &comparison));
+
+    globalization::set_culture_comparer_layout(nullptr, 0, 0, 0);
+}
+
 // ===== Unicode edge cases =====
 
 TEST_F(GlobalizationTest, CompareInfo_Compare_Unicode) {
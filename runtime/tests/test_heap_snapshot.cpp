@@ -0,0 +1,194 @@
+/**
+ * CIL2CPP Runtime Tests - Heap snapshot (per-type census, object graph with retained sizes)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace cil2cpp;
+
+namespace {
+
+struct HeapNode : Object {
+    Object* leaf;
+    int64_t payload;
+};
+
+TypeInfo make_type(const char* name, const char* full_name, uint32_t instance_size) {
+    return {
+        .name = name,
+        .namespace_name = "Tests",
+        .full_name = full_name,
+        .base_type = nullptr,
+        .interfaces = nullptr,
+        .interface_count = 0,
+        .instance_size = instance_size,
+        .element_size = sizeof(Object*),
+        .flags = TypeFlags::None,
+        .vtable = nullptr,
+        .fields = nullptr,
+        .field_count = 0,
+        .methods = nullptr,
+        .method_count = 0,
+        .properties = nullptr, .property_count = 0,
+        .finalizer = nullptr,
+    };
+}
+
+// Each test counts its own types, so leftovers from other tests don't show up
+TypeInfo CensusNodeType = make_type("CensusNode", "Tests.CensusNode", sizeof(HeapNode));
+TypeInfo CensusLeafType = make_type("CensusLeaf", "Tests.CensusLeaf", sizeof(Object));
+TypeInfo GraphNodeType = make_type("GraphNode", "Tests.GraphNode", sizeof(HeapNode));
+TypeInfo GraphLeafType = make_type("GraphLeaf", "Tests.GraphLeaf", sizeof(Object));
+
+constexpr int kNodes = 100;
+constexpr int kLeaves = 10;
+
+// kNodes nodes held by one array, each pointing at one of kLeaves shared leaves
+Array* build_pattern(TypeInfo* node_type, TypeInfo* leaf_type) {
+    Object* leaves[kLeaves];
+    for (auto& leaf : leaves) leaf = object_alloc(leaf_type);
+    Array* nodes = array_create(node_type, kNodes);
+    for (int i = 0; i < kNodes; i++) {
+        auto* node = static_cast<HeapNode*>(object_alloc(node_type));
+        node->leaf = leaves[i % kLeaves];
+        array_set<Object*>(nodes, i, node);
+    }
+    return nodes;
+}
+
+const heap_snapshot::TypeCount* find(const heap_snapshot::Census& census, const TypeInfo* type) {
+    for (const auto& entry : census.types)
+        if (entry.type == type) return &entry;
+    return nullptr;
+}
+
+struct GraphNode {
+    uint64_t bytes;
+    uint64_t retained;
+    std::string type;
+};
+
+struct Graph {
+    std::string header;
+    std::map<unsigned, GraphNode> nodes;
+    std::vector<std::pair<unsigned, unsigned>> edges;
+};
+
+Graph read_graph(FILE* in) {
+    Graph graph;
+    char line[512];
+    std::rewind(in);
+    if (std::fgets(line, sizeof(line), in)) graph.header = line;
+    while (std::fgets(line, sizeof(line), in)) {
+        unsigned id, from, to;
+        unsigned long long bytes, retained;
+        char type[256];
+        if (std::sscanf(line, "node %u %llu %llu %255s", &id, &bytes, &retained, type) == 4)
+            graph.nodes[id] = {bytes, retained, type};
+        else if (std::sscanf(line, "edge %u %u", &from, &to) == 2)
+            graph.edges.emplace_back(from, to);
+    }
+    return graph;
+}
+
+class HeapSnapshotTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        runtime_init();
+        for (auto* type : {&CensusNodeType, &CensusLeafType, &GraphNodeType, &GraphLeafType})
+            type_register(type);
+    }
+    void TearDown() override {
+        runtime_shutdown();
+    }
+};
+
+} // namespace
+
+TEST_F(HeapSnapshotTest, Census_CountsLiveInstancesPerType) {
+    Array* nodes = build_pattern(&CensusNodeType, &CensusLeafType);
+    auto census = heap_snapshot::census();
+
+    auto* node = find(census, &CensusNodeType);
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->count, static_cast<uint64_t>(kNodes));
+    EXPECT_GE(node->bytes, kNodes * sizeof(HeapNode));
+
+    auto* leaf = find(census, &CensusLeafType);
+    ASSERT_NE(leaf, nullptr);
+    EXPECT_EQ(leaf->count, static_cast<uint64_t>(kLeaves));
+    EXPECT_GE(leaf->bytes, kLeaves * sizeof(Object));
+
+    auto* array = find(census, nodes->__type_info);
+    ASSERT_NE(array, nullptr);
+    EXPECT_EQ(array->count, 1u);
+    EXPECT_GE(array->bytes, kNodes * sizeof(Object*));
+
+    EXPECT_GE(census.objects, static_cast<uint64_t>(kNodes + kLeaves + 1));
+    for (size_t i = 1; i < census.types.size(); i++)
+        EXPECT_GE(census.types[i - 1].bytes, census.types[i].bytes);
+
+    auto text = heap_snapshot::format(census, 0);
+    EXPECT_EQ(text.rfind("cil2cpp heap census: ", 0), 0u) << text;
+    EXPECT_NE(text.find("  Tests.CensusNode\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("  Tests.CensusLeaf\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("  Tests.CensusNode[]\n"), std::string::npos) << text;
+
+    // Totals, column titles, one row
+    auto top = heap_snapshot::format(census, 1);
+    EXPECT_EQ(std::count(top.begin(), top.end(), '\n'), 3) << top;
+    EXPECT_EQ(array_get<Object*>(nodes, 0)->__type_info, &CensusNodeType);
+}
+
+TEST_F(HeapSnapshotTest, Census_IgnoresBlocksWithoutKnownTypeInfo) {
+    // A block whose first word is not a TypeInfo the runtime knows is "other"
+    void* raw = gc::alloc(64, nullptr);
+    auto census = heap_snapshot::census();
+
+    EXPECT_GE(census.other_blocks, 1u);
+    EXPECT_GE(census.other_bytes, 64u);
+    for (const auto& entry : census.types) EXPECT_NE(entry.type, nullptr);
+    EXPECT_NE(raw, nullptr);
+}
+
+TEST_F(HeapSnapshotTest, Graph_RetainedSizeCoversEverythingBehindTheArray) {
+    Array* nodes = build_pattern(&GraphNodeType, &GraphLeafType);
+    FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    ASSERT_TRUE(heap_snapshot::write_graph(file));
+    auto graph = read_graph(file);
+    std::fclose(file);
+
+    EXPECT_EQ(graph.header, "# cil2cpp heap graph 1\n");
+
+    unsigned array_id = 0;
+    uint64_t node_bytes = 0, leaf_bytes = 0;
+    int node_count = 0, leaf_count = 0;
+    for (const auto& [id, n] : graph.nodes) {
+        if (n.type == "Tests.GraphNode[]") array_id = id;
+        if (n.type == "Tests.GraphNode") { node_count++; node_bytes += n.bytes; }
+        if (n.type == "Tests.GraphLeaf") { leaf_count++; leaf_bytes += n.bytes; }
+    }
+    ASSERT_NE(array_id, 0u);
+    EXPECT_EQ(node_count, kNodes);
+    EXPECT_EQ(leaf_count, kLeaves);
+
+    int from_array = 0;
+    for (const auto& [from, to] : graph.edges) {
+        ASSERT_TRUE(graph.nodes.count(from) && graph.nodes.count(to));
+        if (from == array_id && graph.nodes[to].type == "Tests.GraphNode") from_array++;
+    }
+    EXPECT_EQ(from_array, kNodes);
+
+    // Nodes are reachable only through the array, leaves only through the nodes
+    const auto& array = graph.nodes[array_id];
+    EXPECT_EQ(array.retained, array.bytes + node_bytes + leaf_bytes);
+    EXPECT_EQ(array_get<Object*>(nodes, 0)->__type_info, &GraphNodeType);
+}
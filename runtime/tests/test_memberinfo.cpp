@@ -350,3 +350,550 @@ TEST_F(MemberInfoTestFixture, MemberInfoGetDeclaringType_OnMethodInfo) {
     ASSERT_NE(dt, nullptr);
     EXPECT_EQ(dt->type_info, &MemberInfoTest_Animal);
 }
+
+// ===== Name index / wrapper caching =====
+
+// Methods declared out of name order, with an overload pair ("Add")
+static MethodInfo MemberInfoTest_IndexedMethods[] = {
+    { .name = "Zeta",   .flags = 0x0006, .vtable_slot = -1 },
+    { .name = "Add",    .parameter_count = 1, .flags = 0x0006, .vtable_slot = -1 },
+    { .name = "Beta",   .flags = 0x0006, .vtable_slot = -1 },
+    { .name = "Add",    .parameter_count = 2, .flags = 0x0006, .vtable_slot = -1 },
+    { .name = "Gamma",  .flags = 0x0006, .vtable_slot = -1 },
+    { .name = "Alpha",  .flags = 0x0006, .vtable_slot = -1 },
+    { .name = "Delta",  .flags = 0x0006, .vtable_slot = -1 },
+    { .name = "Epsilon", .flags = 0x0006, .vtable_slot = -1 },
+    { .name = "get_X",  .method_pointer = reinterpret_cast<void*>(&DummyStringMethod),
+      .flags = 0x0886, .vtable_slot = -1 },
+};
+// Indices sorted by strcmp(name); stable for the two "Add" overloads
+static const UInt16 MemberInfoTest_IndexedMethods_by_name[] = { 1, 3, 5, 2, 6, 7, 4, 0, 8 };
+
+static PropertyInfo MemberInfoTest_IndexedProperties[] = {
+    { .name = "X", .property_type = &System_String_TypeInfo,
+      .getter = reinterpret_cast<void*>(&DummyStringMethod) },
+    { .name = "Y", .property_type = &System_String_TypeInfo,
+      .getter = reinterpret_cast<void*>(&DummyMethod) },
+};
+
+static TypeInfo MemberInfoTest_Indexed = {
+    .name = "Indexed", .namespace_name = "Test", .full_name = "Test.Indexed",
+    .base_type = &System_Object_TypeInfo, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(Object), .element_size = 0,
+    .flags = TypeFlags::None, .vtable = nullptr,
+    .fields = nullptr, .field_count = 0,
+    .methods = MemberInfoTest_IndexedMethods, .method_count = 9,
+.properties = MemberInfoTest_IndexedProperties, .property_count = 2,
+    .method_name_index = MemberInfoTest_IndexedMethods_by_name,
+};
+
+class MemberInfoIndexTest : public MemberInfoTestFixture {
+protected:
+    void SetUp() override {
+        MemberInfoTestFixture::SetUp();
+        for (auto& m : MemberInfoTest_IndexedMethods)
+            m.declaring_type = &MemberInfoTest_Indexed;
+        for (auto& p : MemberInfoTest_IndexedProperties)
+            p.declaring_type = &MemberInfoTest_Indexed;
+    }
+};
+
+TEST_F(MemberInfoIndexTest, TypeGetMethod_Indexed_FindsEveryName) {
+    auto* t = type_get_type_object(&MemberInfoTest_Indexed);
+    for (const char* name : { "Alpha", "Beta", "Gamma", "Delta", "Epsilon", "Zeta" }) {
+        auto* mi = type_get_method(t, string_literal(name));
+        ASSERT_NE(mi, nullptr) << name;
+        EXPECT_STREQ(mi->native_info->name, name);
+    }
+    EXPECT_EQ(type_get_method(t, string_literal("Omega")), nullptr);
+    EXPECT_EQ(type_get_method(t, string_literal("A")), nullptr);
+}
+
+TEST_F(MemberInfoIndexTest, TypeGetMethodsByName_Indexed_OverloadsInDeclarationOrder) {
+    auto* t = type_get_type_object(&MemberInfoTest_Indexed);
+    auto* arr = type_get_methods_by_name(t, "Add", 1);
+    ASSERT_NE(arr, nullptr);
+    ASSERT_EQ(array_length(arr), 2);
+    auto** data = static_cast<ManagedMethodInfo**>(array_data(arr));
+    EXPECT_EQ(data[0]->native_info, &MemberInfoTest_IndexedMethods[1]);
+    EXPECT_EQ(data[1]->native_info, &MemberInfoTest_IndexedMethods[3]);
+}
+
+TEST_F(MemberInfoIndexTest, TypeGetMethodsByName_IgnoreCase_ScansAll) {
+    auto* t = type_get_type_object(&MemberInfoTest_Indexed);
+    auto* arr = type_get_methods_by_name(t, "add", 2);
+    ASSERT_NE(arr, nullptr);
+    EXPECT_EQ(array_length(arr), 2);
+}
+
+TEST_F(MemberInfoIndexTest, LookupsReturnCanonicalWrapper) {
+    auto* t = type_get_type_object(&MemberInfoTest_Indexed);
+    auto* first = type_get_method(t, string_literal("Gamma"));
+    auto* second = type_get_method(t, string_literal("Gamma"));
+    EXPECT_EQ(first, second);
+    auto** all = static_cast<ManagedMethodInfo**>(array_data(type_get_methods(t)));
+    EXPECT_EQ(all[4], first);
+
+    auto* animal = type_get_type_object(&MemberInfoTest_Animal);
+    EXPECT_EQ(type_get_field(animal, string_literal("Tag")),
+              type_get_field(animal, string_literal("Tag")));
+}
+
+TEST_F(MemberInfoIndexTest, GetName_ReturnsCachedString) {
+    auto* mi = type_get_method(type_get_type_object(&MemberInfoTest_Indexed),
+                               string_literal("Delta"));
+    ASSERT_NE(mi, nullptr);
+    EXPECT_EQ(methodinfo_get_name(mi), methodinfo_get_name(mi));
+}
+
+TEST_F(MemberInfoIndexTest, PropertyGetMethod_ResolvesDeclaredAccessor) {
+    auto* props = type_get_properties(type_get_type_object(&MemberInfoTest_Indexed));
+    auto** data = static_cast<ManagedPropertyInfo**>(array_data(props));
+    auto* getter = propertyinfo_get_get_method(data[0]);
+    ASSERT_NE(getter, nullptr);
+    EXPECT_EQ(getter->native_info, &MemberInfoTest_IndexedMethods[8]);
+    EXPECT_EQ(propertyinfo_get_get_method(data[0]), getter);
+}
+
+TEST_F(MemberInfoIndexTest, PropertyGetMethod_SynthesizesMissingAccessor) {
+    auto* props = type_get_properties(type_get_type_object(&MemberInfoTest_Indexed));
+    auto** data = static_cast<ManagedPropertyInfo**>(array_data(props));
+    auto* getter = propertyinfo_get_get_method(data[1]);
+    ASSERT_NE(getter, nullptr);
+    EXPECT_STREQ(getter->native_info->name, "get_Y");
+    EXPECT_EQ(getter->native_info->declaring_type, &MemberInfoTest_Indexed);
+    EXPECT_EQ(propertyinfo_get_get_method(data[1]), getter);
+}
+
+// ===== MethodInfo.Invoke through a typed invoker thunk =====
+
+static Int32 InvokeTest_Sum12(Int32 a, Int32 b, Int32 c, Int32 d, Int32 e, Int32 f,
+                              Int32 g, Int32 h, Int32 i, Int32 j, Int32 k, Int32 l) {
+    return a + b + c + d + e + f + g + h + i + j + k + l;
+}
+
+static void InvokeTest_SetRef(Object** target, Int32* counter) {
+    *target = reinterpret_cast<Object*>(&System_String_TypeInfo);
+    *counter += 1;
+}
+
+static Int32 InvokeTest_Length(String* text, Int32 extra) {
+    return (text ? string_length(text) : 0) + extra;
+}
+
+// Same shape as the compiler's __reflection_invoke_N thunks
+static Object* InvokeTest_Sum12_Thunk(void* __fn, Object*, Object** __args) {
+    auto arg = [](Object* a) { return invoke_arg<Int32>(a, &MemberInfoTest_Int32Type); };
+    using Fn = Int32(*)(Int32, Int32, Int32, Int32, Int32, Int32,
+                        Int32, Int32, Int32, Int32, Int32, Int32);
+    return box<Int32>(reinterpret_cast<Fn>(__fn)(
+        arg(__args[0]), arg(__args[1]), arg(__args[2]), arg(__args[3]), arg(__args[4]),
+        arg(__args[5]), arg(__args[6]), arg(__args[7]), arg(__args[8]), arg(__args[9]),
+        arg(__args[10]), arg(__args[11])),
+        &MemberInfoTest_Int32Type);
+}
+
+static Object* InvokeTest_SetRef_Thunk(void* __fn, Object*, Object** __args) {
+    Int32 __ref1 = invoke_arg<Int32>(__args[1], &MemberInfoTest_Int32Type);
+    reinterpret_cast<void(*)(Object**, Int32*)>(__fn)(
+        invoke_ref_slot(&__args[0], &System_Object_TypeInfo), &__ref1);
+    __args[1] = box<Int32>(__ref1, &MemberInfoTest_Int32Type);
+    return nullptr;
+}
+
+static Object* InvokeTest_Length_Thunk(void* __fn, Object*, Object** __args) {
+    return box<Int32>(reinterpret_cast<Int32(*)(String*, Int32)>(__fn)(
+        reinterpret_cast<String*>(invoke_ref_arg(__args[0], &System_String_TypeInfo)),
+        invoke_arg<Int32>(__args[1], &MemberInfoTest_Int32Type)), &MemberInfoTest_Int32Type);
+}
+
+static TypeInfo InvokeTest_Int64Type = {
+    .name = "Int64", .namespace_name = "System", .full_name = "System.Int64",
+    .instance_size = sizeof(Int64), .flags = TypeFlags::ValueType | TypeFlags::Primitive,
+};
+
+static TypeInfo InvokeTest_EnumType = {
+    .name = "Color", .namespace_name = "Test", .full_name = "Test.Color",
+    .instance_size = sizeof(Int32), .flags = TypeFlags::ValueType | TypeFlags::Enum,
+    .underlying_type = &MemberInfoTest_Int32Type,
+};
+
+static MethodInfo InvokeTest_Methods[] = {
+    { .name = "Sum12", .parameter_count = 12,
+      .method_pointer = reinterpret_cast<void*>(&InvokeTest_Sum12),
+      .flags = 0x0016, .vtable_slot = -1, .invoker = &InvokeTest_Sum12_Thunk },
+    { .name = "SetRef", .parameter_count = 2,
+      .method_pointer = reinterpret_cast<void*>(&InvokeTest_SetRef),
+      .flags = 0x0016, .vtable_slot = -1, .invoker = &InvokeTest_SetRef_Thunk },
+    { .name = "Length", .parameter_count = 2,
+      .method_pointer = reinterpret_cast<void*>(&InvokeTest_Length),
+      .flags = 0x0016, .vtable_slot = -1, .invoker = &InvokeTest_Length_Thunk },
+};
+
+TEST_F(MemberInfoTestFixture, Invoke_Thunk_UnboxesArgsAndBoxesResult) {
+    auto* mi = create_managed_method_info(&InvokeTest_Methods[0]);
+    auto* args = array_create(&System_Object_TypeInfo, 12);
+    auto** data = static_cast<Object**>(array_data(args));
+    for (Int32 i = 0; i < 12; i++)
+        data[i] = (i == 5) ? nullptr : box<Int32>(i + 1, &MemberInfoTest_Int32Type);
+
+    auto* result = methodinfo_invoke(mi, nullptr, args);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->__type_info, &MemberInfoTest_Int32Type);
+    // 1..12 minus the null (default 0) in slot 5
+    EXPECT_EQ(unbox<Int32>(result), 78 - 6);
+}
+
+TEST_F(MemberInfoTestFixture, Invoke_Thunk_ByRefArgsWriteBack) {
+    auto* mi = create_managed_method_info(&InvokeTest_Methods[1]);
+    auto* args = array_create(&System_Object_TypeInfo, 2);
+    auto** data = static_cast<Object**>(array_data(args));
+    auto* original = box<Int32>(41, &MemberInfoTest_Int32Type);
+    data[1] = original;
+
+    EXPECT_EQ(methodinfo_invoke(mi, nullptr, args), nullptr);
+    EXPECT_EQ(data[0], reinterpret_cast<Object*>(&System_String_TypeInfo));
+    // The result comes back in a new box; the caller's box is untouched
+    ASSERT_NE(data[1], original);
+    EXPECT_EQ(unbox<Int32>(data[1]), 42);
+    EXPECT_EQ(unbox<Int32>(original), 41);
+}
+
+TEST_F(MemberInfoTestFixture, Invoke_Thunk_NullByRefValueArgGetsBox) {
+    auto* mi = create_managed_method_info(&InvokeTest_Methods[1]);
+    auto* args = array_create(&System_Object_TypeInfo, 2);
+    auto** data = static_cast<Object**>(array_data(args));
+
+    EXPECT_EQ(methodinfo_invoke(mi, nullptr, args), nullptr);
+    ASSERT_NE(data[1], nullptr);
+    EXPECT_EQ(data[1]->__type_info, &MemberInfoTest_Int32Type);
+    EXPECT_EQ(unbox<Int32>(data[1]), 1);
+}
+
+static Exception* invoke_expecting_exception(ManagedMethodInfo* mi, Array* args) {
+    Exception* caught = nullptr;
+    CIL2CPP_TRY
+        methodinfo_invoke(mi, nullptr, args);
+    CIL2CPP_CATCH_ALL
+        caught = get_current_exception();
+    CIL2CPP_END_TRY
+    return caught;
+}
+
+TEST_F(MemberInfoTestFixture, Invoke_ArgumentCountMismatchThrows) {
+    auto* mi = create_managed_method_info(&InvokeTest_Methods[0]);
+    for (Int32 count : {2, 13}) {
+        auto* caught = invoke_expecting_exception(mi, array_create(&System_Object_TypeInfo, count));
+        ASSERT_NE(caught, nullptr) << count;
+        EXPECT_EQ(caught->__type_info, &TargetParameterCountException_TypeInfo);
+    }
+    auto* caught = invoke_expecting_exception(mi, nullptr);
+    ASSERT_NE(caught, nullptr);
+    EXPECT_EQ(caught->__type_info, &TargetParameterCountException_TypeInfo);
+}
+
+static Array* invoke_args(Object* first, Object* second) {
+    auto* args = array_create(&System_Object_TypeInfo, 2);
+    auto** data = static_cast<Object**>(array_data(args));
+    data[0] = first;
+    data[1] = second;
+    return args;
+}
+
+TEST_F(MemberInfoTestFixture, Invoke_ArgumentTypeMismatchThrows) {
+    auto* mi = create_managed_method_info(&InvokeTest_Methods[2]);
+    auto* text = string_literal("abc");
+    auto* number = box<Int32>(2, &MemberInfoTest_Int32Type);
+
+    // A boxed int for the String parameter, a String for the int parameter
+    for (auto* args : {invoke_args(number, number), invoke_args(text, text)}) {
+        auto* caught = invoke_expecting_exception(mi, args);
+        ASSERT_NE(caught, nullptr);
+        EXPECT_EQ(caught->__type_info, &ArgumentException_TypeInfo);
+    }
+    // A box of another value type is rejected too, not reinterpreted
+    auto* other = box<Int64>(2, &InvokeTest_Int64Type);
+    EXPECT_NE(invoke_expecting_exception(mi, invoke_args(text, other)), nullptr);
+
+    auto* result = methodinfo_invoke(mi, nullptr, invoke_args(text, number));
+    EXPECT_EQ(unbox<Int32>(result), 5);
+}
+
+TEST_F(MemberInfoTestFixture, Invoke_EnumAndUnderlyingTypeAreInterchangeable) {
+    auto* mi = create_managed_method_info(&InvokeTest_Methods[2]);
+    auto* color = box<Int32>(4, &InvokeTest_EnumType);
+
+    auto* result = methodinfo_invoke(mi, nullptr, invoke_args(nullptr, color));
+    EXPECT_EQ(unbox<Int32>(result), 4);
+}
+
+// ===== Property accessor thunks and MethodInfo.CreateDelegate =====
+
+struct AccessorTest_Poco : Object {
+    Int32 value;
+};
+
+static Int32 AccessorTest_get_Value(AccessorTest_Poco* self) { return self->value; }
+static void AccessorTest_set_Value(AccessorTest_Poco* self, Int32 v) { self->value = v; }
+
+static Object* AccessorTest_Getter_Thunk(void* __fn, Object* __obj, Object**) {
+    return box<Int32>(reinterpret_cast<Int32(*)(AccessorTest_Poco*)>(__fn)(
+        reinterpret_cast<AccessorTest_Poco*>(__obj)), &MemberInfoTest_Int32Type);
+}
+
+static Object* AccessorTest_Setter_Thunk(void* __fn, Object* __obj, Object** __args) {
+    reinterpret_cast<void(*)(AccessorTest_Poco*, Int32)>(__fn)(
+        reinterpret_cast<AccessorTest_Poco*>(__obj), invoke_arg<Int32>(__args[0], &MemberInfoTest_Int32Type));
+    return nullptr;
+}
+
+static TypeInfo* AccessorTest_Setter_ParamTypes[] = { &MemberInfoTest_Int32Type };
+
+static MethodInfo AccessorTest_Methods[] = {
+    { .name = "get_Value", .return_type = &MemberInfoTest_Int32Type,
+      .method_pointer = reinterpret_cast<void*>(&AccessorTest_get_Value),
+      .flags = 0x0886, .vtable_slot = -1, .invoker = &AccessorTest_Getter_Thunk },
+    { .name = "set_Value", .parameter_types = AccessorTest_Setter_ParamTypes, .parameter_count = 1,
+      .method_pointer = reinterpret_cast<void*>(&AccessorTest_set_Value),
+      .flags = 0x0886, .vtable_slot = -1, .invoker = &AccessorTest_Setter_Thunk },
+};
+
+static PropertyInfo AccessorTest_Properties[] = {
+    { .name = "Value", .property_type = &MemberInfoTest_Int32Type,
+      .getter = reinterpret_cast<void*>(&AccessorTest_get_Value),
+      .setter = reinterpret_cast<void*>(&AccessorTest_set_Value) },
+};
+
+static TypeInfo AccessorTest_PocoType = {
+    .name = "Poco", .namespace_name = "Test", .full_name = "Test.Poco",
+    .base_type = &System_Object_TypeInfo, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(AccessorTest_Poco), .element_size = 0,
+    .flags = TypeFlags::None, .vtable = nullptr,
+    .fields = nullptr, .field_count = 0,
+    .methods = AccessorTest_Methods, .method_count = 2,
+.properties = AccessorTest_Properties, .property_count = 1,
+};
+
+// Func<Poco, int> and Func<int>: only Invoke's arity matters to CreateDelegate
+static MethodInfo AccessorTest_OpenFunc_Methods[] = { { .name = "Invoke", .parameter_count = 1 } };
+static MethodInfo AccessorTest_ClosedFunc_Methods[] = { { .name = "Invoke", .parameter_count = 0 } };
+
+static TypeInfo AccessorTest_OpenFunc = {
+    .name = "Func`2", .namespace_name = "System", .full_name = "System.Func`2",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(Delegate), .element_size = 0,
+    .flags = TypeFlags::Delegate, .vtable = nullptr,
+    .fields = nullptr, .field_count = 0,
+    .methods = AccessorTest_OpenFunc_Methods, .method_count = 1,
+.properties = nullptr, .property_count = 0,
+};
+
+static TypeInfo AccessorTest_ClosedFunc = {
+    .name = "Func`1", .namespace_name = "System", .full_name = "System.Func`1",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(Delegate), .element_size = 0,
+    .flags = TypeFlags::Delegate, .vtable = nullptr,
+    .fields = nullptr, .field_count = 0,
+    .methods = AccessorTest_ClosedFunc_Methods, .method_count = 1,
+.properties = nullptr, .property_count = 0,
+};
+
+class PropertyAccessorTest : public MemberInfoTestFixture {
+protected:
+    void SetUp() override {
+        MemberInfoTestFixture::SetUp();
+        for (auto& m : AccessorTest_Methods) m.declaring_type = &AccessorTest_PocoType;
+        AccessorTest_Properties[0].declaring_type = &AccessorTest_PocoType;
+    }
+
+    AccessorTest_Poco* NewPoco(Int32 value) {
+        auto* poco = static_cast<AccessorTest_Poco*>(
+            gc::alloc(sizeof(AccessorTest_Poco), &AccessorTest_PocoType));
+        poco->value = value;
+        return poco;
+    }
+
+    ManagedPropertyInfo* ValueProperty() {
+        auto* props = type_get_properties(type_get_type_object(&AccessorTest_PocoType));
+        return static_cast<ManagedPropertyInfo**>(array_data(props))[0];
+    }
+};
+
+TEST_F(PropertyAccessorTest, GetValue_BoxesThroughInvoker) {
+    auto* result = propertyinfo_get_value(ValueProperty(), NewPoco(42), nullptr);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->__type_info, &MemberInfoTest_Int32Type);
+    EXPECT_EQ(unbox<Int32>(result), 42);
+}
+
+TEST_F(PropertyAccessorTest, SetValue_UnboxesThroughInvoker) {
+    auto* poco = NewPoco(1);
+    propertyinfo_set_value(ValueProperty(), poco, box<Int32>(7, &MemberInfoTest_Int32Type), nullptr);
+    EXPECT_EQ(poco->value, 7);
+    // null → default(int), like .NET
+    propertyinfo_set_value(ValueProperty(), poco, nullptr, nullptr);
+    EXPECT_EQ(poco->value, 0);
+}
+
+TEST_F(PropertyAccessorTest, CreateDelegate_OpenInstanceGetter) {
+    auto* getter = propertyinfo_get_get_method(ValueProperty());
+    auto* del = reinterpret_cast<Delegate*>(
+        methodinfo_create_delegate(getter, type_get_type_object(&AccessorTest_OpenFunc), nullptr));
+    ASSERT_NE(del, nullptr);
+    EXPECT_EQ(del->__type_info, &AccessorTest_OpenFunc);
+    EXPECT_EQ(del->target, nullptr);
+    // Invoke with no target calls method_ptr(args...), so the Poco becomes 'this'
+    auto fn = reinterpret_cast<Int32(*)(AccessorTest_Poco*)>(del->method_ptr);
+    EXPECT_EQ(fn(NewPoco(5)), 5);
+}
+
+TEST_F(PropertyAccessorTest, CreateDelegate_ClosedGetter) {
+    auto* poco = NewPoco(9);
+    auto* getter = propertyinfo_get_get_method(ValueProperty());
+    auto* del = reinterpret_cast<Delegate*>(
+        methodinfo_create_delegate(getter, type_get_type_object(&AccessorTest_ClosedFunc), poco));
+    ASSERT_NE(del, nullptr);
+    EXPECT_EQ(del->target, poco);
+}
+
+TEST_F(PropertyAccessorTest, CreateDelegate_ArityMismatchThrows) {
+    auto* getter = propertyinfo_get_get_method(ValueProperty());
+    bool caught = false;
+    CIL2CPP_TRY
+        methodinfo_create_delegate(getter, type_get_type_object(&AccessorTest_ClosedFunc), nullptr);
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
+
+// ===== MethodInfo.CreateDelegate: virtual and interface dispatch =====
+
+struct DispatchTest_Point : Object {
+    Int32 value;
+};
+
+static Int32 DispatchTest_Square_Area(Object*) { return 4; }
+static Int32 DispatchTest_Square_GetValue(Object*) { return 16; }
+static Int32 DispatchTest_Point_GetValue(Int32* self) { return *self; }
+// Like the compiler's __unbox_thunk: what a value type's vtables hold
+static Int32 DispatchTest_Point_GetValue_Unbox(Object* boxed) {
+    return DispatchTest_Point_GetValue(
+        reinterpret_cast<Int32*>(reinterpret_cast<char*>(boxed) + sizeof(Object)));
+}
+
+// Abstract Shape.Area and IValue.GetValue have no body; Square and Point implement them
+static MethodInfo DispatchTest_ShapeMethods[] = {
+    { .name = "Area", .flags = 0x05C6, .vtable_slot = 0 },
+};
+static MethodInfo DispatchTest_IValueMethods[] = {
+    { .name = "GetValue", .flags = 0x05C6, .vtable_slot = 0 },
+};
+static MethodInfo DispatchTest_PointMethods[] = {
+    { .name = "GetValue", .method_pointer = reinterpret_cast<void*>(&DispatchTest_Point_GetValue),
+      .flags = 0x01E6, .vtable_slot = 4 },
+};
+
+static void* DispatchTest_ShapeSlots[] = { nullptr };
+static void* DispatchTest_SquareSlots[] = { reinterpret_cast<void*>(&DispatchTest_Square_Area) };
+static void* DispatchTest_SquareIValueSlots[] = { reinterpret_cast<void*>(&DispatchTest_Square_GetValue) };
+static void* DispatchTest_PointSlots[] = {
+    nullptr, nullptr, nullptr, nullptr, reinterpret_cast<void*>(&DispatchTest_Point_GetValue_Unbox) };
+
+static TypeInfo DispatchTest_IValue = {
+    .name = "IValue", .namespace_name = "Test", .full_name = "Test.IValue",
+    .flags = TypeFlags::Interface,
+    .methods = DispatchTest_IValueMethods, .method_count = 1,
+};
+static VTable DispatchTest_ShapeVTable = { nullptr, DispatchTest_ShapeSlots, 1 };
+static TypeInfo DispatchTest_Shape = {
+    .name = "Shape", .namespace_name = "Test", .full_name = "Test.Shape",
+    .base_type = &System_Object_TypeInfo, .instance_size = sizeof(Object),
+    .flags = TypeFlags::Abstract, .vtable = &DispatchTest_ShapeVTable,
+    .methods = DispatchTest_ShapeMethods, .method_count = 1,
+};
+static VTable DispatchTest_SquareVTable = { nullptr, DispatchTest_SquareSlots, 1 };
+static InterfaceVTable DispatchTest_SquareInterfaces[] = {
+    { &DispatchTest_IValue, DispatchTest_SquareIValueSlots, 1 } };
+static TypeInfo DispatchTest_Square = {
+    .name = "Square", .namespace_name = "Test", .full_name = "Test.Square",
+    .base_type = &DispatchTest_Shape, .instance_size = sizeof(Object),
+    .flags = TypeFlags::None, .vtable = &DispatchTest_SquareVTable,
+    .interface_vtables = DispatchTest_SquareInterfaces, .interface_vtable_count = 1,
+};
+static VTable DispatchTest_PointVTable = { nullptr, DispatchTest_PointSlots, 5 };
+static InterfaceVTable DispatchTest_PointInterfaces[] = {
+    { &DispatchTest_IValue, &DispatchTest_PointSlots[4], 1 } };
+static TypeInfo DispatchTest_PointType = {
+    .name = "Point", .namespace_name = "Test", .full_name = "Test.Point",
+    .base_type = nullptr, .instance_size = sizeof(DispatchTest_Point),
+    .flags = TypeFlags::ValueType, .vtable = &DispatchTest_PointVTable,
+    .methods = DispatchTest_PointMethods, .method_count = 1,
+    .interface_vtables = DispatchTest_PointInterfaces, .interface_vtable_count = 1,
+};
+
+class DelegateDispatchTest : public PropertyAccessorTest {
+protected:
+    void SetUp() override {
+        PropertyAccessorTest::SetUp();
+        DispatchTest_ShapeMethods[0].declaring_type = &DispatchTest_Shape;
+        DispatchTest_IValueMethods[0].declaring_type = &DispatchTest_IValue;
+        DispatchTest_PointMethods[0].declaring_type = &DispatchTest_PointType;
+    }
+
+    Delegate* Bind(MethodInfo* method, Object* target) {
+        return reinterpret_cast<Delegate*>(methodinfo_create_delegate(create_managed_method_info(method),
+            type_get_type_object(&AccessorTest_ClosedFunc), target));
+    }
+
+    bool BindThrows(MethodInfo* method, Object* target, TypeInfo* delegate_type) {
+        bool caught = false;
+        CIL2CPP_TRY
+            methodinfo_create_delegate(create_managed_method_info(method),
+                type_get_type_object(delegate_type), target);
+        CIL2CPP_CATCH_ALL
+            caught = true;
+        CIL2CPP_END_TRY
+        return caught;
+    }
+
+    // What the generated Invoke does for a closed delegate
+    static Int32 Invoke(Delegate* del) {
+        return reinterpret_cast<Int32(*)(Object*)>(del->method_ptr)(delegate_adjust_target(del->target));
+    }
+};
+
+TEST_F(DelegateDispatchTest, CreateDelegate_AbstractMethodBindsOverride) {
+    auto* square = object_alloc(&DispatchTest_Square);
+    auto* del = Bind(&DispatchTest_ShapeMethods[0], square);
+    EXPECT_EQ(del->method_ptr, reinterpret_cast<void*>(&DispatchTest_Square_Area));
+    EXPECT_EQ(Invoke(del), 4);
+}
+
+TEST_F(DelegateDispatchTest, CreateDelegate_InterfaceMethodBindsImplementation) {
+    auto* del = Bind(&DispatchTest_IValueMethods[0], object_alloc(&DispatchTest_Square));
+    EXPECT_EQ(del->method_ptr, reinterpret_cast<void*>(&DispatchTest_Square_GetValue));
+    EXPECT_EQ(Invoke(del), 16);
+}
+
+TEST_F(DelegateDispatchTest, CreateDelegate_BoxedValueTypeBindsUnboxedMethod) {
+    auto* point = static_cast<DispatchTest_Point*>(object_alloc(&DispatchTest_PointType));
+    point->value = 7;
+    // Through the interface: the unboxing thunk maps back to Point.GetValue
+    auto* del = Bind(&DispatchTest_IValueMethods[0], point);
+    EXPECT_EQ(del->method_ptr, reinterpret_cast<void*>(&DispatchTest_Point_GetValue));
+    EXPECT_EQ(del->target, point);
+    EXPECT_EQ(Invoke(del), 7);
+    // Declared on the value type itself
+    del = Bind(&DispatchTest_PointMethods[0], point);
+    EXPECT_EQ(del->method_ptr, reinterpret_cast<void*>(&DispatchTest_Point_GetValue));
+    EXPECT_EQ(Invoke(del), 7);
+}
+
+TEST_F(DelegateDispatchTest, CreateDelegate_UnboundAbstractMethodThrows) {
+    // The target's type does not implement the interface
+    EXPECT_TRUE(BindThrows(&DispatchTest_IValueMethods[0], NewPoco(1), &AccessorTest_ClosedFunc));
+    EXPECT_TRUE(BindThrows(&DispatchTest_ShapeMethods[0], NewPoco(1), &AccessorTest_ClosedFunc));
+    // Open instance: there is no target to dispatch on, and no body to bind
+    EXPECT_TRUE(BindThrows(&DispatchTest_ShapeMethods[0], nullptr, &AccessorTest_OpenFunc));
+}
@@ -0,0 +1,131 @@
+/**
+ * CIL2CPP Runtime Tests - Sampling profiler (symbolisation, collapsed / pprof output)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace cil2cpp;
+
+namespace {
+
+#ifdef _MSC_VER
+#define TEST_NOINLINE __declspec(noinline)
+#else
+#define TEST_NOINLINE __attribute__((noinline))
+#endif
+
+volatile int g_sink = 0;
+
+// Stand-ins for two generated methods; big enough that entry + offset stays inside them
+TEST_NOINLINE void ProfilerTest_Work(int n) {
+    for (int i = 0; i < n; i++) g_sink = g_sink * 31 + i;
+}
+
+TEST_NOINLINE void ProfilerTest_Main(int n) {
+    for (int i = 0; i < n; i++) ProfilerTest_Work(i);
+    g_sink = g_sink + 1;
+}
+
+const void* addr(void (*fn)(int), int offset = 0) {
+    return reinterpret_cast<const char*>(reinterpret_cast<const void*>(fn)) + offset;
+}
+
+void register_test_methods() {
+    static bool registered = [] {
+        static const profiler::MethodSymbol table[] = {
+            { addr(ProfilerTest_Work), "ProfilerTest_Work", "Demo.Program.Work" },
+            { addr(ProfilerTest_Main), "ProfilerTest_Main", "Demo.Program.Main" },
+        };
+        profiler::register_methods(table, 2);
+        return true;
+    }();
+    (void)registered;
+}
+
+std::string read_file(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        register_test_methods();
+        profiler::reset();
+        path_ = std::filesystem::temp_directory_path() /
+            ("cil2cpp_profile_" + std::to_string(reinterpret_cast<uintptr_t>(this)));
+    }
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+        std::filesystem::remove(path_.string() + ".pb", ec);
+    }
+    std::filesystem::path path_;
+};
+
+} // namespace
+
+TEST_F(ProfilerTest, Symbolize_CompiledMethod) {
+    EXPECT_EQ(profiler::symbolize(addr(ProfilerTest_Work)), "Demo.Program.Work");
+    EXPECT_EQ(profiler::symbolize(addr(ProfilerTest_Main, 4)), "Demo.Program.Main");
+    EXPECT_EQ(profiler::symbolize(addr(ProfilerTest_Main, 4), profiler::FrameNames::Cpp), "ProfilerTest_Main");
+}
+
+TEST_F(ProfilerTest, Record_WritesCollapsedStacks) {
+    // Leaf first; the caller frame is a return address, looked up one byte back
+    const void* stack[] = { addr(ProfilerTest_Work, 2), addr(ProfilerTest_Main, 5) };
+    for (int i = 0; i < 3; i++) profiler::record(stack, 2);
+    const void* leaf_only[] = { addr(ProfilerTest_Main, 3) };
+    profiler::record(leaf_only, 1);
+    EXPECT_EQ(profiler::sample_count(), 4u);
+
+    ASSERT_TRUE(profiler::write(path_.string().c_str()));
+    EXPECT_EQ(read_file(path_), "Demo.Program.Main 1\nDemo.Program.Main;Demo.Program.Work 3\n");
+
+    ASSERT_TRUE(profiler::write(path_.string().c_str(), profiler::Format::Collapsed, profiler::FrameNames::Cpp));
+    EXPECT_EQ(read_file(path_), "ProfilerTest_Main 1\nProfilerTest_Main;ProfilerTest_Work 3\n");
+}
+
+TEST_F(ProfilerTest, Record_WritesPprofByExtension) {
+    const void* stack[] = { addr(ProfilerTest_Work, 2), addr(ProfilerTest_Main, 5) };
+    profiler::record(stack, 2);
+    auto pb = path_.string() + ".pb";
+    ASSERT_TRUE(profiler::write(pb.c_str()));
+    auto data = read_file(pb);
+    ASSERT_FALSE(data.empty());
+    EXPECT_EQ(static_cast<unsigned char>(data[0]), 0x0Au);   // field 1 (sample_type), length-delimited
+    EXPECT_NE(data.find("Demo.Program.Work"), std::string::npos);
+    EXPECT_NE(data.find("nanoseconds"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, Reset_DropsSamples) {
+    const void* stack[] = { addr(ProfilerTest_Work) };
+    profiler::record(stack, 1);
+    profiler::reset();
+    EXPECT_EQ(profiler::sample_count(), 0u);
+}
+
+#ifdef __linux__
+TEST_F(ProfilerTest, Start_SamplesBusyThread) {
+    ASSERT_TRUE(profiler::start(1000));
+    EXPECT_TRUE(profiler::is_running());
+    EXPECT_FALSE(profiler::start(1000));
+
+    auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+    while (std::chrono::steady_clock::now() < until) ProfilerTest_Main(200);
+    profiler::stop();
+
+    EXPECT_FALSE(profiler::is_running());
+    EXPECT_GT(profiler::sample_count(), 0u);
+    ASSERT_TRUE(profiler::write(path_.string().c_str()));
+    EXPECT_FALSE(read_file(path_).empty());
+}
+#endif
@@ -0,0 +1,485 @@
+/**
+ * CIL2CPP Runtime Tests - SemaphoreSlim / ManualResetEventSlim ICalls
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/sync_slim.h>
+#include <cil2cpp/cancellation.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/type_info.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace cil2cpp;
+using namespace cil2cpp::icall;
+
+namespace {
+
+// Stand-in for the generated Task<bool>: Task fields followed by m_result
+struct TestBoolTask {
+    Task base;
+    bool f_m_result;
+};
+
+TypeInfo BoolTaskTypeInfo = {
+    .name = "Task`1",
+    .namespace_name = "System.Threading.Tasks",
+    .full_name = "System.Threading.Tasks.Task`1<System.Boolean>",
+    .base_type = nullptr,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(TestBoolTask),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .properties = nullptr, .property_count = 0,
+    .finalizer = nullptr,
+};
+
+// StrongBox<bool> (SemaphoreSlim.m_lockObjAndDisposed)
+struct TestStrongBox {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    bool f_Value;
+};
+
+class SyncSlimTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        gc::init();
+        task_set_bool_typeinfo(&BoolTaskTypeInfo, sizeof(TestBoolTask),
+            offsetof(TestBoolTask, f_m_result));
+    }
+
+    static SemaphoreSlimLayout* make_semaphore(Int32 initial, Int32 max) {
+        auto* s = static_cast<SemaphoreSlimLayout*>(gc::alloc(sizeof(SemaphoreSlimLayout), nullptr));
+        s->f_m_currentCount = initial;
+        s->f_m_maxCount = max;
+        s->f_m_lockObjAndDisposed = gc::alloc(sizeof(TestStrongBox), nullptr);
+        return s;
+    }
+
+    static ManualResetEventSlimLayout* make_event(bool set, Int32 spinCount = 35) {
+        auto* e = static_cast<ManualResetEventSlimLayout*>(
+            gc::alloc(sizeof(ManualResetEventSlimLayout), nullptr));
+        e->f_m_combinedState = static_cast<Int32>((set ? 0x80000000u : 0u) | (spinCount << 19));
+        return e;
+    }
+
+    static bool wait_for_task(Task* t, int ms = 5000) {
+        for (int i = 0; i < ms && !task_is_completed(t); i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return task_is_completed(t);
+    }
+
+    static bool result_of(Task* t) {
+        return reinterpret_cast<TestBoolTask*>(t)->f_m_result;
+    }
+
+    static Int32 load(Int32& field) {
+        return std::atomic_ref<Int32>(field).load();
+    }
+
+    static constexpr CancellationToken kNone{nullptr};
+};
+
+} // namespace
+
+// ===== SemaphoreSlim =====
+
+TEST_F(SyncSlimTest, Semaphore_WaitConsumesCount) {
+    auto* s = make_semaphore(2, 2);
+    EXPECT_TRUE(SemaphoreSlim_Wait(s, 0, kNone));
+    EXPECT_TRUE(SemaphoreSlim_Wait(s, 0, kNone));
+    EXPECT_FALSE(SemaphoreSlim_Wait(s, 0, kNone));
+    EXPECT_EQ(s->f_m_currentCount, 0);
+}
+
+TEST_F(SyncSlimTest, Semaphore_ReleaseReturnsPreviousCount) {
+    auto* s = make_semaphore(0, 5);
+    EXPECT_EQ(SemaphoreSlim_Release(s, 2), 0);
+    EXPECT_EQ(SemaphoreSlim_Release(s, 1), 2);
+    EXPECT_EQ(s->f_m_currentCount, 3);
+}
+
+TEST_F(SyncSlimTest, Semaphore_ReleasePastMaxThrows) {
+    auto* s = make_semaphore(1, 1);
+    TypeInfo* caught = nullptr;
+    CIL2CPP_TRY
+        SemaphoreSlim_Release(s, 1);
+    CIL2CPP_CATCH_ALL
+        caught = get_current_exception()->__type_info;
+    CIL2CPP_END_TRY
+    EXPECT_EQ(caught, &SemaphoreFullException_TypeInfo);
+    EXPECT_EQ(s->f_m_currentCount, 1);
+}
+
+TEST_F(SyncSlimTest, Semaphore_PingPongNeverLosesAWakeup) {
+    // Every handoff parks the waiter: a Release that misses it hangs the test
+    auto* ping = make_semaphore(0, 1);
+    auto* pong = make_semaphore(0, 1);
+    constexpr int kRounds = 5000;
+    std::thread echo([&] {
+        for (int i = 0; i < kRounds; i++) {
+            EXPECT_TRUE(SemaphoreSlim_Wait(ping, -1, kNone));
+            SemaphoreSlim_Release(pong, 1);
+        }
+    });
+    for (int i = 0; i < kRounds; i++) {
+        SemaphoreSlim_Release(ping, 1);
+        EXPECT_TRUE(SemaphoreSlim_Wait(pong, -1, kNone));
+    }
+    echo.join();
+    EXPECT_EQ(ping->f_m_currentCount, 0);
+    EXPECT_EQ(pong->f_m_currentCount, 0);
+}
+
+TEST_F(SyncSlimTest, Semaphore_DisposedWaitThrows) {
+    auto* s = make_semaphore(1, 1);
+    static_cast<TestStrongBox*>(s->f_m_lockObjAndDisposed)->f_Value = true;
+    bool caught = false;
+    CIL2CPP_TRY
+        SemaphoreSlim_Wait(s, 0, kNone);
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
+
+TEST_F(SyncSlimTest, Semaphore_WaitTimesOut) {
+    auto* s = make_semaphore(0, 1);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(SemaphoreSlim_Wait(s, 30, kNone));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(25));
+    EXPECT_EQ(s->f_m_waitCount, 0);
+}
+
+TEST_F(SyncSlimTest, Semaphore_ReleaseWakesParkedWaiters) {
+    auto* s = make_semaphore(0, 100);
+    constexpr int kWaiters = 8;
+    std::atomic<int> acquired{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kWaiters; i++)
+        threads.emplace_back([&] { if (SemaphoreSlim_Wait(s, -1, kNone)) acquired++; });
+    while (load(s->f_m_waitCount) < kWaiters) std::this_thread::yield();
+
+    SemaphoreSlim_Release(s, 3);
+    while (acquired.load() < 3) std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(acquired.load(), 3);  // exactly the released count
+
+    SemaphoreSlim_Release(s, kWaiters - 3);
+    for (auto& t : threads) t.join();
+    EXPECT_EQ(acquired.load(), kWaiters);
+    EXPECT_EQ(s->f_m_currentCount, 0);
+}
+
+TEST_F(SyncSlimTest, Semaphore_MutualExclusionUnderContention) {
+    auto* s = make_semaphore(1, 1);
+    constexpr int kThreads = 4;
+    constexpr int kIterations = 5000;
+    int inside = 0;
+    long long total = 0;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; i++) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < kIterations; j++) {
+                SemaphoreSlim_Wait(s, -1, kNone);
+                EXPECT_EQ(++inside, 1);
+                total++;
+                --inside;
+                SemaphoreSlim_Release(s, 1);
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    EXPECT_EQ(total, kThreads * kIterations);
+    EXPECT_EQ(s->f_m_currentCount, 1);
+}
+
+TEST_F(SyncSlimTest, Semaphore_WaitCanceledWhileParked) {
+    auto* s = make_semaphore(0, 1);
+    auto* cts = cts_create();
+    std::atomic<bool> caught{false};
+    std::thread waiter([&] {
+        CIL2CPP_TRY
+            SemaphoreSlim_Wait(s, -1, cts_get_token(cts));
+        CIL2CPP_CATCH_ALL
+            caught = true;
+        CIL2CPP_END_TRY
+    });
+    while (load(s->f_m_waitCount) == 0) std::this_thread::yield();
+    cts_cancel(cts);
+    waiter.join();
+    EXPECT_TRUE(caught.load());
+    EXPECT_EQ(s->f_m_waitCount, 0);
+}
+
+TEST_F(SyncSlimTest, Semaphore_WaitAsync_AvailableCompletesSynchronously) {
+    auto* s = make_semaphore(1, 1);
+    auto* t = SemaphoreSlim_WaitAsync(s, -1, kNone);
+    ASSERT_NE(t, nullptr);
+    EXPECT_TRUE(task_is_completed(t));
+    EXPECT_TRUE(result_of(t));
+    EXPECT_EQ(s->f_m_currentCount, 0);
+
+    auto* t2 = SemaphoreSlim_WaitAsync(s, 0, kNone);
+    EXPECT_TRUE(task_is_completed(t2));
+    EXPECT_FALSE(result_of(t2));
+}
+
+TEST_F(SyncSlimTest, Semaphore_WaitAsync_ReleaseCompletesInOrder) {
+    auto* s = make_semaphore(0, 10);
+    auto* first = SemaphoreSlim_WaitAsync(s, -1, kNone);
+    auto* second = SemaphoreSlim_WaitAsync(s, -1, kNone);
+    EXPECT_FALSE(task_is_completed(first));
+    EXPECT_FALSE(task_is_completed(second));
+
+    SemaphoreSlim_Release(s, 1);
+    ASSERT_TRUE(wait_for_task(first));
+    EXPECT_TRUE(result_of(first));
+    EXPECT_FALSE(task_is_completed(second));
+
+    SemaphoreSlim_Release(s, 1);
+    ASSERT_TRUE(wait_for_task(second));
+    EXPECT_TRUE(result_of(second));
+    EXPECT_EQ(s->f_m_currentCount, 0);
+    EXPECT_EQ(s->f_m_asyncHead, nullptr);
+}
+
+TEST_F(SyncSlimTest, Semaphore_WaitAsync_TimesOut) {
+    auto* s = make_semaphore(0, 1);
+    auto* t = SemaphoreSlim_WaitAsync(s, 20, kNone);
+    ASSERT_TRUE(wait_for_task(t));
+    EXPECT_FALSE(result_of(t));
+    EXPECT_EQ(s->f_m_asyncHead, nullptr);
+
+    // The expired waiter must not swallow a later release
+    SemaphoreSlim_Release(s, 1);
+    EXPECT_EQ(s->f_m_currentCount, 1);
+}
+
+TEST_F(SyncSlimTest, Semaphore_WaitAsync_Canceled) {
+    auto* s = make_semaphore(0, 1);
+    auto* cts = cts_create();
+    auto* t = SemaphoreSlim_WaitAsync(s, -1, cts_get_token(cts));
+    EXPECT_FALSE(task_is_completed(t));
+    cts_cancel(cts);
+    ASSERT_TRUE(wait_for_task(t));
+    EXPECT_EQ(t->f_status, 2);   // faulted with OperationCanceledException
+    EXPECT_EQ(s->f_m_asyncHead, nullptr);
+}
+
+TEST_F(SyncSlimTest, Semaphore_WaitAsync_ManyWaitersAllGranted) {
+    auto* s = make_semaphore(0, 1000);
+    constexpr int kWaiters = 200;
+    std::vector<Task*> tasks;
+    for (int i = 0; i < kWaiters; i++) tasks.push_back(SemaphoreSlim_WaitAsync(s, -1, kNone));
+
+    std::vector<std::thread> releasers;
+    for (int i = 0; i < 4; i++)
+        releasers.emplace_back([&] { for (int j = 0; j < kWaiters / 4; j++) SemaphoreSlim_Release(s, 1); });
+    for (auto& r : releasers) r.join();
+
+    for (auto* t : tasks) {
+        ASSERT_TRUE(wait_for_task(t));
+        EXPECT_TRUE(result_of(t));
+    }
+    EXPECT_EQ(s->f_m_currentCount, 0);
+}
+
+TEST_F(SyncSlimTest, Semaphore_WaitAsync_TimeoutsExpireInDeadlineOrder) {
+    auto* s = make_semaphore(0, 1);
+    auto* late = SemaphoreSlim_WaitAsync(s, 2000, kNone);
+    auto* early = SemaphoreSlim_WaitAsync(s, 20, kNone);
+    auto* granted = SemaphoreSlim_WaitAsync(s, 1000, kNone);
+    ASSERT_TRUE(wait_for_task(early));
+    EXPECT_FALSE(result_of(early));
+    EXPECT_FALSE(task_is_completed(late));
+
+    // late is first in the queue; a grant takes it off the timer as well
+    SemaphoreSlim_Release(s, 1);
+    ASSERT_TRUE(wait_for_task(late));
+    EXPECT_TRUE(result_of(late));
+    EXPECT_FALSE(task_is_completed(granted));
+    SemaphoreSlim_Release(s, 1);
+    ASSERT_TRUE(wait_for_task(granted));
+    EXPECT_TRUE(result_of(granted));
+    EXPECT_EQ(s->f_m_asyncHead, nullptr);
+}
+
+TEST_F(SyncSlimTest, Semaphore_WaitAsync_AlreadyCanceledTokenNeverQueues) {
+    auto* s = make_semaphore(0, 1);
+    auto* cts = cts_create();
+    cts_cancel(cts);
+    auto* t = SemaphoreSlim_WaitAsync(s, -1, cts_get_token(cts));
+    EXPECT_TRUE(task_is_completed(t));
+    EXPECT_EQ(t->f_status, 2);
+    EXPECT_EQ(s->f_m_asyncHead, nullptr);
+}
+
+TEST_F(SyncSlimTest, Semaphore_WaitCanceledRepeatedly) {
+    // Cancellation must reach a waiter however the wake races its park
+    auto* s = make_semaphore(0, 1);
+    for (int i = 0; i < 200; i++) {
+        auto* cts = cts_create();
+        std::atomic<bool> caught{false};
+        std::thread waiter([&] {
+            CIL2CPP_TRY
+                SemaphoreSlim_Wait(s, -1, cts_get_token(cts));
+            CIL2CPP_CATCH_ALL
+                caught = true;
+            CIL2CPP_END_TRY
+        });
+        cts_cancel(cts);
+        waiter.join();
+        EXPECT_TRUE(caught.load());
+    }
+    EXPECT_EQ(s->f_m_waitCount, 0);
+}
+
+TEST_F(SyncSlimTest, Semaphore_DisposeCancelsQueuedWaiters) {
+    auto* s = make_semaphore(0, 1);
+    auto* cts = cts_create();
+    auto* plain = SemaphoreSlim_WaitAsync(s, -1, kNone);
+    auto* timed = SemaphoreSlim_WaitAsync(s, 60000, kNone);
+    auto* cancelable = SemaphoreSlim_WaitAsync(s, -1, cts_get_token(cts));
+
+    SemaphoreSlim_Dispose(s, true);
+    for (auto* t : {plain, timed, cancelable}) {
+        ASSERT_TRUE(wait_for_task(t));
+        EXPECT_EQ(t->f_status, 2);
+    }
+    EXPECT_EQ(s->f_m_asyncHead, nullptr);
+    EXPECT_TRUE(static_cast<TestStrongBox*>(s->f_m_lockObjAndDisposed)->f_Value);
+    cts_cancel(cts);    // its registration is gone
+}
+
+// ===== Cancellation wakes =====
+
+namespace {
+
+bool g_transitioned = false;
+std::vector<int> g_notify_order;
+
+void record_wake(CancelWake* node) {
+    g_notify_order.push_back(1);
+    *static_cast<int*>(node->context) += 1;
+    cts_wake_done(node);
+}
+
+bool fake_transition(CancellationTokenSource* cts) {
+    g_transitioned = true;
+    g_notify_order.push_back(0);
+    Int32 expected = 0;
+    return std::atomic_ref<Int32>(cts->f__state).compare_exchange_strong(expected, 1);
+}
+
+void fake_callbacks(CancellationTokenSource* cts, bool) {
+    g_notify_order.push_back(2);
+    std::atomic_ref<Int32>(cts->f__state).store(2);
+}
+
+} // namespace
+
+TEST_F(SyncSlimTest, CancelWake_RunsOnceForRegisteredNodes) {
+    auto* cts = cts_create();
+    int fired = 0;
+    CancelWake kept{record_wake, &fired, cts, nullptr, nullptr, {}};
+    CancelWake dropped{record_wake, &fired, cts, nullptr, nullptr, {}};
+    ASSERT_TRUE(cts_register_wake(&kept));
+    ASSERT_TRUE(cts_register_wake(&dropped));
+    EXPECT_FALSE(cts_unregister_wake(&dropped));
+
+    g_notify_order.clear();
+    cts_cancel(cts);
+    cts_cancel(cts);
+    EXPECT_EQ(fired, 1);
+    EXPECT_TRUE(cts_unregister_wake(&kept));
+
+    CancelWake late{record_wake, &fired, cts, nullptr, nullptr, {}};
+    EXPECT_FALSE(cts_register_wake(&late));
+}
+
+TEST_F(SyncSlimTest, NotifyCancellation_WakesBetweenTransitionAndCallbacks) {
+    cts_set_notify_methods(fake_transition, fake_callbacks);
+    auto* cts = cts_create();
+    int fired = 0;
+    CancelWake node{record_wake, &fired, cts, nullptr, nullptr, {}};
+    ASSERT_TRUE(cts_register_wake(&node));
+
+    g_notify_order.clear();
+    CancellationTokenSource_NotifyCancellation(cts, false);
+    EXPECT_TRUE(g_transitioned);
+    EXPECT_EQ(g_notify_order, (std::vector<int>{0, 1, 2}));
+
+    // After the callbacks ran (_state 2) the source still reads as canceled
+    EXPECT_TRUE(cts_is_cancellation_requested(cts));
+    EXPECT_FALSE(cts_register_wake(&node));
+    cts_set_notify_methods(nullptr, nullptr);
+}
+
+// ===== ManualResetEventSlim =====
+
+TEST_F(SyncSlimTest, Event_SetAndReset) {
+    auto* e = make_event(false);
+    EXPECT_FALSE(ManualResetEventSlim_Wait(e, 0, kNone));
+    ManualResetEventSlim_Set(e);
+    EXPECT_TRUE(ManualResetEventSlim_Wait(e, 0, kNone));
+    EXPECT_TRUE(ManualResetEventSlim_Wait(e, -1, kNone));
+    ManualResetEventSlim_Reset(e);
+    EXPECT_FALSE(ManualResetEventSlim_Wait(e, 10, kNone));
+    EXPECT_EQ(e->f_m_combinedState & 0x7FFFF, 0);   // no waiter left registered
+}
+
+TEST_F(SyncSlimTest, Event_SetReleasesAllWaiters) {
+    auto* e = make_event(false, 1);
+    constexpr int kWaiters = 6;
+    std::atomic<int> released{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kWaiters; i++)
+        threads.emplace_back([&] { if (ManualResetEventSlim_Wait(e, -1, kNone)) released++; });
+    while ((load(e->f_m_combinedState) & 0x7FFFF) < kWaiters) std::this_thread::yield();
+
+    ManualResetEventSlim_Set_Cancellation(e, false);
+    for (auto& t : threads) t.join();
+    EXPECT_EQ(released.load(), kWaiters);
+    EXPECT_EQ(e->f_m_combinedState & 0x7FFFF, 0);
+}
+
+TEST_F(SyncSlimTest, Event_WaitCanceled) {
+    auto* e = make_event(false);
+    auto* cts = cts_create();
+    std::thread canceler([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        cts_cancel(cts);
+    });
+    bool caught = false;
+    CIL2CPP_TRY
+        ManualResetEventSlim_Wait(e, -1, cts_get_token(cts));
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    canceler.join();
+    EXPECT_TRUE(caught);
+}
+
+TEST_F(SyncSlimTest, Event_DisposedResetThrows) {
+    auto* e = make_event(false);
+    e->f_m_combinedState |= 0x40000000;
+    bool caught = false;
+    CIL2CPP_TRY
+        ManualResetEventSlim_Reset(e);
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
@@ -100,6 +100,33 @@ TEST(MonitorTest, MultiThread_NoRace) {
     EXPECT_EQ(counter.load(), iterations * 2);
 }
 
+TEST(MonitorTest, ContentionCount_CountsBlockedEnter) {
+    auto* obj = object_alloc(&MonitorTestType);
+    ASSERT_NE(obj, nullptr);
+
+    // Uncontended and recursive acquisitions don't count
+    auto before = monitor::get_contention_count();
+    monitor::enter(obj);
+    monitor::enter(obj);
+    monitor::exit(obj);
+    EXPECT_EQ(monitor::get_contention_count(), before);
+
+    std::atomic<bool> started{false};
+    std::thread t([&]() {
+        gc::register_thread();
+        started.store(true);
+        monitor::enter(obj);
+        monitor::exit(obj);
+        gc::unregister_thread();
+    });
+    while (!started.load()) std::this_thread::yield();
+    while (monitor::get_contention_count() == before) std::this_thread::yield();
+    monitor::exit(obj);
+    t.join();
+
+    EXPECT_EQ(monitor::get_contention_count(), before + 1);
+}
+
 TEST(MonitorTest, WaitPulse_BasicSignal) {
     auto* obj = object_alloc(&MonitorTestType);
     ASSERT_NE(obj, nullptr);
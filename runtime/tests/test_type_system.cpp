@@ -960,3 +960,58 @@ TEST_F(TypeSystemTest, Variance_Contravariant_ViaInterfaceOnClass) {
     };
     EXPECT_TRUE(type_is_assignable_from(&IContravariant_Dog, &ContravariantAnimalImpl));
 }
+
+// ===== Generic virtual method dispatch (GvmCallSite) =====
+
+// Only identity matters for dispatch lookups
+static TypeInfo GvmReceivers[40] = {};
+
+TEST_F(TypeSystemTest, GvmLookup_SmallSite_ReturnsTargetIndex) {
+    static TypeInfo* types[] = { &GvmReceivers[0], &GvmReceivers[1], &GvmReceivers[2] };
+    static GvmCallSite site(types, 3);
+
+    EXPECT_EQ(gvm_lookup(&site, &GvmReceivers[2]), 2);
+    EXPECT_EQ(gvm_lookup(&site, &GvmReceivers[0]), 0);
+    EXPECT_EQ(gvm_lookup(&site, &GvmReceivers[1]), 1);
+}
+
+TEST_F(TypeSystemTest, GvmLookup_UnknownType_ReturnsMinusOne) {
+    static TypeInfo* types[] = { &GvmReceivers[0], &GvmReceivers[1], &GvmReceivers[2] };
+    static GvmCallSite site(types, 3);
+
+    EXPECT_EQ(gvm_lookup(&site, &GvmReceivers[39]), -1);
+    EXPECT_EQ(site.last.load(), nullptr);
+}
+
+TEST_F(TypeSystemTest, GvmLookup_CachesLastResolvedType) {
+    static TypeInfo* types[] = { &GvmReceivers[0], &GvmReceivers[1], &GvmReceivers[2] };
+    static GvmCallSite site(types, 3);
+
+    EXPECT_EQ(gvm_lookup(&site, &GvmReceivers[1]), 1);
+    EXPECT_EQ(site.last.load(), &types[1]);
+    // A miss on an unknown type keeps the cached entry
+    EXPECT_EQ(gvm_lookup(&site, &GvmReceivers[39]), -1);
+    EXPECT_EQ(site.last.load(), &types[1]);
+}
+
+TEST_F(TypeSystemTest, GvmLookup_LargeSite_UsesHashTable) {
+    static TypeInfo* types[32];
+    for (int i = 0; i < 32; i++) types[i] = &GvmReceivers[i];
+    static GvmCallSite site(types, 32);
+
+    for (int round = 0; round < 2; round++) {
+        for (int i = 31; i >= 0; i--)
+            EXPECT_EQ(gvm_lookup(&site, &GvmReceivers[i]), i);
+    }
+    EXPECT_NE(site.table.load(), nullptr);
+    EXPECT_EQ(gvm_lookup(&site, &GvmReceivers[35]), -1);
+}
+
+TEST_F(TypeSystemTest, GvmLookup_DuplicateType_FirstTargetWins) {
+    static TypeInfo* types[12];
+    for (int i = 0; i < 12; i++) types[i] = &GvmReceivers[i];
+    types[10] = &GvmReceivers[3];
+    static GvmCallSite site(types, 12);
+
+    EXPECT_EQ(gvm_lookup(&site, &GvmReceivers[3]), 3);
+}
@@ -3,6 +3,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <vector>
 #include <cil2cpp/unicode.h>
 #include <cil2cpp/string.h>
 #include <cil2cpp/gc.h>
@@ -192,6 +193,29 @@ TEST(UnicodeCharClass, IsLowSurrogate) {
     EXPECT_FALSE(unicode::is_low_surrogate(0xD800));
 }
 
+// ===== ASCII Detection =====
+
+TEST(UnicodeAscii, IsAscii_Empty) {
+    EXPECT_TRUE(unicode::is_ascii(nullptr, 0));
+}
+
+TEST(UnicodeAscii, IsAscii_NonAsciiAtEveryPosition) {
+    // Lengths straddle the 16-unit vector blocks, the 4-unit words and the scalar tail
+    for (Int32 len = 1; len <= 40; len++) {
+        std::vector<Char> buf(static_cast<size_t>(len), u'x');
+        buf[static_cast<size_t>(len - 1)] = 0x7F;
+        EXPECT_TRUE(unicode::is_ascii(buf.data(), len)) << "len " << len;
+        for (Int32 pos = 0; pos < len; pos++) {
+            Char saved = buf[static_cast<size_t>(pos)];
+            for (Char bad : { Char(0x80), Char(0x0100), Char(0xFFFF) }) {
+                buf[static_cast<size_t>(pos)] = bad;
+                EXPECT_FALSE(unicode::is_ascii(buf.data(), len)) << "len " << len << " pos " << pos;
+            }
+            buf[static_cast<size_t>(pos)] = saved;
+        }
+    }
+}
+
 // ===== Case Conversion =====
 
 TEST(UnicodeCaseConversion, ToUpper_Ascii) {
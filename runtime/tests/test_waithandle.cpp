@@ -0,0 +1,342 @@
+/**
+ * CIL2CPP Runtime Tests - Wait handles (events, mutex, semaphore, WaitAny/WaitAll)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/waithandle.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/gc.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace cil2cpp;
+using namespace cil2cpp::icall;
+
+namespace {
+
+constexpr Int32 kWaitTimeout = 258;
+constexpr Int32 kManualReset = 1;
+constexpr Int32 kAutoReset = 0;
+
+Int32 wait_multiple(std::vector<intptr_t>& handles, bool waitAll, Int32 timeoutMs) {
+    return WaitHandle_WaitMultipleIgnoringSyncContext(handles.data(),
+        static_cast<Int32>(handles.size()), waitAll, timeoutMs);
+}
+
+void close_all(const std::vector<intptr_t>& handles) {
+    for (auto h : handles) WaitHandle_CloseHandle(h);
+}
+
+/// TypeInfo of the exception `fn` throws, or nullptr if it returns.
+template <typename Fn>
+TypeInfo* thrown_type(Fn fn) {
+    gc::init();
+    TypeInfo* type = nullptr;
+    CIL2CPP_TRY
+        fn();
+    CIL2CPP_CATCH_ALL
+        type = get_current_exception()->__type_info;
+    CIL2CPP_END_TRY
+    return type;
+}
+
+} // namespace
+
+TEST(WaitHandleTest, ManualResetEvent_StaysSignaled) {
+    intptr_t ev = EventWaitHandle_CreateEventCoreWin32(false, kManualReset);
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 0), kWaitTimeout);
+    EventWaitHandle_Set(ev);
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 0), 0);
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 0), 0);
+    EventWaitHandle_Reset(ev);
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 0), kWaitTimeout);
+    WaitHandle_CloseHandle(ev);
+}
+
+TEST(WaitHandleTest, AutoResetEvent_ReleasesOneWaiter) {
+    intptr_t ev = EventWaitHandle_CreateEventCoreWin32(true, kAutoReset);
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 0), 0);
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 0), kWaitTimeout);
+
+    constexpr int kWaiters = 4;
+    std::atomic<int> woken{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kWaiters; i++) {
+        threads.emplace_back([&] {
+            if (WaitHandle_WaitOneCore(ev, -1) == 0) woken++;
+        });
+    }
+    for (int i = 1; i <= kWaiters; i++) {
+        EventWaitHandle_Set(ev);
+        while (woken.load() < i) std::this_thread::yield();
+        EXPECT_EQ(woken.load(), i); // exactly one waiter per Set
+    }
+    for (auto& t : threads) t.join();
+    WaitHandle_CloseHandle(ev);
+}
+
+TEST(WaitHandleTest, Timeout_Elapses) {
+    intptr_t ev = EventWaitHandle_CreateEventCoreWin32(false, kManualReset);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 50), kWaitTimeout);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(45));
+    WaitHandle_CloseHandle(ev);
+}
+
+TEST(WaitHandleTest, Semaphore_CountsAndMaximum) {
+    intptr_t sem = Semaphore_CreateSemaphoreCoreWin32(1, 3);
+    EXPECT_EQ(WaitHandle_WaitOneCore(sem, 0), 0);
+    EXPECT_EQ(WaitHandle_WaitOneCore(sem, 0), kWaitTimeout);
+    EXPECT_EQ(Semaphore_ReleaseSemaphore(sem, 2), 0);
+    EXPECT_EQ(Semaphore_ReleaseSemaphore(sem, 1), 2);
+    EXPECT_EQ(WaitHandle_WaitOneCore(sem, 0), 0);
+    EXPECT_EQ(WaitHandle_WaitOneCore(sem, 0), 0);
+    EXPECT_EQ(WaitHandle_WaitOneCore(sem, 0), 0);
+    EXPECT_EQ(WaitHandle_WaitOneCore(sem, 0), kWaitTimeout);
+
+    EXPECT_EQ(Semaphore_ReleaseSemaphore(sem, 3), 0);
+    EXPECT_EQ(thrown_type([&] { Semaphore_ReleaseSemaphore(sem, 1); }),
+        &SemaphoreFullException_TypeInfo);
+    WaitHandle_CloseHandle(sem);
+}
+
+TEST(WaitHandleTest, Mutex_RecursiveAndOwnedByThread) {
+    intptr_t m = Mutex_CreateMutexCoreWin32(true);
+    EXPECT_EQ(WaitHandle_WaitOneCore(m, 0), 0); // recursion
+    std::thread other([&] { EXPECT_EQ(WaitHandle_WaitOneCore(m, 0), kWaitTimeout); });
+    other.join();
+
+    Mutex_ReleaseMutex(m);
+    std::thread still([&] { EXPECT_EQ(WaitHandle_WaitOneCore(m, 0), kWaitTimeout); });
+    still.join();
+
+    Mutex_ReleaseMutex(m);
+    std::thread now([&] {
+        EXPECT_EQ(WaitHandle_WaitOneCore(m, 0), 0);
+        Mutex_ReleaseMutex(m);
+    });
+    now.join();
+    WaitHandle_CloseHandle(m);
+}
+
+TEST(WaitHandleTest, Mutex_ReleaseByNonOwnerThrowsApplicationException) {
+    intptr_t m = Mutex_CreateMutexCoreWin32(false);
+    EXPECT_EQ(thrown_type([&] { Mutex_ReleaseMutex(m); }), &ApplicationException_TypeInfo);
+
+    intptr_t ev = EventWaitHandle_CreateEventCoreWin32(true, kManualReset);
+    EXPECT_EQ(thrown_type([&] { WaitHandle_SignalAndWaitNative(m, ev, 0); }),
+        &ApplicationException_TypeInfo);
+    WaitHandle_CloseHandle(ev);
+    WaitHandle_CloseHandle(m);
+}
+
+TEST(WaitHandleTest, Mutex_HandedToBlockedWaiter) {
+    intptr_t m = Mutex_CreateMutexCoreWin32(true);
+    std::atomic<bool> acquired{false};
+    std::thread waiter([&] {
+        EXPECT_EQ(WaitHandle_WaitOneCore(m, -1), 0);
+        acquired = true;
+        Mutex_ReleaseMutex(m);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(acquired.load());
+    Mutex_ReleaseMutex(m);
+    waiter.join();
+    EXPECT_TRUE(acquired.load());
+    WaitHandle_CloseHandle(m);
+}
+
+TEST(WaitHandleTest, WaitAny_ReturnsSignaledIndex) {
+    std::vector<intptr_t> events;
+    for (int i = 0; i < 64; i++)
+        events.push_back(EventWaitHandle_CreateEventCoreWin32(false, kAutoReset));
+    EXPECT_EQ(wait_multiple(events, false, 0), kWaitTimeout);
+
+    EventWaitHandle_Set(events[41]);
+    EXPECT_EQ(wait_multiple(events, false, 0), 41);
+    EXPECT_EQ(WaitHandle_WaitOneCore(events[41], 0), kWaitTimeout); // auto-reset consumed
+
+    std::thread setter([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EventWaitHandle_Set(events[63]);
+    });
+    EXPECT_EQ(wait_multiple(events, false, -1), 63);
+    setter.join();
+    EXPECT_EQ(WaitHandle_WaitOneCore(events[63], 0), kWaitTimeout);
+    close_all(events);
+}
+
+TEST(WaitHandleTest, WaitAny_ConsumesExactlyOneObject) {
+    intptr_t a = EventWaitHandle_CreateEventCoreWin32(false, kAutoReset);
+    intptr_t b = Semaphore_CreateSemaphoreCoreWin32(0, 10);
+    std::vector<intptr_t> handles = { a, b };
+
+    std::thread waiter([&] { EXPECT_NE(wait_multiple(handles, false, -1), kWaitTimeout); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EventWaitHandle_Set(a);
+    Semaphore_ReleaseSemaphore(b, 1);
+    waiter.join();
+
+    // One of the two signals went to the waiter, the other is still pending
+    int remaining = (WaitHandle_WaitOneCore(a, 0) == 0) + (WaitHandle_WaitOneCore(b, 0) == 0);
+    EXPECT_EQ(remaining, 1);
+    close_all(handles);
+}
+
+TEST(WaitHandleTest, WaitAll_RequiresEveryHandle) {
+    intptr_t a = EventWaitHandle_CreateEventCoreWin32(false, kAutoReset);
+    intptr_t b = Semaphore_CreateSemaphoreCoreWin32(0, 1);
+    intptr_t c = EventWaitHandle_CreateEventCoreWin32(true, kManualReset);
+    std::vector<intptr_t> handles = { a, b, c };
+
+    EventWaitHandle_Set(a);
+    EXPECT_EQ(wait_multiple(handles, true, 0), kWaitTimeout);
+    EXPECT_EQ(WaitHandle_WaitOneCore(a, 0), 0); // a failed WaitAll consumes nothing
+
+    std::atomic<bool> done{false};
+    std::thread waiter([&] {
+        EXPECT_EQ(wait_multiple(handles, true, -1), 0);
+        done = true;
+    });
+    EventWaitHandle_Set(a);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(done.load());
+    Semaphore_ReleaseSemaphore(b, 1);
+    waiter.join();
+
+    EXPECT_EQ(WaitHandle_WaitOneCore(a, 0), kWaitTimeout);
+    EXPECT_EQ(WaitHandle_WaitOneCore(b, 0), kWaitTimeout);
+    EXPECT_EQ(WaitHandle_WaitOneCore(c, 0), 0); // manual-reset stays set
+    close_all(handles);
+}
+
+TEST(WaitHandleTest, WaitAll_Timeout) {
+    std::vector<intptr_t> handles = {
+        EventWaitHandle_CreateEventCoreWin32(true, kManualReset),
+        EventWaitHandle_CreateEventCoreWin32(false, kManualReset),
+    };
+    EXPECT_EQ(wait_multiple(handles, true, 30), kWaitTimeout);
+    close_all(handles);
+}
+
+TEST(WaitHandleTest, SignalAndWait) {
+    intptr_t ping = EventWaitHandle_CreateEventCoreWin32(false, kAutoReset);
+    intptr_t pong = EventWaitHandle_CreateEventCoreWin32(false, kAutoReset);
+    std::thread echo([&] {
+        for (int i = 0; i < 100; i++) {
+            WaitHandle_WaitOneCore(ping, -1);
+            EventWaitHandle_Set(pong);
+        }
+    });
+    for (int i = 0; i < 100; i++) EXPECT_EQ(WaitHandle_SignalAndWaitNative(ping, pong, -1), 0);
+    echo.join();
+
+    intptr_t full = Semaphore_CreateSemaphoreCoreWin32(1, 1);
+    EXPECT_EQ(WaitHandle_SignalAndWaitNative(full, pong, 0), 298); // ERROR_TOO_MANY_POSTS
+    WaitHandle_CloseHandle(full);
+    WaitHandle_CloseHandle(ping);
+    WaitHandle_CloseHandle(pong);
+}
+
+TEST(WaitHandleTest, ManyWaitersStress) {
+    intptr_t sem = Semaphore_CreateSemaphoreCoreWin32(0, 1 << 20);
+    intptr_t stop = EventWaitHandle_CreateEventCoreWin32(false, kManualReset);
+    std::vector<intptr_t> handles = { stop, sem };
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&] {
+            while (wait_multiple(handles, false, -1) == 1) consumed++;
+        });
+    }
+    for (int i = 0; i < 10000; i++) Semaphore_ReleaseSemaphore(sem, 1);
+    while (consumed.load() < 10000) std::this_thread::yield();
+    EventWaitHandle_Set(stop);
+    for (auto& t : threads) t.join();
+    EXPECT_EQ(consumed.load(), 10000);
+    EXPECT_EQ(WaitHandle_WaitOneCore(sem, 0), kWaitTimeout);
+    close_all(handles);
+}
+
+#ifndef _WIN32
+
+// Interop.Kernel32 QCall entry points used by Unix CoreLib
+extern "C" {
+intptr_t CreateEventExW(intptr_t, uint16_t*, uint32_t, uint32_t);
+int32_t SetEvent(intptr_t);
+intptr_t CreateSemaphoreExW(intptr_t, int32_t, int32_t, uint16_t*, uint32_t, uint32_t);
+int32_t ReleaseSemaphore(intptr_t, int32_t, int32_t*);
+intptr_t CreateMutexExW(intptr_t, uint16_t*, uint32_t, uint32_t);
+int32_t ReleaseMutex(intptr_t);
+int32_t CloseHandle(intptr_t);
+}
+
+TEST(WaitHandleTest, QCallEntryPoints) {
+    intptr_t ev = CreateEventExW(0, nullptr, 0x1 | 0x2, 0); // manual reset, initially set
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 0), 0);
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 0), 0);
+    EXPECT_EQ(ReleaseMutex(ev), 0); // wrong handle kind
+
+    intptr_t sem = CreateSemaphoreExW(0, 0, 2, nullptr, 0, 0);
+    int32_t previous = -1;
+    EXPECT_EQ(ReleaseSemaphore(sem, 2, &previous), 1);
+    EXPECT_EQ(previous, 0);
+    EXPECT_EQ(ReleaseSemaphore(sem, 1, &previous), 0); // would exceed the maximum
+
+    intptr_t m = CreateMutexExW(0, nullptr, 0, 0);
+    EXPECT_EQ(ReleaseMutex(m), 0); // not owned
+    EXPECT_EQ(WaitHandle_WaitOneCore(m, 0), 0);
+    EXPECT_EQ(ReleaseMutex(m), 1);
+
+    EXPECT_EQ(CloseHandle(ev), 1);
+    EXPECT_EQ(CloseHandle(sem), 1);
+    EXPECT_EQ(CloseHandle(m), 1);
+    EXPECT_EQ(SetEvent(0), 0);
+
+    // Closed handles are rejected, never read
+    EXPECT_EQ(CloseHandle(ev), 0);
+    EXPECT_EQ(SetEvent(ev), 0);
+    EXPECT_EQ(ReleaseMutex(m), 0);
+}
+
+TEST(WaitHandleTest, Mutex_OwnershipEndsWithOwningThread) {
+    // A thread that exits holding a mutex doesn't hand it to whichever thread comes next
+    // (Windows reports such a mutex as abandoned instead)
+    intptr_t m = Mutex_CreateMutexCoreWin32(false);
+    std::thread([&] { EXPECT_EQ(WaitHandle_WaitOneCore(m, 0), 0); }).join();
+    for (int i = 0; i < 4; i++) {
+        std::thread([&] {
+            EXPECT_EQ(WaitHandle_WaitOneCore(m, 0), kWaitTimeout);
+            EXPECT_EQ(thrown_type([&] { Mutex_ReleaseMutex(m); }), &ApplicationException_TypeInfo);
+        }).join();
+    }
+    WaitHandle_CloseHandle(m);
+}
+
+TEST(WaitHandleTest, ClosedHandleRejected) {
+    intptr_t ev = EventWaitHandle_CreateEventCoreWin32(true, kManualReset);
+    WaitHandle_CloseHandle(ev);
+    WaitHandle_CloseHandle(ev); // double close is ignored
+    EXPECT_FALSE(EventWaitHandle_Set(ev));
+    EXPECT_EQ(thrown_type([&] { WaitHandle_WaitOneCore(ev, 0); }),
+        &InvalidOperationException_TypeInfo);
+}
+
+TEST(WaitHandleTest, StaleHandleRejectedAfterSlotReuse) {
+    intptr_t old_ev = EventWaitHandle_CreateEventCoreWin32(false, kManualReset);
+    WaitHandle_CloseHandle(old_ev);
+    // The next object takes the freed slot; the old handle must not reach it
+    intptr_t ev = EventWaitHandle_CreateEventCoreWin32(false, kManualReset);
+    EXPECT_NE(ev, old_ev);
+    EXPECT_FALSE(EventWaitHandle_Set(old_ev));
+    EXPECT_EQ(CloseHandle(old_ev), 0);
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 0), kWaitTimeout);
+    EXPECT_TRUE(EventWaitHandle_Set(ev));
+    EXPECT_EQ(WaitHandle_WaitOneCore(ev, 0), 0);
+    WaitHandle_CloseHandle(ev);
+}
+
+#endif
@@ -5,6 +5,12 @@ class Program
 {
     static void Main()
     {
+        if (Array.IndexOf(Environment.GetCommandLineArgs(), "--bench") >= 0)
+        {
+            RunBenchmark();
+            return;
+        }
+
         Console.WriteLine("=== CompressionTest ===");
 
         // Test 1: GZipStream round-trip
@@ -63,6 +69,164 @@ class Program
         string deflateResult = Encoding.UTF8.GetString(deflateDecompressed);
         Console.WriteLine(deflateResult == original ? "DeflateRoundTrip: OK" : "DeflateRoundTrip: FAIL");
 
+        // Test 3: BrotliStream round-trip
+        byte[] brotliCompressed;
+        using (var compressedStream = new MemoryStream())
+        {
+            using (var brotli = new BrotliStream(compressedStream, CompressionLevel.Optimal, leaveOpen: true))
+            {
+                brotli.Write(originalBytes, 0, originalBytes.Length);
+            }
+            brotliCompressed = compressedStream.ToArray();
+        }
+        Console.WriteLine(brotliCompressed.Length < originalBytes.Length ? "BrotliCompress: OK" : "BrotliCompress: FAIL");
+
+        byte[] brotliDecompressed;
+        using (var compressedStream = new MemoryStream(brotliCompressed))
+        using (var brotli = new BrotliStream(compressedStream, CompressionMode.Decompress))
+        using (var resultStream = new MemoryStream())
+        {
+            brotli.CopyTo(resultStream);
+            brotliDecompressed = resultStream.ToArray();
+        }
+        Console.WriteLine(Encoding.UTF8.GetString(brotliDecompressed) == original ? "BrotliRoundTrip: OK" : "BrotliRoundTrip: FAIL");
+
+        // Test 4: BrotliEncoder / BrotliDecoder one-shot
+        var oneShot = new byte[BrotliEncoder.GetMaxCompressedLength(originalBytes.Length)];
+        bool encoded = BrotliEncoder.TryCompress(originalBytes, oneShot, out int oneShotWritten, quality: 5, window: 22);
+        Console.WriteLine(encoded && oneShotWritten < originalBytes.Length ? "BrotliTryCompress: OK" : "BrotliTryCompress: FAIL");
+
+        var oneShotResult = new byte[originalBytes.Length];
+        bool decoded = BrotliDecoder.TryDecompress(oneShot.AsSpan(0, oneShotWritten), oneShotResult, out int oneShotRead);
+        Console.WriteLine(decoded && oneShotRead == originalBytes.Length && oneShotResult.AsSpan().SequenceEqual(originalBytes)
+            ? "BrotliTryDecompress: OK" : "BrotliTryDecompress: FAIL");
+
+        // Destination too small: one-shot reports failure instead of throwing
+        bool tooSmall = BrotliDecoder.TryDecompress(oneShot.AsSpan(0, oneShotWritten), new byte[8], out _);
+        Console.WriteLine(!tooSmall ? "BrotliTryDecompressShort: OK" : "BrotliTryDecompressShort: FAIL");
+
+        // Streaming encoder with explicit flush and final block
+        using (var encoder = new BrotliEncoder(quality: 4, window: 20))
+        {
+            var streamed = new byte[oneShot.Length + 64];
+            encoder.Compress(originalBytes, streamed, out int consumed, out int written, isFinalBlock: false);
+            encoder.Flush(streamed.AsSpan(written), out int flushed);
+            encoder.Compress(ReadOnlySpan<byte>.Empty, streamed.AsSpan(written + flushed), out _, out int tail, isFinalBlock: true);
+
+            using var decoder = new BrotliDecoder();
+            var streamedResult = new byte[originalBytes.Length];
+            var status = decoder.Decompress(streamed.AsSpan(0, written + flushed + tail), streamedResult, out _, out int produced);
+            Console.WriteLine(consumed == originalBytes.Length && status == System.Buffers.OperationStatus.Done
+                && streamedResult.AsSpan(0, produced).SequenceEqual(originalBytes)
+                ? "BrotliEncoderStreaming: OK" : "BrotliEncoderStreaming: FAIL");
+        }
+
+        // Test 5: Brotli throughput — 8 MB of semi-compressible data through BrotliStream
+        // (rates go to stderr so stdout stays comparable with dotnet run)
+        var payload = new byte[8 * 1024 * 1024];
+        uint seed = 12345;
+        for (int i = 0; i < payload.Length; i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            payload[i] = (byte)((seed >> 16) % 24 + 'a');
+        }
+
+        var sw = System.Diagnostics.Stopwatch.StartNew();
+        byte[] bulkCompressed;
+        using (var compressedStream = new MemoryStream())
+        {
+            using (var brotli = new BrotliStream(compressedStream, CompressionLevel.Fastest, leaveOpen: true))
+            {
+                brotli.Write(payload, 0, payload.Length);
+            }
+            bulkCompressed = compressedStream.ToArray();
+        }
+        double compressMs = sw.Elapsed.TotalMilliseconds;
+
+        sw.Restart();
+        byte[] bulkDecompressed;
+        using (var compressedStream = new MemoryStream(bulkCompressed))
+        using (var brotli = new BrotliStream(compressedStream, CompressionMode.Decompress))
+        using (var resultStream = new MemoryStream())
+        {
+            brotli.CopyTo(resultStream);
+            bulkDecompressed = resultStream.ToArray();
+        }
+        double decompressMs = sw.Elapsed.TotalMilliseconds;
+
+        bool bulkOk = bulkCompressed.Length < payload.Length && bulkDecompressed.AsSpan().SequenceEqual(payload);
+        Console.WriteLine(bulkOk ? "BrotliThroughput: OK" : "BrotliThroughput: FAIL");
+        Console.Error.WriteLine($"Brotli 8 MB: compress {8000.0 / compressMs:F1} MB/s, decompress {8000.0 / decompressMs:F1} MB/s, ratio {(double)bulkCompressed.Length / payload.Length:F3}");
+
         Console.WriteLine("=== Done ===");
     }
+
+    /// <summary>
+    /// Performance workload for `dev.py integration --perf`: GZip, Brotli and ZipArchive
+    /// round trips over 4 MB of text. The checksum covers decompressed bytes and zip entry
+    /// CRCs only; compressed sizes depend on the zlib/brotli build and are left out.
+    /// </summary>
+    static void RunBenchmark()
+    {
+        var payload = new byte[4 * 1024 * 1024];
+        uint seed = 12345;
+        for (int i = 0; i < payload.Length; i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            payload[i] = (byte)((seed >> 16) % 24 + 'a');
+        }
+
+        long checksum = 0;
+        for (int round = 0; round < 2; round++)
+        {
+            using (var compressed = new MemoryStream())
+            {
+                using (var gzip = new GZipStream(compressed, CompressionLevel.Optimal, leaveOpen: true))
+                    gzip.Write(payload, 0, payload.Length);
+                compressed.Position = 0;
+                using var gunzip = new GZipStream(compressed, CompressionMode.Decompress);
+                checksum += SumStream(gunzip);
+            }
+
+            using (var compressed = new MemoryStream())
+            {
+                using (var brotli = new BrotliStream(compressed, CompressionLevel.Fastest, leaveOpen: true))
+                    brotli.Write(payload, 0, payload.Length);
+                compressed.Position = 0;
+                using var unbrotli = new BrotliStream(compressed, CompressionMode.Decompress);
+                checksum += SumStream(unbrotli);
+            }
+
+            using (var zipStream = new MemoryStream())
+            {
+                using (var zip = new ZipArchive(zipStream, ZipArchiveMode.Create, leaveOpen: true))
+                {
+                    for (int e = 0; e < 8; e++)
+                    {
+                        using var entry = zip.CreateEntry($"part{e}.txt", CompressionLevel.Fastest).Open();
+                        entry.Write(payload, e * (payload.Length / 8), payload.Length / 8);
+                    }
+                }
+                zipStream.Position = 0;
+                using var read = new ZipArchive(zipStream, ZipArchiveMode.Read);
+                foreach (var entry in read.Entries)
+                {
+                    checksum += entry.Crc32;
+                    using var s = entry.Open();
+                    checksum += SumStream(s);
+                }
+            }
+        }
+        Console.WriteLine($"Compression bench: {checksum}");
+    }
+
+    static long SumStream(Stream stream)
+    {
+        var buffer = new byte[81920];
+        long sum = 0;
+        int n;
+        while ((n = stream.Read(buffer, 0, buffer.Length)) > 0)
+            for (int i = 0; i < n; i++) sum += buffer[i];
+        return sum;
+    }
 }
@@ -724,6 +724,7 @@ public class Program
         TestDefaultInterfaceMethods();
         TestExceptionFilters();
         TestPatternMatching();
+        TestCultureStringSort();
     }
 
     static void TestAsyncEnumerable()
@@ -2187,6 +2188,15 @@ public class Program
         Console.WriteLine(end);  // world
     }
 
+    // Array.Sort with a culture comparer: the compiler guards ArraySortHelper's comparison
+    // sort with the runtime's sort-key path
+    static void TestCultureStringSort()
+    {
+        string[] words = { "pear", "Apple", "banana", "apple" };
+        Array.Sort(words, StringComparer.InvariantCulture);
+        Console.WriteLine(string.Join(",", words)); // apple,Apple,banana,pear
+    }
+
     // Exercises Index.Value and Index.IsFromEnd properties
     static void TestIndexProperties()
     {
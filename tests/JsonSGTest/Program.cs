@@ -12,6 +12,12 @@ class Program
 {
     static void Main()
     {
+        if (Array.IndexOf(Environment.GetCommandLineArgs(), "--bench") >= 0)
+        {
+            RunBenchmark();
+            return;
+        }
+
         Console.WriteLine("=== JsonSGTest ===");
 
         var person = new Person { Name = "Bob", Age = 25 };
@@ -29,6 +35,23 @@ class Program
 
         Console.WriteLine("=== Done ===");
     }
+
+    /// <summary>
+    /// Performance workload for `dev.py integration --perf`: source-generated
+    /// serialize/deserialize round trips. Prints one deterministic checksum line.
+    /// </summary>
+    static void RunBenchmark()
+    {
+        long checksum = 0;
+        for (int i = 0; i < 100_000; i++)
+        {
+            var person = new Person { Name = "Person" + (i % 1000), Age = i % 100 };
+            string json = JsonSerializer.Serialize(person, AppJsonContext.Default.Person);
+            var back = JsonSerializer.Deserialize(json, AppJsonContext.Default.Person)!;
+            checksum += json.Length + back.Age + back.Name.Length;
+        }
+        Console.WriteLine($"JsonSG bench: {checksum}");
+    }
 }
 
 public class Person
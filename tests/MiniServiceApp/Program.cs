@@ -198,6 +198,12 @@ class Program
 {
     static void Main()
     {
+        if (Array.IndexOf(Environment.GetCommandLineArgs(), "--bench") >= 0)
+        {
+            RunBenchmark();
+            return;
+        }
+
         // === Section 1: Configuration ===
         Console.WriteLine("=== MiniServiceApp ===");
         Console.WriteLine();
@@ -362,4 +368,43 @@ class Program
 
         Console.WriteLine("=== Done ===");
     }
+
+    /// <summary>
+    /// Performance workload for `dev.py integration --perf`: the catalog service loop
+    /// (orders, LINQ analysis, decimal formatting) without console logging.
+    /// Services are resolved once — see the note on repeated transient resolution above.
+    /// </summary>
+    static void RunBenchmark()
+    {
+        var services = new ServiceCollection();
+        services.AddSingleton<IProductRepository, InMemoryProductRepository>();
+        services.AddTransient<IOrderService, OrderService>();
+        services.AddTransient<ICatalogAnalyzer, CatalogAnalyzer>();
+        var provider = services.BuildServiceProvider();
+        var repo = provider.GetRequiredService<IProductRepository>();
+        var orderService = provider.GetRequiredService<IOrderService>();
+        var analyzer = provider.GetRequiredService<ICatalogAnalyzer>();
+
+        decimal revenue = 0;
+        long checksum = 0;
+        for (int i = 0; i < 20_000; i++)
+        {
+            var order = orderService.CreateOrder("Customer" + (i % 50), new List<(int, int)>
+            {
+                (1 + i % 8, 1 + i % 3),
+                (10, 1 + i % 5),
+            });
+            revenue += order.GrandTotal;
+            checksum += order.OrderId.Length;
+
+            var summary = analyzer.Analyze();
+            checksum += summary.ActiveProducts + summary.MostExpensiveProduct.Length;
+            foreach (var (category, count) in analyzer.GetCategoryCounts())
+                checksum += category.Length * count;
+
+            var line = string.Join(",", repo.GetByCategory("Electronics").Select(p => $"{p.Name}={p.Price * p.Stock}"));
+            checksum += line.Length;
+        }
+        Console.WriteLine($"MiniService bench: {checksum} revenue={revenue.ToString(CultureInfo.InvariantCulture)}");
+    }
 }
@@ -5,6 +5,12 @@ class Program
 {
     static void Main()
     {
+        if (Array.IndexOf(Environment.GetCommandLineArgs(), "--bench") >= 0)
+        {
+            RunBenchmark();
+            return;
+        }
+
         // Test 1: Basic IsMatch
         try
         {
@@ -125,4 +131,29 @@ class Program
             Console.WriteLine($"[10] ERROR: {ex.GetType().Name}: {ex.Message}");
         }
     }
+
+    /// <summary>
+    /// Performance workload for `dev.py integration --perf`: scans a synthetic access
+    /// log with IsMatch / Match groups / Matches / Replace. Prints one checksum line.
+    /// </summary>
+    static void RunBenchmark()
+    {
+        var lines = new string[20_000];
+        for (int i = 0; i < lines.Length; i++)
+            lines[i] = $"2026-{1 + i % 12:D2}-{1 + i % 28:D2} 10:{i % 60:D2}:00 GET /api/items/{i} user{i % 97}@example.com status={(i % 7 == 0 ? 500 : 200)}";
+
+        var date = new Regex(@"(?<y>\d{4})-(?<m>\d{2})-(?<d>\d{2})");
+        var email = new Regex(@"\b[\w.]+@[\w.]+\.\w+\b");
+        var error = new Regex(@"status=5\d\d$");
+        long checksum = 0;
+        foreach (var line in lines)
+        {
+            var m = date.Match(line);
+            if (m.Success) checksum += int.Parse(m.Groups["m"].Value) + int.Parse(m.Groups["d"].Value);
+            if (error.IsMatch(line)) checksum += 1000;
+            checksum += email.Matches(line).Count;
+            checksum += Regex.Replace(line, @"\d", "#").Length;
+        }
+        Console.WriteLine($"Regex bench: {checksum}");
+    }
 }
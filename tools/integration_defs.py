@@ -22,6 +22,7 @@ class TestDefinition:
     run_timeout: int = 0      # subprocess timeout; 0 = default (no explicit timeout)
     build_dir_nested: bool = False  # True = build dir inside output dir
     expected_seconds: int = 25  # for longest-first scheduling
+    perf_args: tuple = ()     # args that switch the program to its repeatable workload (e.g. --bench)
 
     def __post_init__(self):
         if not self.exe_name:
@@ -67,6 +68,55 @@ class TestResult:
         return sum(1 for s in self.steps if not s.passed)
 
 
+@dataclass
+class PerfStats:
+    """Repeated-run measurements of one executable (AOT binary or .NET assembly)."""
+    times: list = field(default_factory=list)  # wall seconds per run, warm-up excluded
+    peak_rss_kb: int = 0      # max over runs; 0 if the platform can't report it
+    size_bytes: int = 0       # AOT: executable; .NET: framework-dependent build output
+    output: str = ""          # workload checksum line (stdout of the first run)
+
+    @property
+    def median_s(self):
+        t = sorted(self.times)
+        if not t:
+            return 0.0
+        mid = len(t) // 2
+        return t[mid] if len(t) % 2 else (t[mid - 1] + t[mid]) / 2
+
+    @property
+    def p95_s(self):
+        # Nearest-rank percentile: with few runs this is the slowest one
+        t = sorted(self.times)
+        if not t:
+            return 0.0
+        rank = max(1, -(-95 * len(t) // 100))
+        return t[rank - 1]
+
+    def to_dict(self):
+        return {"median_s": round(self.median_s, 4), "p95_s": round(self.p95_s, 4),
+                "peak_rss_kb": self.peak_rss_kb, "size_bytes": self.size_bytes,
+                "runs": len(self.times)}
+
+
+@dataclass
+class PerfResult:
+    """Workload comparison of one test: AOT binary vs `dotnet` on the same program."""
+    name: str
+    aot: PerfStats = field(default_factory=PerfStats)
+    dotnet: PerfStats = field(default_factory=PerfStats)
+    error_msg: str = ""       # set when a run failed or the two outputs differ
+
+
+@dataclass
+class MetadataSavings:
+    """Trimmed reflection metadata (default) vs --keep-reflection-metadata for one test."""
+    name: str
+    trimmed: PerfStats = field(default_factory=PerfStats)
+    full: PerfStats = field(default_factory=PerfStats)
+    error_msg: str = ""
+
+
 def compare_socket_output(got, expected):
     """SocketTest custom comparison — content-based skip for dynamic lines.
 
@@ -144,7 +194,8 @@ TESTS = [
                    build_dir_nested=True, expected_seconds=20),
     TestDefinition("DirTest", 12, "DirTest",
                    pre_run_cleanup="cil2cpp_dirtest"),
-    TestDefinition("JsonSGTest", 13, "JsonSGTest", expected_seconds=25),
+    TestDefinition("JsonSGTest", 13, "JsonSGTest", expected_seconds=25,
+                   perf_args=("--bench",)),
     TestDefinition("NuGetSimpleTest", 14, "NuGetSimpleTest",
                    expected_seconds=275),
     TestDefinition("DITest", 15, "DITest",
@@ -157,9 +208,11 @@ TESTS = [
     TestDefinition("SerilogTest", 19, "SerilogTest",
                    codegen_config="Debug", expected_seconds=29),
     TestDefinition("ConfigTest", 20, "ConfigTest", expected_seconds=31),
-    TestDefinition("CompressionTest", 21, "CompressionTest"),
+    TestDefinition("CompressionTest", 21, "CompressionTest",
+                   perf_args=("--bench",)),
     TestDefinition("ValidationApp", 22, "ValidationApp", expected_seconds=22),
-    TestDefinition("RegexTest", 23, "RegexTest", expected_seconds=29),
+    TestDefinition("RegexTest", 23, "RegexTest", expected_seconds=29,
+                   perf_args=("--bench",)),
     TestDefinition("DateTimeTest", 24, "DateTimeTest"),
     TestDefinition("DecimalTest", 25, "DecimalTest"),
     TestDefinition("HashidsTest", 26, "HashidsTest", expected_seconds=30),
@@ -172,5 +225,6 @@ TESTS = [
     TestDefinition("FluentValidationTest", 33, "FluentValidationTest",
                    expected_seconds=88),
     TestDefinition("MiniServiceApp", 34, "MiniServiceApp",
-                   expected_seconds=59),
+                   expected_seconds=59,
+                   perf_args=("--bench",)),
 ]
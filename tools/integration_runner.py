@@ -14,7 +14,7 @@ from concurrent.futures import ThreadPoolExecutor, as_completed
 from pathlib import Path
 
 from integration_defs import (
-    TestDefinition, TestResult, StepResult,
+    TestDefinition, TestResult, StepResult, PerfStats, PerfResult, MetadataSavings,
     compare_socket_output,
 )
 
@@ -36,8 +36,10 @@ def _get_dev():
 
 # ===== Shared constants (duplicated from dev.py to avoid import overhead) =====
 
+import json
 import platform
 import re
+import tempfile
 
 _REPO_ROOT = Path(__file__).resolve().parent.parent
 _CLI_PROJECT = _REPO_ROOT / "compiler" / "CIL2CPP.CLI"
@@ -205,6 +207,18 @@ _STEP_METRICS = {
 }
 
 
+def _test_paths(defn, temp_dir):
+    """(csproj, codegen output dir, CMake build dir) of a test inside temp_dir."""
+    csproj_path = _TESTPROJECTS_DIR / defn.csproj_dir / f"{defn.csproj_dir}.csproj"
+    dir_slug = defn.name.lower().replace(" ", "_")
+    output_dir = temp_dir / f"{dir_slug}_output"
+    if defn.build_dir_nested:
+        build_dir = output_dir / "build"
+    else:
+        build_dir = temp_dir / f"{dir_slug}_build"
+    return csproj_path, output_dir, build_dir
+
+
 def run_single_test(defn, temp_dir, config, generator, cmake_arch,
                     runtime_prefix):
     """Execute a single integration test through the 6-step pipeline.
@@ -213,15 +227,7 @@ def run_single_test(defn, temp_dir, config, generator, cmake_arch,
     All output is buffered — no print() calls during execution.
     """
     name = defn.name
-    csproj_path = _TESTPROJECTS_DIR / defn.csproj_dir / f"{defn.csproj_dir}.csproj"
-
-    # Derive output and build directories
-    dir_slug = name.lower().replace(" ", "_")
-    output_dir = temp_dir / f"{dir_slug}_output"
-    if defn.build_dir_nested:
-        build_dir = output_dir / "build"
-    else:
-        build_dir = temp_dir / f"{dir_slug}_build"
+    csproj_path, output_dir, build_dir = _test_paths(defn, temp_dir)
 
     result = TestResult(name=name, phase_num=defn.phase_num)
     dotnet_output = ""
@@ -489,3 +495,259 @@ def print_results(results, wall_clock_seconds=None):
         print(f"  {_c('32', f'Failed: {total_fail}')}")
     print()
     return total_fail
+
+
+# ===== Performance mode (--perf) =====
+
+def _peak_rss_windows(handle):
+    """PeakWorkingSetSize of an exited (not yet closed) process, in KB."""
+    import ctypes
+    from ctypes import wintypes
+
+    class PROCESS_MEMORY_COUNTERS(ctypes.Structure):
+        _fields_ = [("cb", wintypes.DWORD), ("PageFaultCount", wintypes.DWORD),
+                    ("PeakWorkingSetSize", ctypes.c_size_t), ("WorkingSetSize", ctypes.c_size_t),
+                    ("QuotaPeakPagedPoolUsage", ctypes.c_size_t), ("QuotaPagedPoolUsage", ctypes.c_size_t),
+                    ("QuotaPeakNonPagedPoolUsage", ctypes.c_size_t), ("QuotaNonPagedPoolUsage", ctypes.c_size_t),
+                    ("PagefileUsage", ctypes.c_size_t), ("PeakPagefileUsage", ctypes.c_size_t)]
+
+    counters = PROCESS_MEMORY_COUNTERS()
+    counters.cb = ctypes.sizeof(counters)
+    if ctypes.windll.psapi.GetProcessMemoryInfo(int(handle), ctypes.byref(counters), counters.cb):
+        return counters.PeakWorkingSetSize // 1024
+    return 0
+
+
+def _measure_run(cmd, timeout):
+    """Run cmd once. Returns (wall seconds, peak RSS in KB, stdout).
+
+    A run still going after `timeout` seconds is killed and reaped, then raises
+    subprocess.TimeoutExpired.
+    """
+    with tempfile.TemporaryFile() as out:
+        t0 = time.perf_counter()
+        deadline = t0 + timeout
+        proc = subprocess.Popen(cmd, stdout=out, stderr=subprocess.DEVNULL)
+        if _IS_WINDOWS:
+            try:
+                proc.wait(timeout=timeout)
+            except subprocess.TimeoutExpired:
+                proc.kill()
+                proc.wait()
+                raise
+            elapsed = time.perf_counter() - t0
+            rss_kb = _peak_rss_windows(proc._handle)
+        else:
+            # wait4 reaps the child and returns its rusage (ru_maxrss: KB on Linux, bytes on macOS).
+            # Polled with WNOHANG so the deadline holds; 1 ms polls bound the timing error.
+            while True:
+                pid, status, usage = os.wait4(proc.pid, os.WNOHANG)
+                if pid:
+                    break
+                if time.perf_counter() >= deadline:
+                    proc.kill()
+                    _, status, _ = os.wait4(proc.pid, 0)
+                    proc.returncode = os.waitstatus_to_exitcode(status)
+                    raise subprocess.TimeoutExpired(cmd, timeout)
+                time.sleep(0.001)
+            elapsed = time.perf_counter() - t0
+            proc.returncode = os.waitstatus_to_exitcode(status)
+            rss_kb = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+        out.seek(0)
+        stdout = out.read().decode("utf-8", errors="replace").strip()
+    if proc.returncode != 0:
+        raise RuntimeError(f"{Path(cmd[0]).name} exited with code {proc.returncode}")
+    return elapsed, rss_kb, stdout
+
+
+def _measure(cmd, runs, timeout):
+    """One warm-up run (page cache, JIT disk caches), then `runs` measured runs."""
+    stats = PerfStats()
+    _, _, stats.output = _measure_run(cmd, timeout)
+    for _ in range(runs):
+        elapsed, rss_kb, _ = _measure_run(cmd, timeout)
+        stats.times.append(elapsed)
+        stats.peak_rss_kb = max(stats.peak_rss_kb, rss_kb)
+    return stats
+
+
+def _dir_size(directory):
+    return sum(f.stat().st_size for f in Path(directory).rglob("*") if f.is_file())
+
+
+def run_perf(tests, results, temp_dir, config, runs):
+    """Time each test's workload (TestDefinition.perf_args) as AOT binary and on .NET.
+
+    Runs after the normal pipeline, one process at a time, so builds and other tests
+    don't skew the numbers. The .NET side is built once in Release and started with
+    `dotnet <app>.dll` — the same program `dotnet run` would start, without the
+    MSBuild up-to-date check in every sample. Tests whose pipeline failed are skipped.
+    """
+    passed = {r.name for r in results if r.passed}
+    perf_results = []
+    for defn in tests:
+        if not defn.perf_args or defn.name not in passed:
+            continue
+        print(f"  {defn.name:<25} ", end="", flush=True)
+        pr = PerfResult(name=defn.name)
+        csproj_path, _, build_dir = _test_paths(defn, temp_dir)
+        timeout = defn.run_timeout or 600
+        try:
+            exe = _exe_path(build_dir, config, defn.exe_name)
+            pr.aot = _measure([str(exe), *defn.perf_args], runs, timeout)
+            pr.aot.size_bytes = exe.stat().st_size
+
+            dotnet_dir = temp_dir / f"{defn.name.lower()}_dotnet"
+            _run_subprocess(["dotnet", "build", str(csproj_path), "-c", "Release",
+                             "-o", str(dotnet_dir), "--verbosity", "quiet"])
+            dll = dotnet_dir / f"{defn.csproj_dir}.dll"
+            pr.dotnet = _measure(["dotnet", str(dll), *defn.perf_args], runs, timeout)
+            pr.dotnet.size_bytes = _dir_size(dotnet_dir)
+
+            if pr.aot.output != pr.dotnet.output:
+                pr.error_msg = (f"workload output differs: AOT '{pr.aot.output}', "
+                                f".NET '{pr.dotnet.output}'")
+        except Exception as e:
+            pr.error_msg = str(e).strip().split("\n")[0]
+        perf_results.append(pr)
+        print(_c("31", "FAIL") if pr.error_msg else
+              f"AOT {pr.aot.median_s * 1000:.0f} ms, .NET {pr.dotnet.median_s * 1000:.0f} ms")
+    return perf_results
+
+
+def _fmt_mb(kb):
+    return f"{kb / 1024:.1f} MB" if kb else "-"
+
+
+def _fmt_size(size_bytes):
+    return f"{size_bytes / (1024 * 1024):.1f} MB" if size_bytes >= 102400 else f"{size_bytes / 1024:.0f} KB"
+
+
+def print_perf_results(perf_results, runs):
+    """Side-by-side table: median / p95 time, peak RSS and size per workload."""
+    print()
+    print(f"  {'Workload':<18} {'':<7} {'Median':>9} {'p95':>9} {'Peak RSS':>10} {'Size':>10}")
+    print(f"  {'-'*18} {'-'*7} {'-'*9} {'-'*9} {'-'*10} {'-'*10}")
+    for pr in perf_results:
+        if pr.error_msg:
+            print(f"  {pr.name:<18} {_c('31', 'FAIL: ' + pr.error_msg)}")
+            continue
+        for label, st in (("AOT", pr.aot), (".NET", pr.dotnet)):
+            name = pr.name if label == "AOT" else ""
+            print(f"  {name:<18} {label:<7} {st.median_s * 1000:>7.0f}ms {st.p95_s * 1000:>7.0f}ms "
+                  f"{_fmt_mb(st.peak_rss_kb):>10} {_fmt_size(st.size_bytes):>10}")
+        speedup = pr.dotnet.median_s / pr.aot.median_s if pr.aot.median_s else 0
+        print(f"  {'':<18} {'':<7} {_c('90', f'AOT/.NET speed {speedup:.2f}x')}")
+    print(f"\n  {runs} measured runs per side after one warm-up; "
+          f".NET size is the framework-dependent build output.")
+    return sum(1 for pr in perf_results if pr.error_msg)
+
+
+def write_perf_baseline(perf_results, path, config):
+    data = {
+        "config": config,
+        "platform": platform.platform(),
+        "tests": {pr.name: {"aot": pr.aot.to_dict(), "dotnet": pr.dotnet.to_dict()}
+                  for pr in perf_results if not pr.error_msg},
+    }
+    Path(path).write_text(json.dumps(data, indent=2) + "\n", encoding="utf-8")
+
+
+# Metrics checked against the baseline; the .NET side is reported for context only
+_PERF_CHECKS = (("median_s", "median"), ("p95_s", "p95"),
+                ("peak_rss_kb", "peak RSS"), ("size_bytes", "size"))
+
+
+def check_perf_baseline(perf_results, path, threshold):
+    """Compare AOT numbers with a saved baseline. Returns the number of regressions."""
+    baseline = json.loads(Path(path).read_text(encoding="utf-8")).get("tests", {})
+    regressions = 0
+    print()
+    print(f"  Baseline: {path} (threshold {threshold:g}%)")
+    for pr in perf_results:
+        base = baseline.get(pr.name, {}).get("aot")
+        if pr.error_msg or not base:
+            continue
+        current = pr.aot.to_dict()
+        changes = []
+        for key, label in _PERF_CHECKS:
+            old, new = base.get(key, 0), current[key]
+            if not old or not new:
+                continue
+            change = (new - old) / old * 100.0
+            text = f"{label} {change:+.1f}%"
+            if change > threshold:
+                regressions += 1
+                text = _c("31", text + " REGRESSION")
+            changes.append(text)
+        print(f"  {pr.name:<18} {', '.join(changes)}")
+    missing = [pr.name for pr in perf_results if pr.name not in baseline]
+    if missing:
+        print(f"  {_c('33', 'Not in baseline: ' + ', '.join(missing))}")
+    return regressions
+
+
+# ===== Reflection metadata savings (--metadata-savings) =====
+
+def run_metadata_savings(tests, results, temp_dir, config, generator, cmake_arch,
+                         runtime_prefix):
+    """Rebuild each passing test with --keep-reflection-metadata and compare it with the
+    trimmed build from the normal pipeline: executable size and the peak RSS of one run
+    (the perf workload when the test has one). Runs one process at a time.
+    """
+    passed = {r.name for r in results if r.passed}
+    savings = []
+    for defn in tests:
+        if defn.name not in passed:
+            continue
+        print(f"  {defn.name:<25} ", end="", flush=True)
+        sr = MetadataSavings(name=defn.name)
+        csproj_path, output_dir, build_dir = _test_paths(defn, temp_dir)
+        full_output = output_dir.with_name(output_dir.name + "_fullmeta")
+        full_build = temp_dir / f"{full_output.name}_build"
+        timeout = defn.run_timeout or 600
+        try:
+            _run_subprocess(["dotnet", "run", "--no-build", "--project", str(_CLI_PROJECT), "--",
+                             "codegen", "-i", str(csproj_path), "-o", str(full_output),
+                             "-c", defn.codegen_config, "--keep-reflection-metadata"])
+            _run_subprocess(["cmake", "-B", str(full_build), "-S", str(full_output),
+                             "-G", generator, *cmake_arch,
+                             f"-DCMAKE_PREFIX_PATH={runtime_prefix}"])
+            _cmake_build_with_diagnostics(full_build, config)
+
+            for stats, build in ((sr.trimmed, build_dir), (sr.full, full_build)):
+                exe = _exe_path(build, config, defn.exe_name)
+                if defn.pre_run_cleanup:
+                    shutil.rmtree(Path(os.environ.get('TEMP', '/tmp')) / defn.pre_run_cleanup,
+                                  ignore_errors=True)
+                measured = _measure([str(exe), *defn.perf_args], 1, timeout)
+                stats.peak_rss_kb = measured.peak_rss_kb
+                stats.size_bytes = exe.stat().st_size
+        except Exception as e:
+            sr.error_msg = str(e).strip().split("\n")[0]
+        savings.append(sr)
+        print(_c("31", "FAIL") if sr.error_msg else
+              f"{_fmt_size(sr.full.size_bytes)} -> {_fmt_size(sr.trimmed.size_bytes)}")
+    return savings
+
+
+def _saved(full, trimmed):
+    return f"{(full - trimmed) / full * 100:.1f}%" if full and trimmed else "-"
+
+
+def print_metadata_savings(savings):
+    """Per-test table of what trimming reflection metadata saves. Returns the failure count."""
+    print()
+    print(f"  {'Test':<25} {'Size full':>10} {'trimmed':>10} {'saved':>7} "
+          f"{'RSS full':>10} {'trimmed':>10} {'saved':>7}")
+    print(f"  {'-'*25} {'-'*10} {'-'*10} {'-'*7} {'-'*10} {'-'*10} {'-'*7}")
+    for sr in savings:
+        if sr.error_msg:
+            print(f"  {sr.name:<25} {_c('31', 'FAIL: ' + sr.error_msg)}")
+            continue
+        full, trimmed = sr.full, sr.trimmed
+        print(f"  {sr.name:<25} {_fmt_size(full.size_bytes):>10} {_fmt_size(trimmed.size_bytes):>10} "
+              f"{_saved(full.size_bytes, trimmed.size_bytes):>7} {_fmt_mb(full.peak_rss_kb):>10} "
+              f"{_fmt_mb(trimmed.peak_rss_kb):>10} {_saved(full.peak_rss_kb, trimmed.peak_rss_kb):>7}")
+    print("\n  Full = --keep-reflection-metadata; peak RSS of one run after a warm-up.")
+    return sum(1 for sr in savings if sr.error_msg)